@@ -73,15 +73,26 @@ void gf_asm(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
 void gf_compute(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
 void gf_linsolve(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
 void gf_util(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
+void gf_batch(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
 void gf_exit(getfemint::mexargs_in&, getfemint::mexargs_out&) { exit(0); }
 
 namespace getfemint {
-  std::stringstream *global_pinfomsg = 0;
+  thread_local std::stringstream *global_pinfomsg = 0;
   std::ostream& infomsg() {
     return *global_pinfomsg;
   }
 
-  config *config::cfg = 0;
+  std::recursive_mutex &workspace_mutex() {
+    static std::recursive_mutex m;
+    return m;
+  }
+
+  std::recursive_mutex &library_mutex() {
+    static std::recursive_mutex m;
+    return m;
+  }
+
+  thread_local config *config::cfg = 0;
   config::config(gfi_interface_type t) : current_function_(0) {
     switch (t) {
     case MATLAB_INTERFACE:
@@ -90,6 +101,7 @@ namespace getfemint {
       prefer_native_sparse_ = true;
       can_return_integer_ = false;
       has_1D_arrays_ = false;
+      can_share_memory_ = false;
       break;
     case PYTHON_INTERFACE:
       base_index_ = 0;
@@ -97,6 +109,7 @@ namespace getfemint {
       prefer_native_sparse_ = false;
       can_return_integer_ = true;
       has_1D_arrays_ = true;
+      can_share_memory_ = true;
       break;
     case SCILAB_INTERFACE:
       base_index_ = 1;
@@ -104,6 +117,7 @@ namespace getfemint {
       prefer_native_sparse_ = true;
       can_return_integer_ = false;
       has_1D_arrays_ = false;
+      can_share_memory_ = false;
       break;
     default:
       THROW_INTERNAL_ERROR;
@@ -113,6 +127,78 @@ namespace getfemint {
 
 typedef void (* psub_command)(getfemint::mexargs_in& in, getfemint::mexargs_out& out);
 
+namespace getfemint {
+  void call_interface_function(const std::string &function,
+                               mexargs_in &in, mexargs_out &out) {
+    typedef std::map<std::string, psub_command > SUBC_TAB;
+    // built once, at the first call (the "workspace" commands may be
+    // executed by several threads at the same time)
+    static const SUBC_TAB subc_tab = [] {
+      SUBC_TAB t;
+      t["workspace"] = gf_workspace;
+      t["delete"] = gf_delete;
+      t["eltm"] = gf_eltm;
+      t["geotrans"] = gf_geotrans;
+      t["geotrans_get"] = gf_geotrans_get;
+      t["integ"] = gf_integ;
+      t["integ_get"] = gf_integ_get;
+      t["global_function"] = gf_global_function;
+      t["global_function_get"] = gf_global_function_get;
+      t["cont_struct"] = gf_cont_struct;
+      t["cont_struct_get"] = gf_cont_struct_get;
+      t["fem"] = gf_fem;
+      t["fem_get"] = gf_fem_get;
+      t["cvstruct_get"] = gf_cvstruct_get;
+      t["mesher_object"] = gf_mesher_object;
+      t["mesher_object_get"] = gf_mesher_object_get;
+      t["mesh"] = gf_mesh;
+      t["mesh_get"] = gf_mesh_get;
+      t["mesh_set"] = gf_mesh_set;
+      t["mesh_fem"] = gf_mesh_fem;
+      t["mesh_fem_get"] = gf_mesh_fem_get;
+      t["mesh_fem_set"] = gf_mesh_fem_set;
+      t["mesh_im"] = gf_mesh_im;
+      t["mesh_im_get"] = gf_mesh_im_get;
+      t["mesh_im_set"] = gf_mesh_im_set;
+      t["mesh_im_data"] = gf_mesh_im_data;
+      t["mesh_im_data_get"] = gf_mesh_im_data_get;
+      t["mesh_im_data_set"] = gf_mesh_im_data_set;
+      t["model"] = gf_model;
+      t["model_get"] = gf_model_get;
+      t["model_set"] = gf_model_set;
+      t["slice"] = gf_slice;
+      t["slice_get"] = gf_slice_get;
+      t["slice_set"] = gf_slice_set;
+      t["levelset"] = gf_levelset;
+      t["levelset_get"] = gf_levelset_get;
+      t["levelset_set"] = gf_levelset_set;
+      t["mesh_levelset"] = gf_mesh_levelset;
+      t["mesh_levelset_get"] = gf_mesh_levelset_get;
+      t["mesh_levelset_set"] = gf_mesh_levelset_set;
+      t["asm"] = gf_asm;
+      t["compute"] = gf_compute;
+      t["precond"] = gf_precond;
+      t["precond_get"] = gf_precond_get;
+      t["spmat"] = gf_spmat;
+      t["spmat_get"] = gf_spmat_get;
+      t["spmat_set"] = gf_spmat_set;
+      t["linsolve"] = gf_linsolve;
+      t["util"] = gf_util;
+      t["batch"] = gf_batch;
+      t["exit"] = gf_exit;
+      return t;
+    }();
+
+    SUBC_TAB::const_iterator it = subc_tab.find(function);
+    if (it != subc_tab.end()) {
+      it->second(in, out);
+    }
+    else {
+      GMM_THROW(getfemint_bad_arg, "unknown function: " << function);
+    }
+  }
+}
+
 
 extern "C"
 char* getfem_interface_main(int config_id, const char *function,
@@ -120,62 +206,16 @@ char* getfem_interface_main(int config_id, const char *function,
                             int *nb_out_args, gfi_array ***pout_args,
 			    char **pinfomsg, int scilab_flag) {
 
-  typedef std::map<std::string, psub_command > SUBC_TAB;
-  static SUBC_TAB subc_tab;
-
-  if (subc_tab.size() == 0) {
-    subc_tab["workspace"] = gf_workspace;
-    subc_tab["delete"] = gf_delete;
-    subc_tab["eltm"] = gf_eltm;
-    subc_tab["geotrans"] = gf_geotrans;
-    subc_tab["geotrans_get"] = gf_geotrans_get;
-    subc_tab["integ"] = gf_integ;
-    subc_tab["integ_get"] = gf_integ_get;
-    subc_tab["global_function"] = gf_global_function;
-    subc_tab["global_function_get"] = gf_global_function_get;
-    subc_tab["cont_struct"] = gf_cont_struct;
-    subc_tab["cont_struct_get"] = gf_cont_struct_get;
-    subc_tab["fem"] = gf_fem;
-    subc_tab["fem_get"] = gf_fem_get;
-    subc_tab["cvstruct_get"] = gf_cvstruct_get;
-    subc_tab["mesher_object"] = gf_mesher_object;
-    subc_tab["mesher_object_get"] = gf_mesher_object_get;
-    subc_tab["mesh"] = gf_mesh;
-    subc_tab["mesh_get"] = gf_mesh_get;
-    subc_tab["mesh_set"] = gf_mesh_set;
-    subc_tab["mesh_fem"] = gf_mesh_fem;
-    subc_tab["mesh_fem_get"] = gf_mesh_fem_get;
-    subc_tab["mesh_fem_set"] = gf_mesh_fem_set;
-    subc_tab["mesh_im"] = gf_mesh_im;
-    subc_tab["mesh_im_get"] = gf_mesh_im_get;
-    subc_tab["mesh_im_set"] = gf_mesh_im_set;
-    subc_tab["mesh_im_data"] = gf_mesh_im_data;
-    subc_tab["mesh_im_data_get"] = gf_mesh_im_data_get;
-    subc_tab["mesh_im_data_set"] = gf_mesh_im_data_set;
-    subc_tab["model"] = gf_model;
-    subc_tab["model_get"] = gf_model_get;
-    subc_tab["model_set"] = gf_model_set;
-    subc_tab["slice"] = gf_slice;
-    subc_tab["slice_get"] = gf_slice_get;
-    subc_tab["slice_set"] = gf_slice_set;
-    subc_tab["levelset"] = gf_levelset;
-    subc_tab["levelset_get"] = gf_levelset_get;
-    subc_tab["levelset_set"] = gf_levelset_set;
-    subc_tab["mesh_levelset"] = gf_mesh_levelset;
-    subc_tab["mesh_levelset_get"] = gf_mesh_levelset_get;
-    subc_tab["mesh_levelset_set"] = gf_mesh_levelset_set;
-    subc_tab["asm"] = gf_asm;
-    subc_tab["compute"] = gf_compute;
-    subc_tab["precond"] = gf_precond;
-    subc_tab["precond_get"] = gf_precond_get;
-    subc_tab["spmat"] = gf_spmat;
-    subc_tab["spmat_get"] = gf_spmat_get;
-    subc_tab["spmat_set"] = gf_spmat_set;
-    subc_tab["linsolve"] = gf_linsolve;
-    subc_tab["util"] = gf_util;
-    subc_tab["exit"] = gf_exit;
-  }
-
+  // The callers (python) may run several commands at the same time from
+  // different threads, but the commands which run some code of the library
+  // are executed one by one: the library identifies its threads by their
+  // OpenMP number only, so that it is not safe to run it from several
+  // threads which it has not started. Only the bookkeeping of the
+  // workspace (gf_workspace, which locks what it needs) is done while
+  // another command runs.
+  std::unique_lock<std::recursive_mutex>
+    lock(getfemint::library_mutex(), std::defer_lock);
+  if (strcmp(function, "workspace") != 0) lock.lock();
 
   std::stringstream info;
   getfemint::global_pinfomsg = &info;
@@ -187,22 +227,17 @@ char* getfem_interface_main(int config_id, const char *function,
   //     gfi_array_print((gfi_array*)in_args[i]); cout << "\n";
   //  }
   try {
-    static getfemint::config *conf[3];
+    static thread_local std::unique_ptr<getfemint::config> conf[3];
     if (!conf[config_id])
-      conf[config_id] = new getfemint::config((gfi_interface_type)config_id);
+      conf[config_id] = std::make_unique<getfemint::config>
+        ((gfi_interface_type)config_id);
     conf[config_id]->current_function_ = function;
-    config::set_current_config(conf[config_id]);
+    config::set_current_config(conf[config_id].get());
     mexargs_in in(nb_in_args, in_args, false);
     mexargs_out out(*nb_out_args);
     out.set_scilab(bool(scilab_flag));
 
-    SUBC_TAB::iterator it = subc_tab.find(function);
-    if (it != subc_tab.end()) {
-      it->second(in, out);
-    }
-    else {
-      GMM_THROW(getfemint_bad_arg, "unknown function: " << function);
-    }
+    getfemint::call_interface_function(function, in, out);
 
     *pout_args = (gfi_array**)gfi_calloc(out.args().size(),sizeof(gfi_array*));
     if (!*pout_args) GMM_THROW(getfemint_error, "memory exhausted..");
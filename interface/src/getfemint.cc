@@ -941,6 +941,7 @@ namespace getfemint {
     idx = 0;
     okay = 0;
     nb_arg = n;
+    nested = false;
     scilab_flag = false;
   }
 
@@ -950,8 +951,8 @@ namespace getfemint {
         if (out[i]) { gfi_array_destroy(out[i]); free(out[i]); }
       }
       out.clear();
-      workspace().destroy_newly_created_objects();
-    } else {
+      if (!nested) workspace().destroy_newly_created_objects();
+    } else if (!nested) {
       workspace().commit_newly_created_objects();
     }
   }
@@ -94,6 +94,15 @@ namespace getfemint {
   gfi_array* checked_gfi_array_from_string(const char*s);
   gfi_array* checked_gfi_create_sparse(int m, int n, int nzmax,
                                        gfi_complex_flag is_complex);
+  /* vectors sharing the memory of an object, kept alive by `owner` (see
+     gfi_array_create_view) */
+  gfi_array* checked_gfi_array_create_view
+  (int M, const double *data, const std::shared_ptr<const void> &owner);
+  gfi_array* checked_gfi_array_create_view
+  (int M, const std::complex<double> *data,
+   const std::shared_ptr<const void> &owner);
+  gfi_array* checked_gfi_array_create_view
+  (int M, const unsigned *data, const std::shared_ptr<const void> &owner);
 
   typedef bgeot::dim_type dim_type;
   typedef bgeot::scalar_type scalar_type;
@@ -584,6 +593,17 @@ namespace getfemint {
       std::copy(v.begin(), v.end(), gfi_int32_get_data(arg));
     }
     template<class VEC_CONT> void from_vector_container(const VEC_CONT& vv);
+    /* Output v without copy, as a read-only view on the storage of the
+       object `owner`, which remains alive as long as the view. The data
+       is copied when the interface cannot share memory (see config). */
+    template<class T> void
+    from_dcvector_view(const std::vector<T> &v,
+                       const std::shared_ptr<const void> &owner) {
+      if (owner && config::can_share_memory())
+        arg = checked_gfi_array_create_view(int(v.size()), v.data(), owner);
+      else
+        from_dcvector(v);
+    }
   };
 
   template<class STR_CONT> void
@@ -664,6 +684,8 @@ namespace getfemint {
     int idx;
     int okay; /* if 0, the destructor will destroy the allacted arrays in 'out'
                  and will call workspace().destroy_newly_created_objects */
+    bool nested; /* if true, the newly created objects are committed or
+                    destroyed by the enclosing command (see gf_batch) */
     bool scilab_flag;
     /* copy forbidden */
     mexargs_out(const mexargs_out& );
@@ -685,10 +707,15 @@ namespace getfemint {
                                id_type class_id);
     std::deque<gfi_array *>& args() { return out; }
     void set_okay(bool ok) { okay = ok; }
+    void set_nested(bool n) { nested = n; }
     void set_scilab(bool _scilab_flag) {scilab_flag = _scilab_flag;}
     bool get_scilab() const {return scilab_flag;}
   };
 
+  /* Execute the interface function `function` (gf_mesh_get, gf_asm ...). */
+  void call_interface_function(const std::string &function,
+                               mexargs_in &in, mexargs_out &out);
+
   std::string cmd_normalize(const std::string& a);
   bool cmd_strmatch(const std::string& a, const char *s);
   bool cmd_strmatchn(const std::string& a, const char *s, unsigned n);
@@ -42,6 +42,14 @@ namespace getfemint {
     std::swap(pwscmat_r, other.pwscmat_r);
     std::swap(pwscmat_c, other.pwscmat_c);
     std::swap(gfimat, other.gfimat);
+    shared_cscmat_r.swap(other.shared_cscmat_r);
+    shared_cscmat_c.swap(other.shared_cscmat_c);
+  }
+
+  template <typename MAT> static void
+  free_csc(MAT *&p, std::shared_ptr<const MAT> &sp) {
+    if (p && sp.get() == p) sp.reset(); else delete p;
+    p = 0;
   }
 
   gsparse& gsparse::destructive_assign(t_wscmat_r &M) { 
@@ -68,10 +76,8 @@ namespace getfemint {
     pwscmat_r = 0;
     if (pwscmat_c) delete pwscmat_c;
     pwscmat_c = 0;
-    if (pcscmat_r) delete pcscmat_r;
-    pcscmat_r = 0;
-    if (pcscmat_c) delete pcscmat_c;
-    pcscmat_c = 0;
+    free_csc(pcscmat_r, shared_cscmat_r);
+    free_csc(pcscmat_c, shared_cscmat_c);
   }
 
   void gsparse::allocate(size_type m, size_type n, storage_type s_, value_type v_) {
@@ -95,13 +101,13 @@ namespace getfemint {
     if (v_ == REAL) {
       switch (s_) {
         case WSCMAT: delete pwscmat_r; pwscmat_r = 0; break;
-        case CSCMAT: delete pcscmat_r; pcscmat_r = 0; break;
+        case CSCMAT: free_csc(pcscmat_r, shared_cscmat_r); break;
         default: THROW_INTERNAL_ERROR;
       }
     } else {
       switch (s_) {
       case WSCMAT: delete pwscmat_c; pwscmat_c = 0; break;
-      case CSCMAT: delete pcscmat_c; pcscmat_c = 0; break;
+      case CSCMAT: free_csc(pcscmat_c, shared_cscmat_c); break;
       default: THROW_INTERNAL_ERROR;
       }
     }
@@ -177,6 +183,22 @@ namespace getfemint {
     deallocate(s, REAL);
   }
 
+  std::shared_ptr<const void> gsparse::shared_csc() {
+    GMM_ASSERT1(s == CSCMAT && !is_a_native_matrix_ref(),
+                "The matrix is not stored as a getfem CSC matrix");
+    if (v == REAL) {
+      GMM_ASSERT1(pcscmat_r, "Internal error");
+      if (shared_cscmat_r.get() != pcscmat_r)
+        shared_cscmat_r = std::shared_ptr<const t_cscmat_r>(pcscmat_r);
+      return shared_cscmat_r;
+    } else {
+      GMM_ASSERT1(pcscmat_c, "Internal error");
+      if (shared_cscmat_c.get() != pcscmat_c)
+        shared_cscmat_c = std::shared_ptr<const t_cscmat_c>(pcscmat_c);
+      return shared_cscmat_c;
+    }
+  }
+
 
   /* common templates shared between gf_spmat_* */
   template <typename MAT> 
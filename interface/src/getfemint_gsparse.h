@@ -55,6 +55,10 @@ namespace getfemint
     t_cscmat_r *pcscmat_r;
     t_cscmat_c *pcscmat_c;
     const gfi_array  *gfimat;
+    /* non null when the CSC storage is shared with some arrays exported
+       without copy: it is then freed by the last of its owners. */
+    std::shared_ptr<const t_cscmat_r> shared_cscmat_r;
+    std::shared_ptr<const t_cscmat_c> shared_cscmat_c;
 
     void swap(gsparse &other);
     gsparse& destructive_assign(t_wscmat_r &M);
@@ -141,6 +145,9 @@ namespace getfemint
     void to_wsc();
     void to_csc();
     void to_complex();
+    /* Returns an handle keeping the current CSC storage alive (even if the
+       matrix is modified or destroyed afterwards). */
+    std::shared_ptr<const void> shared_csc();
     size_type memsize() const { return 0; /* TODO ! */ }
     size_type ncols() const;
     size_type nrows() const;
@@ -74,6 +74,40 @@ namespace getfemint {
     return t;
   }
 
+  // The owners are storages of plain data (see from_dcvector_view), which
+  // may be released from any thread without lock.
+  static void release_view_owner(void *p)
+  { delete static_cast<std::shared_ptr<const void> *>(p); }
+
+  static gfi_array* checked_gfi_array_create_view
+  (int M, gfi_type_id type, gfi_complex_flag is_complex, const void *data,
+   const std::shared_ptr<const void> &owner) {
+    std::shared_ptr<const void> *powner
+      = new std::shared_ptr<const void>(owner);
+    gfi_array *t = gfi_array_create_view(1, &M, type, is_complex,
+                                         const_cast<void *>(data), powner,
+                                         release_view_owner);
+    if (!t) delete powner;
+    GMM_ASSERT1(t != NULL, "allocation of a view on a vector of " << M << " "
+                << gfi_type_id_name(type,is_complex) << " failed\n");
+    return t;
+  }
+
+  gfi_array* checked_gfi_array_create_view
+  (int M, const double *data, const std::shared_ptr<const void> &owner)
+  { return checked_gfi_array_create_view(M, GFI_DOUBLE, GFI_REAL, data, owner); }
+
+  gfi_array* checked_gfi_array_create_view
+  (int M, const std::complex<double> *data,
+   const std::shared_ptr<const void> &owner) {
+    return checked_gfi_array_create_view(M, GFI_DOUBLE, GFI_COMPLEX,
+                                         data, owner);
+  }
+
+  gfi_array* checked_gfi_array_create_view
+  (int M, const unsigned *data, const std::shared_ptr<const void> &owner)
+  { return checked_gfi_array_create_view(M, GFI_UINT32, GFI_REAL, data, owner); }
+
   gfi_array *
   convert_to_gfi_sparse(const gf_real_sparse_by_row& smat, double threshold)
   {
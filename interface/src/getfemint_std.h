@@ -35,6 +35,7 @@
 #include <getfem/bgeot_config.h>
 #include <getfem/dal_backtrace.h>
 #include <gfi_array.h>
+#include <mutex>
 
 namespace getfemint
 {  
@@ -90,7 +91,8 @@ namespace getfemint
 
   /* see getfem_interface.C */
   struct config {
-    static config *cfg;
+    static thread_local config *cfg; /* configuration of the command run
+                                        by the thread */
     gfi_interface_type interface_type_;
     int base_index_; /* base indexing of arrays (matlab starts at 1, python at 0 */
     bool can_return_integer_; /* matlab < 7 is brain-damaged with respect to int32 type */
@@ -98,15 +100,30 @@ namespace getfemint
     bool prefer_native_sparse_;
     bool has_1D_arrays_; /* true if 1D arrays do exist (for example python),
                            false if they do not existe (i.e. in matlab everything is at least a matrix) */
+    bool can_share_memory_; /* true if arrays may be returned without copy,
+                               as views on the storage of the objects */
     const char *current_function_;
     static int base_index() { return cfg->base_index_; }
     static bool has_native_sparse() { return cfg->has_native_sparse_; }
     static bool prefer_native_sparse() { return cfg->prefer_native_sparse_; }
     static bool can_return_integer() { return cfg->can_return_integer_; }
     static bool has_1D_arrays() { return cfg->has_1D_arrays_; }
+    static bool can_share_memory() { return cfg->can_share_memory_; }
     static std::string current_function() { return std::string(cfg->current_function_); } 
     static void set_current_config(config *p) { cfg = p; }
     config(gfi_interface_type);
   };
+
+  /* The interface may be called from several threads at the same time
+     (python threads). workspace_mutex() protects the bookkeeping of the
+     workspace (table of the objects and of their dependencies), it is held
+     by the methods of workspace_stack. library_mutex() is held by the
+     commands which run some code of the library (all of them except some
+     sub-commands of gf_workspace): the library identifies its threads by
+     their OpenMP number only, so that two commands run from other threads
+     would share its per-thread data. When both are needed, library_mutex()
+     is taken first. */
+  std::recursive_mutex &workspace_mutex();
+  std::recursive_mutex &library_mutex();
 }
 #endif
@@ -34,6 +34,7 @@ namespace getfemint {
 
   /* deletes the current workspace and returns to the parent workspace */
   void workspace_stack::pop_workspace(bool keep_all) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (wrk.size() == 1) THROW_ERROR("You cannot pop the main workspace\n");
     if (keep_all) send_all_objects_to_parent_workspace();
     else clear_workspace();
@@ -44,6 +45,7 @@ namespace getfemint {
   id_type workspace_stack::push_object(const dal::pstatic_stored_object &p,
 					const void *raw_pointer,
 					getfemint_class_id class_id) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     id_type id = id_type(valid_objects.first_false());
     valid_objects.add(id);
     if (id >= obj.size()) obj.push_back(object_info());
@@ -61,6 +63,7 @@ namespace getfemint {
   }
 
   void workspace_stack::sup_dependence(id_type user, id_type used) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (!(valid_objects.is_in(user)) || !(valid_objects.is_in(used)))
       THROW_ERROR("Invalid object\n");
     auto &u = obj[user].dependent_on;
@@ -73,6 +76,7 @@ namespace getfemint {
   
   void workspace_stack::add_hidden_object(id_type user,
 					  const dal::pstatic_stored_object &p) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (!(valid_objects.is_in(user))) THROW_ERROR("Invalid object\n");
     auto &u = obj[user].dependent_on;
     for (auto it = u.begin(); it != u.end(); ++it)
@@ -82,6 +86,7 @@ namespace getfemint {
 
   dal::pstatic_stored_object workspace_stack::hidden_object(id_type user,
 							    const void *p) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (!(valid_objects.is_in(user))) THROW_ERROR("Invalid object\n");
     auto &u = obj[user].dependent_on;
     for (auto it = u.begin(); it != u.end(); ++it)
@@ -90,12 +95,14 @@ namespace getfemint {
   }
 
   void workspace_stack::set_dependence(id_type user, id_type used) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (!(valid_objects.is_in(user)) || !(valid_objects.is_in(used)))
       THROW_ERROR("Invalid object\n");
     add_hidden_object(user, obj[used].p);
   }
 
   void workspace_stack::delete_object(id_type id) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (valid_objects[id]) {
       object_info &ob = obj[id];
       valid_objects.sup(id);
@@ -105,6 +112,7 @@ namespace getfemint {
   }
 
   void workspace_stack::send_object_to_parent_workspace(id_type id) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (get_current_workspace() == 0) THROW_ERROR("Invalid operation\n");
     if (!(valid_objects.is_in(id))) THROW_ERROR("Invalid objects\n");
     auto &o = obj[id];
@@ -112,12 +120,14 @@ namespace getfemint {
   }
 
   void workspace_stack::send_all_objects_to_parent_workspace() {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     id_type cw = get_current_workspace();
     for (dal::bv_visitor_c id(valid_objects); !id.finished(); ++id)
       if ((obj[id]).workspace == cw) obj[id].workspace = id_type(cw-1);
   }
 
   void workspace_stack::clear_workspace(id_type wid) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (wid > get_current_workspace()) THROW_INTERNAL_ERROR;
     dal::bit_vector bv = valid_objects;
     for (dal::bv_visitor_c id(bv); !id.finished(); ++id) {
@@ -131,6 +141,7 @@ namespace getfemint {
 
   const void *workspace_stack::object(id_type id,
 				       const char *expected_type) const {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (valid_objects[id] &&
         std::find(newly_created_objects.begin(),newly_created_objects.end(),id)
 	== newly_created_objects.end()) {
@@ -143,6 +154,7 @@ namespace getfemint {
 
   const dal::pstatic_stored_object &workspace_stack::shared_pointer
   (id_type id, const char *expected_type) const {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (valid_objects[id] &&
         std::find(newly_created_objects.begin(),newly_created_objects.end(),id)
 	== newly_created_objects.end()) {
@@ -153,6 +165,7 @@ namespace getfemint {
   }
 
   id_type workspace_stack::object(const void *raw_pointer) const {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     auto it = kmap.find(raw_pointer);
     if (it != kmap.end()) return it->second; else return id_type(-1);
   }
@@ -160,10 +173,13 @@ namespace getfemint {
   id_type workspace_stack::object(const dal::pstatic_stored_object &p) const
   { const void *q; class_id_of_object(p, &q); return object(q); }
 
-  void workspace_stack::commit_newly_created_objects()
-  { newly_created_objects.resize(0); }
+  void workspace_stack::commit_newly_created_objects() {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
+    newly_created_objects.resize(0);
+  }
 
   void workspace_stack::destroy_newly_created_objects() {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     while (newly_created_objects.size()) {
       delete_object(newly_created_objects.back());
       newly_created_objects.pop_back();
@@ -171,6 +187,7 @@ namespace getfemint {
   }
 
   void workspace_stack::do_stats(std::ostream &o, id_type wid) {  
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     if (wid == id_type(-1)) {
       o << "Anonymous workspace (objects waiting for deletion)\n";
     } else {
@@ -209,6 +226,7 @@ namespace getfemint {
   }
 
   void workspace_stack::do_stats(std::ostream &o) {
+    std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
     for (size_type wid = 0; wid < wrk.size(); ++wid)
       do_stats(o, id_type(wid));
   }
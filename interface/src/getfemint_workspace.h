@@ -47,6 +47,8 @@ namespace getfemint {
   // other variables, in the sense that if a deletion of a variable occurs
   // it will be delayed untill all the dependant variables are deleted
   // (implemented with shared pointers).
+  // The methods of workspace_stack hold workspace_mutex(), the workspace
+  // being shared by the threads which call the interface.
   // The object having a delayed deletion are called hidden objects. It is
   // also possible to directlycreate an hidden object. An hidden object
   // can eventually be retransformed in a normal object.
@@ -77,7 +79,10 @@ namespace getfemint {
   public:
 
     // Creates a new workspace on top of the stack
-    void push_workspace(const std::string &n = "Unnamed") { wrk.push_back(n); }
+    void push_workspace(const std::string &n = "Unnamed") {
+      std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
+      wrk.push_back(n);
+    }
 
     // Deletes the current workspace and returns to the parent workspace
     void pop_workspace(bool keep_all = false);
@@ -113,7 +118,10 @@ namespace getfemint {
     void send_object_to_parent_workspace(id_type obj_id);
     void send_all_objects_to_parent_workspace();
 
-    id_type get_current_workspace() const { return id_type(wrk.size()-1); }
+    id_type get_current_workspace() const {
+      std::lock_guard<std::recursive_mutex> lock(workspace_mutex());
+      return id_type(wrk.size()-1);
+    }
     id_type get_base_workspace() const { return id_type(0); }
     /* Delete every object in the workspace, but *does not* delete the
        workspace itself */
@@ -0,0 +1,119 @@
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+#include <getfemint.h>
+
+using namespace getfemint;
+
+/*@GFDOC
+  Execute a list of commands in a single call to the interface.
+
+  Each command of the list is itself a list whose first element is the
+  name of the interface function (for instance 'mesh_get', 'model_set',
+  'asm' ...) followed by its arguments, exactly as for a direct call
+  (with matlab, the list of commands is a cell array of cell arrays).
+  For instance, with python::
+
+    R = getfem.batch([('mesh_get', m, 'pid from cvid', [0, 1]),
+                      ('model_set', md, 'variable', 'u', U),
+                      ('model_get', md, 'variable', 'u')])
+
+  The commands are executed in order, and the list of their outputs (one
+  list of output arguments per command) is returned. The number of output
+  arguments of each command is not known: the commands return all their
+  output arguments, optional ones included. If a command fails, the
+  execution stops, the error message gives the index of the failing
+  command, and the objects created by the previous commands of the list
+  are deleted.
+
+  This is useful to avoid the overhead of the calls to the interface
+  when many small commands have to be executed (in a loop on the
+  elements for instance).
+@*/
+
+/*@PYTHONEXT
+def batch(commands):
+  """Execute a list of commands in a single call to the interface.
+
+  Each command is a list or a tuple whose first element is the name of the
+  interface function ('mesh_get', 'model_set', 'asm' ...) followed by its
+  arguments. Return the list of the results of the commands: None for a
+  command without output, the output for a command with one output and a
+  tuple of outputs otherwise."""
+  R = getfem('batch', [tuple(c) for c in commands])
+  return [None if len(r) == 0 else (r[0] if len(r) == 1 else r) for r in R]
+@*/
+
+void gf_batch(getfemint::mexargs_in& in, getfemint::mexargs_out& out) {
+  if (in.narg() != 1)
+    THROW_BADARG("Wrong number of input arguments, should be 1.");
+  if (!out.narg_in_range(0, 1))
+    THROW_BADARG("Wrong number of output arguments.");
+
+  const gfi_array *cmds[1] = { in.pop().arg };
+  mexargs_in cmdlist(1, cmds, true);
+  int nb_cmd = cmdlist.narg();
+  std::vector<gfi_array *> results(nb_cmd, 0);
+
+  try {
+    for (int i = 0; i < nb_cmd; ++i) {
+      const gfi_array *cmd[1] = { cmdlist.pop().arg };
+      mexargs_in cin(1, cmd, true);
+      if (cin.narg() < 1 || !cin.front().is_string())
+        THROW_BADARG("command " << i+config::base_index()
+                     << " of the batch should begin with a function name");
+      std::string function = cin.pop().to_string();
+      if (function == "batch" || function == "exit")
+        THROW_BADARG("function " << function << " cannot be used in a batch");
+
+      /* The objects created by the command remain pending in the
+         workspace: they are committed, or deleted if a later command
+         fails, with the ones of the whole batch. */
+      mexargs_out cmd_out(-1);
+      cmd_out.set_nested(true);
+      cmd_out.set_scilab(out.get_scilab());
+      try {
+        call_interface_function(function, cin, cmd_out);
+      } catch (const getfemint_interrupted &) {
+        throw;
+      } catch (const std::logic_error &e) {
+        THROW_ERROR("in command " << i+config::base_index() << " ("
+                    << function << ") of the batch: " << e.what());
+      } catch (const std::runtime_error &e) {
+        THROW_ERROR("in command " << i+config::base_index() << " ("
+                    << function << ") of the batch: " << e.what());
+      }
+
+      std::deque<gfi_array *> &args = cmd_out.args();
+      results[i] = checked_gfi_array_create_1(int(args.size()), GFI_CELL);
+      std::copy(args.begin(), args.end(), gfi_cell_get_data(results[i]));
+      cmd_out.set_okay(1);
+    }
+  } catch (...) {
+    for (gfi_array *r : results)
+      if (r) { gfi_array_destroy(r); gfi_free(r); }
+    throw;
+  }
+
+  gfi_array *res = checked_gfi_array_create_1(nb_cmd, GFI_CELL);
+  std::copy(results.begin(), results.end(), gfi_cell_get_data(res));
+  out.pop().arg = res;
+}
@@ -921,6 +921,36 @@ void gf_mesh_get(getfemint::mexargs_in& m_in,
        out.pop().from_mesh_region(flst);
        );
 
+    /*@GET CVFIDs = ('adjacent faces', @imat CVFIDs)
+    Vectorized version of MESH:GET('adjacent face').
+
+    `CVFIDs` is a two-rows matrix, the first row lists convex #ids, and
+    the second lists face numbers (local number in the convex). Return a
+    two-rows matrix of the same size whose column `j` is the convex face
+    of the neighbor element of the `j`-th face of `CVFIDs`. When a face
+    has no neighbor, both entries of the column are equal to the base
+    index minus one (i.e. -1 with python, 0 with matlab).@*/
+    sub_command
+      ("adjacent faces", 1, 1, 0, 1,
+       check_empty_mesh(pmesh);
+       iarray v = in.pop().to_iarray(2,-1);
+       iarray w = out.pop().create_iarray(2, v.getn());
+       for (size_type j=0; j < v.getn(); j++) {
+         size_type cv = v(0,j) - config::base_index();
+         if (!pmesh->convex_index().is_in(cv))
+           THROW_BADARG("Invalid convex number " << v(0,j));
+         short_type f = short_type(v(1,j) - config::base_index());
+         if (f >= pmesh->structure_of_convex(cv)->nb_faces())
+           THROW_BADARG("Invalid face number " << v(1,j));
+         bgeot::convex_face cvf = pmesh->adjacent_face(cv, f);
+         if (cvf.cv != size_type(-1)) {
+           w(0,j) = int(cvf.cv + config::base_index());
+           w(1,j) = int(cvf.f + config::base_index());
+         } else
+           w(0,j) = w(1,j) = int(config::base_index()) - 1;
+       }
+       );
+
     /*@GET CVFIDs = ('faces from cvid'[, @ivec CVIDs][, 'merge'])
     Return a list of convex faces from a list of convex #id.
 
@@ -997,19 +1027,24 @@ void gf_mesh_get(getfemint::mexargs_in& m_in,
        );
 
 
-    /*@GET N = ('normal of faces', @imat CVFIDs)
+    /*@GET N = ('normal of faces', @imat CVFIDs[, @int nfpt])
     Return matrix of (at face centers) the normal vectors of convexes.
 
     `CVFIDs` is supposed a two-rows matrix, the first row lists convex
-    #ids, and the second lists face numbers (local number in the convex).@*/
+    #ids, and the second lists face numbers (local number in the convex).
+    If `nfpt` is given, the normals are evaluated at the `nfpt` point of
+    each face (vectorized version of MESH:GET('normal of face')).@*/
     sub_command
-      ("normal of faces", 1, 1, 0, 1,
+      ("normal of faces", 1, 2, 0, 1,
        iarray v = in.pop().to_iarray(2,-1);
+       size_type node = 0;
+       if (in.remaining())
+         node = in.pop().to_integer(config::base_index(),10000)-config::base_index();
        darray w = out.pop().create_darray(pmesh->dim(), v.getn());
        for (size_type j=0; j < v.getn(); j++) {
          size_type cv = v(0,j) - config::base_index();
          short_type f  = short_type(v(1,j) - config::base_index());
-         bgeot::base_node N = normal_of_face(*pmesh, cv, f, 0);
+         bgeot::base_node N = normal_of_face(*pmesh, cv, f, node);
          for (size_type i=0; i < pmesh->dim(); ++i) w(i,j)=N[i];
        }
        );
@@ -150,6 +150,19 @@ gf_spmat_get_data(gmm::csc_matrix_ref<const T*, const unsigned int *, const unsi
   }
 }
 
+template <typename T> static void
+gf_spmat_get_view(const gmm::csc_matrix<T> &M,
+                  const std::shared_ptr<const void> &owner,
+                  getfemint::mexargs_out& out) {
+  out.pop().arg = checked_gfi_array_create_view(int(M.jc.size()),
+                                                M.jc.data(), owner);
+  if (out.remaining())
+    out.pop().arg = checked_gfi_array_create_view(int(M.ir.size()),
+                                                  M.ir.data(), owner);
+  if (out.remaining())
+    out.pop().from_dcvector_view(M.pr, owner);
+}
+
 template <typename T> static void
 gf_spmat_get_Dirichlet_nullspace(gsparse &H, getfemint::mexargs_in& in, getfemint::mexargs_out& out, T) {
   garray<T> R            = in.pop().to_garray(T());
@@ -320,6 +333,40 @@ void gf_spmat_get(getfemint::mexargs_in& m_in,
        );
 
 
+    /*@GET @CELL{JC, IR, V} = ('csc view')
+      Return the two index arrays and the array of values of the CSC
+      storage of `M`, without copy. With Python, these are read-only
+      arrays sharing the memory of `M`, which can be given directly to
+      scipy.sparse.csc_matrix. They keep this storage alive, even if `M`
+      is deleted or modified afterwards (any modification of the sparsity
+      pattern of `M` makes it leave this storage, which is then no more
+      updated). With the other interfaces, this is the same as
+      ('csc_ind') followed by ('csc_val').
+
+      If `M` is not stored as a CSC matrix, it is converted into CSC.@*/
+    sub_command
+      ("csc view", 0, 0, 0, 3,
+       gsp.to_csc();
+       if (!config::can_share_memory() || gsp.is_a_native_matrix_ref()) {
+         if (!gsp.is_complex()) {
+           gf_spmat_get_data(gsp.csc(scalar_type()),  out, 0);
+           if (out.remaining())
+             gf_spmat_get_data(gsp.csc(scalar_type()),  out, 1);
+         } else {
+           gf_spmat_get_data(gsp.csc(complex_type()), out, 0);
+           if (out.remaining())
+             gf_spmat_get_data(gsp.csc(complex_type()), out, 1);
+         }
+       } else {
+         std::shared_ptr<const void> owner = gsp.shared_csc();
+         if (!gsp.is_complex())
+           gf_spmat_get_view(gsp.real_csc_w(), owner, out);
+         else
+           gf_spmat_get_view(gsp.cplx_csc_w(), owner, out);
+       }
+       );
+
+
     /*@GET @CELL{N, U0} = ('dirichlet nullspace', @vec R)
     Solve the dirichlet conditions `M.U=R`.
 
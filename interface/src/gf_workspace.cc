@@ -74,6 +74,25 @@ void gf_workspace(getfemint::mexargs_in& m_in, getfemint::mexargs_out& m_out) {
   typedef std::map<std::string, psub_command > SUBC_TAB;
   static SUBC_TAB subc_tab;
 
+  if (m_in.narg() < 1)  THROW_BADARG( "Wrong number of input arguments");
+
+  std::string init_cmd   = m_in.pop().to_string();
+  std::string cmd        = cmd_normalize(init_cmd);
+
+  // This function is called without the lock of the library (see
+  // getfem_interface_main). It is taken by the sub-commands which may
+  // destroy some objects or which look at the library, the other ones
+  // only use the workspace and run while a command of another thread is
+  // executed.
+  std::unique_lock<std::recursive_mutex> llock(library_mutex(),
+                                               std::defer_lock);
+  if (cmd != cmd_normalize("push") && cmd != cmd_normalize("stat")
+      && cmd != cmd_normalize("stats") && cmd != cmd_normalize("keep")
+      && cmd != cmd_normalize("keep all")
+      && cmd != cmd_normalize("class name"))
+    llock.lock();
+  std::lock_guard<std::recursive_mutex> wlock(workspace_mutex());
+
   if (subc_tab.size() == 0) {
 
     /*@FUNC ('push')
@@ -207,12 +226,6 @@ void gf_workspace(getfemint::mexargs_in& m_in, getfemint::mexargs_out& m_out) {
 
 
 
-  if (m_in.narg() < 1)  THROW_BADARG( "Wrong number of input arguments");
-
-  std::string init_cmd   = m_in.pop().to_string();
-  std::string cmd        = cmd_normalize(init_cmd);
-
-  
   SUBC_TAB::iterator it = subc_tab.find(cmd);
   if (it != subc_tab.end()) {
     check_cmd(cmd, it->first.c_str(), m_in, m_out, it->second->arg_in_min,
@@ -24,6 +24,11 @@
 #include <stdio.h>
 #include <string.h>
 #include "gfi_array.h"
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <pthread.h>
+#endif
 
 
 /* -------------------- creation ------------------------*/
@@ -167,11 +172,130 @@ gfi_create_objid(int nid, unsigned *ids, unsigned cid) {
   return t;
 }
 */
+/* ----------------- views ------------------ */
+
+/* The arrays which do not own their data are recorded here, with the
+   handle of the owner of the data. A view is normally destroyed soon
+   after its creation, so the list remains very short. */
+typedef struct gfi_view {
+  const gfi_array *t;
+  void *owner;
+  void (*release)(void *);
+  struct gfi_view *next;
+} gfi_view;
+
+static gfi_view *views = NULL;
+
+/* views are created by getfem_interface_main and released by the caller,
+   possibly from different threads */
+#ifdef _WIN32
+static SRWLOCK views_lock = SRWLOCK_INIT;
+# define LOCK_VIEWS() AcquireSRWLockExclusive(&views_lock)
+# define UNLOCK_VIEWS() ReleaseSRWLockExclusive(&views_lock)
+#else
+static pthread_mutex_t views_lock = PTHREAD_MUTEX_INITIALIZER;
+# define LOCK_VIEWS() pthread_mutex_lock(&views_lock)
+# define UNLOCK_VIEWS() pthread_mutex_unlock(&views_lock)
+#endif
+
+static void
+gfi_array_detach_data(gfi_array *t) {
+  switch (t->storage.type) {
+  case GFI_INT32:
+    t->storage.gfi_storage_u.data_int32.data_int32_val = NULL; break;
+  case GFI_UINT32:
+    t->storage.gfi_storage_u.data_uint32.data_uint32_val = NULL; break;
+  case GFI_DOUBLE:
+    t->storage.gfi_storage_u.data_double.data_double_val = NULL; break;
+  default: assert(0);
+  }
+}
+
+/* remove t from the list of views, return 0 if t is not a view */
+static int
+gfi_view_remove(const gfi_array *t, void **owner, void (**release)(void *)) {
+  gfi_view **pv, *v = NULL;
+  LOCK_VIEWS();
+  for (pv = &views; *pv; pv = &((*pv)->next))
+    if ((*pv)->t == t) { v = *pv; *pv = v->next; break; }
+  UNLOCK_VIEWS();
+  if (!v) return 0;
+  *owner = v->owner; *release = v->release;
+  gfi_free(v);
+  return 1;
+}
+
+gfi_array*
+gfi_array_create_view(int ndim, int *dims, gfi_type_id type,
+                      gfi_complex_flag is_complex,
+                      void *data, void *owner, void (*release)(void *)) {
+  gfi_array *t;
+  gfi_view *v;
+  int sz = 1;
+  if (type != GFI_INT32 && type != GFI_UINT32 && type != GFI_DOUBLE)
+    return NULL;
+  if (!(v = gfi_calloc(1, sizeof(gfi_view)))) return NULL;
+  if (!(t = gfi_calloc(1, sizeof(gfi_array)))) { gfi_free(v); return NULL; }
+  t->dim.dim_len = ndim;
+  t->dim.dim_val = gfi_calloc(ndim, sizeof(int));
+  if (t->dim.dim_val == NULL) { gfi_free(t); gfi_free(v); return NULL; }
+  for (int i=0; i < ndim; ++i) {
+    t->dim.dim_val[i] = dims[i];
+    sz *= dims[i];
+  }
+  t->storage.type = type;
+  switch (type) {
+  case GFI_INT32: {
+    t->storage.gfi_storage_u.data_int32.data_int32_len = sz;
+    t->storage.gfi_storage_u.data_int32.data_int32_val = data;
+  } break;
+  case GFI_UINT32: {
+    t->storage.gfi_storage_u.data_uint32.data_uint32_len = sz;
+    t->storage.gfi_storage_u.data_uint32.data_uint32_val = data;
+  } break;
+  default: {
+    t->storage.gfi_storage_u.data_double.is_complex = is_complex;
+    t->storage.gfi_storage_u.data_double.data_double_len
+      = sz * (is_complex ? 2 : 1);
+    t->storage.gfi_storage_u.data_double.data_double_val = data;
+  } break;
+  }
+  v->t = t; v->owner = owner; v->release = release;
+  LOCK_VIEWS();
+  v->next = views; views = v;
+  UNLOCK_VIEWS();
+  return t;
+}
+
+int
+gfi_array_is_view(const gfi_array *t) {
+  gfi_view *v;
+  int found = 0;
+  LOCK_VIEWS();
+  for (v = views; v && !found; v = v->next)
+    if (v->t == t) found = 1;
+  UNLOCK_VIEWS();
+  return found;
+}
+
+void*
+gfi_array_take_owner(gfi_array *t, void (**release)(void *)) {
+  void *owner = NULL;
+  if (!gfi_view_remove(t, &owner, release)) return NULL;
+  gfi_array_detach_data(t);
+  return owner;
+}
+
 /* ----------------- destruction ------------ */
 
 void
 gfi_array_destroy(gfi_array *t) {
+  void *owner; void (*release)(void *);
   if (t == NULL) return;
+  if (gfi_view_remove(t, &owner, &release)) {
+    gfi_array_detach_data(t);
+    if (release) release(owner);
+  }
   FREE(t->dim.dim_val);
   switch (t->storage.type) {
   case GFI_CHAR: {
@@ -165,6 +165,18 @@ gfi_array*
 gfi_array_from_string(const char *s);
 gfi_array*
 gfi_create_sparse(int m, int n, int nzmax, gfi_complex_flag);
+  /* Arrays which do not own their data (GFI_INT32, GFI_UINT32 or
+     GFI_DOUBLE only): the data belongs to an object which is kept alive by
+     the opaque handle `owner`, released by `release(owner)` when the array
+     is destroyed, unless the handle has been taken over by the caller with
+     gfi_array_take_owner (the data pointer of the array is then reset). */
+gfi_array*
+gfi_array_create_view(int ndim, int *dims, gfi_type_id type, gfi_complex_flag,
+                      void *data, void *owner, void (*release)(void *));
+int
+gfi_array_is_view(const gfi_array *t);
+void*
+gfi_array_take_owner(gfi_array *t, void (**release)(void *));
   /*gfi_array*
     gfi_create_objid(int nid, unsigned *ids, unsigned cid);*/
 void
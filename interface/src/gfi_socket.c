@@ -0,0 +1,472 @@
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "gfi_socket.h"
+
+#define BLOCK_INLINE 0
+#define BLOCK_SHM 1
+
+/* maximal nesting of the cells of an array */
+#define MAX_DEPTH 64
+
+/* -------------------- frames ------------------------*/
+
+static int read_all(int fd, void *p, size_t n) {
+  char *c = (char *)p;
+  while (n) {
+    ssize_t r = read(fd, c, n);
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) return -1;
+    c += r; n -= (size_t)r;
+  }
+  return 0;
+}
+
+static int write_all(int fd, const void *p, size_t n) {
+  const char *c = (const char *)p;
+  while (n) {
+    ssize_t r = write(fd, c, n);
+    if (r < 0 && errno == EINTR) continue;
+    if (r <= 0) return -1;
+    c += r; n -= (size_t)r;
+  }
+  return 0;
+}
+
+/* returns 1 at the end of the stream, -1 on error */
+int gfi_socket_read_frame(int fd, unsigned *magic, unsigned *request_id,
+                          char **payload, uint64_t *length) {
+  uint32_t h[2]; uint64_t len; ssize_t r;
+  char *c = (char *)h; size_t n = sizeof(h);
+  *payload = NULL;
+  /* the end of the stream is only allowed between two frames */
+  while (n) {
+    r = read(fd, c, n);
+    if (r < 0 && errno == EINTR) continue;
+    if (r == 0 && n == sizeof(h)) return 1;
+    if (r <= 0) return -1;
+    c += r; n -= (size_t)r;
+  }
+  if (read_all(fd, &len, sizeof(len))) return -1;
+  if ((uint64_t)(size_t)len != len) return -1;
+  *magic = h[0]; *request_id = h[1]; *length = len;
+  /* at least 8 bytes, so that the payload is aligned for the doubles */
+  if (!(*payload = malloc(len ? (size_t)len : 8))) return -1;
+  if (read_all(fd, *payload, (size_t)len)) {
+    free(*payload); *payload = NULL; return -1;
+  }
+  return 0;
+}
+
+int gfi_socket_write_frame(int fd, unsigned magic, unsigned request_id,
+                           const char *payload, uint64_t length) {
+  char h[16];
+  uint32_t m = magic, id = request_id;
+  memcpy(h, &m, 4); memcpy(h+4, &id, 4); memcpy(h+8, &length, 8);
+  if (write_all(fd, h, sizeof(h))) return -1;
+  return write_all(fd, payload, (size_t)length);
+}
+
+/* -------------------- encoding ------------------------*/
+
+static int reserve(gfi_socket_buffer *b, size_t n) {
+  if (b->size + n > b->capacity) {
+    size_t c = b->capacity ? b->capacity : 256;
+    char *p;
+    while (c < b->size + n) c *= 2;
+    if (!(p = realloc(b->data, c))) return -1;
+    b->data = p; b->capacity = c;
+  }
+  return 0;
+}
+
+static int put(gfi_socket_encoder *e, const void *p, size_t n) {
+  if (reserve(&e->buf, n)) return -1;
+  memcpy(e->buf.data + e->buf.size, p, n);
+  e->buf.size += n;
+  return 0;
+}
+
+int gfi_socket_shm_prefix(char *prefix, size_t n) {
+  unsigned long long r = 0;
+  int fd = open("/dev/urandom", O_RDONLY);
+  if (fd == -1 || read_all(fd, &r, sizeof(r))) {
+    if (fd != -1) close(fd);
+    return -1;
+  }
+  close(fd);
+  return (snprintf(prefix, n, "/gfi-%ld-%016llx", (long)getpid(), r)
+          >= (int)n) ? -1 : 0;
+}
+
+void gfi_socket_encoder_init(gfi_socket_encoder *e, size_t shm_threshold,
+                             const char *shm_prefix, char shm_side) {
+  e->buf.data = NULL; e->buf.size = e->buf.capacity = 0;
+  e->shm_threshold = shm_prefix ? shm_threshold : 0;
+  e->shm_prefix = shm_prefix; e->shm_side = shm_side;
+  e->shm_first = 0; e->nb_shm = 0;
+}
+
+void gfi_socket_encoder_release(gfi_socket_encoder *e) {
+  free(e->buf.data);
+  e->buf.data = NULL; e->buf.size = e->buf.capacity = 0;
+}
+
+int gfi_socket_put_int32(gfi_socket_encoder *e, int32_t v)
+{ return put(e, &v, sizeof(v)); }
+
+int gfi_socket_put_uint32(gfi_socket_encoder *e, uint32_t v)
+{ return put(e, &v, sizeof(v)); }
+
+int gfi_socket_put_string(gfi_socket_encoder *e, const char *s) {
+  uint32_t n = (uint32_t)(s ? strlen(s) : 0);
+  if (gfi_socket_put_uint32(e, n)) return -1;
+  return put(e, s, n);
+}
+
+static int shm_name(char *name, size_t size, const char *prefix,
+                    char side, uint32_t k) {
+  return (snprintf(name, size, "%s-%c%u", prefix, side, (unsigned)k)
+          >= (int)size) ? -1 : 0;
+}
+
+static int put_shm_block(gfi_socket_encoder *e, const void *p, uint64_t n) {
+  static uint32_t cnt = 0; /* the sessions are not shared by threads */
+  char name[128];
+  uint32_t k = cnt++;
+  void *m;
+  int fd;
+  /* the numbers of the segments of the encoder are consecutive */
+  if (e->nb_shm++ == 0) e->shm_first = k;
+  if (shm_name(name, sizeof(name), e->shm_prefix, e->shm_side, k) ||
+      (fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600)) == -1)
+    return -1;
+  if (ftruncate(fd, (off_t)n) == -1 ||
+      (m = mmap(NULL, (size_t)n, PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0)) == MAP_FAILED) {
+    close(fd); shm_unlink(name); return -1;
+  }
+  close(fd);
+  memcpy(m, p, (size_t)n);
+  munmap(m, (size_t)n);
+  if (gfi_socket_put_uint32(e, k)) { shm_unlink(name); return -1; }
+  return 0;
+}
+
+void gfi_socket_encoder_unlink_shm(gfi_socket_encoder *e) {
+  char name[128];
+  uint32_t i;
+  for (i = 0; i < e->nb_shm; ++i)
+    if (shm_name(name, sizeof(name), e->shm_prefix, e->shm_side,
+                 e->shm_first + i) == 0)
+      shm_unlink(name);
+  e->nb_shm = 0;
+}
+
+static int put_block(gfi_socket_encoder *e, const void *p, uint64_t n) {
+  unsigned char kind = (e->shm_threshold && n >= e->shm_threshold)
+    ? BLOCK_SHM : BLOCK_INLINE;
+  if (put(e, &kind, 1) || put(e, &n, sizeof(n))) return -1;
+  if (kind == BLOCK_SHM) {
+    size_t size = e->buf.size;
+    if (put_shm_block(e, p, n) == 0) return 0;
+    /* fall back to an inline block */
+    e->buf.size = size - sizeof(n) - 1;
+    kind = BLOCK_INLINE;
+    if (put(e, &kind, 1) || put(e, &n, sizeof(n))) return -1;
+  }
+  if (reserve(&e->buf, 7)) return -1;
+  while (e->buf.size % 8) e->buf.data[e->buf.size++] = 0;
+  return put(e, p, (size_t)n);
+}
+
+int gfi_socket_put_array(gfi_socket_encoder *e, const gfi_array *t) {
+  const gfi_storage *s = &t->storage;
+  uint32_t i, cplx = 0;
+  if (s->type == GFI_DOUBLE) cplx = (uint32_t)s->gfi_storage_u.data_double.is_complex;
+  if (s->type == GFI_SPARSE) cplx = (uint32_t)s->gfi_storage_u.sp.is_complex;
+  if (gfi_socket_put_uint32(e, (uint32_t)s->type) ||
+      gfi_socket_put_uint32(e, t->dim.dim_len)) return -1;
+  for (i = 0; i < t->dim.dim_len; ++i)
+    if (gfi_socket_put_uint32(e, t->dim.dim_val[i])) return -1;
+  if (gfi_socket_put_uint32(e, cplx)) return -1;
+  switch (s->type) {
+  case GFI_INT32:
+    return put_block(e, s->gfi_storage_u.data_int32.data_int32_val,
+                     (uint64_t)s->gfi_storage_u.data_int32.data_int32_len*4);
+  case GFI_UINT32:
+    return put_block(e, s->gfi_storage_u.data_uint32.data_uint32_val,
+                     (uint64_t)s->gfi_storage_u.data_uint32.data_uint32_len*4);
+  case GFI_DOUBLE:
+    return put_block(e, s->gfi_storage_u.data_double.data_double_val,
+                     (uint64_t)s->gfi_storage_u.data_double.data_double_len*8);
+  case GFI_CHAR:
+    return put_block(e, s->gfi_storage_u.data_char.data_char_val,
+                     s->gfi_storage_u.data_char.data_char_len);
+  case GFI_CELL:
+    if (gfi_socket_put_uint32(e, s->gfi_storage_u.data_cell.data_cell_len))
+      return -1;
+    for (i = 0; i < s->gfi_storage_u.data_cell.data_cell_len; ++i)
+      if (gfi_socket_put_array(e, s->gfi_storage_u.data_cell.data_cell_val[i]))
+        return -1;
+    return 0;
+  case GFI_OBJID:
+    if (gfi_socket_put_uint32(e, s->gfi_storage_u.objid.objid_len)) return -1;
+    for (i = 0; i < s->gfi_storage_u.objid.objid_len; ++i)
+      if (gfi_socket_put_int32(e, s->gfi_storage_u.objid.objid_val[i].id) ||
+          gfi_socket_put_int32(e, s->gfi_storage_u.objid.objid_val[i].cid))
+        return -1;
+    return 0;
+  case GFI_SPARSE:
+    if (put_block(e, s->gfi_storage_u.sp.ir.ir_val,
+                  (uint64_t)s->gfi_storage_u.sp.ir.ir_len*4) ||
+        put_block(e, s->gfi_storage_u.sp.jc.jc_val,
+                  (uint64_t)s->gfi_storage_u.sp.jc.jc_len*4))
+      return -1;
+    return put_block(e, s->gfi_storage_u.sp.pr.pr_val,
+                     (uint64_t)s->gfi_storage_u.sp.pr.pr_len*8);
+  default:
+    return -1;
+  }
+}
+
+/* -------------------- decoding ------------------------*/
+
+/* check the compressed columns of a m x n sparse matrix: increasing
+   column starts from 0 to at most the size of ir, and row indices < m */
+static int valid_sparse(const gfi_sparse *sp, uint32_t m, uint32_t n) {
+  uint32_t j, i;
+  const int *jc = sp->jc.jc_val, *ir = sp->ir.ir_val;
+  if (jc[0] != 0) return 0;
+  for (j = 0; j < n; ++j)
+    if (jc[j+1] < jc[j]) return 0;
+  if ((uint32_t)jc[n] > sp->ir.ir_len) return 0;
+  for (i = 0; i < (uint32_t)jc[n]; ++i)
+    if (ir[i] < 0 || (uint32_t)ir[i] >= m) return 0;
+  return 1;
+}
+
+void gfi_socket_decoder_init(gfi_socket_decoder *d, const char *data,
+                             size_t size, const char *shm_prefix,
+                             char shm_side) {
+  memset(d, 0, sizeof(*d));
+  d->data = data; d->size = size;
+  d->shm_prefix = shm_prefix; d->shm_side = shm_side;
+}
+
+void gfi_socket_decoder_release(gfi_socket_decoder *d) {
+  size_t i;
+  for (i = 0; i < d->nb_allocs; ++i) free(d->allocs[i]);
+  for (i = 0; i < d->nb_maps; ++i) munmap(d->maps[i], d->map_sizes[i]);
+  free(d->allocs); free(d->maps); free(d->map_sizes);
+  memset(d, 0, sizeof(*d));
+}
+
+static void *dalloc(gfi_socket_decoder *d, size_t n) {
+  void *p;
+  if (d->nb_allocs == d->max_allocs) {
+    size_t m = d->max_allocs ? 2*d->max_allocs : 16;
+    void **a = realloc(d->allocs, m*sizeof(void*));
+    if (!a) return NULL;
+    d->allocs = a; d->max_allocs = m;
+  }
+  if (!(p = calloc(n ? n : 1, 1))) return NULL;
+  d->allocs[d->nb_allocs++] = p;
+  return p;
+}
+
+static int get(gfi_socket_decoder *d, void *p, size_t n) {
+  if (d->size - d->pos < n) return -1;
+  memcpy(p, d->data + d->pos, n);
+  d->pos += n;
+  return 0;
+}
+
+int gfi_socket_get_int32(gfi_socket_decoder *d, int32_t *v)
+{ return get(d, v, sizeof(*v)); }
+
+int gfi_socket_get_uint32(gfi_socket_decoder *d, uint32_t *v)
+{ return get(d, v, sizeof(*v)); }
+
+const char *gfi_socket_get_string(gfi_socket_decoder *d) {
+  uint32_t n; char *s;
+  if (gfi_socket_get_uint32(d, &n) || d->size - d->pos < n) return NULL;
+  if (!(s = dalloc(d, (size_t)n + 1))) return NULL;
+  memcpy(s, d->data + d->pos, n);
+  d->pos += n;
+  return s;
+}
+
+static void *map_shm_block(gfi_socket_decoder *d, uint32_t k, uint64_t n) {
+  struct stat st;
+  char name[128];
+  void *m;
+  int fd;
+  if (!d->shm_prefix ||
+      shm_name(name, sizeof(name), d->shm_prefix, d->shm_side, k) ||
+      (fd = shm_open(name, O_RDONLY, 0)) == -1)
+    return NULL;
+  /* only the segments of the peer, which runs as the same user */
+  if (fstat(fd, &st) == -1 || st.st_uid != geteuid() ||
+      (uint64_t)st.st_size < n) { close(fd); return NULL; }
+  shm_unlink(name);
+  if (n == 0) { close(fd); return dalloc(d, 8); }
+  /* private mapping: the receiver may not modify the data of the sender */
+  m = mmap(NULL, (size_t)n, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (m == MAP_FAILED) return NULL;
+  if (d->nb_maps == d->max_maps) {
+    size_t k = d->max_maps ? 2*d->max_maps : 4;
+    void **a = realloc(d->maps, k*sizeof(void*));
+    size_t *s;
+    if (!a) { munmap(m, (size_t)n); return NULL; }
+    d->maps = a;
+    if (!(s = realloc(d->map_sizes, k*sizeof(size_t))))
+      { munmap(m, (size_t)n); return NULL; }
+    d->map_sizes = s; d->max_maps = k;
+  }
+  d->maps[d->nb_maps] = m; d->map_sizes[d->nb_maps++] = (size_t)n;
+  return m;
+}
+
+/* size of the next block, when it is not given by the dimensions */
+static int peek_block_size(gfi_socket_decoder *d, uint64_t *n) {
+  if (d->size - d->pos < 1 + sizeof(*n)) return -1;
+  memcpy(n, d->data + d->pos + 1, sizeof(*n));
+  return 0;
+}
+
+/* the size of the block is checked against the expected one */
+static void *get_block(gfi_socket_decoder *d, uint64_t expected) {
+  unsigned char kind; uint64_t n;
+  if (get(d, &kind, 1) || get(d, &n, sizeof(n)) || n != expected) return NULL;
+  if (kind == BLOCK_SHM) {
+    uint32_t k;
+    return gfi_socket_get_uint32(d, &k) ? NULL : map_shm_block(d, k, n);
+  } else if (kind == BLOCK_INLINE) {
+    void *p;
+    while (d->pos % 8) d->pos++;
+    if (d->pos > d->size || d->size - d->pos < n) return NULL;
+    /* never return a null pointer for an empty block */
+    p = n ? (void *)(d->data + d->pos) : dalloc(d, 8);
+    d->pos += (size_t)n;
+    return p;
+  }
+  return NULL;
+}
+
+/* the number of elements of the arrays fits in an uint32 */
+static gfi_array *get_array(gfi_socket_decoder *d, int depth) {
+  uint32_t type, ndim, cplx, n, i;
+  uint64_t nb = 1;
+  gfi_array *t = dalloc(d, sizeof(gfi_array));
+  gfi_storage *s;
+  if (!t || depth > MAX_DEPTH || gfi_socket_get_uint32(d, &type) ||
+      gfi_socket_get_uint32(d, &ndim))
+    return NULL;
+  if (ndim > 64 || !(t->dim.dim_val = dalloc(d, ndim*sizeof(u_int))))
+    return NULL;
+  t->dim.dim_len = ndim;
+  for (i = 0; i < ndim; ++i) {
+    if (gfi_socket_get_uint32(d, &t->dim.dim_val[i])) return NULL;
+    nb *= t->dim.dim_val[i];
+    if (nb > UINT32_MAX) return NULL;
+  }
+  if (gfi_socket_get_uint32(d, &cplx)) return NULL;
+  s = &t->storage;
+  s->type = (gfi_type_id)type;
+  switch (type) {
+  case GFI_INT32:
+    s->gfi_storage_u.data_int32.data_int32_len = (u_int)nb;
+    return (s->gfi_storage_u.data_int32.data_int32_val = get_block(d, nb*4))
+      ? t : NULL;
+  case GFI_UINT32:
+    s->gfi_storage_u.data_uint32.data_uint32_len = (u_int)nb;
+    return (s->gfi_storage_u.data_uint32.data_uint32_val = get_block(d, nb*4))
+      ? t : NULL;
+  case GFI_DOUBLE:
+    if (cplx && (nb *= 2) > UINT32_MAX) return NULL;
+    s->gfi_storage_u.data_double.is_complex = (int)cplx;
+    s->gfi_storage_u.data_double.data_double_len = (u_int)nb;
+    return (s->gfi_storage_u.data_double.data_double_val = get_block(d, nb*8))
+      ? t : NULL;
+  case GFI_CHAR: {
+    uint64_t len;
+    if (peek_block_size(d, &len) || len > UINT32_MAX) return NULL;
+    s->gfi_storage_u.data_char.data_char_len = (u_int)len;
+    return (s->gfi_storage_u.data_char.data_char_val = get_block(d, len))
+      ? t : NULL;
+  }
+  case GFI_CELL:
+    if (gfi_socket_get_uint32(d, &n) || n > d->size - d->pos) return NULL;
+    s->gfi_storage_u.data_cell.data_cell_len = n;
+    if (!(s->gfi_storage_u.data_cell.data_cell_val
+          = dalloc(d, n*sizeof(gfi_array*)))) return NULL;
+    for (i = 0; i < n; ++i)
+      if (!(s->gfi_storage_u.data_cell.data_cell_val[i]
+            = get_array(d, depth+1))) return NULL;
+    return t;
+  case GFI_OBJID:
+    if (gfi_socket_get_uint32(d, &n) || n > d->size - d->pos) return NULL;
+    s->gfi_storage_u.objid.objid_len = n;
+    if (!(s->gfi_storage_u.objid.objid_val
+          = dalloc(d, n*sizeof(gfi_object_id)))) return NULL;
+    for (i = 0; i < n; ++i) {
+      int32_t id, cid;
+      if (gfi_socket_get_int32(d, &id) || gfi_socket_get_int32(d, &cid))
+        return NULL;
+      s->gfi_storage_u.objid.objid_val[i].id = id;
+      s->gfi_storage_u.objid.objid_val[i].cid = cid;
+    }
+    return t;
+  case GFI_SPARSE: {
+    gfi_sparse *sp = &s->gfi_storage_u.sp;
+    uint64_t nnz;
+    if (ndim != 2 || peek_block_size(d, &nnz)) return NULL;
+    sp->is_complex = (int)cplx;
+    nnz /= 4; /* size of ir */
+    if ((cplx ? 2*nnz : nnz) > UINT32_MAX || t->dim.dim_val[1] == UINT32_MAX)
+      return NULL;
+    sp->ir.ir_len = (u_int)nnz;
+    sp->jc.jc_len = t->dim.dim_val[1] + 1;
+    sp->pr.pr_len = (u_int)(cplx ? 2*nnz : nnz);
+    if (!(sp->ir.ir_val = get_block(d, nnz*4)) ||
+        !(sp->jc.jc_val = get_block(d, (uint64_t)sp->jc.jc_len*4)) ||
+        !(sp->pr.pr_val = get_block(d, (uint64_t)sp->pr.pr_len*8)))
+      return NULL;
+    return valid_sparse(sp, t->dim.dim_val[0], t->dim.dim_val[1]) ? t : NULL;
+  }
+  default:
+    return NULL;
+  }
+}
+
+gfi_array *gfi_socket_get_array(gfi_socket_decoder *d)
+{ return get_array(d, 0); }
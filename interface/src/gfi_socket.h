@@ -0,0 +1,159 @@
+/* -*- c++ -*- (enables emacs c++ mode) */
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/**\file gfi_socket.h
+   \brief Binary frames exchanged with the getfem_socket_server.
+
+   The getfem_socket_server executes the commands of the interface sent by
+   a local front-end through a Unix-domain socket. The messages are frames
+   made of a 16 bytes header
+
+     uint32 magic ('GFRQ' for a request, 'GFRP' for a reply, 'GFHL' for
+            the hello frame),
+     uint32 request id (the reply has the id of its request),
+     uint64 length of the payload,
+
+   followed by the payload. All the integers are in the native byte order
+   (the front-end runs on the same host). The server first sends a hello
+   frame, whose payload is the string prefix of the names of the shared
+   memory segments of the session (see below). The payload of a request
+   is
+
+     int32 config id (gfi_interface_type), int32 number of outputs (-1 when
+     unknown), string function name, uint32 number of arguments, arrays.
+
+   and the payload of a reply is
+
+     int32 status (gfi_status), string information message, then a string
+     error message if status is GFI_STATUS_ERROR, or uint32 number of
+     outputs followed by the arrays otherwise.
+
+   A string is a uint32 length followed by its characters. An array is
+
+     uint32 type (gfi_type_id), uint32 ndim, uint32 dims[ndim], uint32
+     is_complex, then for GFI_INT32, GFI_UINT32, GFI_DOUBLE and GFI_CHAR
+     a data block, for GFI_CELL an uint32 n followed by n arrays, for
+     GFI_OBJID an uint32 n followed by n pairs of int32 (id, class id),
+     and for GFI_SPARSE three data blocks (ir, jc and pr). The number of
+     elements (doubled for the complex arrays) has to fit in an uint32,
+     and the cells are nested at most 64 levels.
+
+   A data block is an uint8 kind, an uint64 size in bytes and, for an
+   inline block (kind 0), the data, starting at the next offset of the
+   payload which is a multiple of 8. For a shared memory block (kind 1),
+   the data is in a POSIX shared memory segment whose number k follows as
+   an uint32. The name of the segment is the prefix given by the server
+   followed by "-c<k>" for the segments of the front-end (requests) and
+   "-s<k>" for the ones of the server (replies): the names are never read
+   from the peer, and the prefix is random, so that the receiver opens
+   only the segments of the session. The segment is created by the sender
+   and unlinked by the receiver once it has been mapped, after a check of
+   its owner. When a payload cannot be encoded or decoded, its remaining
+   segments are unlinked by the sender or by the receiver.
+
+   The requests of a session are executed in order, and they may be sent
+   without waiting for the replies of the previous ones.
+*/
+
+#ifndef GFI_SOCKET_H__
+#define GFI_SOCKET_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gfi_array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GFI_SOCKET_REQUEST 0x51524647u /* "GFRQ" */
+#define GFI_SOCKET_REPLY   0x50524647u /* "GFRP" */
+#define GFI_SOCKET_HELLO   0x4c484647u /* "GFHL" */
+
+  /* default size (in bytes) from which the data of an array is sent in a
+     shared memory segment. */
+#define GFI_SOCKET_SHM_THRESHOLD (1 << 20)
+
+typedef struct gfi_socket_buffer {
+  char *data;
+  size_t size, capacity;
+} gfi_socket_buffer;
+
+  /* Payload under construction. Arrays whose data is larger than
+     `shm_threshold` bytes are sent in shared memory (never if 0 or if
+     there is no prefix), in segments named shm_prefix-<shm_side><k>. */
+typedef struct gfi_socket_encoder {
+  gfi_socket_buffer buf;
+  size_t shm_threshold;
+  const char *shm_prefix;
+  char shm_side;
+  uint32_t shm_first, nb_shm; /* segments created for the payload */
+} gfi_socket_encoder;
+
+  /* Payload being read. The decoded arrays point into the payload or into
+     the mapped shared memory segments: they are valid until the call of
+     gfi_socket_decoder_release. Only the segments named
+     shm_prefix-<shm_side><k> are accepted. */
+typedef struct gfi_socket_decoder {
+  const char *data;
+  size_t size, pos;
+  const char *shm_prefix;
+  char shm_side;
+  void **allocs; size_t nb_allocs, max_allocs;
+  void **maps; size_t *map_sizes; size_t nb_maps, max_maps;
+} gfi_socket_decoder;
+
+int gfi_socket_read_frame(int fd, unsigned *magic, unsigned *request_id,
+                          char **payload, uint64_t *length);
+int gfi_socket_write_frame(int fd, unsigned magic, unsigned request_id,
+                           const char *payload, uint64_t length);
+
+  /* random prefix of the names of the shared memory segments of a
+     session (n >= 64) */
+int gfi_socket_shm_prefix(char *prefix, size_t n);
+
+void gfi_socket_encoder_init(gfi_socket_encoder *e, size_t shm_threshold,
+                             const char *shm_prefix, char shm_side);
+void gfi_socket_encoder_release(gfi_socket_encoder *e);
+  /* unlink the segments of the payload which the receiver has not
+     unlinked (the ones of a payload which could not be sent or read) */
+void gfi_socket_encoder_unlink_shm(gfi_socket_encoder *e);
+int gfi_socket_put_int32(gfi_socket_encoder *e, int32_t v);
+int gfi_socket_put_uint32(gfi_socket_encoder *e, uint32_t v);
+int gfi_socket_put_string(gfi_socket_encoder *e, const char *s);
+int gfi_socket_put_array(gfi_socket_encoder *e, const gfi_array *t);
+
+void gfi_socket_decoder_init(gfi_socket_decoder *d, const char *data,
+                             size_t size, const char *shm_prefix,
+                             char shm_side);
+void gfi_socket_decoder_release(gfi_socket_decoder *d);
+int gfi_socket_get_int32(gfi_socket_decoder *d, int32_t *v);
+int gfi_socket_get_uint32(gfi_socket_decoder *d, uint32_t *v);
+  /* the returned string is valid until gfi_socket_decoder_release */
+const char *gfi_socket_get_string(gfi_socket_decoder *d);
+gfi_array *gfi_socket_get_array(gfi_socket_decoder *d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GFI_SOCKET_H__ */
@@ -0,0 +1,230 @@
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/*
+  getfem_socket_server: executes the commands of the interface sent by
+  local front-ends through a Unix-domain socket (see gfi_socket.h for the
+  format of the frames).
+
+  Each connection is a session, served by its own process: the sessions
+  run concurrently and each one has its own workspace, which is deleted
+  when the front-end closes the connection. The socket is only accessible
+  to the user running the server.
+*/
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "gfi_socket.h"
+#include "getfem_interface.h"
+
+static const char *socket_path = NULL;
+
+static void shutdown_server(int sig) {
+  (void)sig;
+  if (socket_path) unlink(socket_path);
+  _exit(0);
+}
+
+/* Decode a request, execute it and encode its reply. */
+static int serve_request(const char *payload, size_t length,
+                         const char *shm_prefix, gfi_socket_encoder *rep) {
+  gfi_socket_decoder d;
+  int32_t config_id, nb_out;
+  uint32_t nb_in, i;
+  const char *fname;
+  const gfi_array **in = NULL;
+  gfi_array **out = NULL;
+  char *infomsg = NULL, *errmsg = NULL;
+  int nout = 0, ok = -1;
+
+  gfi_socket_decoder_init(&d, payload, length, shm_prefix, 'c');
+  if (gfi_socket_get_int32(&d, &config_id) ||
+      gfi_socket_get_int32(&d, &nb_out) ||
+      !(fname = gfi_socket_get_string(&d)) ||
+      gfi_socket_get_uint32(&d, &nb_in) || nb_in > length)
+    errmsg = strdup("getfem_socket_server: malformed request");
+  else if (config_id < MATLAB_INTERFACE || config_id > SCILAB_INTERFACE)
+    errmsg = strdup("getfem_socket_server: invalid configuration id");
+  else if (!(in = calloc(nb_in ? nb_in : 1, sizeof(gfi_array*))))
+    errmsg = strdup("getfem_socket_server: memory exhausted");
+  else {
+    for (i = 0; i < nb_in; ++i)
+      if (!(in[i] = gfi_socket_get_array(&d))) break;
+    if (i < nb_in)
+      errmsg = strdup("getfem_socket_server: malformed argument");
+    else {
+      nout = nb_out;
+      errmsg = getfem_interface_main(config_id, fname, (int)nb_in, in,
+                                     &nout, &out, &infomsg, 0);
+    }
+  }
+
+  if (gfi_socket_put_int32(rep, errmsg ? GFI_STATUS_ERROR : GFI_STATUS_OK) ||
+      gfi_socket_put_string(rep, infomsg ? infomsg : "")) goto end;
+  if (errmsg) {
+    if (gfi_socket_put_string(rep, errmsg)) goto end;
+  } else {
+    if (gfi_socket_put_uint32(rep, (uint32_t)nout)) goto end;
+    for (i = 0; i < (uint32_t)nout; ++i)
+      if (gfi_socket_put_array(rep, out[i])) goto end;
+  }
+  ok = 0;
+
+ end:
+  if (ok != 0) {
+    /* the reply is replaced by an error, its segments are removed */
+    gfi_socket_encoder_unlink_shm(rep);
+    rep->buf.size = 0;
+    if (gfi_socket_put_int32(rep, GFI_STATUS_ERROR) == 0 &&
+        gfi_socket_put_string(rep, "") == 0 &&
+        gfi_socket_put_string(rep, "getfem_socket_server: "
+                              "the reply cannot be encoded") == 0)
+      ok = 0;
+  }
+  if (out) {
+    for (i = 0; i < (uint32_t)nout; ++i)
+      { gfi_array_destroy(out[i]); gfi_free(out[i]); }
+    gfi_free(out);
+  }
+  free(in); free(infomsg); free(errmsg);
+  gfi_socket_decoder_release(&d);
+  return ok;
+}
+
+static void serve_session(int fd, size_t shm_threshold) {
+  char shm_prefix[64];
+  gfi_socket_encoder hello;
+  int r;
+  /* the names of the shared memory segments of the session */
+  gfi_socket_encoder_init(&hello, 0, NULL, 's');
+  if (gfi_socket_shm_prefix(shm_prefix, sizeof(shm_prefix)) ||
+      gfi_socket_put_string(&hello, shm_prefix) ||
+      gfi_socket_write_frame(fd, GFI_SOCKET_HELLO, 0, hello.buf.data,
+                             hello.buf.size)) {
+    fprintf(stderr, "getfem_socket_server: cannot open the session\n");
+    gfi_socket_encoder_release(&hello);
+    close(fd);
+    return;
+  }
+  gfi_socket_encoder_release(&hello);
+  for (;;) {
+    unsigned magic, id;
+    char *payload;
+    uint64_t length;
+    gfi_socket_encoder rep;
+    r = gfi_socket_read_frame(fd, &magic, &id, &payload, &length);
+    if (r == 1) break;
+    if (r != 0 || magic != GFI_SOCKET_REQUEST) {
+      fprintf(stderr, "getfem_socket_server: bad frame, session closed\n");
+      free(payload);
+      break;
+    }
+    gfi_socket_encoder_init(&rep, shm_threshold, shm_prefix, 's');
+    r = serve_request(payload, (size_t)length, shm_prefix, &rep);
+    free(payload);
+    if (r == 0)
+      r = gfi_socket_write_frame(fd, GFI_SOCKET_REPLY, id,
+                                 rep.buf.data, rep.buf.size);
+    if (r != 0) gfi_socket_encoder_unlink_shm(&rep);
+    gfi_socket_encoder_release(&rep);
+    if (r != 0) break;
+  }
+  close(fd);
+}
+
+static void usage(const char *prog) {
+  fprintf(stderr, "usage: %s [-single] [-shm threshold] socket_path\n"
+          "  -single        : serve only one session, in the server process\n"
+          "  -shm threshold : size in bytes from which the arrays are sent\n"
+          "                   in shared memory (0 to disable, default %d)\n",
+          prog, GFI_SOCKET_SHM_THRESHOLD);
+  exit(1);
+}
+
+int main(int argc, char **argv) {
+  struct sockaddr_un addr;
+  size_t shm_threshold = GFI_SOCKET_SHM_THRESHOLD;
+  int single = 0, sock, i, r;
+  mode_t mask;
+
+  for (i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "-single") == 0) single = 1;
+    else if (strcmp(argv[i], "-shm") == 0 && i+1 < argc)
+      shm_threshold = (size_t)strtoul(argv[++i], NULL, 10);
+    else if (argv[i][0] == '-' || socket_path) usage(argv[0]);
+    else socket_path = argv[i];
+  }
+  if (!socket_path || strlen(socket_path) >= sizeof(addr.sun_path))
+    usage(argv[0]);
+
+  if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) == -1)
+    { perror("socket"); exit(1); }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, socket_path);
+  unlink(socket_path);
+  /* the socket is created without access for the group and the others */
+  mask = umask(077);
+  r = bind(sock, (struct sockaddr*)&addr, sizeof(addr));
+  umask(mask);
+  if (r == -1 || chmod(socket_path, 0600) == -1 || listen(sock, 16) == -1)
+    { perror("bind"); close(sock); unlink(socket_path); exit(1); }
+
+  signal(SIGINT, shutdown_server);
+  signal(SIGTERM, shutdown_server);
+  signal(SIGPIPE, SIG_IGN);
+  signal(SIGCHLD, SIG_IGN); /* the sessions are not waited for */
+  printf("getfem interface server is listening on %s\n", socket_path);
+  fflush(stdout);
+
+  for (;;) {
+    int fd = accept(sock, NULL, NULL);
+    if (fd == -1) {
+      if (errno == EINTR) continue;
+      perror("accept"); break;
+    }
+    if (single) {
+      close(sock); unlink(socket_path);
+      serve_session(fd, shm_threshold);
+      return 0;
+    }
+    switch (fork()) {
+    case -1: perror("fork"); close(fd); break;
+    case 0:
+      close(sock);
+      socket_path = NULL;
+      signal(SIGINT, SIG_DFL); signal(SIGTERM, SIG_DFL);
+      serve_session(fd, shm_threshold);
+      _exit(0);
+    default:
+      close(fd);
+    }
+  }
+  close(sock); unlink(socket_path);
+  return 1;
+}
@@ -0,0 +1,349 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 3 of the License,  or
+# (at your option) any later version along with the GCC Runtime Library
+# Exception either version 3.1 or (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License and GCC Runtime Library Exception for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+"""Client of the getfem_socket_server.
+
+The getfem_socket_server executes the commands of the interface sent
+through a Unix-domain socket by front-ends running on the same host (see
+interface/src/gfi_socket.h for the format of the messages). This module
+does not need the compiled getfem module::
+
+  c = Client('/tmp/getfem.sock')
+  m = c.call('mesh', 'cartesian', np.arange(0., 11.), np.arange(0., 11.))
+  R = c.pipeline([('mesh_get', m, 'nbpts'), ('mesh_get', m, 'pts')])
+
+Each connection is a session with its own workspace, which is deleted
+when the connection is closed. The getfem objects are returned as Object
+instances, which may be used as arguments of the next commands.
+"""
+
+import mmap
+import os
+import selectors
+import socket
+import struct
+
+import numpy as np
+
+GFI_INT32, GFI_UINT32, GFI_DOUBLE, GFI_CHAR, GFI_CELL, GFI_OBJID, \
+  GFI_SPARSE = 0, 1, 2, 4, 5, 6, 7
+REQUEST, REPLY, HELLO = 0x51524647, 0x50524647, 0x4c484647
+PYTHON_INTERFACE = 1
+SHM_THRESHOLD = 1 << 20
+
+
+class Object(object):
+  """Reference to an object of the workspace of the session."""
+  def __init__(self, classid, objid):
+    self.classid = classid
+    self.objid = objid
+
+  def __eq__(self, other):
+    return (isinstance(other, Object) and self.classid == other.classid
+            and self.objid == other.objid)
+
+  def __hash__(self):
+    return hash((self.classid, self.objid))
+
+  def __repr__(self):
+    return 'Object(%d, %d)' % (self.classid, self.objid)
+
+
+class Error(RuntimeError):
+  pass
+
+
+class _Encoder(object):
+  def __init__(self, shm_threshold, client):
+    self.buf = bytearray()
+    self.shm_threshold = shm_threshold
+    self.client = client
+    self.segments = []
+
+  def u32(self, v): self.buf += struct.pack('=I', v)
+  def i32(self, v): self.buf += struct.pack('=i', v)
+
+  def string(self, s):
+    b = s.encode('utf-8')
+    self.u32(len(b)); self.buf += b
+
+  def block(self, data):
+    data = memoryview(data).cast('B')
+    n = data.nbytes
+    if self.shm_threshold and n >= self.shm_threshold:
+      # the segments are named after the prefix given by the server
+      k = self.client.shm_count
+      self.client.shm_count += 1
+      name = '%s-c%d' % (self.client.shm_prefix, k)
+      fd = os.open('/dev/shm' + name, os.O_CREAT | os.O_EXCL | os.O_RDWR,
+                   0o600)
+      try:
+        os.ftruncate(fd, n)
+        with mmap.mmap(fd, n) as m: m[:] = data
+      finally:
+        os.close(fd)
+      self.segments.append(name)
+      self.buf += struct.pack('=BQI', 1, n, k)
+    else:
+      self.buf += struct.pack('=BQ', 0, n)
+      self.buf += bytes(-len(self.buf) % 8)
+      self.buf += data
+
+  def header(self, t, dims, cplx=0):
+    self.u32(t); self.u32(len(dims))
+    for d in dims: self.u32(d)
+    self.u32(cplx)
+
+  def array(self, o):
+    if isinstance(o, str):
+      b = o.encode('utf-8')
+      self.header(GFI_CHAR, [len(b)]); self.block(b)
+    elif isinstance(o, Object):
+      self.header(GFI_OBJID, [1]); self.u32(1)
+      self.i32(o.objid); self.i32(o.classid)
+    elif isinstance(o, (bool, int, np.integer)):
+      self.header(GFI_INT32, []); self.block(struct.pack('=i', int(o)))
+    elif isinstance(o, (float, np.floating)):
+      self.header(GFI_DOUBLE, []); self.block(struct.pack('=d', float(o)))
+    elif isinstance(o, (complex, np.complexfloating)):
+      self.header(GFI_DOUBLE, [], 1)
+      self.block(struct.pack('=dd', o.real, o.imag))
+    elif isinstance(o, (list, tuple)) and not _is_numeric(o):
+      self.header(GFI_CELL, [len(o)]); self.u32(len(o))
+      for x in o: self.array(x)
+    else:
+      a = np.asarray(o)
+      if a.dtype.kind in 'biu':
+        t, cplx, a = GFI_INT32, 0, a.astype(np.int32)
+      elif a.dtype.kind == 'f':
+        t, cplx, a = GFI_DOUBLE, 0, a.astype(np.float64)
+      elif a.dtype.kind == 'c':
+        t, cplx, a = GFI_DOUBLE, 1, a.astype(np.complex128)
+      else:
+        raise TypeError('unhandled argument of type %s' % type(o))
+      self.header(t, a.shape, cplx)
+      self.block(np.asfortranarray(a).reshape(-1, order='F'))
+
+
+def _is_numeric(o):
+  if len(o) and isinstance(o[0], (str, Object, list, tuple)):
+    return (not isinstance(o[0], (str, Object))
+            and all(isinstance(x, (list, tuple)) and _is_numeric(x)
+                    for x in o))
+  return all(isinstance(x, (bool, int, float, complex, np.number,
+                            np.ndarray)) for x in o)
+
+
+class _Decoder(object):
+  def __init__(self, data, shm_prefix=None):
+    self.data = memoryview(data)
+    self.pos = 0
+    self.shm_prefix = shm_prefix
+
+  def unpack(self, fmt):
+    r = struct.unpack_from(fmt, self.data, self.pos)
+    self.pos += struct.calcsize(fmt)
+    return r
+
+  def u32(self): return self.unpack('=I')[0]
+  def i32(self): return self.unpack('=i')[0]
+
+  def string(self):
+    n = self.u32()
+    s = bytes(self.data[self.pos:self.pos+n]).decode('utf-8', 'replace')
+    self.pos += n
+    return s
+
+  def block(self):
+    kind, n = self.unpack('=BQ')
+    if kind == 1:
+      # only the segments of the server for this session
+      name = '%s-s%d' % (self.shm_prefix, self.unpack('=I')[0])
+      fd = os.open('/dev/shm' + name, os.O_RDONLY | os.O_NOFOLLOW)
+      try:
+        if os.fstat(fd).st_uid != os.geteuid():
+          raise Error('shared memory segment of another user')
+        os.unlink('/dev/shm' + name)
+        if n == 0: return memoryview(b'')
+        # the array keeps the (private) mapping alive: no copy of the data
+        return memoryview(mmap.mmap(fd, n, mmap.MAP_PRIVATE,
+                                    mmap.PROT_READ | mmap.PROT_WRITE))
+      finally:
+        os.close(fd)
+    self.pos += -self.pos % 8
+    b = self.data[self.pos:self.pos+n]
+    self.pos += n
+    return b
+
+  def numeric(self, dtype, dims):
+    a = np.frombuffer(self.block(), dtype=dtype)
+    if len(dims) == 0: return a[0].item()
+    return a.reshape(dims, order='F')
+
+  def array(self):
+    t = self.u32()
+    dims = [self.u32() for i in range(self.u32())]
+    cplx = self.u32()
+    if t == GFI_INT32: return self.numeric(np.int32, dims)
+    if t == GFI_UINT32: return self.numeric(np.uint32, dims)
+    if t == GFI_DOUBLE:
+      return self.numeric(np.complex128 if cplx else np.float64, dims)
+    if t == GFI_CHAR: return bytes(self.block()).decode('utf-8', 'replace')
+    if t == GFI_CELL:
+      return tuple(self.array() for i in range(self.u32()))
+    if t == GFI_OBJID:
+      ids = []
+      for i in range(self.u32()):
+        objid = self.i32(); ids.append(Object(self.i32(), objid))
+      return ids[0] if len(ids) == 1 else ids
+    if t == GFI_SPARSE:
+      ir = np.frombuffer(self.block(), dtype=np.int32)
+      jc = np.frombuffer(self.block(), dtype=np.int32)
+      pr = np.frombuffer(self.block(),
+                         dtype=np.complex128 if cplx else np.float64)
+      return (pr, ir, jc, tuple(dims))
+    raise Error('unknown array type %d in the reply' % t)
+
+
+class Client(object):
+  """Session of a getfem_socket_server listening on the socket `path`."""
+  def __init__(self, path, shm_threshold=SHM_THRESHOLD):
+    self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    self.sock.connect(path)
+    self.shm_threshold = shm_threshold
+    self.next_id = 0
+    self.infomsg = ''
+    self.shm_count = 0
+    # the server gives the prefix of the names of the shared memory segments
+    head = self._recv(16)
+    magic, rid, n = struct.unpack('=IIQ', head)
+    if magic != HELLO: raise Error('bad hello from the server')
+    self.shm_prefix = _Decoder(self._recv(n)).string()
+
+  def _recv(self, n):
+    data = bytearray()
+    while len(data) < n:
+      b = self.sock.recv(n - len(data))
+      if not b: raise Error('connection closed by the server')
+      data += b
+    return bytes(data)
+
+  def close(self):
+    """Close the session (its workspace is deleted)."""
+    if self.sock is not None:
+      self.sock.close()
+      self.sock = None
+
+  def __enter__(self): return self
+  def __exit__(self, *args): self.close()
+
+  def call(self, function, *args):
+    """Execute the interface function `function` (such as 'mesh_get')
+    with the arguments `args`. Return None, the output or the tuple of the
+    outputs of the function."""
+    return self.pipeline([(function,) + args])[0]
+
+  def pipeline(self, commands):
+    """Send all the commands of the list `commands`, each one given as
+    (function, arguments...), without waiting for the replies, and return
+    the list of their results. An Error is raised after the reception of
+    all the replies if one of the commands failed."""
+    frames = bytearray()
+    segments = []
+    for c in commands:
+      e = _Encoder(self.shm_threshold, self)
+      e.i32(PYTHON_INTERFACE); e.i32(-1); e.string(c[0]); e.u32(len(c)-1)
+      for a in c[1:]: e.array(a)
+      frames += struct.pack('=IIQ', REQUEST, self.next_id + len(segments),
+                            len(e.buf))
+      frames += e.buf
+      segments.append(e.segments)
+    first = self.next_id
+    self.next_id += len(commands)
+    try:
+      replies = self._exchange(bytes(frames), len(commands))
+    finally:
+      # the segments are normally unlinked by the server
+      for name in [n for s in segments for n in s]:
+        try: os.unlink('/dev/shm' + name)
+        except FileNotFoundError: pass
+    results, errors, info = [], [], []
+    try:
+      for k, (rid, payload) in enumerate(replies):
+        if rid != first + k: raise Error('unexpected reply')
+        d = _Decoder(payload, self.shm_prefix)
+        status = d.i32()
+        msg = d.string()
+        if msg: info.append(msg)
+        if status != 0:
+          errors.append('%s: %s' % (commands[k][0], d.string()))
+          results.append(None)
+          continue
+        out = [d.array() for i in range(d.u32())]
+        results.append(None if len(out) == 0 else
+                       (out[0] if len(out) == 1 else tuple(out)))
+    except Exception:
+      # the segments of the replies which have not been read
+      self._unlink_server_segments()
+      raise
+    self.infomsg = ''.join(info)
+    if errors: raise Error('\n'.join(errors))
+    return results
+
+  def _unlink_server_segments(self):
+    # all the replies have been received: the remaining segments of the
+    # server are not read anymore
+    prefix = os.path.basename(self.shm_prefix) + '-s'
+    for name in os.listdir('/dev/shm'):
+      if name.startswith(prefix):
+        try: os.unlink('/dev/shm/' + name)
+        except FileNotFoundError: pass
+
+  def _exchange(self, frames, nb_replies):
+    # the replies are read while the requests are sent, so that none of
+    # both sides blocks when the socket buffers are full
+    sel = selectors.DefaultSelector()
+    sel.register(self.sock, selectors.EVENT_READ | selectors.EVENT_WRITE)
+    self.sock.setblocking(False)
+    sent, inbuf, replies = 0, bytearray(), []
+    try:
+      while len(replies) < nb_replies:
+        if sent == len(frames):
+          sel.modify(self.sock, selectors.EVENT_READ)
+        for key, events in sel.select():
+          if events & selectors.EVENT_WRITE and sent < len(frames):
+            try: sent += self.sock.send(frames[sent:sent + (1 << 20)])
+            except BlockingIOError: pass
+          if events & selectors.EVENT_READ:
+            try: data = self.sock.recv(1 << 20)
+            except BlockingIOError: continue
+            if not data: raise Error('connection closed by the server')
+            inbuf += data
+            while len(inbuf) >= 16:
+              magic, rid, n = struct.unpack_from('=IIQ', inbuf)
+              if magic != REPLY: raise Error('bad reply from the server')
+              if len(inbuf) < 16 + n: break
+              replies.append((rid, bytearray(inbuf[16:16+n])))
+              del inbuf[:16+n]
+    finally:
+      sel.close()
+      self.sock.setblocking(True)
+    return replies
@@ -327,6 +327,20 @@ PyObject_is_GetfemObject(PyObject *o, gfi_object_id *pid)
   return go != NULL;
 }
 
+/* true for a list or a tuple whose first element is a string, or a list
+   or a tuple of such sequences (such as the commands of a batch): it cannot
+   be a numerical array, the costly inspection by numpy is avoided. */
+static int
+is_string_sequence(PyObject *o)
+{
+  while (PyTuple_Check(o) || PyList_Check(o)) {
+    if (PySequence_Fast_GET_SIZE(o) == 0) return 0;
+    o = PySequence_Fast_GET_ITEM(o, 0);
+    if (PyUnicode_Check(o)) return 1;
+  }
+  return 0;
+}
+
 static gfi_array *
 PyObject_to_gfi_array(gcollect *gc, PyObject *o)
 {
@@ -395,7 +409,8 @@ PyObject_to_gfi_array(gcollect *gc, PyObject *o)
     if (!(TGFISTORE(double,val)=gc_alloc(gc,sizeof(double)*2))) return NULL;
     TGFISTORE(double,val)[0] = real;
     TGFISTORE(double,val)[1] = imag;
-  } else if (PyTypeNum_ISNUMBER(PyArray_ObjectType(o,0))) {
+  } else if (!is_string_sequence(o) &&
+             PyTypeNum_ISNUMBER(PyArray_ObjectType(o,0))) {
     //printf("Numerical Array");
     /* python numeric sequences are stored in numerical array */
     int dtype = PyArray_ObjectType(o,0);
@@ -576,6 +591,64 @@ build_gfi_array_list(gcollect *gc, PyObject *tuple, const char **pfunction_name,
   return l;
 }
 
+/* The data of the arrays returned by getfem is not copied: the numpy
+   arrays take it over (it is freed with the numpy array), or, for the
+   views on the storage of getfem objects, take over the handle which
+   keeps the owner of the data alive. */
+typedef struct gfi_view_owner {
+  void *owner;
+  void (*release)(void *);
+} gfi_view_owner;
+
+static void
+release_gfi_data(PyObject *capsule) {
+  gfi_free(PyCapsule_GetPointer(capsule, "getfem.data"));
+}
+
+static void
+release_gfi_view(PyObject *capsule) {
+  gfi_view_owner *v = PyCapsule_GetPointer(capsule, "getfem.view");
+  /* the release may wait for a getfem command running in another thread */
+  Py_BEGIN_ALLOW_THREADS;
+  if (v->release) v->release(v->owner);
+  Py_END_ALLOW_THREADS;
+  free(v);
+}
+
+/* numpy array (in fortran order) on the data of t. *taken is set when
+   the data of t now belongs to the numpy array. */
+static PyObject *
+gfi_array_data_to_PyArray(gfi_array *t, int typenum, void *data, int *taken) {
+  PyObject *o, *base;
+  int view = gfi_array_is_view(t);
+  npy_intp *dim = PyDimMem_NEW(t->dim.dim_len);
+  for (u_int i=0; i < t->dim.dim_len; i++)
+    dim[i] = (npy_intp)t->dim.dim_val[i];
+  o = PyArray_New(&PyArray_Type, t->dim.dim_len, dim, typenum, NULL, data, 0,
+                  view ? NPY_ARRAY_FARRAY_RO : NPY_ARRAY_FARRAY, NULL);
+  PyDimMem_FREE(dim);
+  if (!o) return NULL;
+  if (view) {
+    gfi_view_owner *v = malloc(sizeof(gfi_view_owner));
+    if (!v) { Py_DECREF(o); return PyErr_NoMemory(); }
+    v->owner = gfi_array_take_owner(t, &v->release);
+    if (!(base = PyCapsule_New(v, "getfem.view", release_gfi_view))) {
+      if (v->release) v->release(v->owner);
+      free(v); Py_DECREF(o); return NULL;
+    }
+  } else {
+    if (!(base = PyCapsule_New(data, "getfem.data", release_gfi_data))) {
+      Py_DECREF(o); return NULL;
+    }
+    *taken = 1;
+  }
+  /* the reference to base is stolen, even on failure */
+  if (PyArray_SetBaseObject((PyArrayObject *)o, base) < 0) {
+    Py_DECREF(o); return NULL;
+  }
+  return o;
+}
+
 PyObject*
 gfi_array_to_PyObject(gfi_array *t, int in__init__) {
   PyObject *o = NULL;
@@ -587,49 +660,29 @@ gfi_array_to_PyObject(gfi_array *t, int in__init__) {
     if (t->dim.dim_len == 0)
       return PyLong_FromLong(TGFISTORE(int32,val)[0]);
     else {
-      npy_intp *dim = PyDimMem_NEW(t->dim.dim_len);
-      for (u_int i=0; i < t->dim.dim_len; i++)
-        dim[i] = (npy_intp)t->dim.dim_val[i];
-      if (!(o = PyArray_EMPTY(t->dim.dim_len, dim, NPY_INT, 1)))
-        return NULL;
-      PyDimMem_FREE(dim);
-
-      npy_intp itemsize = PyArray_ITEMSIZE((PyArrayObject *)o);
-      npy_intp size = PyArray_Size(o); /* Number of elements. */
-      memcpy(PyArray_DATA((PyArrayObject *)o), TGFISTORE(int32,val),
-             size*itemsize); // new copy
+      int taken = 0;
+      o = gfi_array_data_to_PyArray(t, NPY_INT, TGFISTORE(int32,val), &taken);
+      if (taken) TGFISTORE(int32,val) = NULL;
     }
   } break;
   case GFI_DOUBLE: {
     // printf("GFI_DOUBLE\n");
+    int taken = 0;
     if (!gfi_array_is_complex(t)) {
       if (t->dim.dim_len == 0)
         return PyFloat_FromDouble(TGFISTORE(double,val)[0]);
-      else {
-        npy_intp *dim = PyDimMem_NEW(t->dim.dim_len);
-        for (u_int i=0; i < t->dim.dim_len; i++)
-          dim[i] = (npy_intp)t->dim.dim_val[i];
-        if (!(o = PyArray_EMPTY(t->dim.dim_len, dim, NPY_DOUBLE, 1)))
-          return NULL;
-        PyDimMem_FREE(dim);
-      }
+      else
+        o = gfi_array_data_to_PyArray(t, NPY_DOUBLE, TGFISTORE(double,val),
+                                      &taken);
     } else {
       if (t->dim.dim_len == 0)
         return PyComplex_FromDoubles(TGFISTORE(double,val)[0],
                                      TGFISTORE(double,val)[1]);
-      else {
-        npy_intp *dim = PyDimMem_NEW(t->dim.dim_len);
-        for (u_int i=0; i < t->dim.dim_len; i++)
-          dim[i] = (npy_intp)t->dim.dim_val[i];
-        if (!(o = PyArray_EMPTY(t->dim.dim_len, dim, NPY_CDOUBLE, 1)))
-          return NULL;
-        PyDimMem_FREE(dim);
-      }
+      else
+        o = gfi_array_data_to_PyArray(t, NPY_CDOUBLE, TGFISTORE(double,val),
+                                      &taken);
     }
-    npy_intp itemsize = PyArray_ITEMSIZE((PyArrayObject *)o);
-    npy_intp size = PyArray_Size(o); /* Number of elements. */
-    memcpy(PyArray_DATA((PyArrayObject *)o), TGFISTORE(double,val),
-           size*itemsize); // new copy
+    if (taken) TGFISTORE(double,val) = NULL;
   } break;
   case GFI_CHAR: {
     //printf("GFI_CHAR\n");
@@ -740,11 +793,12 @@ call_getfem_(PyObject *self, PyObject *args, int in__init__)
       } else if (out) {
         int i, err = 0;
         PyObject *d[out_cnt];
-        for (i = 0; i < out_cnt; ++i) {
+        for (i = 0; i < out_cnt; ++i)
           if (!err && !(d[i] = gfi_array_to_PyObject(out[i], in__init__)))
             err = 1;
-          gfi_array_destroy(out[i]);
-        }
+        Py_BEGIN_ALLOW_THREADS;
+        for (i = 0; i < out_cnt; ++i) gfi_array_destroy(out[i]);
+        Py_END_ALLOW_THREADS;
 
         free(out);
         if (!err) {
@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 2.1 of the License,  or
+# (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+############################################################################
+"""  Timing of the batched and vectorized commands.
+
+  This program compares the time of N small commands executed one by one
+  with the time of the same commands given to getfem.batch, and the time
+  of a loop on the faces with the one of the vectorized queries on the
+  faces. It checks nothing and is not run by make check:
+
+    python bench_batch.py [N]
+
+  $Id$
+"""
+import sys
+import time
+
+import numpy as np
+
+import getfem as gf
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+
+def best(f, repeat = 5):
+  t = []
+  for i in range(repeat):
+    t0 = time.perf_counter(); f(); t.append(time.perf_counter() - t0)
+  return min(t)
+
+def compare(what, t_loop, t_vect, n):
+  print('%-28s loop %8.2f us  batched %8.2f us  ratio %5.2f'
+        % (what, 1e6*t_loop/n, 1e6*t_vect/n, t_loop/t_vect))
+
+NX = 30
+m = gf.Mesh('cartesian', np.arange(0,1+1./NX,1./NX),
+                         np.arange(0,1+1./NX,1./NX))
+mf = gf.MeshFem(m, 1); mf.set_classical_fem(1)
+md = gf.Model('real')
+md.add_fem_variable('u', mf)
+md.add_initialized_data('c', [1.])
+
+# Small commands, one by one or in a single call.
+cmds = [('mesh_fem_get', mf, 'nbdof')] * N
+compare('mesh_fem_get nbdof', best(lambda: [mf.nbdof() for c in cmds]),
+        best(lambda: gf.batch(cmds)), N)
+cmds = [('model_set', md, 'variable', 'c', [float(i)]) for i in range(N)]
+compare('model_set variable',
+        best(lambda: [md.set_variable('c', c[4]) for c in cmds]),
+        best(lambda: gf.batch(cmds)), N)
+cmds = [('mesh_get', m, 'pid from cvid', i % m.nbcvs()) for i in range(N)]
+compare('mesh_get pid from cvid',
+        best(lambda: [m.pid_from_cvid(c[3]) for c in cmds]),
+        best(lambda: gf.batch(cmds)), N)
+
+# Queries on each face, or on all the faces at once.
+CVF = m.faces_from_cvid()
+nbf = CVF.shape[1]
+compare('normal of face(s)',
+        best(lambda: [m.normal_of_face(CVF[0,j], CVF[1,j])
+                      for j in range(nbf)]),
+        best(lambda: m.normal_of_faces(CVF)), nbf)
+compare('adjacent face(s)',
+        best(lambda: [m.adjacent_face(CVF[0,j], CVF[1,j])
+                      for j in range(nbf)]),
+        best(lambda: m.adjacent_faces(CVF)), nbf)
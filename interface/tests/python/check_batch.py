@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 2.1 of the License,  or
+# (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+############################################################################
+"""  Test of the execution of a list of commands in a single call.
+
+  This program is used to check that getfem.batch gives the same results
+  as the direct calls, including the vectorized queries on the convexes.
+
+  $Id$
+"""
+import numpy as np
+
+import getfem as gf
+
+NX = 6
+m = gf.Mesh('cartesian', np.arange(0,1+1./NX,1./NX),
+                         np.arange(0,1+1./NX,1./NX))
+mf = gf.MeshFem(m, 1); mf.set_classical_fem(1)
+mim = gf.MeshIm(m, 2)
+md = gf.Model('real')
+md.add_fem_variable('u', mf)
+nbd = mf.nbdof()
+
+# Several commands in one call, compared with the direct calls.
+U = np.arange(nbd, dtype=float)
+R = gf.batch([('mesh_get', m, 'pid from cvid', [0, 1]),
+              ('model_set', md, 'variable', 'u', U),
+              ('model_get', md, 'variable', 'u'),
+              ('mesh_fem_get', mf, 'nbdof')])
+if (len(R) != 4 or R[1] is not None or R[3] != nbd):
+  print("Bad batch results"); exit(1)
+pid, idx = m.pid_from_cvid([0, 1])
+if (np.any(R[0][0] != pid) or np.any(R[0][1] != idx)):
+  print("Bad batch results"); exit(1)
+if (np.linalg.norm(R[2] - U) != 0. or
+    np.linalg.norm(md.variable('u') - U) != 0.):
+  print("Bad batch results"); exit(1)
+
+# Objects created by a batch.
+R = gf.batch([('mesh_fem', m, 1), ('mesh_im', m, 3)])
+if (not isinstance(R[0], gf.MeshFem) or not isinstance(R[1], gf.MeshIm)):
+  print("Bad objects created by batch"); exit(1)
+
+# A failing command stops the batch with an error on this command.
+try:
+  gf.batch([('mesh_fem', m, 1), ('mesh_get', m, 'no such query')])
+  print("Error not reported"); exit(1)
+except RuntimeError as e:
+  if ('command 1 (mesh_get)' not in str(e)):
+    print("Bad error message:", e); exit(1)
+
+# Vectorized queries on the convexes.
+F = m.outer_faces()
+N = m.normal_of_faces(F)
+for j in range(F.shape[1]):
+  if (np.linalg.norm(N[:,j] - m.normal_of_face(F[0,j], F[1,j], 1)) > 1e-12):
+    print("Bad normal of faces"); exit(1)
+if (np.linalg.norm(m.normal_of_faces(F, 1) - N) > 1e-12):
+  print("Bad normal of faces"); exit(1)
+
+CVF = m.faces_from_cvid()
+A = m.adjacent_faces(CVF)
+if (A.shape != CVF.shape): print("Bad adjacent faces"); exit(1)
+for j in range(CVF.shape[1]):
+  a = m.adjacent_face(CVF[0,j], CVF[1,j])
+  if (a.size == 0):
+    if (A[0,j] != -1 or A[1,j] != -1): print("Bad adjacent faces"); exit(1)
+  elif (np.any(A[:,j] != a[:,0])):
+    print("Bad adjacent faces"); exit(1)
+if (np.count_nonzero(A[0] == -1) != F.shape[1]):
+  print("Bad adjacent faces"); exit(1)
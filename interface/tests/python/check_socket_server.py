@@ -0,0 +1,210 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 2.1 of the License,  or
+# (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+############################################################################
+"""  Test of the getfem_socket_server.
+
+  This program is used to check that the commands sent to the
+  getfem_socket_server through a Unix-domain socket, pipelined or not,
+  give the same results as the direct calls, that large arrays go through
+  shared memory, that the sessions have separate workspaces, that the
+  socket is private, that malformed arrays are rejected and that the
+  shared memory segments of the unread replies are removed.
+
+  $Id$
+"""
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+import numpy as np
+
+import getfem as gf
+import getfem_client as gfc
+
+server = os.path.join(os.path.dirname(os.path.abspath(sys.argv[0])),
+                      '../../src/getfem_socket_server')
+if not os.path.isfile(server):
+  print("getfem_socket_server not built, test skipped"); exit(77)
+
+path = os.path.join(tempfile.mkdtemp(), 'getfem.sock')
+proc = subprocess.Popen([server, '-shm', '4096', path],
+                        stdout=subprocess.DEVNULL)
+for i in range(100):
+  if os.path.exists(path): break
+  time.sleep(0.05)
+
+def solve(c, NX):
+  X = np.arange(0, 1+1./NX, 1./NX)
+  m = c.call('mesh', 'cartesian', X, X)
+  mf = c.call('mesh_fem', m, 1)
+  mim = c.call('mesh_im', m, 4)
+  md = c.call('model', 'real')
+  R = c.pipeline([('mesh_fem_set', mf, 'classical fem', 2),
+                  ('model_set', md, 'add fem variable', 'u', mf),
+                  ('model_set', md, 'add Laplacian brick', mim, 'u'),
+                  ('model_set', md, 'add initialized data', 'f', [1.]),
+                  ('model_set', md, 'add source term brick', mim, 'u', 'f'),
+                  ('model_set', md, 'add Dirichlet condition with multipliers',
+                   mim, 'u', mf, -1),
+                  ('model_get', md, 'solve'),
+                  ('model_get', md, 'variable', 'u')])
+  return R[-1]
+
+def solve_direct(NX):
+  X = np.arange(0, 1+1./NX, 1./NX)
+  m = gf.Mesh('cartesian', X, X)
+  mf = gf.MeshFem(m, 1); mf.set_classical_fem(2)
+  mim = gf.MeshIm(m, 4)
+  md = gf.Model('real')
+  md.add_fem_variable('u', mf)
+  md.add_Laplacian_brick(mim, 'u')
+  md.add_initialized_data('f', [1.])
+  md.add_source_term_brick(mim, 'u', 'f')
+  md.add_Dirichlet_condition_with_multipliers(mim, 'u', mf, -1)
+  md.solve()
+  return md.variable('u')
+
+def raw_request(c, function, first, put_arg):
+  # request function, first on an argument encoded by put_arg
+  e = gfc._Encoder(0, c)
+  e.i32(gfc.PYTHON_INTERFACE); e.i32(-1); e.string(function); e.u32(2)
+  e.array(first)
+  put_arg(e)
+  frame = struct.pack('=IIQ', gfc.REQUEST, c.next_id, len(e.buf)) + e.buf
+  rid, payload = c._exchange(bytes(frame), 1)[0]
+  c.next_id += 1
+  d = gfc._Decoder(payload)
+  status = d.i32(); d.string()
+  return (status, d.string() if status else '') # status and error message
+
+def sparse_request(c, ir, jc):
+  # request 'spmat', 'copy' on a 2x2 sparse matrix given by ir and jc
+  def put_arg(e):
+    e.header(gfc.GFI_SPARSE, [2, 2])
+    e.block(np.array(ir, dtype=np.int32))
+    e.block(np.array(jc, dtype=np.int32))
+    e.block(np.ones(len(ir)))
+  return raw_request(c, 'spmat', 'copy', put_arg)[0]
+
+def malformed(r):
+  return r[0] != 0 and 'malformed argument' in r[1]
+
+def nested_cells(depth):
+  def put_arg(e):
+    for i in range(depth): e.header(gfc.GFI_CELL, [1]); e.u32(1)
+    e.array(1.)
+  return put_arg
+
+try:
+  if (os.stat(path).st_mode & 0o777) != 0o600:
+    print("The socket is accessible to other users"); exit(1)
+
+  with gfc.Client(path, shm_threshold=4096) as c:
+    # the names of the shared memory segments come from the server
+    if not c.shm_prefix.startswith('/gfi-'):
+      print("Bad shared memory prefix"); exit(1)
+    # small and large arrays (sent in shared memory) are returned unchanged
+    m = c.call('mesh', 'empty', 2)
+    P = np.random.rand(2, 2000)
+    c.call('mesh_set', m, 'add point', P)
+    if (np.linalg.norm(c.call('mesh_get', m, 'pts') - P) != 0. or
+        c.call('mesh_get', m, 'nbpts') != 2000):
+      print("Bad arrays through the socket"); exit(1)
+    if (c.call('util', 'trace level') is None): print("Bad output"); exit(1)
+
+    # pipelined requests
+    U = solve(c, 10)
+    if (np.linalg.norm(U - solve_direct(10)) > 1e-10):
+      print("Bad pipelined results"); exit(1)
+
+    # errors
+    try:
+      c.pipeline([('mesh_get', m, 'nbpts'), ('mesh_get', m, 'no such query')])
+      print("Error not reported"); exit(1)
+    except gfc.Error:
+      pass
+    if (c.call('mesh_get', m, 'nbpts') != 2000):
+      print("Session lost after an error"); exit(1)
+
+    # the compressed columns of the sparse arrays are checked
+    if sparse_request(c, [0, 1], [0, 1, 2]) != 0:
+      print("Valid sparse array rejected"); exit(1)
+    for ir, jc in [([0, 2], [0, 1, 2]),   # row index out of range
+                   ([0, 1], [0, 2, 1]),   # decreasing column starts
+                   ([0, 1], [1, 1, 2]),   # first column start not 0
+                   ([0, 1], [0, 1, 3])]:  # more entries than ir
+      if sparse_request(c, ir, jc) == 0:
+        print("Invalid sparse array accepted"); exit(1)
+    if (c.call('mesh_get', m, 'nbpts') != 2000):
+      print("Session lost after a malformed request"); exit(1)
+
+    # the number of elements of the arrays has to fit in an uint32
+    def put_dims(dims, cplx):
+      return lambda e: (e.header(gfc.GFI_DOUBLE, dims, cplx), e.block(b''))
+    for dims, cplx in [([65536, 65536], 0), ([1 << 16] * 8, 0),
+                       ([1 << 31], 1)]:
+      if not malformed(raw_request(c, 'util', 'trace level',
+                                   put_dims(dims, cplx))):
+        print("Array with too many elements accepted"); exit(1)
+    # the nesting of the cells is limited
+    if malformed(raw_request(c, 'util', 'trace level', nested_cells(10))):
+      print("Nested cells rejected"); exit(1)
+    if not malformed(raw_request(c, 'util', 'trace level',
+                                 nested_cells(100000))):
+      print("Too deeply nested cells accepted"); exit(1)
+
+    # the segments of a reply which the client fails to read are removed
+    array = gfc._Decoder.array
+    def failing_array(d): raise gfc.Error('decoding failure')
+    gfc._Decoder.array = failing_array
+    try:
+      c.call('mesh_get', m, 'pts')
+      print("Decoding failure not reported"); exit(1)
+    except gfc.Error:
+      pass
+    finally:
+      gfc._Decoder.array = array
+    prefix = os.path.basename(c.shm_prefix) + '-s'
+    if [n for n in os.listdir('/dev/shm') if n.startswith(prefix)]:
+      print("Shared memory segments left after a decoding failure"); exit(1)
+    if (c.call('mesh_get', m, 'nbpts') != 2000):
+      print("Session lost after a decoding failure"); exit(1)
+
+  # concurrent sessions, with separate workspaces
+  results = {}
+  def session(k):
+    with gfc.Client(path) as c:
+      results[k] = (solve(c, 6 + k), c.call('mesh', 'empty', 2))
+  threads = [threading.Thread(target=session, args=(k,)) for k in range(3)]
+  for t in threads: t.start()
+  for t in threads: t.join()
+  for k in range(3):
+    if (np.linalg.norm(results[k][0] - solve_direct(6 + k)) > 1e-10):
+      print("Bad result in session", k); exit(1)
+    if (results[k][1] != results[0][1]):
+      print("The sessions do not have separate workspaces"); exit(1)
+finally:
+  proc.terminate()
+  proc.wait()
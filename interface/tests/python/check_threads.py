@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 2.1 of the License,  or
+# (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+############################################################################
+"""  Test of the use of the interface from several python threads.
+
+  This program is used to check that independent models can be built,
+  solved and deleted from several python threads (the commands running
+  some code of the library are executed one at a time), and that the
+  bookkeeping of the workspace is not blocked by a long command of
+  another thread.
+
+  $Id$
+"""
+import threading
+import time
+
+import numpy as np
+
+import getfem as gf
+
+def solve(k, NX = 12):
+  m = gf.Mesh('cartesian', np.arange(0,1+1./NX,1./NX),
+                           np.arange(0,1+1./NX,1./NX))
+  mf = gf.MeshFem(m, 1); mf.set_classical_fem(2)
+  mim = gf.MeshIm(m, 4)
+  md = gf.Model('real')
+  md.add_fem_variable('u', mf)
+  md.add_Laplacian_brick(mim, 'u')
+  md.add_initialized_data('f', [float(k+1)])
+  md.add_source_term_brick(mim, 'u', 'f')
+  md.add_Dirichlet_condition_with_multipliers(mim, 'u', mf, -1)
+  md.solve()
+  return md.variable('u')
+
+ref = [solve(k) for k in range(4)]
+
+results = {}
+errors = []
+def worker(k):
+  try:
+    for it in range(3): results[k] = solve(k)
+  except Exception as e:
+    errors.append(e)
+
+threads = [threading.Thread(target=worker, args=(k,)) for k in range(4)]
+for t in threads: t.start()
+for t in threads: t.join()
+
+if errors: print(errors); exit(1)
+for k in range(4):
+  if np.linalg.norm(results[k] - ref[k]) > 1e-10:
+    print("Bad result in thread", k); exit(1)
+
+# A command of the workspace runs while a long solve is executed by
+# another thread (only the lock of the library is held by the solve).
+solving = threading.Event()
+solved = threading.Event()
+def long_solve():
+  m = gf.Mesh('cartesian', np.arange(0,1+1./150,1./150),
+                           np.arange(0,1+1./150,1./150))
+  mf = gf.MeshFem(m, 1); mf.set_classical_fem(2)
+  mim = gf.MeshIm(m, 4)
+  md = gf.Model('real')
+  md.add_fem_variable('u', mf)
+  md.add_Laplacian_brick(mim, 'u')
+  md.add_initialized_data('f', [1.])
+  md.add_source_term_brick(mim, 'u', 'f')
+  md.add_Dirichlet_condition_with_multipliers(mim, 'u', mf, -1)
+  solving.set()
+  md.solve()
+  solved.set()
+
+m0 = gf.Mesh('empty', 1)
+t = threading.Thread(target=long_solve)
+t.start()
+solving.wait(); time.sleep(0.1)
+if not solved.is_set():
+  nb = 0
+  while not solved.is_set() and nb < 100:
+    if gf.getfem('workspace', 'class name', m0) != 'gfMesh':
+      print("Bad class name"); exit(1)
+    nb += 1
+  if nb < 2:
+    print("The workspace is blocked by the command of another thread")
+    exit(1)
+t.join()
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Python GetFEM interface
+#
+# Copyright (C) 2022-2022 Yves Renard.
+#
+# This file is a part of GetFEM
+#
+# GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+# under  the  terms  of the  GNU  Lesser General Public License as published
+# by  the  Free Software Foundation;  either version 2.1 of the License,  or
+# (at your option) any later version.
+# This program  is  distributed  in  the  hope  that it will be useful,  but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+# License for more details.
+# You  should  have received a copy of the GNU Lesser General Public License
+# along  with  this program;  if not, write to the Free Software Foundation,
+# Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+############################################################################
+"""  Test of the arrays returned without copy.
+
+  This program is used to check that the arrays returned by the
+  Python-GetFEM interface take over the memory allocated by GetFEM, and
+  that the views on sparse matrices remain valid as long as they are
+  used, whatever happens to their matrix.
+
+  $Id$
+"""
+import gc
+
+import numpy as np
+import scipy.sparse as sp
+
+import getfem as gf
+
+NX = 10
+m = gf.Mesh('cartesian', np.arange(0,1+1./NX,1./NX),
+                         np.arange(0,1+1./NX,1./NX))
+mf = gf.MeshFem(m, 1); mf.set_classical_fem(2)
+mim = gf.MeshIm(m, 4)
+nbd = mf.nbdof()
+
+# Ordinary outputs: the numpy array owns the data coming from GetFEM.
+P = mf.basic_dof_nodes()
+if (P.shape != (2, nbd) or P.base is None or not P.flags.writeable):
+  print("Bad output array"); exit(1)
+P[0,0] = 12.
+if (P[0,0] != 12.): print("Bad output array"); exit(1)
+
+# Views on the CSC storage of a sparse matrix.
+K = gf.asm_laplacian(mim, mf, mf, np.ones(nbd))
+K.to_csc()
+JC, IR, VAL = K.csc_view()
+if (VAL.flags.writeable or JC.shape != (nbd+1,) or VAL.shape != (K.nnz(),)):
+  print("Bad sparse view"); exit(1)
+S = sp.csc_matrix((VAL, IR, JC), shape=K.size())
+if (np.linalg.norm(S.toarray() - K.full()) > 1e-12):
+  print("Bad sparse view"); exit(1)
+F = K.full()
+K.to_wsc()                  # K leaves the storage shared with the views
+K.add(range(nbd), range(nbd), np.eye(nbd))
+del K; gc.collect()
+if (np.linalg.norm(S.toarray() - F) > 1e-12):
+  print("Bad sparse view"); exit(1)
@@ -177,6 +177,14 @@ namespace bgeot {
       }
       return true;
     }
+    size_t hash() const override {
+      size_t h = dal::hash_combine(static_stored_object_key::hash(),
+                                   pspt->size());
+      for (const base_node &pt : *pspt)
+        for (const scalar_type &x : pt)
+          h = dal::hash_combine(h, std::hash<scalar_type>()(x));
+      return h;
+    }
     stored_point_tab_key(const stored_point_tab *p) : pspt(p) {}
   };
 
@@ -240,6 +248,12 @@ namespace bgeot {
       if (nf != o.nf) return false;
       return true;
     }
+    size_t hash() const override{
+      size_t h = dal::hash_combine(static_stored_object_key::hash(), type);
+      h = dal::hash_combine(h, N);
+      h = dal::hash_combine(h, K);
+      return dal::hash_combine(h, nf);
+    }
     convex_of_reference_key(int t, dim_type NN, short_type KK = 0,
                             short_type nnf = 0)
       : type(t), N(NN), K(KK), nf(nnf) {}
@@ -103,6 +103,12 @@ namespace bgeot {
       if (nf != o.nf) return false;
       return true;
     }
+    size_t hash() const override{
+      size_t h = dal::hash_combine(static_stored_object_key::hash(), type);
+      h = dal::hash_combine(h, N);
+      h = dal::hash_combine(h, K);
+      return dal::hash_combine(h, nf);
+    }
     convex_structure_key(int t, dim_type NN, short_type KK = 0,
                          short_type nnf = 0)
       : type(t), N(NN), K(KK), nf(nnf)  {}
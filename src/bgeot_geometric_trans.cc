@@ -436,7 +436,10 @@ namespace bgeot {
       if (!pgt()->is_linear()) {
         base_matrix B2(P*P, P), Htau(N_, P*P);
         if (have_pgp()) {
-          gmm::mult(G(), pgp_->hessian(ii_), Htau);
+          const packed_tensor_tab &hpc = pgp_->hessians();
+          PC.base_resize(pgt()->nb_points(), P*P);
+          std::copy(hpc[ii_], hpc[ii_] + hpc.tensor_size(), PC.begin());
+          gmm::mult(G(), PC, Htau);
         } else {
           /* very inefficient of course... */
           PC.base_resize(pgt()->nb_points(), P*P);
@@ -504,6 +507,13 @@ namespace bgeot {
     mutable std::vector<std::vector<FUNC>> grad_, hess_;
     mutable bool grad_computed_ = false;
     mutable bool hess_computed_ = false;
+    // evaluation of all the functions and derivatives together
+    // (only for the polynomial transformations)
+    mutable polynomial_family<opt_long_scalar_type>
+      val_family_, grad_family_, hess_family_;
+    mutable bool families_computed_ = false, families_valid_ = false;
+
+    void compute_families_() const; // defined for the polynomials
 
     void compute_grad_() const {
       if (grad_computed_) return;
@@ -590,6 +600,82 @@ namespace bgeot {
 
   };
 
+  template<> void igeometric_trans<base_poly>::compute_families_() const {
+    if (families_computed_) return;
+    GLOBAL_OMP_GUARD
+    if (families_computed_) return;
+    compute_grad_(); compute_hess_();
+    size_type R = trans.size();
+    families_valid_ =
+      val_family_.init(R, [&](size_type l) -> const base_poly &
+                       { return trans[l]; }) &&
+      grad_family_.init(R*dim(), [&](size_type l) -> const base_poly &
+                        { return grad_[l%R][l/R]; }) &&
+      hess_family_.init(R*dim()*dim(), [&](size_type l) -> const base_poly &
+                        { return hess_[l%R][l/R]; });
+    families_computed_ = true;
+  }
+
+  static inline void
+  eval_family(const polynomial_family<opt_long_scalar_type> &f,
+              const base_node &pt, std::vector<scalar_type> &v,
+              std::true_type)
+  { f.eval(pt.begin(), &v[0]); }
+
+  static inline void
+  eval_family(const polynomial_family<opt_long_scalar_type> &f,
+              const base_node &pt, std::vector<scalar_type> &v,
+              std::false_type) {
+    std::vector<opt_long_scalar_type> w(f.size());
+    f.eval(pt.begin(), &w[0]);
+    for (size_type i = 0; i < w.size(); ++i) v[i] = to_scalar(w[i]);
+  }
+
+  static inline void
+  eval_family(const polynomial_family<opt_long_scalar_type> &f,
+              const base_node &pt, std::vector<scalar_type> &v) {
+    eval_family(f, pt, v,
+                std::is_same<opt_long_scalar_type, scalar_type>());
+  }
+
+  template<> void igeometric_trans<base_poly>::poly_vector_val
+  (const base_node &pt, base_vector &val) const {
+    val.resize(nb_points());
+    if (!families_computed_) compute_families_();
+    if (families_valid_ && nb_points())
+      { eval_family(val_family_, pt, val); return; }
+    for (size_type k = 0; k < nb_points(); ++k)
+      val[k] = to_scalar(trans[k].eval(pt.begin()));
+  }
+
+  template<> void igeometric_trans<base_poly>::poly_vector_grad
+  (const base_node &pt, base_matrix &pc) const {
+    pc.base_resize(nb_points(),dim());
+    if (!families_computed_) compute_families_();
+    if (families_valid_ && pc.size()) {
+      eval_family(grad_family_, pt, pc.as_vector()); return;
+    }
+    for (size_type i = 0; i < nb_points(); ++i)
+      for (dim_type n = 0; n < dim(); ++n)
+        pc(i, n) = to_scalar(grad_[i][n].eval(pt.begin()));
+  }
+
+  template<> void igeometric_trans<base_poly>::poly_vector_hess
+  (const base_node &pt, base_matrix &pc) const {
+    pc.base_resize(nb_points(),dim()*dim());
+    if (!families_computed_) compute_families_();
+    // the hessians are symmetric: pc(i, n*dim()+m) = hess_[i][m*dim()+n]
+    if (families_valid_ && pc.size()) {
+      eval_family(hess_family_, pt, pc.as_vector()); return;
+    }
+    for (size_type i = 0; i < nb_points(); ++i)
+      for (dim_type n = 0; n < dim(); ++n) {
+        for (dim_type m = 0; m <= n; ++m)
+          pc(i, n*dim()+m) = pc(i, m*dim()+n) =
+            to_scalar(hess_[i][m*dim()+n].eval(pt.begin()));
+      }
+  }
+
   typedef igeometric_trans<base_poly> poly_geometric_trans;
   typedef igeometric_trans<polynomial_composite> comppoly_geometric_trans;
   typedef igeometric_trans<base_rational_fraction> fraction_geometric_trans;
@@ -1340,37 +1426,83 @@ namespace bgeot {
   { DAL_STORED_OBJECT_DEBUG_CREATED(this, "Geotrans precomp"); }
 
   void geotrans_precomp_::init_val() const {
-    c.clear();
-    c.resize(pspt->size(), base_vector(pgt->nb_points()));
+    size_t memsize = cache_memsize();
+    base_vector v(pgt->nb_points());
+    multi_index mi(1); mi[0] = pgt->nb_points();
+    c.init(pspt->size(), mi);
     for (size_type j = 0; j < pspt->size(); ++j)
-      pgt->poly_vector_val((*pspt)[j], c[j]);
+      { pgt->poly_vector_val((*pspt)[j], v); c.set(j, v); }
+    cache_memsize_changed(memsize);
   }
 
   void geotrans_precomp_::init_grad() const {
+    size_t memsize = cache_memsize();
     dim_type N = pgt->dim();
-    pc.clear();
-    pc.resize(pspt->size(), base_matrix(pgt->nb_points() , N));
+    base_matrix m(pgt->nb_points(), N);
+    pc.init(pspt->size(), multi_index(pgt->nb_points(), N));
     for (size_type j = 0; j < pspt->size(); ++j)
-      pgt->poly_vector_grad((*pspt)[j], pc[j]);
+      { pgt->poly_vector_grad((*pspt)[j], m); pc.set(j, m); }
+    cache_memsize_changed(memsize);
   }
 
   void geotrans_precomp_::init_hess() const {
-    base_poly P, Q;
+    size_t memsize = cache_memsize();
     dim_type N = pgt->structure()->dim();
-    hpc.clear();
-    hpc.resize(pspt->size(), base_matrix(pgt->nb_points(), gmm::sqr(N)));
+    base_matrix m(pgt->nb_points(), gmm::sqr(N));
+    hpc.init(pspt->size(), multi_index(pgt->nb_points(), gmm::sqr(N)));
     for (size_type j = 0; j < pspt->size(); ++j)
-      pgt->poly_vector_hess((*pspt)[j], hpc[j]);
+      { pgt->poly_vector_hess((*pspt)[j], m); hpc.set(j, m); }
+    cache_memsize_changed(memsize);
+  }
+
+  static void unpack_matrices(const packed_tensor_tab &t,
+                              std::vector<base_matrix> &v) {
+    v.resize(t.size());
+    for (size_type i = 0; i < t.size(); ++i) {
+      v[i].base_resize(t.sizes()[0], t.sizes()[1]);
+      std::copy(t[i], t[i] + t.tensor_size(), v[i].begin());
+    }
+  }
+
+  void geotrans_precomp_::unpack_val() const {
+    size_t memsize = cache_memsize();
+    const packed_tensor_tab &t = vals();
+    c_pts.resize(t.size());
+    for (size_type i = 0; i < t.size(); ++i)
+      c_pts[i] = base_vector(t[i], t[i] + t.tensor_size());
+    cache_memsize_changed(memsize);
+  }
+
+  void geotrans_precomp_::unpack_grad() const {
+    size_t memsize = cache_memsize();
+    unpack_matrices(grads(), pc_pts);
+    cache_memsize_changed(memsize);
+  }
+
+  void geotrans_precomp_::unpack_hess() const {
+    size_t memsize = cache_memsize();
+    unpack_matrices(hessians(), hpc_pts);
+    cache_memsize_changed(memsize);
+  }
+
+  size_t geotrans_precomp_::cache_memsize() const {
+    size_t memsize = c.memsize() + pc.memsize() + hpc.memsize();
+    for (const base_vector &v : c_pts)
+      memsize += v.capacity() * sizeof(scalar_type);
+    for (const std::vector<base_matrix> *pv : {&pc_pts, &hpc_pts})
+      for (const base_matrix &m : *pv)
+        memsize += m.capacity() * sizeof(scalar_type);
+    return memsize;
   }
 
   base_node geotrans_precomp_::transform(size_type i,
                                          const base_matrix &G) const {
-    if (c.empty()) init_val();
+    const scalar_type *ci = vals()[i];
     size_type N = G.nrows(), k = pgt->nb_points();
     base_node P(N);
     base_matrix::const_iterator git = G.begin();
     for (size_type l = 0; l < k; ++l) {
-      scalar_type a = c[i][l];
+      scalar_type a = ci[l];
       base_node::iterator pit = P.begin(), pite = P.end();
       for (; pit != pite; ++git, ++pit) *pit += a * (*git);
     }
@@ -91,6 +91,91 @@ namespace bgeot
            (gmm::vect_norm2(y) < IN_EPS);
   }
 
+  /* Closed form inversion of a linear transformation for a set of
+     packed points: x_ref = B^T (x - G_0) and the residual
+     |(x - G_0) - K x_ref|^2 which is non zero when P < N. The sizes are
+     template parameters for the usual dimensions so that the loops on
+     the points can be vectorized. */
+  template <size_type NN, size_type PP>
+  static void invert_lin_packed_(size_type N, size_type P,
+                                 const scalar_type *x, size_type nbpt,
+                                 const scalar_type *g0,
+                                 const scalar_type *BT,
+                                 const scalar_type *KK,
+                                 scalar_type *xr, scalar_type *res) {
+    if (NN) N = NN;
+    if (PP) P = PP;
+    scalar_type y[NN ? NN : 1];
+    std::vector<scalar_type> yv(NN ? 0 : N);
+    scalar_type *py = NN ? y : yv.data();
+    for (size_type i = 0; i < nbpt; ++i, x += N, xr += P) {
+      for (size_type k = 0; k < N; ++k) py[k] = x[k] - g0[k];
+      for (size_type l = 0; l < P; ++l) {
+        scalar_type a(0);
+        for (size_type k = 0; k < N; ++k) a += BT[l*N+k] * py[k];
+        xr[l] = a;
+      }
+      scalar_type r(0);
+      for (size_type k = 0; k < N; ++k) {
+        scalar_type a = py[k];
+        for (size_type l = 0; l < P; ++l) a -= KK[k*P+l] * xr[l];
+        r += a*a;
+      }
+      res[i] = r;
+    }
+  }
+
+  size_type geotrans_inv_convex::invert_packed(const std::vector<scalar_type> &xx,
+                                               std::vector<base_node> &pts_ref,
+                                               dal::bit_vector &isin,
+                                               dal::bit_vector &converged,
+                                               scalar_type IN_EPS,
+                                               bool project_into_element) {
+    assert(pgt);
+    size_type nbpt = (N == 0) ? 0 : xx.size() / N, nbin = 0;
+    isin.clear(); converged.clear();
+    pts_ref.resize(nbpt);
+
+    if (pgt->is_linear()) {
+      std::vector<scalar_type> g0(N), BT(P*N), KK(N*P), xr(nbpt*P), res(nbpt);
+      base_matrix KG(N, P);
+      gmm::mult(G, pc, KG);
+      for (size_type k = 0; k < N; ++k) {
+        g0[k] = G(k, 0);
+        for (size_type l = 0; l < P; ++l)
+          { BT[l*N+k] = B(k, l); KK[k*P+l] = KG(k, l); }
+      }
+      auto f = &invert_lin_packed_<0, 0>;
+      if (N == 2 && P == 2) f = &invert_lin_packed_<2, 2>;
+      else if (N == 3 && P == 3) f = &invert_lin_packed_<3, 3>;
+      else if (N == 3 && P == 2) f = &invert_lin_packed_<3, 2>;
+      else if (N == 2 && P == 1) f = &invert_lin_packed_<2, 1>;
+      else if (N == 1 && P == 1) f = &invert_lin_packed_<1, 1>;
+      (*f)(N, P, xx.data(), nbpt, g0.data(), BT.data(), KK.data(),
+           xr.data(), res.data());
+      converged.add(0, nbpt);
+      for (size_type i = 0; i < nbpt; ++i) {
+        base_node &n_ref = pts_ref[i];
+        n_ref.resize(P);
+        std::copy(xr.begin() + i*P, xr.begin() + (i+1)*P, n_ref.begin());
+        if (pgt->convex_ref()->is_in(n_ref) < IN_EPS && res[i] < IN_EPS*IN_EPS)
+          { isin.add(i); ++nbin; }
+      }
+    } else {
+      base_node n(N);
+      for (size_type i = 0; i < nbpt; ++i) {
+        std::copy(xx.begin() + i*N, xx.begin() + (i+1)*N, n.begin());
+        bool conv = true;
+        pts_ref[i].resize(P);
+        if (invert_nonlin(n, pts_ref[i], IN_EPS, conv, false,
+                          project_into_element))
+          { isin.add(i); ++nbin; }
+        if (conv) converged.add(i);
+      }
+    }
+    return nbin;
+  }
+
   void geotrans_inv_convex::update_B() {
     if (P != N) {
       pgt->compute_K_matrix(G, pc, K);
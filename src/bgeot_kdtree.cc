@@ -20,253 +20,345 @@
 ===========================================================================*/
 
 
+
 #include "getfem/bgeot_kdtree.h"
+#include "getfem/getfem_omp.h"
 
 namespace bgeot {
-  
-  /* leafs contains a list of points */
-  struct kdtree_leaf : public kdtree_elt_base {
-    kdtree_tab_type::const_iterator it;
-    kdtree_leaf(kdtree_tab_type::const_iterator begin, 
-		kdtree_tab_type::const_iterator end) : 
-      kdtree_elt_base(unsigned(std::distance(begin,end))) { it = begin; }
-  };
-  
-  struct kdtree_node : public kdtree_elt_base {
-    scalar_type split_v;
-    std::unique_ptr<kdtree_elt_base> left, right; /* left: <=v, right: >v */
-    kdtree_node(scalar_type v, std::unique_ptr<kdtree_elt_base> &&left_,
-		std::unique_ptr<kdtree_elt_base> &&right_) : 
-      kdtree_elt_base(0), split_v(v),
-      left(std::move(left_)), right(std::move(right_)) {}
-  };
 
-  typedef kdtree_tab_type::iterator ITER;
-  
-  /* sorting of kdtree_tab_type with respect to a component of the points */
-  struct component_sort {
-    unsigned dir; 
-    component_sort(unsigned d) : dir(d) {}
-    bool operator()(const index_node_pair& a, const index_node_pair& b) 
-    { return a.n.at(dir) < b.n.at(dir); }
-  };
-  /* splitting of kdtree_tab_type with respect to a given value */
-  /*struct component_split { 
-    unsigned dir; scalar_type v;
-    component_split(unsigned d, scalar_type v_) : dir(d), v(v_) {}
-    bool operator()(const index_node_pair& a) 
-    { return (a.n.at(dir) <= v); }
-  };
-  */
-
-  static ITER partition(ITER begin, ITER end, unsigned dir, scalar_type median) {
-    --end;
-    do {
-      while (begin <= end && (*begin).n.at(dir) <= median) ++begin; 
-      while (begin <= end && (*end).n.at(dir) > median) --end;
-      if (begin < end) { begin->swap(*end); ++begin; --end; } else break;
-    } while (1);
-    return begin;
-  }
-  /* 
-     build (recursively) a complete tree for points in the interval
-     [begin, end[ dir is the splitting direction.
-     (may be ameliorated doing a single sort on each component at the begining)
-  */
-  static std::unique_ptr<kdtree_elt_base> build_tree_(ITER begin,
-						      ITER end, unsigned dir) {
-    if (begin == end) return 0;
-    size_type npts = std::distance(begin,end);
-    if (npts > kdtree_elt_base::PTS_PER_LEAF) {
-      ITER itmedian;
-      scalar_type median;
-      size_type N = begin->n.size();
-      unsigned ndir_tests = unsigned(dir/N); dir = unsigned(dir % N);
-      if (npts > 50) {
-	/* too much points for an exact median: estimation of the median .. */
-        std::vector<index_node_pair> v(30);
-        //random_sample(begin,end,v.begin(),v.end());
-	for (size_type i=0; i < v.size(); ++i) 
-	  v[i] = begin[rand() % npts];
-        std::sort(v.begin(), v.end(), component_sort(dir));
-        median = (v[v.size()/2-1].n.at(dir)+v[v.size()/2].n.at(dir))/2;
-        //itmedian = std::partition(begin,end,component_split(dir, median));
-	itmedian = partition(begin,end,dir,median);
-	/*ITER it = begin; cout << "}"; while (it < end) { 
-	  if (it == itmedian) cout << "<|>"; else cout << " ";
-	  cout << (*it).n[dir];
-	  ++it;
-	  } cout << "}\n";*/
+  enum { PTS_PER_LEAF = kdtree_flat_node::PTS_PER_LEAF };
 
-      } else {
-	/* exact median computation */
-        std::sort(begin, end, component_sort(dir));
-        itmedian = begin + npts/2 - 1;
-        median = (*itmedian).n[dir];
-        while (itmedian < end && (*itmedian).n[dir] == median) itmedian++;
-      }
-      if (itmedian == end) /* could not split the set (all points have same value for component 'dir' !) */
-	if (ndir_tests == N-1) /* tested all N direction ? so all points are strictly the same */
-	  return std::make_unique<kdtree_leaf>(begin,end); 
-        else return std::make_unique<kdtree_node>
-	       (median, 
-		build_tree_(begin, itmedian, unsigned((dir+1)%N + (ndir_tests+1)*N)), std::unique_ptr<kdtree_node>());
-      else { /* the general case */
-	assert((*itmedian).n[dir] >= median && median >= (*(itmedian-1)).n[dir]);
-	return std::make_unique<kdtree_node>
-	  (median, build_tree_(begin, itmedian, unsigned((dir+1)%N)), 
-	   build_tree_(itmedian,end, unsigned((dir+1)%N)));
-      }
-    } else {
-      return std::make_unique<kdtree_leaf>(begin,end);
+  /* number of nodes of a tree built on n points. The sizes of the
+     sub-trees of a same level differ at most by one, so that the
+     memoization keeps this computation in O(log(n)). */
+  struct kdtree_node_count {
+    std::map<size_type, size_type> memo;
+    size_type operator()(size_type n) {
+      if (n <= PTS_PER_LEAF) return 1;
+      auto it = memo.find(n);
+      if (it != memo.end()) return it->second;
+      size_type nb = 1 + (*this)(n/2) + (*this)(n - n/2);
+      memo[n] = nb;
+      return nb;
     }
-  }
+  };
 
-  /* avoid pushing too much arguments on the stack for points_in_box_ */
-  struct points_in_box_data_ {
-    base_node::const_iterator bmin;
-    base_node::const_iterator bmax;
-    kdtree_tab_type *ipts;
+  /* data shared by the build of the different sub-trees */
+  struct kdtree_build_data_ {
+    const scalar_type *c; /* coordinates in the original order */
     size_type N;
+    std::vector<size_type> &perm;
+    std::vector<kdtree_flat_node> &nodes;
+    kdtree_build_data_(const scalar_type *c_, size_type N_,
+                       std::vector<size_type> &p,
+                       std::vector<kdtree_flat_node> &nd)
+      : c(c_), N(N_), perm(p), nodes(nd) {}
   };
 
-  /* recursive lookup for points inside a given box */
-  static void points_in_box_(const points_in_box_data_& p,
-			     const kdtree_elt_base *t, unsigned dir) {
-    if (!t->isleaf()) {
-      const kdtree_node *tn = static_cast<const kdtree_node*>(t);
-      if (p.bmin[dir] <= tn->split_v && tn->left.get())
-        points_in_box_(p, tn->left.get(), unsigned((dir+1)%p.N));
-      if (p.bmax[dir] > tn->split_v && tn->right)
-        points_in_box_(p, tn->right.get(), unsigned((dir+1)%p.N));
-    } else {
-      const kdtree_leaf *tl = static_cast<const kdtree_leaf*>(t);
-      kdtree_tab_type::const_iterator itpt = tl->it;
-      for (size_type i=tl->n;i; --i, ++itpt) {
-        bool is_in = true;
-        base_node::const_iterator it=itpt->n.const_begin();
-        for (size_type k=0; k < p.N; ++k) {
-	  //cout << "test: k=" << k << ", " << it[k] << ", p.bmin[k]=" << p.bmin[k] << ", p.bmax[k]=" << p.bmax[k] << "\n";
-          if (it[k] < p.bmin[k] || it[k] > p.bmax[k]) {
-	    is_in = false; break; 
-	  }
-        }
-        if (is_in) p.ipts->push_back(*itpt);
+  /* splits the node inode storing the points perm[begin..end[ along
+     the direction of largest extent. Returns false for a leaf. */
+  static bool split_node_(const kdtree_build_data_ &b, size_type inode,
+                          size_type begin, size_type end,
+                          kdtree_node_count &count) {
+    kdtree_flat_node &nd = b.nodes[inode];
+    size_type npts = end - begin;
+    if (npts <= PTS_PER_LEAF) {
+      nd.dir = unsigned(-1); nd.first = begin; nd.last = end;
+      return false;
+    }
+    unsigned dir = 0;
+    scalar_type ext_max(-1);
+    for (size_type k = 0; k < b.N; ++k) {
+      scalar_type vmin = b.c[b.perm[begin]*b.N+k], vmax = vmin;
+      for (size_type i = begin+1; i < end; ++i) {
+        scalar_type v = b.c[b.perm[i]*b.N+k];
+        vmin = std::min(vmin, v); vmax = std::max(vmax, v);
       }
+      if (vmax - vmin > ext_max) { ext_max = vmax - vmin; dir = unsigned(k); }
     }
+    const scalar_type *c = b.c; size_type N = b.N;
+    auto itmedian = b.perm.begin() + (begin + npts/2);
+    std::nth_element(b.perm.begin() + begin, itmedian, b.perm.begin() + end,
+                     [c, N, dir](size_type i, size_type j)
+                     { return c[i*N+dir] < c[j*N+dir]; });
+    nd.dir = dir;
+    nd.split_v = c[(*itmedian)*N+dir];
+    nd.first = begin; nd.last = end;
+    nd.right = inode + 1 + count(npts/2);
+    return true;
   }
 
-  /* avoid pushing too much arguments on the stack for nearest_neighbor_ */
-  struct nearest_neighbor_data_ {
-    base_node::const_iterator pos;
-    index_node_pair *ipt;
-    size_type N;
-    mutable scalar_type dist2;
-    base_node::iterator vec_to_tree_elm;
-  };
+  static void build_subtree_(const kdtree_build_data_ &b, size_type inode,
+                             size_type begin, size_type end,
+                             kdtree_node_count &count) {
+    if (split_node_(b, inode, begin, end, count)) {
+      size_type mid = begin + (end - begin)/2, right = b.nodes[inode].right;
+      build_subtree_(b, inode+1, begin, mid, count);
+      build_subtree_(b, right, mid, end, count);
+    }
+  }
 
-  /* recursive lookup for the nearest neighbor point at a given position */
-  static void nearest_neighbor_assist(const nearest_neighbor_data_& p,
-			              const kdtree_elt_base *t, unsigned dir) {
-    scalar_type dist2(0);
-    for (size_type k=0; k < p.N; ++k)
-      dist2 += p.vec_to_tree_elm[k] * p.vec_to_tree_elm[k];
-    if (dist2 > p.dist2 && p.dist2 > scalar_type(0)) return;
+  void kdtree::clear_tree() {
+    nodes = std::vector<kdtree_flat_node>();
+    coords = std::vector<scalar_type>();
+    tree_built = false;
+  }
 
-    if (!t->isleaf()) {
-      const kdtree_node *tn = static_cast<const kdtree_node*>(t);
-      scalar_type tmp = p.vec_to_tree_elm[dir];
-      scalar_type dist = p.pos[dir] - tn->split_v;
-      if (tn->left.get()) {
-        if (dist > tmp) p.vec_to_tree_elm[dir] = dist;
-        nearest_neighbor_assist(p, tn->left.get(), unsigned((dir+1)%p.N));
-        p.vec_to_tree_elm[dir] = tmp;
-      }
-      if (tn->right) {
-        if (-dist > tmp) p.vec_to_tree_elm[dir] = -dist;
-        nearest_neighbor_assist(p, tn->right.get(), unsigned((dir+1)%p.N));
-        p.vec_to_tree_elm[dir] = tmp;
+  void kdtree::build_tree() {
+    clear_tree();
+    size_type npts = pts.size();
+    if (npts) {
+      std::vector<scalar_type> c(npts*N);
+      std::vector<size_type> perm(npts);
+      for (size_type i = 0; i < npts; ++i) {
+        perm[i] = i;
+        std::copy(pts[i].n.begin(), pts[i].n.end(), c.begin() + i*N);
       }
-    } else {
-      // find the nearest neighbor inside the leaf
-      const kdtree_leaf *tl = static_cast<const kdtree_leaf*>(t);
-      kdtree_tab_type::const_iterator itpt = tl->it;
-      for (size_type i=tl->n;i; --i, ++itpt) {
-        dist2 = scalar_type(0);
-        base_node::const_iterator it=itpt->n.const_begin();
-        for (size_type k=0; k < p.N; ++k) {
-          scalar_type dist = it[k] - p.pos[k];
-          dist2 += dist * dist;
+      kdtree_node_count count;
+      nodes.resize(count(npts));
+      kdtree_build_data_ b(c.data(), N, perm, nodes);
+
+      /* The upper levels are split sequentially until there are enough
+         independent sub-trees to feed the threads. */
+      struct subtree { size_type inode, begin, end; };
+      std::vector<subtree> subtrees(1, subtree{0, 0, npts}), next;
+      size_type nb_min = (npts > 10000) ? 8*getfem::max_concurrency() : 1;
+      while (subtrees.size() < nb_min) {
+        next.resize(0);
+        for (const subtree &st : subtrees) {
+          if (split_node_(b, st.inode, st.begin, st.end, count)) {
+            size_type mid = st.begin + (st.end - st.begin)/2;
+            next.push_back(subtree{st.inode+1, st.begin, mid});
+            next.push_back(subtree{nodes[st.inode].right, mid, st.end});
+          }
         }
-        if (dist2 < p.dist2 || p.dist2 < scalar_type(0)){
-          *(p.ipt) = *itpt;
-          p.dist2 = dist2;
+        if (next.empty()) { subtrees.resize(0); break; }
+        subtrees.swap(next);
+      }
+
+      size_type nbst = subtrees.size();
+      GETFEM_OMP_FOR(size_type ist = 0, ist < nbst, ++ist, {
+        kdtree_node_count lcount;
+        build_subtree_(b, subtrees[ist].inode, subtrees[ist].begin,
+                       subtrees[ist].end, lcount);
+      })
+
+      /* points and coordinates are stored in the tree order */
+      kdtree_tab_type pts2(npts);
+      coords.resize(npts*N);
+      for (size_type i = 0; i < npts; ++i) {
+        pts2[i].swap(pts[perm[i]]);
+        std::copy(c.begin() + perm[i]*N, c.begin() + (perm[i]+1)*N,
+                  coords.begin() + i*N);
+      }
+      pts.swap(pts2);
+    }
+    tree_built = true;
+  }
+
+  /* lookup for points inside a given box */
+  void kdtree::points_in_box_(std::vector<size_type> &ipos,
+                              const scalar_type *bmin,
+                              const scalar_type *bmax) const {
+    size_type stack[128], nst = 0;
+    stack[nst++] = 0;
+    while (nst) {
+      const kdtree_flat_node &nd = nodes[stack[--nst]];
+      if (nd.isleaf()) {
+        for (size_type i = nd.first; i < nd.last; ++i) {
+          const scalar_type *it = &coords[i*N];
+          bool is_in = true;
+          for (size_type k=0; k < N; ++k)
+            if (it[k] < bmin[k] || it[k] > bmax[k]) { is_in = false; break; }
+          if (is_in) ipos.push_back(i);
         }
+      } else {
+        size_type inode = size_type(&nd - &nodes[0]);
+        if (bmax[nd.dir] >= nd.split_v) stack[nst++] = nd.right;
+        if (bmin[nd.dir] <= nd.split_v) stack[nst++] = inode+1;
       }
     }
   }
 
-  static void nearest_neighbor_main(const nearest_neighbor_data_& p,
-			            const kdtree_elt_base *t, unsigned dir) {
-    if (!t->isleaf()) {
-      const kdtree_node *tn = static_cast<const kdtree_node*>(t);
-      scalar_type dist = p.pos[dir] - tn->split_v;
-      if ((dist <= scalar_type(0) && tn->left.get()) || !tn->right.get()) {
-        nearest_neighbor_main(p, tn->left.get(), unsigned((dir+1)%p.N));
-      } else if (tn->right.get()) {
-        nearest_neighbor_main(p, tn->right.get(), unsigned((dir+1)%p.N));
+  /* heap is a max-heap on the distance of the (at most) k points found */
+  void kdtree::k_nearest_(heap_type &heap, const scalar_type *pos,
+                          size_type k) const {
+    struct elt { size_type inode; scalar_type d2; };
+    elt stack[128]; size_type nst = 0;
+    stack[nst++] = elt{0, scalar_type(0)};
+    while (nst) {
+      elt e = stack[--nst];
+      if (heap.size() == k && e.d2 >= heap.front().first) continue;
+      const kdtree_flat_node &nd = nodes[e.inode];
+      if (nd.isleaf()) {
+        for (size_type i = nd.first; i < nd.last; ++i) {
+          const scalar_type *it = &coords[i*N];
+          scalar_type d2(0);
+          for (size_type l=0; l < N; ++l)
+            { scalar_type a = it[l] - pos[l]; d2 += a*a; }
+          if (heap.size() < k) {
+            heap.push_back(std::make_pair(d2, i));
+            std::push_heap(heap.begin(), heap.end());
+          } else if (d2 < heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = std::make_pair(d2, i);
+            std::push_heap(heap.begin(), heap.end());
+          }
+        }
       } else {
-        assert(false);
+        scalar_type diff = pos[nd.dir] - nd.split_v;
+        size_type near = (diff <= scalar_type(0)) ? e.inode+1 : nd.right;
+        size_type far = (diff <= scalar_type(0)) ? nd.right : e.inode+1;
+        stack[nst++] = elt{far, std::max(e.d2, diff*diff)};
+        stack[nst++] = elt{near, e.d2};
       }
-      // check the possibility of points at the opposite side of the current
-      // tree node which are closer to pos as the current minimum distance
-      if (dist * dist <= p.dist2) {
-        for (size_type k=0; k < p.N; ++k) p.vec_to_tree_elm[k] = 0.;
-        if ((dist <= scalar_type(0) && tn->right.get()) || !tn->left.get()) {
-          p.vec_to_tree_elm[dir] = -dist;
-          nearest_neighbor_assist(p, tn->right.get(), unsigned((dir+1)%p.N));
-        } else if (tn->left.get()) {
-          p.vec_to_tree_elm[dir] = dist;
-          nearest_neighbor_assist(p, tn->left.get(), unsigned((dir+1)%p.N));
+    }
+  }
+
+  void kdtree::points_in_ball_(std::vector<size_type> &ipos,
+                               const scalar_type *pos,
+                               scalar_type radius2) const {
+    size_type stack[128], nst = 0;
+    stack[nst++] = 0;
+    while (nst) {
+      size_type inode = stack[--nst];
+      const kdtree_flat_node &nd = nodes[inode];
+      if (nd.isleaf()) {
+        for (size_type i = nd.first; i < nd.last; ++i) {
+          const scalar_type *it = &coords[i*N];
+          scalar_type d2(0);
+          for (size_type l=0; l < N; ++l)
+            { scalar_type a = it[l] - pos[l]; d2 += a*a; }
+          if (d2 <= radius2) ipos.push_back(i);
         }
+      } else {
+        scalar_type diff = pos[nd.dir] - nd.split_v;
+        if (diff >= scalar_type(0) || diff*diff <= radius2)
+          stack[nst++] = nd.right;
+        if (diff <= scalar_type(0) || diff*diff <= radius2)
+          stack[nst++] = inode+1;
       }
-    } else {
-      // find the nearest neighbor inside the leaf which contains pos
-      nearest_neighbor_assist(p, t, dir);
     }
   }
 
-  void kdtree::clear_tree() { tree = std::unique_ptr<kdtree_elt_base>(); }
+  static const scalar_type *coords_of_(const base_node &pt)
+  { return &(*(pt.const_begin())); }
 
   void kdtree::points_in_box(kdtree_tab_type &ipts,
-			     const base_node &min, 
-			     const base_node &max) {
+                             const base_node &min,
+                             const base_node &max) {
     ipts.resize(0);
-    if (tree == 0) { tree = build_tree_(pts.begin(), pts.end(), 0); if (!tree) return; }
-    base_node bmin(min), bmax(max);
-    for (size_type i=0; i < bmin.size(); ++i) if (bmin[i] > bmax[i]) return;
-    points_in_box_data_ p; 
-    p.bmin = bmin.const_begin(); p.bmax = bmax.const_begin();
-    p.ipts = &ipts; p.N = N; 
-    points_in_box_(p, tree.get(), 0);
+    check_tree();
+    if (nodes.empty()) return;
+    for (size_type i=0; i < min.size(); ++i) if (min[i] > max[i]) return;
+    std::vector<size_type> ipos;
+    points_in_box_(ipos, coords_of_(min), coords_of_(max));
+    ipts.resize(ipos.size());
+    for (size_type i=0; i < ipos.size(); ++i) ipts[i] = pts[ipos[i]];
   }
 
   scalar_type kdtree::nearest_neighbor(index_node_pair &ipt,
                                        const base_node &pos) {
-    
     ipt.i = size_type(-1);
-    if (tree == 0) {
-      tree = build_tree_(pts.begin(), pts.end(), 0);
-      if (!tree) return scalar_type(-1);
+    check_tree();
+    if (nodes.empty()) return scalar_type(-1);
+    heap_type heap;
+    k_nearest_(heap, coords_of_(pos), 1);
+    ipt = pts[heap[0].second];
+    return heap[0].first;
+  }
+
+  void kdtree::k_nearest_neighbors(kdtree_tab_type &ipts,
+                                   const base_node &pos, size_type k,
+                                   std::vector<scalar_type> *dist2) {
+    ipts.resize(0); if (dist2) dist2->resize(0);
+    check_tree();
+    if (nodes.empty() || k == 0) return;
+    heap_type heap;
+    k_nearest_(heap, coords_of_(pos), k);
+    std::sort_heap(heap.begin(), heap.end());
+    ipts.resize(heap.size()); if (dist2) dist2->resize(heap.size());
+    for (size_type i = 0; i < heap.size(); ++i) {
+      ipts[i] = pts[heap[i].second];
+      if (dist2) (*dist2)[i] = heap[i].first;
     }
-    nearest_neighbor_data_ p;
-    p.pos = pos.const_begin();
-    p.ipt = &ipt;
-    p.N = N;
-    p.dist2 = scalar_type(-1);
-    base_node tmp(N);
-    p.vec_to_tree_elm = tmp.begin();
-    nearest_neighbor_main(p, tree.get(), 0);
-    return p.dist2;
   }
+
+  void kdtree::points_in_ball(kdtree_tab_type &ipts, const base_node &pos,
+                              scalar_type radius) {
+    ipts.resize(0);
+    check_tree();
+    if (nodes.empty() || radius < scalar_type(0)) return;
+    std::vector<size_type> ipos;
+    points_in_ball_(ipos, coords_of_(pos), radius*radius);
+    ipts.resize(ipos.size());
+    for (size_type i=0; i < ipos.size(); ++i) ipts[i] = pts[ipos[i]];
+  }
+
+  /* The batched queries are distributed over chunks of consecutive
+     query points, each chunk being treated by a single thread. */
+  static size_type nb_query_chunks_(size_type nq) {
+    size_type nbc = 16 * getfem::max_concurrency();
+    return std::max(size_type(1), std::min(nbc, nq / 64));
+  }
+
+  void kdtree::nearest_neighbors(const std::vector<base_node> &pos,
+                                 std::vector<size_type> &ids,
+                                 std::vector<scalar_type> &dist2) {
+    k_nearest_neighbors(pos, 1, ids, dist2);
+  }
+
+  void kdtree::k_nearest_neighbors(const std::vector<base_node> &pos,
+                                   size_type k, std::vector<size_type> &ids,
+                                   std::vector<scalar_type> &dist2) {
+    size_type nq = pos.size();
+    ids.assign(nq*k, size_type(-1));
+    dist2.assign(nq*k, scalar_type(-1));
+    check_tree();
+    if (nodes.empty() || k == 0) return;
+    size_type nbc = nb_query_chunks_(nq);
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbc, ++ic, {
+      heap_type heap;
+      heap.reserve(k);
+      for (size_type j = (nq*ic)/nbc; j < (nq*(ic+1))/nbc; ++j) {
+        GMM_ASSERT2(pos[j].size() == N, "invalid dimension");
+        heap.resize(0);
+        k_nearest_(heap, coords_of_(pos[j]), k);
+        std::sort_heap(heap.begin(), heap.end());
+        for (size_type l = 0; l < heap.size(); ++l) {
+          ids[j*k+l] = pts[heap[l].second].i;
+          dist2[j*k+l] = heap[l].first;
+        }
+      }
+    })
+  }
+
+  void kdtree::points_in_balls(const std::vector<base_node> &pos,
+                               scalar_type radius,
+                               std::vector<size_type> &ptr,
+                               std::vector<size_type> &ids) {
+    size_type nq = pos.size();
+    ptr.assign(nq+1, 0); ids.resize(0);
+    check_tree();
+    if (nodes.empty() || radius < scalar_type(0)) return;
+    size_type nbc = nb_query_chunks_(nq);
+    std::vector<std::vector<size_type> > chunk_ids(nbc);
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbc, ++ic, {
+      std::vector<size_type> &cids = chunk_ids[ic];
+      for (size_type j = (nq*ic)/nbc; j < (nq*(ic+1))/nbc; ++j) {
+        GMM_ASSERT2(pos[j].size() == N, "invalid dimension");
+        size_type s = cids.size();
+        points_in_ball_(cids, coords_of_(pos[j]), radius*radius);
+        ptr[j+1] = cids.size() - s;
+      }
+    })
+    for (size_type j = 0; j < nq; ++j) ptr[j+1] += ptr[j];
+    ids.resize(ptr[nq]);
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbc, ++ic, {
+      const std::vector<size_type> &cids = chunk_ids[ic];
+      size_type j0 = ptr[(nq*ic)/nbc];
+      for (size_type l = 0; l < cids.size(); ++l) ids[j0+l] = pts[cids[l]].i;
+    })
+  }
+
 }
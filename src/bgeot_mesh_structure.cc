@@ -22,6 +22,7 @@
 
 
 #include "getfem/bgeot_mesh_structure.h"
+#include "getfem/getfem_omp.h"
 
 namespace bgeot {
 
@@ -69,6 +70,7 @@ namespace bgeot {
   void mesh_structure::swap_convex(size_type i, size_type j) {
     if (i == j) return;
     std::vector<size_type> doubles;
+    invalidate_face_adjacency();
 
     if (is_convex_valid(i))
       for (size_type k = 0; k < convex_tab[i].pts.size(); ++k) {
@@ -99,6 +101,7 @@ namespace bgeot {
 
   void mesh_structure::sup_convex(size_type ic) {
     if (!(is_convex_valid(ic))) return;
+    invalidate_face_adjacency();
     for (size_type l = 0; l < convex_tab[ic].pts.size(); ++l) {
       size_type &ind = convex_tab[ic].pts[l];
       std::vector<size_type>::iterator it1= points_tab[ind].begin(), it2 = it1;
@@ -109,6 +112,127 @@ namespace bgeot {
     convex_tab.sup(ic);
   }
 
+  void mesh_structure::link_points_of_convexes
+  (const std::vector<size_type> &icv) {
+    invalidate_face_adjacency();
+    std::vector<size_type> cnt;
+    for (size_type ic : icv)
+      for (size_type ip : convex_tab[ic].pts) {
+        if (ip >= cnt.size()) cnt.resize(std::max(ip+1, 2*cnt.size()), 0);
+        ++(cnt[ip]);
+      }
+    for (size_type ip = 0; ip < cnt.size(); ++ip)
+      if (cnt[ip]) points_tab[ip].reserve(points_tab[ip].size() + cnt[ip]);
+    for (size_type ic : icv)
+      for (size_type ip : convex_tab[ic].pts) points_tab[ip].push_back(ic);
+  }
+
+  /* The faces are identified by the sorted list of their point IDs. They
+     are distributed into buckets according to their smallest point ID and
+     each bucket is sorted and scanned independently, so that the matching
+     is done in parallel. A face shared by exactly two convexes of the same
+     dimension gives a neighbor. A face found only once has no neighbor,
+     unless its points are included in another convex (for instance in a
+     mesh mixing linear and higher degree structures). These ambiguous
+     cases and the non-manifold ones are marked with the convex ID
+     size_type(-2) and are left to the usual search. */
+  void mesh_structure::build_face_adjacency() {
+    invalidate_face_adjacency();
+    const dal::bit_vector &cvs = convex_tab.index();
+    size_type nbcv = cvs.card() ? cvs.last_true() + 1 : 0;
+    std::vector<size_type> ofs(nbcv+1, 0), kofs(1, 0);
+    for (size_type ic = 0; ic < nbcv; ++ic) {
+      ofs[ic+1] = ofs[ic];
+      if (!cvs.is_in(ic)) continue;
+      pconvex_structure cs = convex_tab[ic].cstruct;
+      for (short_type f = 0; f < cs->nb_faces(); ++f)
+        kofs.push_back(kofs.back() + cs->nb_points_of_face(f));
+      ofs[ic+1] += cs->nb_faces();
+    }
+    size_type nbf = ofs[nbcv];
+    std::vector<size_type> keys(kofs[nbf]), fcv(nbf);
+    std::vector<short_type> ff(nbf);
+
+    size_type nbchunks = std::min(nbcv / 1024 + 1,
+                                  4 * getfem::max_concurrency());
+    auto sort_keys = [&](size_type ich) {
+      for (size_type ic = (nbcv*ich)/nbchunks;
+           ic < (nbcv*(ich+1))/nbchunks; ++ic)
+        for (size_type i = ofs[ic]; i < ofs[ic+1]; ++i) {
+          short_type f = short_type(i - ofs[ic]);
+          ind_pt_face_ct pt = ind_points_of_face_of_convex(ic, f);
+          std::copy(pt.begin(), pt.end(), keys.begin() + kofs[i]);
+          std::sort(keys.begin() + kofs[i], keys.begin() + kofs[i+1]);
+          fcv[i] = ic; ff[i] = f;
+        }
+    };
+    GETFEM_OMP_FOR(size_type ich = 0, ich < nbchunks, ++ich,
+                   sort_keys(ich));
+
+    /* buckets of faces having the same smallest point ID */
+    size_type nbp = points_tab.size();
+    std::vector<size_type> bofs(nbp+1, 0), bfaces(nbf);
+    for (size_type i = 0; i < nbf; ++i)
+      if (kofs[i+1] > kofs[i]) ++(bofs[keys[kofs[i]]+1]);
+    for (size_type ip = 0; ip < nbp; ++ip) bofs[ip+1] += bofs[ip];
+    {
+      std::vector<size_type> pos(bofs.begin(), bofs.end()-1);
+      for (size_type i = 0; i < nbf; ++i)
+        if (kofs[i+1] > kofs[i]) bfaces[pos[keys[kofs[i]]]++] = i;
+    }
+
+    auto key_less = [&](size_type i, size_type j) {
+      return std::lexicographical_compare
+        (keys.begin() + kofs[i], keys.begin() + kofs[i+1],
+         keys.begin() + kofs[j], keys.begin() + kofs[j+1]);
+    };
+    auto key_equal = [&](size_type i, size_type j) {
+      return (kofs[i+1] - kofs[i] == kofs[j+1] - kofs[j])
+        && std::equal(keys.begin() + kofs[i], keys.begin() + kofs[i+1],
+                      keys.begin() + kofs[j]);
+    };
+    const convex_face unknown(size_type(-2), short_type(-1));
+    std::vector<convex_face> adj(nbf, unknown);
+    nbchunks = std::min(nbp / 1024 + 1, 4 * getfem::max_concurrency());
+    auto match_faces = [&](size_type ich) {
+      for (size_type ip = (nbp*ich)/nbchunks;
+           ip < (nbp*(ich+1))/nbchunks; ++ip) {
+        auto it = bfaces.begin() + bofs[ip], ite = bfaces.begin() + bofs[ip+1];
+        std::sort(it, ite, key_less);
+        while (it != ite) {
+          auto it2 = it + 1;
+          while (it2 != ite && key_equal(*it, *it2)) ++it2;
+          if (it2 - it == 1) {
+            size_type i = *it, ic = fcv[i];
+            bool found = false;
+            for (size_type icv : points_tab[ip])
+              if (icv != ic && is_convex_having_points
+                  (icv, short_type(kofs[i+1]-kofs[i]), keys.begin()+kofs[i])
+                  && convex_tab[ic].cstruct->dim()
+                     == convex_tab[icv].cstruct->dim())
+                { found = true; break; }
+            if (!found) adj[i] = convex_face::invalid_face();
+          } else if (it2 - it == 2) {
+            size_type i = *it, j = *(it+1);
+            if (fcv[i] != fcv[j]
+                && convex_tab[fcv[i]].cstruct->dim()
+                   == convex_tab[fcv[j]].cstruct->dim()) {
+              adj[i] = convex_face(fcv[j], ff[j]);
+              adj[j] = convex_face(fcv[i], ff[i]);
+            }
+          }
+          it = it2;
+        }
+      }
+    };
+    GETFEM_OMP_FOR(size_type ich = 0, ich < nbchunks, ++ich,
+                   match_faces(ich));
+
+    face_adj_ofs.swap(ofs);
+    face_adj.swap(adj);
+    face_adj_valid = true;
+  }
+
   size_type mesh_structure::add_face_of_convex(size_type ic, short_type f) {
     return add_convex( (structure_of_convex(ic)->faces_structure())[f],
                   ind_points_of_face_of_convex(ic, f).begin());
@@ -185,6 +309,8 @@ namespace bgeot {
       mems += convex_tab[i].pts.size() * sizeof(size_type);
     for (size_type i = 0; i < points_tab.size(); ++i)
       mems += points_tab[i].size() * sizeof(size_type);
+    mems += face_adj_ofs.capacity() * sizeof(size_type)
+      + face_adj.capacity() * sizeof(convex_face);
     return mems;
   }
 
@@ -205,7 +331,7 @@ namespace bgeot {
   void mesh_structure::clear(void) {
     points_tab = dal::dynamic_tas<ind_cv_ct, 8>();
     convex_tab = dal::dynamic_tas<mesh_convex_structure, 8>();
-
+    invalidate_face_adjacency();
   }
 
   void mesh_structure::stat(void) {
@@ -217,6 +343,8 @@ namespace bgeot {
   void mesh_structure::neighbors_of_convex(size_type ic, short_type iff,
                                             ind_set &s) const {
     s.resize(0);
+    const convex_face *cf = stored_adjacent_face(ic, iff);
+    if (cf) { if (cf->cv != size_type(-1)) s.push_back(cf->cv); return; }
     ind_pt_face_ct pt = ind_points_of_face_of_convex(ic, iff);
 
     for (size_type i = 0; i < points_tab[pt[0]].size(); ++i) {
@@ -281,6 +409,13 @@ namespace bgeot {
     s.resize(0);
     unsigned nbf = nb_faces_of_convex(ic);
     for (short_type iff = 0; iff < nbf; ++iff) {
+      const convex_face *cf = stored_adjacent_face(ic, iff);
+      if (cf) {
+        if (cf->cv != size_type(-1)
+            && std::find(s.begin(), s.end(), cf->cv) == s.end())
+          s.push_back(cf->cv);
+        continue;
+      }
       ind_pt_face_ct pt = ind_points_of_face_of_convex(ic, iff);
 
       for (size_type i = 0; i < points_tab[pt[0]].size(); ++i) {
@@ -296,6 +431,8 @@ namespace bgeot {
 
   size_type mesh_structure::neighbor_of_convex(size_type ic,
                                                 short_type iff) const {
+    const convex_face *cf = stored_adjacent_face(ic, iff);
+    if (cf) return cf->cv;
     ind_pt_face_ct pt = ind_points_of_face_of_convex(ic, iff);
 
     for (size_type i = 0; i < points_tab[pt[0]].size(); ++i) {
@@ -309,6 +446,8 @@ namespace bgeot {
   }
 
   convex_face mesh_structure::adjacent_face(size_type cv, short_type f) const {
+    const convex_face *cf = stored_adjacent_face(cv, f);
+    if (cf) return *cf;
     size_type neighbor_element = neighbor_of_convex(cv, f);
     if (neighbor_element == size_type(-1)) return convex_face::invalid_face();
     auto pcs = structure_of_convex(neighbor_element);
@@ -117,6 +117,19 @@ namespace bgeot {
     return id;
   }
 
+  void node_tab::add_node_to_index(size_type i, const base_node &pt) {
+    GMM_ASSERT1(!index().is_in(i), "A node already exists at index " << i);
+    scalar_type npt = gmm::vect_norm2(pt);
+    max_radius = std::max(max_radius, npt);
+    eps = max_radius * prec_factor;
+    if (this->card() == 0)
+      dim_ = pt.size();
+    else
+      GMM_ASSERT1(dim_ == pt.size(), "Nodes should have the same dimension");
+    dal::dynamic_tas<base_node>::add_to_index(i, pt);
+    for (size_type is = 0; is < sorters.size(); ++is) sorters[is].insert(i);
+  }
+
   void node_tab::swap_points(size_type i, size_type j) {
     if (i != j) {
       bool existi = index().is_in(i), existj = index().is_in(j);
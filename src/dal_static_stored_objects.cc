@@ -27,6 +27,8 @@
 #include <set>
 #include <algorithm>
 #include <deque>
+#include <tuple>
+#include <vector>
 
 
 namespace dal {
@@ -139,14 +141,36 @@ namespace dal {
   #define ON_STORED_DEBUG(expression)
 #endif
 
+#ifdef GETFEM_HAS_OPENMP
+  // Locks of the shards. As for the lock_factory, they are only taken in
+  // the parallel sections.
+  struct shard_read_guard {
+    std::shared_lock<stored_object_mutex> lock;
+    shard_read_guard(stored_object_mutex &m) : lock(m, std::defer_lock)
+    { if (getfem::me_is_multithreaded_now()) lock.lock(); }
+  };
+
+  struct shard_write_guard {
+    std::unique_lock<stored_object_mutex> lock;
+    shard_write_guard(stored_object_mutex &m) : lock(m, std::defer_lock)
+    { if (getfem::me_is_multithreaded_now()) lock.lock(); }
+  };
+#else
+  struct shard_read_guard { shard_read_guard(stored_object_mutex &) {} };
+  struct shard_write_guard { shard_write_guard(stored_object_mutex &) {} };
+#endif
+
+  static size_t shard_of_hash(size_t h)
+  { return (h ^ (h >> 7) ^ (h >> 17)) % stored_object_tab::NB_SHARDS; }
+
+  static size_t shard_of_object(const pstatic_stored_object &o)
+  { return shard_of_hash(size_t(o.get()) >> 4); }
+
   // Gives a pointer to a key of an object from its pointer, while looking in the storage of
   // a specific thread
   pstatic_stored_object_key key_of_stored_object(pstatic_stored_object o, size_t thread){
-    auto& stored_keys = singleton<stored_object_tab>::instance(thread).stored_keys_;
     STORED_ASSERT(dal_static_stored_tab_valid__, "Too late to do that");
-    auto it = stored_keys.find(o);
-    if (it != stored_keys.end()) return it->second;
-    return nullptr;
+    return singleton<stored_object_tab>::instance(thread).key_of_object_(o);
   }
 
   // gives a key of the stored object while looking in the storage of other threads
@@ -169,15 +193,17 @@ namespace dal {
   }
 
   bool exists_stored_object(pstatic_stored_object o){
-    auto& stored_keys = singleton<stored_object_tab>::instance().stored_keys_;
+    auto& stored_objects = singleton<stored_object_tab>::instance();
     ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) return false)
-    return  (stored_keys.find(o) != stored_keys.end());
+    return stored_objects.exists_stored_object(o);
   }
 
   pstatic_stored_object search_stored_object(pstatic_stored_object_key k){
     auto& stored_objects = singleton<stored_object_tab>::instance();
     ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) return nullptr)
-    return stored_objects.search_stored_object(k);
+    auto p = stored_objects.search_stored_object(k);
+    if (p) ++stored_objects.hits_; else ++stored_objects.misses_;
+    return p;
   }
 
   pstatic_stored_object search_stored_object_on_all_threads(pstatic_stored_object_key k){
@@ -195,16 +221,15 @@ namespace dal {
     return nullptr;
   }
 
-  std::pair<stored_object_tab::iterator, stored_object_tab::iterator>
-    iterators_of_object(pstatic_stored_object o){
+  // record of a stored object, looking in the storages of all threads
+  enr_static_stored_object *entry_of_object(pstatic_stored_object o){
     for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
       auto& stored_objects = singleton<stored_object_tab>::instance(thread);
       ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
-      auto it = stored_objects.iterator_of_object_(o);
-      if (it != stored_objects.end()) return {it, stored_objects.end()};
+      auto e = stored_objects.entry_of_object_(o);
+      if (e) return e;
     }
-    return {singleton<stored_object_tab>::instance().end(),
-            singleton<stored_object_tab>::instance().end()};
+    return nullptr;
   }
 
 
@@ -212,17 +237,20 @@ namespace dal {
     for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
       auto& stored_objects = singleton<stored_object_tab>::instance(thread);
       ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
-      auto& stored_keys = stored_objects.stored_keys_;
 
-      GMM_ASSERT1(stored_objects.size() == stored_keys.size(),
+      GMM_ASSERT1(stored_objects.nb_objects_() == stored_objects.nb_keys_(),
                   "keys and objects tables don't match");
-      for (auto &&pair : stored_keys){
-        auto itos = iterators_of_object(pair.first);
-        GMM_ASSERT1(itos.first != itos.second, "Key without object is found");
-      }
-      for (auto &&pair : stored_objects){
-        auto itos = iterators_of_object(pair.second.p);
-        GMM_ASSERT1(itos.first != itos.second, "Object has key but cannot be found");
+      for (const auto &s : stored_objects.shards_)
+        for (auto &&pair : s.keys){
+          auto e = entry_of_object(pair.first);
+          GMM_ASSERT1(e, "Key without object is found");
+        }
+      std::list<pstatic_stored_object> objects;
+      stored_objects.for_each_object_
+        ([&](const enr_static_stored_object &e){ objects.push_back(e.p); });
+      for (auto &&pobj : objects){
+        auto e = entry_of_object(pobj);
+        GMM_ASSERT1(e, "Object has key but cannot be found");
       }
     }
   }
@@ -281,11 +309,35 @@ namespace dal {
     return dependent_empty;
   }
 
+  static std::atomic<size_t> stored_objects_memory_budget_{0};
+
+  void set_stored_objects_memory_budget(size_t bytes) {
+    stored_objects_memory_budget_ = bytes;
+    for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread)
+      singleton<stored_object_tab>::instance(thread).failed_eviction_memsize_ = 0;
+  }
+
+  size_t stored_objects_memory_budget(void)
+  { return stored_objects_memory_budget_; }
+
   void add_stored_object(pstatic_stored_object_key k, pstatic_stored_object o,
                          permanence perm) {
     STORED_ASSERT(dal_static_stored_tab_valid__, "Too late to add an object");
     auto& stored_objects = singleton<stored_object_tab>::instance();
     stored_objects.add_stored_object(k,o,perm);
+
+    size_t budget = stored_objects_memory_budget_;
+    if (budget && stored_objects.memsize_total_ > budget
+        && stored_objects.memsize_total_
+           > stored_objects.failed_eviction_memsize_
+        && !getfem::me_is_multithreaded_now()) {
+      std::list<pstatic_stored_object> to_delete;
+      stored_objects.select_evictions_(budget, to_delete);
+      if (!to_delete.empty()) {
+        stored_objects.evictions_ += to_delete.size();
+        del_stored_objects(to_delete, true);
+      }
+    }
   }
 
   void basic_delete(std::list<pstatic_stored_object> &to_delete){
@@ -319,8 +371,8 @@ namespace dal {
     for (it = to_delete.begin(); it != to_delete.end(); it = itnext) {
       itnext = it; itnext++;
 
-      auto itos = iterators_of_object(*it);
-      if (itos.first == itos.second) {
+      auto e = entry_of_object(*it);
+      if (!e) {
         if (ignore_unstored) to_delete.erase(it);
         else if (getfem::me_is_multithreaded_now()) {
             GMM_WARNING1("This object is (already?) not stored : "<< it->get()
@@ -331,33 +383,32 @@ namespace dal {
           << " typename: " << typeid(*it->get()).name());
         }
       }
-      else itos.first->second.valid = false;
+      else e->valid = false;
     }
 
     for (auto &&pobj : to_delete) {
       if (pobj) {
-        auto itos = iterators_of_object(pobj);
-        GMM_ASSERT1(itos.first != itos.second, "An object disapeared !");
-        itos.first->second.valid = false;
-        auto second_dep = itos.first->second.dependencies;
+        auto e = entry_of_object(pobj);
+        GMM_ASSERT1(e, "An object disapeared !");
+        e->valid = false;
+        auto second_dep = e->dependencies;
         for (const auto &pdep : second_dep) {
           if (del_dependency(pobj, pdep)) {
-            auto itods = iterators_of_object(pdep);
-            if (itods.first->second.perm == AUTODELETE_STATIC_OBJECT
-                && itods.first->second.valid) {
-              itods.first->second.valid = false;
+            auto ed = entry_of_object(pdep);
+            if (ed && ed->perm == AUTODELETE_STATIC_OBJECT && ed->valid) {
+              ed->valid = false;
               to_delete.push_back(pdep);
             }
           }
         }
-        for (auto &&pdep : itos.first->second.dependent_object) {
-          auto itods = iterators_of_object(pdep);
-          if (itods.first != itods.second) {
-            GMM_ASSERT1(itods.first->second.perm != PERMANENT_STATIC_OBJECT,
+        for (auto &&pdep : e->dependent_object) {
+          auto ed = entry_of_object(pdep);
+          if (ed) {
+            GMM_ASSERT1(ed->perm != PERMANENT_STATIC_OBJECT,
             "Trying to delete a permanent object " << pdep);
-            if (itods.first->second.valid) {
-              itods.first->second.valid = false;
-              to_delete.push_back(itods.first->second.p);
+            if (ed->valid) {
+              ed->valid = false;
+              to_delete.push_back(ed->p);
             }
           }
         }
@@ -379,152 +430,287 @@ namespace dal {
       auto& stored_objects = singleton<stored_object_tab>::instance(thread);
       ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
       if (perm == PERMANENT_STATIC_OBJECT) perm = STRONG_STATIC_OBJECT;
-      for (auto &&pair : stored_objects){
-        if (pair.second.perm >= perm) to_delete.push_back(pair.second.p);
-      }
+      stored_objects.for_each_object_([&](const enr_static_stored_object &e){
+        if (e.perm >= perm) to_delete.push_back(e.p);
+      });
     }
     del_stored_objects(to_delete, false);
   }
 
   void list_stored_objects(std::ostream &ost){
     for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
-      auto& stored_keys = singleton<stored_object_tab>::instance(thread).stored_keys_;
+      auto& stored_objects = singleton<stored_object_tab>::instance(thread);
       ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
-      if (stored_keys.begin() == stored_keys.end())
+      if (stored_objects.nb_keys_() == 0)
         ost << "No static stored objects" << endl;
       else ost << "Static stored objects" << endl;
-      for (const auto &t : stored_keys)
-        ost << "Object: " << t.first << " typename: "
-            << typeid(*(t.first)).name() << endl;
+      for (const auto &s : stored_objects.shards_)
+        for (const auto &t : s.keys)
+          ost << "Object: " << t.first << " typename: "
+              << typeid(*(t.first)).name() << endl;
     }
   }
 
   size_t nb_stored_objects(void){
     long num_objects = 0;
     for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
-      auto& stored_keys = singleton<stored_object_tab>::instance(thread).stored_keys_;
+      auto& stored_objects = singleton<stored_object_tab>::instance(thread);
       ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
-      num_objects += stored_keys.size();
+      num_objects += stored_objects.nb_keys_();
     }
     return num_objects;
   }
 
+  stored_objects_stats stored_objects_statistics(void){
+    stored_objects_stats st{0, 0, 0, 0, 0};
+    for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
+      auto& stored_objects = singleton<stored_object_tab>::instance(thread);
+      ON_STORED_DEBUG(if (!dal_static_stored_tab_valid__) continue;)
+      st.nb_objects += stored_objects.nb_keys_();
+      st.hits += stored_objects.hits_;
+      st.misses += stored_objects.misses_;
+      st.evictions += stored_objects.evictions_;
+      st.memsize += stored_objects.cache_memsize_();
+    }
+    return st;
+  }
+
+  void reset_stored_objects_statistics(void){
+    for(size_t thread = 0; thread != singleton<stored_object_tab>::num_threads(); ++thread){
+      auto& stored_objects = singleton<stored_object_tab>::instance(thread);
+      stored_objects.hits_ = 0;
+      stored_objects.misses_ = 0;
+      stored_objects.evictions_ = 0;
+    }
+  }
+
 /**
   STATIC_STORED_TAB -------------------------------------------------------
 */
-  stored_object_tab::stored_object_tab()
-    : std::map<enr_static_stored_object_key, enr_static_stored_object>(),
-      locks_{}, stored_keys_{}{
+  stored_object_tab::stored_object_tab(){
       ON_STORED_DEBUG(dal_static_stored_tab_valid__ = true;)
     }
 
   stored_object_tab::~stored_object_tab(){
     ON_STORED_DEBUG(dal_static_stored_tab_valid__ = false;)
+    for_each_object_([](const enr_static_stored_object &e)
+                     { e.p->memsize_total_ = nullptr; });
+  }
+
+  // key of o (with its hash value) in the table t, false if o is not stored
+  static bool stored_key(const stored_object_tab &t,
+                         const pstatic_stored_object &o,
+                         enr_static_stored_object_key &k){
+    const auto &s = t.shards_[shard_of_object(o)];
+    shard_read_guard guard(s.mutex);
+    auto it = s.keys.find(o);
+    if (it == s.keys.end()) return false;
+    k = it->second;
+    return true;
+  }
+
+  // apply f to the record of o under an exclusive lock of its shard,
+  // false if o is not stored in t
+  template <typename F>
+  static bool modify_stored_object(stored_object_tab &t,
+                                   const pstatic_stored_object &o, F f){
+    enr_static_stored_object_key k;
+    if (!stored_key(t, o, k)) return false;
+    auto &s = t.shards_[shard_of_hash(k.h)];
+    shard_write_guard guard(s.mutex);
+    auto ito = s.objects.find(k);
+    GMM_ASSERT1(ito != s.objects.end(), "Object has a key, but cannot be found");
+    f(ito->second);
+    return true;
   }
 
   pstatic_stored_object
   stored_object_tab::search_stored_object(pstatic_stored_object_key k) const{
-    auto guard = locks_.get_lock();
-    auto it = find(enr_static_stored_object_key(k));
-    return (it != end()) ? it->second.p : nullptr;
+    enr_static_stored_object_key ek(k);
+    const auto &s = shards_[shard_of_hash(ek.h)];
+    shard_read_guard guard(s.mutex);
+    auto it = s.objects.find(ek);
+    if (it == s.objects.end()) return nullptr;
+    it->second.last_use.store(++clock_, std::memory_order_relaxed);
+    return it->second.p;
+  }
+
+  pstatic_stored_object_key
+  stored_object_tab::key_of_object_(pstatic_stored_object o) const{
+    enr_static_stored_object_key k;
+    if (!stored_key(*this, o, k)) return nullptr;
+    return k.p;
   }
 
   bool stored_object_tab::add_dependency_(pstatic_stored_object o1,
                                           pstatic_stored_object o2){
-    auto guard = locks_.get_lock();
-    auto it = stored_keys_.find(o1);
-    if (it == stored_keys_.end()) return false;
-    auto ito1 = find(it->second);
-    GMM_ASSERT1(ito1 != end(), "Object has a key, but cannot be found");
-    ito1->second.dependencies.insert(o2);
-    return true;
+    return modify_stored_object(*this, o1, [&](enr_static_stored_object &e)
+                                { e.dependencies.insert(o2); });
   }
 
   void stored_object_tab::add_stored_object(pstatic_stored_object_key k,
     pstatic_stored_object o,  permanence perm){
     DAL_STORED_OBJECT_DEBUG_ADDED(o.get());
-    auto guard = locks_.get_lock();
-    GMM_ASSERT1(stored_keys_.find(o) == stored_keys_.end(),
-      "This object has already been stored, possibly with another key");
-    stored_keys_[o] = k;
-    insert(std::make_pair(enr_static_stored_object_key(k),
-                          enr_static_stored_object(o, perm)));
+    enr_static_stored_object_key ek(k);
+    {
+      auto &s = shards_[shard_of_object(o)];
+      shard_write_guard guard(s.mutex);
+      GMM_ASSERT1(s.keys.find(o) == s.keys.end(),
+        "This object has already been stored, possibly with another key");
+      s.keys[o] = ek;
+    }
+    auto &s = shards_[shard_of_hash(ek.h)];
+    shard_write_guard guard(s.mutex);
+    auto ito = s.objects.emplace(std::piecewise_construct,
+                                 std::forward_as_tuple(ek),
+                                 std::forward_as_tuple(o, perm));
+    if (ito.second) {
+      ito.first->second.last_use = ++clock_;
+      o->memsize_total_ = &memsize_total_;
+      memsize_total_ += o->cache_memsize();
+    }
     auto t = singleton<stored_object_tab>::this_thread();
-    GMM_ASSERT2(stored_keys_.size() == size() && t != size_t(-1),
+    GMM_ASSERT2(ito.second && t != size_t(-1),
       "stored_keys are not consistent with stored_object tab");
   }
 
   bool stored_object_tab::add_dependent_(pstatic_stored_object o1,
     pstatic_stored_object o2){
-    auto guard = locks_.get_lock();
-    auto it = stored_keys_.find(o2);
-    if (it == stored_keys_.end()) return false;
-    auto ito2 = find(it->second);
-    GMM_ASSERT1(ito2 != end(), "Object has a key, but cannot be found");
-    ito2->second.dependent_object.insert(o1);
-    return true;
+    return modify_stored_object(*this, o2, [&](enr_static_stored_object &e)
+                                { e.dependent_object.insert(o1); });
   }
 
   bool stored_object_tab::del_dependency_(pstatic_stored_object o1,
                                           pstatic_stored_object o2){
-    auto guard = locks_.get_lock();
-    auto it1 = stored_keys_.find(o1);
-    if (it1 == stored_keys_.end()) return false;
-    auto ito1 = find(it1->second);
-    GMM_ASSERT1(ito1 != end(), "Object has a key, but cannot be found");
-    ito1->second.dependencies.erase(o2);
-    return true;
+    return modify_stored_object(*this, o1, [&](enr_static_stored_object &e)
+                                { e.dependencies.erase(o2); });
   }
 
-  stored_object_tab::iterator stored_object_tab
-    ::iterator_of_object_(pstatic_stored_object o){
-    auto itk = stored_keys_.find(o);
-    if (itk == stored_keys_.end()) return end();
-    auto ito = find(itk->second);
-    GMM_ASSERT1(ito != end(), "Object has a key, but is not stored");
-    return ito;
+  enr_static_stored_object *stored_object_tab
+    ::entry_of_object_(pstatic_stored_object o){
+    enr_static_stored_object_key k;
+    if (!stored_key(*this, o, k)) return nullptr;
+    auto &s = shards_[shard_of_hash(k.h)];
+    shard_read_guard guard(s.mutex);
+    auto ito = s.objects.find(k);
+    GMM_ASSERT1(ito != s.objects.end(), "Object has a key, but is not stored");
+    return &(ito->second);
   }
 
   bool stored_object_tab::del_dependent_(pstatic_stored_object o1,
                                          pstatic_stored_object o2){
-    auto guard = locks_.get_lock();
-    auto it2 = stored_keys_.find(o2);
-    if (it2 == stored_keys_.end()) return false;
-    auto ito2 = find(it2->second);
-    GMM_ASSERT1(ito2 != end(), "Object has a key, but cannot be found");
-    ito2->second.dependent_object.erase(o1);
-    return true;
+    return modify_stored_object(*this, o2, [&](enr_static_stored_object &e)
+                                { e.dependent_object.erase(o1); });
   }
 
   bool stored_object_tab::exists_stored_object(pstatic_stored_object o) const{
-    auto guard = locks_.get_lock();
-    return (stored_keys_.find(o) != stored_keys_.end());
+    const auto &s = shards_[shard_of_object(o)];
+    shard_read_guard guard(s.mutex);
+    return (s.keys.find(o) != s.keys.end());
   }
 
   bool stored_object_tab::has_dependent_objects(pstatic_stored_object o) const{
-    auto guard = locks_.get_lock();
-    auto it = stored_keys_.find(o);
-    GMM_ASSERT1(it != stored_keys_.end(), "Object is not stored");
-    auto ito = find(it->second);
-    GMM_ASSERT1(ito != end(), "Object has a key, but cannot be found");
+    enr_static_stored_object_key k;
+    GMM_ASSERT1(stored_key(*this, o, k), "Object is not stored");
+    const auto &s = shards_[shard_of_hash(k.h)];
+    shard_read_guard guard(s.mutex);
+    auto ito = s.objects.find(k);
+    GMM_ASSERT1(ito != s.objects.end(), "Object has a key, but cannot be found");
     return ito->second.dependent_object.empty();
   }
 
   void stored_object_tab::basic_delete_(std::list<pstatic_stored_object> &to_delete){
-    auto guard = locks_.get_lock();
     for (auto it = to_delete.begin(); it != to_delete.end();){
       DAL_STORED_OBJECT_DEBUG_DELETED(it->get());
-      auto itk = stored_keys_.find(*it);
-      auto ito = end();
-      if (itk != stored_keys_.end()){
-          ito = find(itk->second);
-          stored_keys_.erase(itk);
+      enr_static_stored_object_key k;
+      bool found = false;
+      {
+        auto &s = shards_[shard_of_object(*it)];
+        shard_write_guard guard(s.mutex);
+        auto itk = s.keys.find(*it);
+        if (itk != s.keys.end()) {
+          k = itk->second;
+          s.keys.erase(itk);
+          found = true;
+        }
       }
-      if (ito != end()){
-        erase(ito);
-        it = to_delete.erase(it);
-      } else ++it;
+      if (found) {
+        auto &s = shards_[shard_of_hash(k.h)];
+        shard_write_guard guard(s.mutex);
+        auto ito = s.objects.find(k);
+        if (ito != s.objects.end()) s.objects.erase(ito); else found = false;
+      }
+      if (found && (*it)->memsize_total_.exchange(nullptr))
+        memsize_total_ -= (*it)->cache_memsize();
+      if (found) it = to_delete.erase(it); else ++it;
+    }
+  }
+
+  size_t stored_object_tab::nb_objects_() const{
+    size_t n = 0;
+    for (const auto &s : shards_) {
+      shard_read_guard guard(s.mutex);
+      n += s.objects.size();
+    }
+    return n;
+  }
+
+  size_t stored_object_tab::nb_keys_() const{
+    size_t n = 0;
+    for (const auto &s : shards_) {
+      shard_read_guard guard(s.mutex);
+      n += s.keys.size();
+    }
+    return n;
+  }
+
+  size_t stored_object_tab::cache_memsize_() const{
+    return memsize_total_;
+  }
+
+  // True if the object o, described by e, is referred to only by the storage
+  // (its table, the key table and the dependency lists),
+  // as well as the objects which would be deleted with it.
+  static bool referred_only_by_storage(const pstatic_stored_object &o,
+                                       const enr_static_stored_object &e){
+    if (size_t(o.use_count())
+        > 2 + e.dependencies.size() + e.dependent_object.size()) return false;
+    for (const auto &pdep : e.dependencies) {
+      auto ed = entry_of_object(pdep);
+      if (!ed) continue;
+      if (ed->perm == AUTODELETE_STATIC_OBJECT
+          && ed->dependent_object.size() == 1
+          && !referred_only_by_storage(pdep, *ed)) return false;
+    }
+    return true;
+  }
+
+  void stored_object_tab::select_evictions_
+  (size_t budget, std::list<pstatic_stored_object> &to_delete){
+    // The objects are deleted down to three quarters of the budget, to
+    // amortize the cost of the sort.
+    size_t m = memsize_total_, target = budget / 4 * 3;
+    if (m <= budget) return;
+    // candidates, from the least recently to the most recently searched
+    std::vector<std::pair<size_t, const enr_static_stored_object *>> cand;
+    for_each_object_([&](const enr_static_stored_object &e){
+      if (e.perm >= WEAK_STATIC_OBJECT && e.dependent_object.empty()
+          && e.p->cache_memsize())
+        cand.emplace_back(size_t(e.last_use), &e);
+    });
+    std::sort(cand.begin(), cand.end(),
+              [](const std::pair<size_t, const enr_static_stored_object *> &a,
+                 const std::pair<size_t, const enr_static_stored_object *> &b)
+              { return a.first < b.first; });
+    for (const auto &c : cand) {
+      if (m <= target) break;
+      if (!referred_only_by_storage(c.second->p, *(c.second))) continue;
+      to_delete.push_back(c.second->p);
+      m -= c.second->p->cache_memsize();
     }
+    // The objects still in use cannot be deleted: the scan is not done
+    // again before the memory grows past what they use.
+    failed_eviction_memsize_ = (m > budget) ? m : 0;
   }
 
-}/* end of namespace dal                                                             */
\ No newline at end of file
+}/* end of namespace dal                                                             */
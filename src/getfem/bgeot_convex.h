@@ -188,13 +188,15 @@ namespace bgeot {
       auto &o = dynamic_cast<const special_convex_structure_key_ &>(oo);
       return p < o.p;
     }
+    // The key of p is this key itself : the keys are compared by address of
+    // the structure, as in compare.
     bool equal(const static_stored_object_key &oo) const override {
       auto &o = dynamic_cast<const special_convex_structure_key_ &>(oo);
-      if (p == o.p) return true;
-
-      auto pkey = dal::key_of_stored_object(p);
-      auto poo_key = dal::key_of_stored_object(o.p);
-      return *pkey == *poo_key;
+      return p.get() == o.p.get();
+    }
+    size_t hash() const override {
+      return dal::hash_combine(static_stored_object_key::hash(),
+                               dal::hash_value(p.get()));
     }
     special_convex_structure_key_(pconvex_structure pp) : p(pp) {}
   };
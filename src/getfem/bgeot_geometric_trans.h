@@ -288,25 +288,41 @@ namespace bgeot {
   /**
    *  precomputed geometric transformation operations use this for
    *  repetitive evaluation of a geometric transformations on a set of
-   *  points "pspt" in the reference convex which do not change.
+   *  points "pspt" in the reference convex which do not change. The
+   *  values of all the points are stored in a single block (see
+   *  packed_tensor_tab). val(i), grad(i) and hessian(i) give them as
+   *  one vector or matrix per point, built on their first call.
    */
   class APIDECL geotrans_precomp_ : virtual public dal::static_stored_object {
   protected:
     pgeometric_trans pgt;
     pstored_point_tab pspt;  /* a set of points in the reference elt*/
-    mutable std::vector<base_vector> c;  /* precomputed values for the     */
-                                         /* transformation                 */
-    mutable std::vector<base_matrix> pc; /* precomputed values for gradient*/
-                                         /* of the transformation.         */
-    mutable std::vector<base_matrix> hpc; /* precomputed values for hessian*/
-                                          /*  of the transformation.       */
+    mutable packed_tensor_tab c;  /* precomputed values for the          */
+                                  /* transformation (nb_points)          */
+    mutable packed_tensor_tab pc; /* precomputed values for gradient     */
+                                  /* of the transformation (nb_points,N) */
+    mutable packed_tensor_tab hpc; /* precomputed values for hessian     */
+                                   /* of the transformation (nb_points,N*N)*/
+    /* the same ones, one vector or matrix per point (only for val, grad */
+    /* and hessian)                                                      */
+    mutable std::vector<base_vector> c_pts;
+    mutable std::vector<base_matrix> pc_pts, hpc_pts;
   public:
+    inline const packed_tensor_tab &vals() const
+    { if (c.empty()) init_val(); return c; }
+    inline const packed_tensor_tab &grads() const
+    { if (pc.empty()) init_grad(); return pc; }
+    inline const packed_tensor_tab &hessians() const
+    { if (hpc.empty()) init_hess(); return hpc; }
+    /// values on point i
     inline const base_vector &val(size_type i) const
-    { if (c.empty()) init_val(); return c[i]; }
+    { if (c_pts.empty()) unpack_val(); return c_pts[i]; }
+    /// gradient on point i
     inline const base_matrix &grad(size_type i) const
-    { if (pc.empty()) init_grad(); return pc[i]; }
+    { if (pc_pts.empty()) unpack_grad(); return pc_pts[i]; }
+    /// hessian on point i
     inline const base_matrix &hessian(size_type i) const
-    { if (hpc.empty()) init_hess(); return hpc[i]; }
+    { if (hpc_pts.empty()) unpack_hess(); return hpc_pts[i]; }
 
     /**
      *  Apply the geometric transformation from the reference convex to
@@ -326,6 +342,7 @@ namespace bgeot {
     pgeometric_trans get_trans() const { return pgt; }
     // inline const stored_point_tab& get_point_tab() const { return *pspt; }
     inline pstored_point_tab get_ppoint_tab() const { return pspt; }
+    size_t cache_memsize() const override;
     geotrans_precomp_(pgeometric_trans pg, pstored_point_tab ps);
     ~geotrans_precomp_()
       { DAL_STORED_OBJECT_DEBUG_DESTROYED(this, "Geotrans precomp"); }
@@ -334,6 +351,9 @@ namespace bgeot {
     void init_val() const;
     void init_grad() const;
     void init_hess() const;
+    void unpack_val() const;
+    void unpack_grad() const;
+    void unpack_hess() const;
 
     /**
      *  precomputes a geometric transformation for a fixed set of
@@ -355,10 +375,10 @@ namespace bgeot {
                                     VEC& pt) const {
     size_type k = 0;
     gmm::clear(pt);
-    if (c.empty()) init_val();
+    const scalar_type *cj = vals()[j];
     for (typename CONT::const_iterator itk = G.begin();
          itk != G.end(); ++itk, ++k)
-      gmm::add(gmm::scaled(*itk, c[j][k]), pt);
+      gmm::add(gmm::scaled(*itk, cj[k]), pt);
     GMM_ASSERT1(k == pgt->nb_points(),
                 "Wrong number of points in transformation");
   }
@@ -366,8 +386,7 @@ namespace bgeot {
   template <typename CONT>
   void geotrans_precomp_::transform(const CONT& G,
                                     stored_point_tab& pt_tab) const {
-    if (c.empty()) init_val();
-    pt_tab.clear(); pt_tab.resize(c.size(), base_node(G[0].size()));
+    pt_tab.clear(); pt_tab.resize(vals().size(), base_node(G[0].size()));
     for (size_type j = 0; j < c.size(); ++j) {
       transform(G, j, pt_tab[j]);
     }
@@ -55,6 +55,7 @@
 #include "bgeot_geometric_trans.h"
 #include "bgeot_small_vector.h"
 #include "bgeot_kdtree.h"
+#include "dal_bit_vector.h"
 
 namespace bgeot {
 
@@ -133,7 +134,41 @@ namespace bgeot {
     */
     bool invert(const base_node& n, base_node& n_ref, bool &converged, 
                 scalar_type IN_EPS=1e-12, bool project_into_element=false);
+
+    /**
+       batched version of invert for a set of points of the real element.
+       Linear transformations are inverted in closed form for all the
+       points at once.
+
+       @return the number of points inside the convex.
+
+       @param pts nodes on the real element (base_node or index_node_pair)
+
+       @param pts_ref computed nodes on the reference convex
+
+       @param isin on output, contains the indices of the points inside
+       the convex.
+
+       @param converged on output, contains the indices of the points for
+       which the geometric transformation could be inverted.
+
+       @param IN_EPS a threshold.
+    */
+    template<class CONT>
+    size_type invert(const CONT &pts, std::vector<base_node> &pts_ref,
+                     dal::bit_vector &isin, dal::bit_vector &converged,
+                     scalar_type IN_EPS=1e-12,
+                     bool project_into_element=false);
+
   private:
+    static const base_node &node_of_(const base_node &n) { return n; }
+    static const base_node &node_of_(const index_node_pair &p)
+    { return p.n; }
+    size_type invert_packed(const std::vector<scalar_type> &xx,
+                            std::vector<base_node> &pts_ref,
+                            dal::bit_vector &isin,
+                            dal::bit_vector &converged, scalar_type IN_EPS,
+                            bool project_into_element);
     bool invert_lin(const base_node& n, base_node& n_ref, scalar_type IN_EPS);
     bool invert_nonlin(const base_node& n, base_node& n_ref,
                        scalar_type IN_EPS, bool &converged, bool throw_except,
@@ -171,6 +206,24 @@ namespace bgeot {
   }
 
 
+  template<class CONT>
+  size_type geotrans_inv_convex::invert(const CONT &pts,
+                                        std::vector<base_node> &pts_ref,
+                                        dal::bit_vector &isin,
+                                        dal::bit_vector &converged,
+                                        scalar_type IN_EPS,
+                                        bool project_into_element) {
+    std::vector<scalar_type> xx(pts.size()*N);
+    auto itx = xx.begin();
+    for (const auto &pt : pts) {
+      const base_node &n = node_of_(pt);
+      GMM_ASSERT2(n.size() == N, "dimensions mismatch");
+      itx = std::copy(n.begin(), n.end(), itx);
+    }
+    return invert_packed(xx, pts_ref, isin, converged, IN_EPS,
+                         project_into_element);
+  }
+
   /**
      handles the geometric inversion for a given (supposedly quite large)
      set of points
@@ -205,6 +258,23 @@ namespace bgeot {
       return ipts.size();
     }
 
+    /// Find all the points at a distance lower or equal to radius of p.
+    size_type points_in_ball(kdtree_tab_type &ipts, const base_node &p,
+                             scalar_type radius) const {
+      tree.points_in_ball(ipts, p, radius);
+      return ipts.size();
+    }
+
+    /// Find the k nearest points of p, sorted by increasing distance.
+    size_type nearest_points(kdtree_tab_type &ipts, const base_node &p,
+                             size_type k) const {
+      tree.k_nearest_neighbors(ipts, p, k);
+      return ipts.size();
+    }
+
+    /// Underlying kdtree, for the batched (parallel) queries.
+    kdtree &points_tree() const { return tree; }
+
     /** Search all the points in the convex cv, which is the transformation
      *  of the convex cref via the geometric transformation pgt.
      *
@@ -246,6 +316,8 @@ namespace bgeot {
     base_node min, max; /* bound of the box enclosing the convex */
     size_type nbpt = 0; /* nb of points in the convex */
     kdtree_tab_type boxpts;
+    std::vector<base_node> pts_ref;
+    dal::bit_vector isin, converged;
     bounding_box(min, max, cv.points(), pgt);
     for (size_type k=0; k < min.size(); ++k) { min[k] -= EPS; max[k] += EPS; }
     gic.init(cv.points(),pgt);
@@ -254,11 +326,10 @@ namespace bgeot {
     else boxpts = tree.points();
     /* and invert the geotrans, and check if the obtained point is 
        inside the reference convex */
-    for (size_type l = 0; l < boxpts.size(); ++l) {
-      // base_node pt_ref;
-      if (gic.invert(boxpts[l].n, pftab[nbpt], EPS)) {
-        itab[nbpt++] = boxpts[l].i;
-      }
+    gic.invert(boxpts, pts_ref, isin, converged, EPS);
+    for (dal::bv_visitor l(isin); !l.finished(); ++l) {
+      pftab[nbpt] = pts_ref[l];
+      itab[nbpt++] = boxpts[l].i;
     }
     return nbpt;
   }
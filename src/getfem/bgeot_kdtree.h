@@ -37,19 +37,27 @@
     @date January 2004.
     @brief Simple implementation of a KD-tree.
 
-    Basically, a KD-tree is a balanced N-dimensional tree.
+    Basically, a KD-tree is a balanced N-dimensional tree. The tree is
+    stored in a flat array of nodes and the coordinates of the points
+    are packed contiguously in the tree order. The build is done with
+    exact median splits (std::nth_element) and runs in parallel on
+    independent sub-trees when OpenMP is enabled.
 */
 #include "bgeot_small_vector.h"
 
 namespace bgeot {
 
-  /* generic node for the kdtree */
-  struct kdtree_elt_base {
+  /* node of the flat kdtree. For a tree node, the left child is stored
+     just after the node itself and the right child at index "right".
+     For a leaf, [first, last[ is the range of the stored points. */
+  struct kdtree_flat_node {
     enum { PTS_PER_LEAF=8 };
-    unsigned n; /* 0 => is a tree node, != 0 => tree leaf storing n points */
-    bool isleaf() const { return (n != 0); }
-    kdtree_elt_base(unsigned n_) : n(n_) {}
-    virtual ~kdtree_elt_base() {}
+    scalar_type split_v; /* left: <= split_v, right: >= split_v */
+    size_type first, last, right;
+    unsigned dir; /* splitting direction, unsigned(-1) for a leaf */
+    bool isleaf() const { return (dir == unsigned(-1)); }
+    kdtree_flat_node() : split_v(0), first(0), last(0), right(0),
+                         dir(unsigned(-1)) {}
   };
 
   /// store a point and the associated index for the kdtree.
@@ -101,10 +109,12 @@ namespace bgeot {
   */
   class kdtree {
     dim_type N; /* dimension of points */
-    std::unique_ptr<kdtree_elt_base> tree;
     kdtree_tab_type pts;
+    std::vector<kdtree_flat_node> nodes;
+    std::vector<scalar_type> coords; /* packed coordinates, tree order */
+    bool tree_built;
   public:
-    kdtree() : N(0) {}
+    kdtree() : N(0), tree_built(false) {}
 
     kdtree(const kdtree&) = delete;
     kdtree &operator = (const kdtree&) = delete;
@@ -122,11 +132,15 @@ namespace bgeot {
         N = n.size();
       else
         GMM_ASSERT2(N == n.size(), "invalid dimension");
-      if (tree) clear_tree();
+      if (tree_built) clear_tree();
       pts.push_back(index_node_pair(i, n));
     }
     size_type nb_points() const { return pts.size(); }
     const kdtree_tab_type &points() const { return pts; }
+    /** build the tree. This is done automatically by the first query,
+        but it has to be called explicitly before using the const
+        queries concurrently from several threads. */
+    void build_tree();
     /* fills ipts with the indexes of points in the box
        [min,max] */
     void points_in_box(kdtree_tab_type &ipts,
@@ -136,9 +150,46 @@ namespace bgeot {
        pos and returns the square of the distance to this point*/
     scalar_type nearest_neighbor(index_node_pair &ipt,
                                  const base_node &pos);
+    /* fills ipts with the k nearest neighbors of pos, sorted by
+       increasing distance. If dist2 is not null, it is filled with
+       the squares of the distances. */
+    void k_nearest_neighbors(kdtree_tab_type &ipts, const base_node &pos,
+                             size_type k,
+                             std::vector<scalar_type> *dist2 = 0);
+    /* fills ipts with the points at a distance lower or equal to
+       radius of pos. */
+    void points_in_ball(kdtree_tab_type &ipts, const base_node &pos,
+                        scalar_type radius);
+
+    /* Batched queries, executed in parallel. The results are given
+       with the indexes of the points. */
+
+    /* ids[j] is the nearest neighbor of pos[j], dist2[j] the square of
+       the distance (size_type(-1) and -1 for an empty tree). */
+    void nearest_neighbors(const std::vector<base_node> &pos,
+                           std::vector<size_type> &ids,
+                           std::vector<scalar_type> &dist2);
+    /* ids[j*k+l] is the l-th nearest neighbor of pos[j] (size_type(-1)
+       if the tree contains less than k points). */
+    void k_nearest_neighbors(const std::vector<base_node> &pos,
+                             size_type k, std::vector<size_type> &ids,
+                             std::vector<scalar_type> &dist2);
+    /* The points at a distance lower or equal to radius of pos[j] are
+       ids[ptr[j]], ..., ids[ptr[j+1]-1] (compressed row storage). */
+    void points_in_balls(const std::vector<base_node> &pos,
+                         scalar_type radius, std::vector<size_type> &ptr,
+                         std::vector<size_type> &ids);
+
   private:
-    typedef std::vector<size_type>::const_iterator ITER;
+    typedef std::vector<std::pair<scalar_type, size_type> > heap_type;
     void clear_tree();
+    void check_tree() { if (!tree_built) build_tree(); }
+    void points_in_box_(std::vector<size_type> &ipos, const scalar_type *bmin,
+                        const scalar_type *bmax) const;
+    void k_nearest_(heap_type &heap, const scalar_type *pos,
+                    size_type k) const;
+    void points_in_ball_(std::vector<size_type> &ipos, const scalar_type *pos,
+                         scalar_type radius2) const;
   };
 }
 
@@ -85,6 +85,28 @@ namespace bgeot {
     dal::dynamic_tas<mesh_convex_structure, 8> convex_tab;
     point_ct points_tab;
 
+    /* Face adjacency table (see build_face_adjacency()). The neighbors of
+       the faces of convex ic are stored in face_adj[face_adj_ofs[ic]...]. */
+    std::vector<size_type> face_adj_ofs;
+    std::vector<convex_face> face_adj;
+    bool face_adj_valid = false;
+
+    void invalidate_face_adjacency() {
+      if (face_adj_valid) {
+        face_adj_valid = false;
+        std::vector<size_type>().swap(face_adj_ofs);
+        std::vector<convex_face>().swap(face_adj);
+      }
+    }
+    /* Return the neighbor stored in the face adjacency table, or 0 if the
+       table is not built or does not allow to conclude. */
+    const convex_face *stored_adjacent_face(size_type ic, short_type f) const {
+      if (!face_adj_valid) return 0;
+      const convex_face &cf = face_adj[face_adj_ofs[ic] + f];
+      return (cf.cv == size_type(-2)) ? 0 : &cf;
+    }
+    void link_points_of_convexes(const std::vector<size_type> &icv);
+
   public :
 
     /// Return the list of valid convex IDs
@@ -134,6 +156,19 @@ namespace bgeot {
     template<class ITER>
     size_type add_convex(pconvex_structure cs,
                          ITER ipts, bool *present = 0);
+    /** Insert nb convexes of the same structure, without checking whether
+        they already exist in the mesh_structure. The point to convex lists
+        are extended once for all, which is much faster than repeated
+        calls to add_convex for large meshes.
+        @param cs the structure of the new convexes.
+        @param nb the number of convexes.
+        @param ipts an iterator over the nb*cs->nb_points() point IDs of
+        the convex nodes, convex after convex.
+        @param ind if not null, receives the IDs of the new convexes.
+    */
+    template<class ITER>
+    void add_convexes_noverif(pconvex_structure cs, size_type nb, ITER ipts,
+                              std::vector<size_type> *ind = 0);
     template<class ITER> size_type add_simplex(dim_type dim, ITER ipts)
       { return add_convex(simplex_structure(dim), ipts); }
     size_type add_segment(size_type a, size_type b);
@@ -186,6 +221,21 @@ namespace bgeot {
                                                 short_type f) const;
 
     size_type memsize() const;
+    /** Build the face adjacency table of the mesh structure, matching
+        the faces by sorting their point IDs, in parallel when possible.
+        Until the next modification of the convexes,
+        neighbor_of_convex(), adjacent_face() and neighbors_of_convex()
+        (for a single face or for all faces) then become constant time
+        lookups instead of searches through the convexes attached to the
+        face points. To be called after the mesh is built, for instance
+        before computing its outer faces. The regular mesh generators and
+        the mesh importers call it on the meshes they build.
+    */
+    void build_face_adjacency();
+    /// Return true if the face adjacency table is built and up to date.
+    bool has_face_adjacency() const { return face_adj_valid; }
+    /// Drop the face adjacency table, the faces being searched again.
+    void clear_face_adjacency() { invalidate_face_adjacency(); }
     /** Reorder the convex IDs and point IDs, such that there is no
         hole in their numbering. */
     void optimize_structure();
@@ -292,6 +342,7 @@ namespace bgeot {
                                                ITER ipts, size_type is) {
     mesh_convex_structure s; s.cstruct = cs;
     size_type nb = cs->nb_points();
+    invalidate_face_adjacency();
 
     if (is != size_type(-1)) { sup_convex(is); convex_tab.add_to_index(is,s); }
     else is = convex_tab.add(s);
@@ -302,6 +353,23 @@ namespace bgeot {
     return is;
   }
 
+  template<class ITER>
+  void mesh_structure::add_convexes_noverif(pconvex_structure cs,
+                                            size_type nb, ITER ipts,
+                                            std::vector<size_type> *ind) {
+    mesh_convex_structure s; s.cstruct = cs;
+    size_type nbp = cs->nb_points();
+    std::vector<size_type> icv(nb);
+    for (size_type i = 0; i < nb; ++i) {
+      icv[i] = convex_tab.add(s);
+      mesh_convex_structure::ind_pt_ct &pts = convex_tab[icv[i]].pts;
+      pts.resize(nbp);
+      for (size_type k = 0; k < nbp; ++k, ++ipts) pts[k] = *ipts;
+    }
+    link_points_of_convexes(icv);
+    if (ind) ind->swap(icv);
+  }
+
   template<class ITER>
   size_type mesh_structure::add_convex(pconvex_structure cs,
                                        ITER ipts, bool *present) {
@@ -90,6 +90,10 @@ namespace bgeot {
     size_type add_node(const base_node &pt, const scalar_type radius=0,
                        bool remove_duplicated_nodes = true);
     size_type add(const base_node &pt) { return add_node(pt); }
+    /** Add a point at a given index, without any search for an existing
+        proximate point (used to load meshes whose nodes are known to be
+        distinct). */
+    void add_node_to_index(size_type i, const base_node &pt);
     void sup_node(size_type i);
     void sup(size_type i) { sup_node(i); }
     void resort(void) { sorters = std::vector<sorter>(); }
@@ -42,6 +42,7 @@
 #include "bgeot_config.h"
 #include "dal_static_stored_objects.h"
 #include <vector>
+#include <algorithm>
 
 namespace bgeot
 {
@@ -547,6 +548,145 @@ namespace bgeot
   }
 
 
+  namespace detail {
+    template<typename T, typename ITER>
+    inline void eval_monomials_(const ITER &x, short_type n, short_type d,
+                                T *m, size_type *first, size_type *next) {
+      m[0] = T(1);
+      if (n == 0 || d == 0) return;
+      for (short_type j = 0; j < n; ++j) { m[j+1] = T(x[j]); first[j] = j+1; }
+      size_type end = n + 1;
+      for (short_type e = 2; e <= d; ++e) {
+        size_type k = end;
+        for (short_type j = 0; j < n; ++j) {
+          T a = T(x[j]);
+          next[j] = k;
+          for (size_type i = first[j]; i < end; ++i) m[k++] = a * m[i];
+        }
+        std::copy(next, next + n, first);
+        end = k;
+      }
+    }
+  }
+
+  /** Values at the point x of all the monomials of N variables and of degree
+   *  at most d, in the order of the coefficients of a polynomial (m should
+   *  be of size alpha(N, d)). The monomials of degree e are the products
+   *  of x_j with the monomials of degree e-1 depending only on
+   *  x_j, ..., x_{N-1}.
+   */
+  template<int N, typename T, typename ITER>
+  inline void eval_monomials(const ITER &x, short_type d, T *m) {
+    size_type first[N], next[N];
+    detail::eval_monomials_(x, short_type(N), d, m, first, next);
+  }
+
+  /// Same as eval_monomials<N> for a dimension n given at run time.
+  template<typename T, typename ITER>
+  void eval_monomials(const ITER &x, short_type n, short_type d, T *m) {
+    switch (n) {
+    case 0 : m[0] = T(1); return;
+    case 1 : eval_monomials<1>(x, d, m); return;
+    case 2 : eval_monomials<2>(x, d, m); return;
+    case 3 : eval_monomials<3>(x, d, m); return;
+    default : {
+      std::vector<size_type> first(n), next(n);
+      detail::eval_monomials_(x, n, d, m, &first[0], &next[0]);
+    }
+    }
+  }
+
+  /**
+   * A family of polynomials of the same dimension evaluated together: the
+   * monomials are evaluated once at the point, and the values of all the
+   * polynomials are then accumulated monomial by monomial (only on the
+   * monomials which appear in one of the polynomials at least).
+   * This is much faster than the evaluation of each polynomial for the
+   * base functions of a finite element method or of a geometric
+   * transformation and for their derivatives.
+   */
+  template<typename T> class polynomial_family {
+    short_type n, d;
+    size_type nb;
+    std::vector<size_type> monomials; // indices of the monomials used
+    std::vector<T> coeffs; // coeffs[l*nb+i] : coefficient of the monomial
+                           // monomials[l] in the polynomial i
+
+  public :
+
+    /// Number of polynomials.
+    size_type size() const { return nb; }
+    short_type dim() const { return n; }
+    short_type degree() const { return d; }
+
+    /** Initialize the family with the polynomials poly(0), ...,
+     *  poly(nbp-1). Return false (and leaves the family empty) if they do
+     *  not have all the same dimension.
+     */
+    template<typename F> bool init(size_type nbp, F poly) {
+      n = d = 0; nb = 0; monomials.clear(); coeffs.clear();
+      if (nbp == 0) return true;
+      short_type nn = poly(0).dim(), dd = 0;
+      for (size_type i = 0; i < nbp; ++i) {
+        if (poly(i).dim() != nn) return false;
+        dd = std::max(dd, poly(i).real_degree());
+      }
+      size_type M = alpha(nn, dd);
+      for (size_type k = 0; k < M; ++k) {
+        bool used = false;
+        for (size_type i = 0; i < nbp && !used; ++i)
+          used = (k < poly(i).size() && poly(i)[k] != T(0));
+        if (used || k == 0) monomials.push_back(k);
+      }
+      coeffs.resize(monomials.size() * nbp);
+      for (size_type l = 0; l < monomials.size(); ++l)
+        for (size_type i = 0; i < nbp; ++i)
+          coeffs[l*nbp+i] = (monomials[l] < poly(i).size())
+            ? poly(i)[monomials[l]] : T(0);
+      n = nn; d = dd; nb = nbp;
+      return true;
+    }
+
+    /** Evaluate all the polynomials at the point x ("x" is an iterator
+     *  pointing to the list of variables); res should be of size size().
+     */
+    template<typename ITER> void eval(const ITER &x, T *res) const {
+      const size_type MAXM = 128;
+      T mbuf[MAXM];
+      std::vector<T> mvec;
+      T *m = mbuf;
+      size_type M = alpha(n, d);
+      if (M > MAXM) { mvec.resize(M); m = &mvec[0]; }
+      eval_(x, m, res);
+    }
+
+    /** Evaluate all the polynomials at the points pts[0], ...,
+     *  pts[npt-1]. The values at the point k are stored in res(k), which
+     *  should return a pointer to size() values. The monomials are
+     *  evaluated in the same buffer for all the points.
+     */
+    template<typename PTS, typename RES>
+    void eval_points(const PTS &pts, size_type npt, RES res) const {
+      std::vector<T> m(alpha(n, d));
+      for (size_type k = 0; k < npt; ++k) eval_(pts[k].begin(), &m[0], res(k));
+    }
+
+    polynomial_family() : n(0), d(0), nb(0) {}
+
+  private :
+
+    template<typename ITER> void eval_(const ITER &x, T *m, T *res) const {
+      eval_monomials(x, n, d, m);
+      const T *c = coeffs.data();
+      std::copy(c, c + nb, res); // the first monomial is the constant one
+      c += nb;
+      for (size_type l = 1; l < monomials.size(); ++l, c += nb) {
+        T a = m[monomials[l]];
+        for (size_type i = 0; i < nb; ++i) res[i] += a * c[i];
+      }
+    }
+  };
+
   /// Print P to the output stream o. for instance cout << P;
   template<typename T>  std::ostream &operator <<(std::ostream &o,
                                                   const polynomial<T>& P) {
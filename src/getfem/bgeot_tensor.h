@@ -37,6 +37,7 @@
 #ifndef BGEOT_TENSOR_H__
 #define BGEOT_TENSOR_H__
 
+#include <cstdint>
 #include "bgeot_small_vector.h"
 #include "getfem/getfem_omp.h"
 
@@ -261,6 +262,24 @@ namespace bgeot {
       }
     }
 
+    /** Same as above for a tensor of sizes mi. */
+    inline size_type adjust_sizes_changing_last(const multi_index &mi,
+                                                size_type P) {
+      size_type d = mi.size(), e = 1;
+      sizes_.resize(d); coeff_.resize(d);
+      if (d) {
+        for (size_type k = 0; k < d; ++k)
+          { sizes_[k] = mi[k]; coeff_[k] = e; e *= mi[k]; }
+        e = coeff_.back();
+        sizes_.back() = P;
+        this->resize(e*P);
+        return e;
+      } else {
+        this->resize(1);
+        return 1;
+      }
+    }
+
     inline void remove_unit_dim() {
       if (sizes_.size()) {
 	size_type i = 0, j = 0;
@@ -559,6 +578,72 @@ namespace bgeot {
   typedef tensor<complex_type> base_complex_tensor;
 
 
+  /* ********************************************************************* */
+  /*                Class packed_tensor_tab.                               */
+  /* ********************************************************************* */
+
+  /** Values of a tensor of fixed sizes on a set of points, stored point
+      after point in a single block. The values at each point are stored as
+      those of a base_tensor (first index first) and begin on a 32 bytes
+      boundary, the size of the values of each point being padded.
+  */
+  class packed_tensor_tab {
+    std::vector<scalar_type> data;
+    multi_index sizes_;
+    size_type nb = 0, stride = 0, offset = 0;
+
+  public :
+
+    enum { ALIGNMENT = 32 / sizeof(scalar_type) };
+
+    /** Allocate (and set to zero) the values on nbpt points. */
+    void init(size_type nbpt, const multi_index &mi) {
+      sizes_ = mi; nb = nbpt;
+      size_type n = mi.total_size();
+      stride = ((n + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+      data.assign(nb * stride + ALIGNMENT - 1, scalar_type(0));
+      size_type a = size_type(reinterpret_cast<std::uintptr_t>(data.data())
+                              / sizeof(scalar_type)) % ALIGNMENT;
+      offset = a ? ALIGNMENT - a : 0;
+    }
+    /** Allocate the values on nbpt points with the sizes of t (no value at
+        all if t is empty). */
+    void init(size_type nbpt, const base_tensor &t)
+    { init(nbpt, t.size() ? t.sizes() : multi_index(1)); }
+    void clear()
+    { data = std::vector<scalar_type>(); sizes_.clear(); nb=stride=offset=0; }
+
+    bool empty() const { return nb == 0; }
+    /// number of points.
+    size_type size() const { return nb; }
+    const multi_index &sizes() const { return sizes_; }
+    /// number of values on each point.
+    size_type tensor_size() const { return sizes_.total_size(); }
+
+    /// values on the point i.
+    const scalar_type *operator[](size_type i) const
+    { GMM_ASSERT2(i < nb, "out of range"); return data.data()+offset+i*stride; }
+    scalar_type *operator[](size_type i)
+    { GMM_ASSERT2(i < nb, "out of range"); return data.data()+offset+i*stride; }
+
+    /** Copy the values on the point i in t, which is resized. */
+    void get(size_type i, base_tensor &t) const {
+      t.adjust_sizes(sizes_);
+      std::copy((*this)[i], (*this)[i] + t.size(), t.begin());
+    }
+    /** Copy the values on the point i from a container of the right size. */
+    template <typename CONT> void set(size_type i, const CONT &t) {
+      GMM_ASSERT1(size_type(t.size()) == tensor_size(), "dimensions mismatch");
+      std::copy(t.begin(), t.end(), (*this)[i]);
+    }
+
+    size_type memsize() const {
+      return data.capacity() * sizeof(scalar_type) + sizes_.memsize()
+        + sizeof(*this) - sizeof(multi_index);
+    }
+  };
+
+
 }  /* end of namespace bgeot.                                              */
 
 
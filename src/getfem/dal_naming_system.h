@@ -52,6 +52,11 @@ namespace dal {
    *
    * Methods may have parameters such as integer or other methods.
    *  The class METHOD have to derive from dal::static_stored_object
+   *
+   *  The complete names already parsed are kept with the name of the
+   *  stored method, so that a method is found again without parsing its
+   *  name. As the naming systems are singletons, there is one instance
+   *  per thread and the tables need no lock.
    */
   template <class METHOD> class naming_system {
 
@@ -86,6 +91,9 @@ namespace dal {
     std::vector<pgenfunction> genfunctions;
     std::map<std::string, std::string> shorter_names;
     std::map<std::string, std::string> aliases;
+    // complete name -> (name of the stored method, end of the name)
+    std::unordered_map<std::string,
+                       std::pair<std::string, size_type>> parsed_names;
 
     struct method_key : virtual public static_stored_object_key {
       std::string name;
@@ -100,6 +108,11 @@ namespace dal {
 	      return name == o.name;
       }
 
+      size_t hash() const override{
+	      return hash_combine(static_stored_object_key::hash(),
+	                          std::hash<std::string>()(name));
+      }
+
       method_key(const std::string &name_) : name(name_) {}
     };
 
@@ -116,8 +129,7 @@ namespace dal {
     std::string normative_name_of_method(pmethod pm) const;
     std::string shorter_name_of_method(pmethod pm) const;
     pmethod method(const std::string &name, size_type &i,
-		   bool throw_if_not_found = true)
-    { getfem::standard_locale sl; return method_(name, i, throw_if_not_found); }
+		   bool throw_if_not_found = true);
     naming_system(std::string pr) : prefix(pr) {}
     bool delete_method(std::string name);
   };
@@ -319,6 +331,34 @@ namespace dal {
 
   }
 
+  template <class METHOD>
+  typename naming_system<METHOD>::pmethod
+  naming_system<METHOD>::method(const std::string &name, size_type &i,
+				bool throw_if_not_found) {
+    if (i == 0) {
+      auto it = parsed_names.find(name);
+      if (it != parsed_names.end()) {
+	auto pnname = std::make_shared<method_key>(it->second.first);
+	pstatic_stored_object o = search_stored_object(pnname);
+	if (o) {
+	  i = it->second.second;
+	  return std::dynamic_pointer_cast<const METHOD>(o);
+	}
+      }
+    }
+
+    size_type i0 = i;
+    getfem::standard_locale sl;
+    pmethod pm = method_(name, i, throw_if_not_found);
+    if (i0 == 0 && pm.get()) {
+      pstatic_stored_object_key k = key_of_stored_object(pm);
+      const method_key *p = k.get()
+	? dynamic_cast<const method_key *>(k.get()) : nullptr;
+      if (p) parsed_names[name] = std::make_pair(p->name, i);
+    }
+    return pm;
+  }
+
   /**deletion of static_stored_object in the naming system*/
   template <class METHOD>
   bool naming_system<METHOD>::delete_method(std::string name) {
@@ -38,7 +38,8 @@ Stored object :
 
 A type of object to be stored should derive from
 dal::static_stored_object and a key should inherit from
-static_stored_object_key with an overloaded "compare" method.
+static_stored_object_key with an overloaded "compare" method, as well as
+"equal" and "hash" ones (the keys are stored in hash tables).
 
 To store a new object, you have to test if the object is not
 already stored and then call dal::add_stored_object:
@@ -73,11 +74,17 @@ std::shared_ptr are used.
 #include "dal_singleton.h"
 #include <set>
 #include <list>
+#include <vector>
+#include <typeinfo>
+#include <unordered_map>
 
 
 #include "getfem/getfem_arch_config.h"
 
 #include <atomic>
+#ifdef GETFEM_HAS_OPENMP
+  #include <shared_mutex>
+#endif
 
 #define DAL_STORED_OBJECT_DEBUG 0
 
@@ -124,6 +131,11 @@ namespace dal {
     virtual bool equal(const static_stored_object_key &) const = 0;
 
   public :
+    /** Hash value of the key, which has to be the same for two equal keys.
+        Each type of key computes it from its contents, starting from the
+        one of this class, which only depends on the type of the key. */
+    virtual size_t hash() const = 0;
+
     bool operator < (const static_stored_object_key &o) const {
       // comparaison des noms d'objet
       if (typeid(*this).before(typeid(o))) return true;
@@ -143,10 +155,40 @@ namespace dal {
     virtual ~static_stored_object_key() {}
   };
 
+  inline size_t static_stored_object_key::hash() const
+  { return typeid(*this).hash_code(); }
+
+  inline size_t hash_combine(size_t seed, size_t h)
+  { return seed ^ (h + size_t(0x9e3779b9) + (seed << 6) + (seed >> 2)); }
+
+  /** Hash value of the parameter of a simple_key: std::hash, or a
+      combination of the hash values of the components for the pairs and
+      vectors. Another type of parameter needs its own overload. */
+  template <typename T> inline size_t hash_value(const T &a)
+  { return std::hash<T>()(a); }
+
+  template <typename T1, typename T2>
+  size_t hash_value(const std::pair<T1, T2> &a);
+
+  template <typename T> size_t hash_value(const std::vector<T> &v);
+
+  template <typename T1, typename T2>
+  inline size_t hash_value(const std::pair<T1, T2> &a)
+  { return hash_combine(hash_value(a.first), hash_value(a.second)); }
+
+  template <typename T> inline size_t hash_value(const std::vector<T> &v) {
+    size_t h = v.size();
+    for (const T &x : v) h = hash_combine(h, hash_value(x));
+    return h;
+  }
+
   template <typename var_type>
   class simple_key : virtual public static_stored_object_key {
     var_type a;
   public :
+    size_t hash() const override
+    { return hash_combine(static_stored_object_key::hash(), hash_value(a)); }
+
      bool compare(const static_stored_object_key &oo) const override {
       auto &o = dynamic_cast<const simple_key &>(oo);
       return a < o.a;
@@ -203,7 +245,35 @@ namespace dal {
   /**
   base class for static stored objects
   */
-  class static_stored_object { public : virtual ~static_stored_object() {} };
+  struct stored_object_tab;
+
+  class static_stored_object {
+    // total memory of the cached data of the storage of the object, if any
+    // (not copied with the object)
+    struct memsize_total_ptr : public std::atomic<std::atomic<size_t> *> {
+      memsize_total_ptr() : std::atomic<std::atomic<size_t> *>(nullptr) {}
+      memsize_total_ptr(const memsize_total_ptr &)
+        : std::atomic<std::atomic<size_t> *>(nullptr) {}
+      memsize_total_ptr &operator =(const memsize_total_ptr &)
+      { return *this; }
+      using std::atomic<std::atomic<size_t> *>::operator =;
+    };
+    mutable memsize_total_ptr memsize_total_;
+    friend struct stored_object_tab;
+  protected :
+    /** To be called when the cached data of the object has changed, with
+        the value of cache_memsize() before the change. */
+    void cache_memsize_changed(size_t old_memsize) const {
+      std::atomic<size_t> *t = memsize_total_;
+      if (t) *t += cache_memsize() - old_memsize;
+    }
+  public :
+    /** Memory (in bytes) of the data cached by the object, which can be
+        recomputed. Only the objects with cached data may be deleted to
+        respect the memory budget (see set_stored_objects_memory_budget). */
+    virtual size_t cache_memsize() const { return 0; }
+    virtual ~static_stored_object() {}
+  };
 
   typedef std::shared_ptr<const static_stored_object> pstatic_stored_object;
 
@@ -287,6 +357,35 @@ namespace dal {
   /** Test the validity of the whole global storage */
   void test_stored_objects(void);
 
+  /** Statistics on the global storage. */
+  struct stored_objects_stats {
+    size_t nb_objects;  // number of stored objects
+    size_t hits;        // number of searches which found the object
+    size_t misses;      // number of searches which did not find it
+    size_t evictions;   // objects deleted to respect the memory budget
+    size_t memsize;     // memory of the cached data (see cache_memsize)
+  };
+
+  /** Return the statistics, summed over the storages of all the threads. */
+  stored_objects_stats stored_objects_statistics(void);
+
+  /** Reset the counters of hits, misses and evictions. */
+  void reset_stored_objects_statistics(void);
+
+  /** Set the memory budget (in bytes) for the cached data of the objects
+      stored by each thread (0 for no limit, which is the default). When an
+      object is added and the budget is exceeded, the objects with cached
+      data which have been searched the least recently are deleted, down to
+      three quarters of the budget, except the ones which are still
+      referred to outside of the storage or which other objects depend on.
+      When they cannot bring the memory under the budget, no other attempt
+      is done until the memory exceeds the one left by this attempt. The budget
+      is not enforced in parallel sections. */
+  void set_stored_objects_memory_budget(size_t bytes);
+
+  /** Return the memory budget (0 for no limit). */
+  size_t stored_objects_memory_budget(void);
+
 
   /** Pointer to an object with the dependencies */
   struct enr_static_stored_object {
@@ -295,33 +394,60 @@ namespace dal {
     const permanence perm;
     std::set<pstatic_stored_object> dependent_object;
     std::set<pstatic_stored_object> dependencies;
+    mutable std::atomic<size_t> last_use; // stamp of the last search
     enr_static_stored_object(pstatic_stored_object o, permanence perma)
-      : p(o), perm(perma) {valid = true;}
+      : p(o), perm(perma) {valid = true; last_use = 0;}
     enr_static_stored_object()
-      : perm(STANDARD_STATIC_OBJECT) {valid = true;}
+      : perm(STANDARD_STATIC_OBJECT) {valid = true; last_use = 0;}
     enr_static_stored_object(const enr_static_stored_object& enr_o)
       : p(enr_o.p), perm(enr_o.perm), dependent_object(enr_o.dependent_object),
-      dependencies(enr_o.dependencies){valid = static_cast<bool>(enr_o.perm);}
+      dependencies(enr_o.dependencies)
+    {valid = static_cast<bool>(enr_o.perm); last_use = size_t(enr_o.last_use);}
   };
 
 
 
-  /** Pointer to a key with a coherent order */
+  /** Pointer to a key, with its hash value */
   struct enr_static_stored_object_key {
     pstatic_stored_object_key p;
-    bool operator < (const enr_static_stored_object_key &o) const
-    { return (*p) < (*(o.p)); }
-    enr_static_stored_object_key(pstatic_stored_object_key o) : p(o) {}
+    size_t h;
+    bool operator == (const enr_static_stored_object_key &o) const
+    { return h == o.h && (*p) == (*(o.p)); }
+    enr_static_stored_object_key(pstatic_stored_object_key o)
+      : p(o), h(o->hash()) {}
+    enr_static_stored_object_key() : h(0) {}
+  };
+
+  struct enr_static_stored_object_key_hash {
+    size_t operator()(const enr_static_stored_object_key &k) const
+    { return k.h; }
   };
 
 
+#ifdef GETFEM_HAS_OPENMP
+  typedef std::shared_timed_mutex stored_object_mutex;
+#else
+  struct stored_object_mutex {};
+#endif
+
+  /** Table of stored objects. Thread safe: the table is divided into shards
+      according to the hash values of the keys, each one with a reader-writer
+      lock, so that the searches only take a shared lock on one shard. */
+  struct stored_object_tab {
+
+    enum { NB_SHARDS = 16 };
 
-  /** Table of stored objects. Thread safe, uses thread specific mutexes. */
-  struct stored_object_tab :
-    public std::map<enr_static_stored_object_key, enr_static_stored_object> {
+    typedef std::unordered_map<enr_static_stored_object_key,
+                               enr_static_stored_object,
+                               enr_static_stored_object_key_hash> object_tab;
+    typedef std::unordered_map<pstatic_stored_object,
+                               enr_static_stored_object_key> stored_key_tab;
 
-    typedef std::map<pstatic_stored_object,pstatic_stored_object_key>
-      stored_key_tab;
+    struct shard {
+      object_tab objects;  // objects whose key hash falls in this shard
+      stored_key_tab keys; // keys of the objects whose address falls in it
+      mutable stored_object_mutex mutex;
+    };
 
     stored_object_tab();
     ~stored_object_tab();
@@ -329,11 +455,13 @@ namespace dal {
       search_stored_object(pstatic_stored_object_key k) const;
     bool has_dependent_objects(pstatic_stored_object o) const;
     bool exists_stored_object(pstatic_stored_object o) const;
+    pstatic_stored_object_key key_of_object_(pstatic_stored_object o) const;
     //adding the object to the storage on the current thread
     void add_stored_object(pstatic_stored_object_key k, pstatic_stored_object o,
     permanence perm);
 
-    iterator iterator_of_object_(pstatic_stored_object o);
+    //record of the object, nullptr if it is not on this thread
+    enr_static_stored_object *entry_of_object_(pstatic_stored_object o);
     //delete o2 from the dependency list of o1
     //true if successfull, false if o1 is not
     //on this thread
@@ -355,11 +483,44 @@ namespace dal {
     bool add_dependent_(pstatic_stored_object o1,
     pstatic_stored_object o2);
     void basic_delete_(std::list<pstatic_stored_object> &to_delete);
-
-    getfem::lock_factory locks_;
-    stored_key_tab stored_keys_;
+    //number of objects and number of keys of this thread
+    size_t nb_objects_() const;
+    size_t nb_keys_() const;
+    //memory of the cached data of the objects of this thread
+    size_t cache_memsize_() const;
+    //select the objects to be deleted to respect the memory budget
+    void select_evictions_(size_t budget,
+                           std::list<pstatic_stored_object> &to_delete);
+
+    //call f on the record of each object, under a shared lock of its shard
+    //(f should not access the storage)
+    template <typename F> void for_each_object_(F f) const;
+
+    shard shards_[NB_SHARDS];
+    //clock giving the stamps of the searches
+    mutable std::atomic<size_t> clock_{0};
+    std::atomic<size_t> hits_{0}, misses_{0}, evictions_{0};
+    //memory of the cached data of the objects of this thread
+    std::atomic<size_t> memsize_total_{0};
+    //memory left by the last eviction which could not respect the budget
+    std::atomic<size_t> failed_eviction_memsize_{0};
   };
 
+#ifdef GETFEM_HAS_OPENMP
+  template <typename F> void stored_object_tab::for_each_object_(F f) const {
+    for (const auto &s : shards_) {
+      std::shared_lock<stored_object_mutex> guard(s.mutex, std::defer_lock);
+      if (getfem::me_is_multithreaded_now()) guard.lock();
+      for (const auto &pair : s.objects) f(pair.second);
+    }
+  }
+#else
+  template <typename F> void stored_object_tab::for_each_object_(F f) const {
+    for (const auto &s : shards_)
+      for (const auto &pair : s.objects) f(pair.second);
+  }
+#endif
+
 
 
   /** delete all the specific type of stored objects*/
@@ -368,10 +529,11 @@ namespace dal {
     std::list<pstatic_stored_object> delete_object_list;
 
     auto filter_objects = [&](stored_object_tab &stored_objects){
-      for(auto &&pair : stored_objects){
-        auto p_object = std::dynamic_pointer_cast<const OBJECT_TYPE>(pair.second.p);
-        if(p_object != nullptr) delete_object_list.push_back(pair.second.p);
-      }
+      stored_objects.for_each_object_
+        ([&](const enr_static_stored_object &e){
+          auto p_object = std::dynamic_pointer_cast<const OBJECT_TYPE>(e.p);
+          if(p_object != nullptr) delete_object_list.push_back(e.p);
+        });
     };
 
     if (!all_threads){
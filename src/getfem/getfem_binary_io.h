@@ -0,0 +1,159 @@
+/* -*- c++ -*- (enables emacs c++ mode) */
+/*===========================================================================
+
+ Copyright (C) 2020 Yves Renard
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+ As a special exception, you  may use  this file  as it is a part of a free
+ software  library  without  restriction.  Specifically,  if   other  files
+ instantiate  templates  or  use macros or inline functions from this file,
+ or  you compile this  file  and  link  it  with other files  to produce an
+ executable, this file  does  not  by itself cause the resulting executable
+ to be covered  by the GNU Lesser General Public License.  This   exception
+ does not  however  invalidate  any  other  reasons why the executable file
+ might be covered by the GNU Lesser General Public License.
+
+===========================================================================*/
+
+/**@file getfem_binary_io.h
+   @author  Yves Renard <Yves.Renard@insa-lyon.fr>
+   @date October 2020.
+   @brief Versioned binary container with a section table, used by the
+   binary formats of mesh, mesh_fem and mesh_im.
+
+   A binary file is made of a header, of a sequence of named sections
+   (raw data, each one aligned on 8 bytes) and of a section table stored
+   at the end of the file:
+
+     - header: magic "GETFEMBF", format version (uint32), endianness mark
+       0x01020304 (uint32), file type (32 chars), number of sections
+       (uint64) and offset of the section table (uint64).
+
+     - section table: for each section, its name (48 chars), its offset
+       and its size in bytes (uint64).
+
+   The reader maps the file in memory (mmap) when possible so that the
+   sections can be accessed without any copy.
+*/
+#ifndef GETFEM_BINARY_IO_H__
+#define GETFEM_BINARY_IO_H__
+
+#include <fstream>
+#include <map>
+#include "getfem_config.h"
+
+namespace getfem {
+
+  /** Writes a binary file section by section. */
+  class binary_file_writer {
+  public:
+    struct section_desc {
+      std::string name;
+      gmm::uint64_type offset, nbytes;
+    };
+
+  protected:
+    std::ofstream f;
+    std::string fname;
+    std::vector<section_desc> table;
+    gmm::uint64_type pos;
+
+    void write_raw(const void *data, gmm::uint64_type nbytes);
+    void align();
+
+  public:
+    /// Write a raw section of nbytes bytes.
+    void write_section(const std::string &name, const void *data,
+                       size_type nbytes);
+    /// Write a section containing the elements of a vector.
+    template <typename T>
+    void write_section(const std::string &name, const std::vector<T> &v)
+    { write_section(name, v.data(), v.size() * sizeof(T)); }
+    /// Write a list of strings (separated by '\0').
+    void write_strings(const std::string &name,
+                       const std::vector<std::string> &l);
+    /// Write the section table and close the file.
+    void close();
+    const std::string &filename() const { return fname; }
+
+    binary_file_writer(const std::string &name,
+                       const std::string &file_type);
+    ~binary_file_writer();
+  };
+
+  /** Reads a binary file written by binary_file_writer. */
+  class binary_file_reader {
+  public:
+    struct section_desc {
+      gmm::uint64_type offset, nbytes;
+    };
+
+  protected:
+    std::string fname, ftype;
+    const char *data;
+    size_type data_size;
+    bool mapped;
+    std::vector<char> buffer; /* when the file cannot be mapped */
+    std::map<std::string, section_desc> table;
+
+    void read_table_(const std::string &file_type);
+
+  public:
+    const std::string &file_type() const { return ftype; }
+    const std::string &filename() const { return fname; }
+    bool has_section(const std::string &name) const
+    { return table.find(name) != table.end(); }
+    /// Pointer on the data of a section (no copy), nbytes is its size.
+    const void *section(const std::string &name, size_type &nbytes) const;
+    /// Pointer on the data of a section seen as an array of n elements.
+    template <typename T>
+    const T *section_as(const std::string &name, size_type &n) const {
+      size_type nbytes;
+      const void *p = section(name, nbytes);
+      GMM_ASSERT1(nbytes % sizeof(T) == 0, "Section '" << name
+                  << "' of file '" << fname << "' has a wrong size");
+      n = nbytes / sizeof(T);
+      return static_cast<const T *>(p);
+    }
+    /// Copy of a section in a vector.
+    template <typename T>
+    void read_section(const std::string &name, std::vector<T> &v) const {
+      size_type n;
+      const T *p = section_as<T>(name, n);
+      v.assign(p, p+n);
+    }
+    /// Read a list of strings written with write_strings.
+    void read_strings(const std::string &name,
+                      std::vector<std::string> &l) const;
+
+    /** Open the file. If file_type is not empty, it is checked against
+        the type of the file. */
+    binary_file_reader(const std::string &name,
+                       const std::string &file_type = "");
+    ~binary_file_reader();
+
+    binary_file_reader(const binary_file_reader &) = delete;
+    binary_file_reader &operator =(const binary_file_reader &) = delete;
+  };
+
+  /** Return true if the file begins with the magic of the binary files. */
+  bool is_binary_file(const std::string &name);
+
+}  /* end of namespace getfem.                                             */
+
+
+#endif /* GETFEM_BINARY_IO_H__                                            */
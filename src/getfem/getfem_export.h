@@ -41,6 +41,10 @@
 #include "getfem_interpolation.h"
 #include "getfem_mesh_slice.h"
 #include <list>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace getfem {
 
@@ -64,6 +68,11 @@ namespace getfem {
       legacy and serial vtkUnstructuredGrid)
 
       A vtk_export can store multiple scalar/vector fields.
+
+      In binary mode, the data of a vtu file is written inline, encoded in
+      base64, unless set_appended_binary() is called. It is then written
+      as raw blocks with 64 bits headers, possibly compressed with zlib,
+      in an AppendedData section at the end of the file.
   */
   class vtk_export {
   protected:
@@ -79,6 +88,10 @@ namespace getfem {
     dim_type dim_;
     bool reverse_endian;
     std::vector<unsigned char> vals;
+    bool appended;    // vtu only: raw binary data appended to the file
+    bool compressed;  // appended data compressed with zlib
+    size_type block_start;
+    std::vector<unsigned char> appended_data; // compressed blocks
     enum { EMPTY, HEADER_WRITTEN, STRUCTURE_WRITTEN, IN_CELL_DATA,
            IN_POINT_DATA } state;
 
@@ -88,6 +101,8 @@ namespace getfem {
     void write_separ();
     void clear_vals();
     void write_vals();
+    void write_format();
+    void append_compressed_vals();
 
   public:
     vtk_export(const std::string& fname, bool ascii_ = false, bool vtk_= true);
@@ -96,8 +111,18 @@ namespace getfem {
     /** should be called before write_*_data */
     void exporting(const mesh& m);
     void exporting(const mesh_fem& mf);
+    /** export only the convexes of cvlst (for instance one piece of a
+        partitioned mesh) */
+    void exporting(const mesh_fem& mf, const dal::bit_vector &cvlst);
     void exporting(const stored_mesh_slice& sl);
 
+    /** vtu only: write the binary data as raw blocks appended at the end
+        of the file instead of base64 inline data, compressed with zlib if
+        compress is true (and if GetFEM is built with zlib). Should be
+        called before any write_mesh or write_dataset. The appended data
+        is kept in memory until the file is completed. */
+    void set_appended_binary(bool compress = true);
+
     /** the header is the second line of text in the exported file,
        you can put whatever you want -- call this before any write_dataset
        or write_mesh */
@@ -167,8 +192,7 @@ namespace getfem {
       } else {
         union { T value; unsigned char bytes[sizeof(T)]; } UNION;
         UNION.value = v;
-        for (size_type i=0; i < sizeof(T); i++)
-          vals.push_back(UNION.bytes[i]);
+        vals.insert(vals.end(), UNION.bytes, UNION.bytes + sizeof(T));
       }
     }
   }
@@ -244,7 +268,7 @@ namespace getfem {
     if (cell_data) {
       switch_to_cell_data();
       nb_val = psl ? psl->linked_mesh().convex_index().card()
-                   : pmf->linked_mesh().convex_index().card();
+                   : pmf->convex_index().card();
     } else {
       switch_to_point_data();
       nb_val = psl ? psl->nb_points() : pmf_dof_used.card();
@@ -255,23 +279,25 @@ namespace getfem {
                 "inconsistency in the size of the dataset: "
                 << gmm::vect_size(U) << " != " << nb_val << "*" << Q);
     if (vtk) write_separ();
-    if (!vtk && !ascii) write_val(float(gmm::vect_size(U)));
+    if (!vtk && !ascii && !appended) write_val(float(gmm::vect_size(U)));
     if (Q == 1) {
       if (vtk)
         os << "SCALARS " << remove_spaces(name) << " float 1\n"
            << "LOOKUP_TABLE default\n";
-      else
-        os << "<DataArray type=\"Float32\" Name=\"" << remove_spaces(name) << "\" "
-           << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
+      else {
+        os << "<DataArray type=\"Float32\" Name=\"" << remove_spaces(name) << "\" ";
+        write_format();
+      }
       for (size_type i=0; i < nb_val; ++i)
         write_val(float(U[i]));
     } else if (Q <= 3) {
       if (vtk)
         os << "VECTORS " << remove_spaces(name) << " float\n";
-      else
+      else {
         os << "<DataArray type=\"Float32\" Name=\"" << remove_spaces(name) << "\" "
-           << "NumberOfComponents=\"3\" "
-           << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
+           << "NumberOfComponents=\"3\" ";
+        write_format();
+      }
       for (size_type i=0; i < nb_val; ++i)
         write_vec(U.begin() + i*Q, Q);
     } else if (Q == gmm::sqr(dim_)) {
@@ -280,10 +306,11 @@ namespace getfem {
        */
       if (vtk)
         os << "TENSORS " << remove_spaces(name) << " float\n";
-      else
+      else {
         os << "<DataArray type=\"Float32\" Name=\"" << remove_spaces(name)
-           << "\" NumberOfComponents=\"9\" "
-           << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
+           << "\" NumberOfComponents=\"9\" ";
+        write_format();
+      }
       for (size_type i=0; i < nb_val; ++i)
         write_3x3tensor(U.begin() + i*Q);
     } else
@@ -291,7 +318,7 @@ namespace getfem {
                          + " does not accept vectors of dimension > 3");
     write_vals();
     if (vtk) write_separ();
-    if (!vtk) os << "\n" << "</DataArray>\n";
+    if (!vtk && !appended) os << "\n" << "</DataArray>\n";
   }
 
 
@@ -301,6 +328,249 @@ namespace getfem {
     vtu_export(std::ostream &os_, bool ascii_ = false) : vtk_export(os_, ascii_, false) {}
   };
 
+  /** @brief Parallel VTU export (.pvtu file and its .vtu pieces).
+
+      The convexes of the exported mesh_fem are distributed into pieces,
+      each piece being written concurrently in its own vtu file
+      basename_i.vtu, with appended binary data (compressed if zlib is
+      available). The file basename.pvtu referencing the pieces is written
+      when the export is completed (call to close() or destructor).
+
+      Without MPI, the convexes are split into nb_pieces ranges of
+      consecutive convexes (by default one per thread). With MPI
+      (GETFEM_PARA_LEVEL > 1), each process writes the piece of its mpi
+      region and the .pvtu file is written by the process of rank 0.
+  */
+  class pvtu_export {
+    std::string basename;
+    bool compress;
+    std::unique_ptr<mesh_fem> pmf;
+    std::vector<std::unique_ptr<vtu_export> > pieces;
+    std::vector<size_type> cv_ofs;  // first cell of each local piece
+    size_type nb_cells, nb_total_pieces, first_piece;
+    std::vector<std::string> point_arrays, cell_arrays;
+    bool closed;
+
+    static size_type nb_components(size_type Q);
+    void check_exporting() const;
+  public:
+    pvtu_export(const std::string &basename_, bool compress_ = true);
+    ~pvtu_export(); // the .pvtu file is written by the destructor
+    /** should be called before write_*_data. A nb_pieces of 0 stands
+        for the number of threads. */
+    void exporting(const mesh &m, size_type nb_pieces = 0);
+    void exporting(const mesh_fem &mf, size_type nb_pieces = 0);
+    void write_mesh();
+    /** append a new scalar or vector field defined on mf to each piece. */
+    template<class VECT> void write_point_data(const mesh_fem &mf,
+                                               const VECT &U,
+                                               const std::string &name);
+    /** export data which is constant over each element. U should have
+        one value (or qdim values) per exported convex, in the order of
+        the convex numbers. */
+    template<class VECT> void write_cell_data(const VECT &U,
+                                              const std::string &name,
+                                              size_type qdim = 1);
+    /** complete the pieces and write the .pvtu file */
+    void close();
+  };
+
+  template<class VECT>
+  void pvtu_export::write_point_data(const mesh_fem &mf, const VECT &U,
+                                     const std::string &name) {
+    check_exporting();
+    size_type nbd = mf.nb_dof();
+    GMM_ASSERT1(nbd && gmm::vect_size(U) % nbd == 0,
+                "inconsistency in the size of the dataset");
+    size_type Q = (gmm::vect_size(U) / nbd) * mf.get_qdim();
+    size_type nc = nb_components(Q);
+    auto write_piece = [&](size_type i) {
+      pieces[i]->write_point_data(mf, U, name);
+    };
+    GETFEM_OMP_FOR(size_type i = 0, i < pieces.size(), ++i, write_piece(i));
+    std::stringstream ss;
+    ss << "<PDataArray type=\"Float32\" Name=\"" << remove_spaces(name)
+       << "\" NumberOfComponents=\"" << nc << "\"/>\n";
+    point_arrays.push_back(ss.str());
+  }
+
+  template<class VECT>
+  void pvtu_export::write_cell_data(const VECT &U, const std::string &name,
+                                    size_type qdim) {
+    check_exporting();
+    GMM_ASSERT1(nb_cells && gmm::vect_size(U) % nb_cells == 0,
+                "inconsistency in the size of the dataset: "
+                << gmm::vect_size(U) << " is not a multiple of " << nb_cells);
+    size_type Q = gmm::vect_size(U) / nb_cells;
+    GMM_ASSERT1(qdim == 1 || Q == qdim, "inconsistent qdim");
+    size_type nc = nb_components(Q);
+    auto write_piece = [&](size_type i) {
+      std::vector<scalar_type> V(Q*(cv_ofs[i+1] - cv_ofs[i]));
+      for (size_type j = 0; j < V.size(); ++j) V[j] = U[Q*cv_ofs[i] + j];
+      pieces[i]->write_cell_data(V, name, qdim);
+    };
+    GETFEM_OMP_FOR(size_type i = 0, i < pieces.size(), ++i, write_piece(i));
+    std::stringstream ss;
+    ss << "<PDataArray type=\"Float32\" Name=\"" << remove_spaces(name)
+       << "\" NumberOfComponents=\"" << nc << "\"/>\n";
+    cell_arrays.push_back(ss.str());
+  }
+
+  /** @brief Writer of ParaView collection files (.pvd).
+
+      A pvd file references a series of vtu or pvtu files, typically the
+      time steps of a transient computation. The file is rewritten at each
+      call to add_dataset, so that it is always complete. With MPI, it
+      should be used by a single process.
+  */
+  class pvd_export {
+    std::string filename;
+    std::vector<std::string> datasets;
+  public:
+    pvd_export(const std::string &fname) : filename(fname) {}
+    /** add the file fname (whose path is relative to the one of the pvd
+        file) to the collection, with the given time value and part. */
+    void add_dataset(const std::string &fname, scalar_type time,
+                     size_type part = 0);
+  };
+
+  /** @brief Export of a time series to the XDMF format.
+
+      The geometry (a mesh, a mesh_fem or a stored_mesh_slice) is written
+      only once, and each time step adds only its fields. The data is
+      stored in raw binary form in the file basename.bin and described by
+      the XDMF index basename.xmf (readable by ParaView or VisIt), which
+      contains a temporal collection of grids sharing the same topology
+      and geometry.
+
+      The datasets of a step are converted to single precision by the
+      calling thread; the step is then handed to a background thread which
+      appends it to the binary file and rewrites the index, so that the
+      index always describes complete steps. At most nb_buffers steps are
+      pending, the calling thread waiting for the writer if needed.
+
+      @code
+        getfem::xdmf_series_export exp("result");
+        exp.exporting(mf);
+        for (scalar_type t = 0; t < T; t += dt) {
+          ... compute U
+          exp.begin_step(t);
+          exp.write_point_data(mf, U, "u");
+          exp.end_step();
+        }
+      @endcode
+  */
+  class xdmf_series_export {
+    std::string basename, binname;
+    const stored_mesh_slice *psl;
+    std::unique_ptr<mesh_fem> pmf;
+    dal::bit_vector pmf_dof_used;
+    std::vector<unsigned> pmf_mapping_type;
+    dim_type dim_;
+    size_type nb_points, nb_cells;
+    std::string geometry;    // xml description of the topology and geometry
+    size_type data_size;     // size of the data handed to the writer
+    size_type nb_steps;
+    bool in_step, closed;
+
+    struct chunk {
+      std::vector<unsigned char> data;
+      std::string grid;      // xml description of the step, if any
+    };
+    chunk current;
+    std::deque<chunk> pending;
+    size_type nb_buffers;
+    std::ofstream binfile;
+    std::string grids;       // accessed by the writer thread only
+    std::string error;
+    bool stop;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread writer;
+
+    void check_exporting() const;
+    std::string data_item(size_type nb, size_type nc, bool real);
+    void write_dataset_(const std::vector<scalar_type> &U,
+                        const std::string &name, size_type qdim,
+                        bool cell_data);
+    void push(chunk &&c);
+    void stop_writer();
+    void writer_loop();
+    void write_index();
+  public:
+    xdmf_series_export(const std::string &basename_, size_type nb_buffers_=2);
+    ~xdmf_series_export(); // waits for the completion of the pending steps
+    /** should be called before write_mesh or begin_step */
+    void exporting(const mesh &m);
+    void exporting(const mesh_fem &mf);
+    void exporting(const stored_mesh_slice &sl);
+    /** write the geometry (done at the first step if not called) */
+    void write_mesh();
+    /** start a new time step */
+    void begin_step(scalar_type time);
+    /** add a scalar or vector field defined on mf to the current step.
+        If a slice is exported, or if mf is not the exported mesh_fem,
+        U is interpolated. */
+    template<class VECT> void write_point_data(const mesh_fem &mf,
+                                               const VECT &U,
+                                               const std::string &name);
+    /** add a field already interpolated on the exported slice. */
+    template<class VECT> void write_sliced_point_data(const VECT &Uslice,
+                                                      const std::string &name,
+                                                      size_type qdim = 1);
+    /** add data which is constant over each element (not for slices).
+        U should have convex_index().card() values (or qdim times more). */
+    template<class VECT> void write_cell_data(const VECT &U,
+                                              const std::string &name,
+                                              size_type qdim = 1);
+    /** hand the current step to the writer thread */
+    void end_step();
+    /** wait until everything handed to the writer is on disk */
+    void flush();
+    /** complete the current step and the export */
+    void close();
+  };
+
+  template<class VECT>
+  void xdmf_series_export::write_point_data(const mesh_fem &mf,
+                                            const VECT &U,
+                                            const std::string &name) {
+    check_exporting();
+    size_type Q = (gmm::vect_size(U) / mf.nb_dof()) * mf.get_qdim();
+    std::vector<scalar_type> V;
+    if (psl) {
+      V.resize(Q*psl->nb_points());
+      psl->interpolate(mf, U, V);
+    } else {
+      std::vector<scalar_type> W(pmf->nb_dof() * Q);
+      if (&mf != pmf.get()) interpolation(mf, *pmf, U, W);
+      else gmm::copy(U, W);
+      V.resize(Q*pmf_dof_used.card());
+      size_type cnt = 0;
+      for (dal::bv_visitor d(pmf_dof_used); !d.finished(); ++d, ++cnt)
+        for (size_type q=0; q < Q; ++q) V[cnt*Q + q] = W[d*Q + q];
+    }
+    write_dataset_(V, name, Q, false);
+  }
+
+  template<class VECT>
+  void xdmf_series_export::write_sliced_point_data(const VECT &U,
+                                                   const std::string &name,
+                                                   size_type qdim) {
+    std::vector<scalar_type> V(gmm::vect_size(U));
+    gmm::copy(U, V);
+    write_dataset_(V, name, qdim, false);
+  }
+
+  template<class VECT>
+  void xdmf_series_export::write_cell_data(const VECT &U,
+                                           const std::string &name,
+                                           size_type qdim) {
+    std::vector<scalar_type> V(gmm::vect_size(U));
+    gmm::copy(U, V);
+    write_dataset_(V, name, qdim, true);
+  }
+
   /** @brief A (quite large) class for exportation of data to IBM OpenDX.
 
                      http://www.opendx.org/
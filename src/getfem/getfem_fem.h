@@ -438,6 +438,20 @@ namespace getfem {
      */
     virtual void hess_base_value(const base_node &x, base_tensor &t) const = 0;
 
+    /** Give the values of all components of the base functions at all the
+     *  points of pts: the tensor of the point i of the packed tab t is the
+     *  one given by base_value. The default version calls base_value on
+     *  each point. Used by fem_precomp.
+     */
+    virtual void base_values(const bgeot::stored_point_tab &pts,
+                             bgeot::packed_tensor_tab &t) const;
+    /// Same as base_values for the gradients (grad_base_value).
+    virtual void grad_base_values(const bgeot::stored_point_tab &pts,
+                                  bgeot::packed_tensor_tab &t) const;
+    /// Same as base_values for the hessians (hess_base_value).
+    virtual void hess_base_values(const bgeot::stored_point_tab &pts,
+                                  bgeot::packed_tensor_tab &t) const;
+
     /** Give the value of all components of the base functions at the
         current point of the fem_interpolation_context.  Used by
         elementary computations.  if withM is false the matrix M for
@@ -508,6 +522,13 @@ namespace getfem {
     mutable std::vector<std::vector<FUNC>> grad_, hess_;
     mutable bool grad_computed_ = false;
     mutable bool hess_computed_ = false;
+    // evaluation of all the base functions and derivatives together
+    // (only for the polynomial fems)
+    mutable bgeot::polynomial_family<bgeot::opt_long_scalar_type>
+      val_family_, grad_family_, hess_family_;
+    mutable bool families_computed_ = false, families_valid_ = false;
+
+    void compute_families_() const; // defined for the polynomial fems
 
     void compute_grad_() const {
       if (grad_computed_) return;
@@ -593,8 +614,33 @@ namespace getfem {
 	    *it = bgeot::to_scalar(hess_[i][j+k*n].eval(x.begin()));
     }
 
+    void base_values(const bgeot::stored_point_tab &pts,
+                     bgeot::packed_tensor_tab &t) const
+    { virtual_fem::base_values(pts, t); }
+    void grad_base_values(const bgeot::stored_point_tab &pts,
+                          bgeot::packed_tensor_tab &t) const
+    { virtual_fem::grad_base_values(pts, t); }
+    void hess_base_values(const bgeot::stored_point_tab &pts,
+                          bgeot::packed_tensor_tab &t) const
+    { virtual_fem::hess_base_values(pts, t); }
+
   };
 
+  /* Fast evaluation of the polynomial fems with polynomial families. */
+  template<> void fem<bgeot::base_poly>::compute_families_() const;
+  template<> void fem<bgeot::base_poly>::base_value(const base_node &x,
+                                                    base_tensor &t) const;
+  template<> void fem<bgeot::base_poly>::grad_base_value(const base_node &x,
+                                                         base_tensor &t) const;
+  template<> void fem<bgeot::base_poly>::hess_base_value(const base_node &x,
+                                                         base_tensor &t) const;
+  template<> void fem<bgeot::base_poly>::base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const;
+  template<> void fem<bgeot::base_poly>::grad_base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const;
+  template<> void fem<bgeot::base_poly>::hess_base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const;
+
   /** Classical polynomial FEM. */
   typedef const fem<bgeot::base_poly> * ppolyfem;
   /** Polynomial composite FEM */
@@ -650,35 +696,52 @@ namespace getfem {
      Pre-computations on a fem (given a fixed set of points on the
      reference convex, this object computes the value/gradient/hessian
      of all base functions on this set of points and stores them.
+     The values of all the points are stored in a single block (see
+     bgeot::packed_tensor_tab). val(i), grad(i) and hess(i) give them as
+     one tensor per point, built on their first call.
   */
   class fem_precomp_ : virtual public dal::static_stored_object {
   protected:
     const pfem pf;
     const bgeot::pstored_point_tab pspt;
-    mutable std::vector<base_tensor> c;   // stored values of base functions
-    mutable std::vector<base_tensor> pc;  // stored gradients of base functions
-    mutable std::vector<base_tensor> hpc; // stored hessians of base functions
+    mutable bgeot::packed_tensor_tab c;   // stored values of base functions
+    mutable bgeot::packed_tensor_tab pc;  // stored gradients of base functions
+    mutable bgeot::packed_tensor_tab hpc; // stored hessians of base functions
+    // the same ones, one tensor per point (only for val, grad and hess)
+    mutable std::vector<base_tensor> c_pts, pc_pts, hpc_pts;
   public:
-    /// returns values of the base functions
+    /// values of the base functions on all the points
+    inline const bgeot::packed_tensor_tab &vals() const
+      { if (c.empty()) init_val(); return c; }
+    /// gradients of the base functions on all the points
+    inline const bgeot::packed_tensor_tab &grads() const
+      { if (pc.empty()) init_grad(); return pc; }
+    /// hessians of the base functions on all the points
+    inline const bgeot::packed_tensor_tab &hessians() const
+      { if (hpc.empty()) init_hess(); return hpc; }
+    /// values of the base functions on point i
     inline const base_tensor &val(size_type i) const
-      { if (c.empty()) init_val(); return c[i]; }
-    /// returns gradients of the base functions
+      { if (c_pts.empty()) unpack_(vals(), c_pts); return c_pts[i]; }
+    /// gradients of the base functions on point i
     inline const base_tensor &grad(size_type i) const
-      { if (pc.empty()) init_grad(); return pc[i]; }
-    /// returns hessians of the base functions
+      { if (pc_pts.empty()) unpack_(grads(), pc_pts); return pc_pts[i]; }
+    /// hessians of the base functions on point i
     inline const base_tensor &hess(size_type i) const
-      { if (hpc.empty()) init_hess(); return hpc[i]; }
+      { if (hpc_pts.empty()) unpack_(hessians(), hpc_pts); return hpc_pts[i]; }
     inline pfem get_pfem() const { return pf; }
     // inline const bgeot::stored_point_tab& get_point_tab() const
     //  { return *pspt; }
     inline bgeot::pstored_point_tab get_ppoint_tab() const
     { return pspt; }
+    size_t cache_memsize() const override;
     fem_precomp_(const pfem, const bgeot::pstored_point_tab);
     ~fem_precomp_() { DAL_STORED_OBJECT_DEBUG_DESTROYED(this, "Fem_precomp"); }
   private:
     void init_val() const;
     void init_grad() const;
     void init_hess() const;
+    void unpack_(const bgeot::packed_tensor_tab &p,
+                 std::vector<base_tensor> &v) const;
   };
 
 
@@ -698,13 +761,16 @@ namespace getfem {
 
      If you need a set of "temporary" getfem::fem_precomp_, create
      them via a getfem::fem_precomp_pool structure. All memory will be
-     freed when this structure will be destroyed.  */
+     freed when this structure will be destroyed. The unused objects of
+     the global pool can also be deleted automatically by setting a
+     memory budget (see dal::set_stored_objects_memory_budget).  */
   pfem_precomp fem_precomp(pfem pf, bgeot::pstored_point_tab pspt,
                            dal::pstatic_stored_object dep);
 
-  /** Request for the removal of a pfem_precomp */
+  /** Request for the removal of a pfem_precomp (it may already have been
+      removed to respect the memory budget of the storage). */
   inline void delete_fem_precomp(pfem_precomp pfp)
-  { dal::del_stored_object(pfp); }
+  { dal::del_stored_object(pfp, true); }
 
 
   /**
@@ -55,22 +55,64 @@ namespace getfem {
     mutable std::vector<std::vector<size_type> > index_of_global_dof_;
     mutable bgeot::pstored_point_tab pspt_override;
 
-    struct precomp_data { std::vector<base_tensor> val, grad, hess; };
+  public :
+    /// Statistics of the cache of the values of the base functions.
+    struct precomp_statistics {
+      size_type nb_hits, nb_misses, nb_evictions;
+      size_type nb_entries, memory; // current number of entries and bytes
+      precomp_statistics()
+        : nb_hits(0), nb_misses(0), nb_evictions(0), nb_entries(0),
+          memory(0) {}
+    };
+
+  protected :
+    // values (data[0]), gradients (data[1]) and hessians (data[2]) of the
+    // base functions on all the points of a point tab, stored point by point
+    // with the layout of the tensors of real_*base_value.
+    // The stamp of last use is updated by the readers of the cache, which
+    // only share its lock.
+    struct precomp_data {
+      std::array<base_vector, 3> data;
+      std::atomic<size_type> last_use;
+      precomp_data() : last_use(0) {}
+    };
 
     class precomp_pool
     : virtual public dal::static_stored_object,
       public std::vector< std::map<bgeot::pstored_point_tab,
                                    precomp_data > >
-    {};
+    {
+    public :
+      // number of convexes with an entry for each point tab. The
+      // dependency of the pool on a point tab is removed with its last entry.
+      std::map<bgeot::pstored_point_tab, size_type> nb_uses;
+    };
 
     // store values, gradients and hessians of base functions
     mutable std::shared_ptr<precomp_pool> precomps;
+    mutable precomp_statistics precomps_stats;
+    mutable std::atomic<size_type> precomps_hits;
+    mutable std::atomic<size_type> precomps_counter;
+    mutable size_type precomps_memory_limit;
+    shared_lock_factory precomps_locks;
 
     DAL_SIMPLE_KEY(precomp_pool_key, std::shared_ptr<precomp_pool>);
 
     void init();
     virtual void update_from_context() const;
+    void compute_precomp(size_type cv, const bgeot::stored_point_tab &ptab,
+                         size_type order, base_vector &v) const;
+    void precomp_value(const fem_interpolation_context &c, size_type order,
+                       base_tensor &t) const;
+    void evict_precomps() const;
   public :
+    /** Statistics of the cache of the values, gradients and hessians of
+        the base functions on the integration points of each convex. */
+    precomp_statistics cache_statistics() const;
+    /** Set the maximal memory (in bytes) used by the cache. When it is
+        exceeded, the least recently used entries are removed. */
+    void set_cache_memory_limit(size_type bytes) const;
+    size_type cache_memory_limit() const { return precomps_memory_limit; }
     virtual size_type nb_dof(size_type cv) const;
     virtual size_type index_of_global_dof(size_type cv, size_type i) const;
     virtual bgeot::pconvex_ref ref_convex(size_type cv) const;
@@ -164,6 +164,8 @@ namespace getfem {
       const mesh_im *im;
       ga_if_hierarchy current_hierarchy;
       std::map<std::string, base_vector> local_dofs;
+      // points of the im_data on the current element
+      std::map<const im_data *, im_data::element_points> imd_points;
       std::map<const mesh_fem *, pfem_precomp> pfps;
       std::map<const mesh_fem *, std::list<ga_if_hierarchy>> pfp_hierarchy;
       std::map<const mesh_fem *, base_tensor> base;
@@ -59,6 +59,21 @@ namespace getfem {
     virtual void hess(const fem_interpolation_context&, base_matrix&) const
     { GMM_ASSERT1(false, "this global_function has no hessian"); }
 
+    /** Values (v[k]), gradients (g(:,k)) and hessians (h(:,k), of size
+        dim()*dim()) at all the points pts[k] of the reference element of
+        the convex of the context c, whose point is modified. The default
+        versions loop on the points, they should be overloaded when the
+        evaluation can be shared by the points of a convex. */
+    virtual void val_of_points(fem_interpolation_context &c,
+                               const std::vector<base_node> &pts,
+                               base_vector &v) const;
+    virtual void grad_of_points(fem_interpolation_context &c,
+                                const std::vector<base_node> &pts,
+                                base_matrix &g) const;
+    virtual void hess_of_points(fem_interpolation_context &c,
+                                const std::vector<base_node> &pts,
+                                base_matrix &h) const;
+
     virtual bool is_in_support(const base_node & /* pt */ ) const { return true; }
     virtual void bounding_box(base_node &bmin, base_node &bmax) const {
       GMM_ASSERT1(bmin.size() == dim_ && bmax.size() == dim_,
@@ -157,6 +172,18 @@ namespace getfem {
     { f->grad(c, g); }
     virtual void hess(const fem_interpolation_context &c, base_matrix &h) const
     { f->hess(c, h); }
+    virtual void val_of_points(fem_interpolation_context &c,
+                               const std::vector<base_node> &pts,
+                               base_vector &v) const
+    { f->val_of_points(c, pts, v); }
+    virtual void grad_of_points(fem_interpolation_context &c,
+                                const std::vector<base_node> &pts,
+                                base_matrix &g) const
+    { f->grad_of_points(c, pts, g); }
+    virtual void hess_of_points(fem_interpolation_context &c,
+                                const std::vector<base_node> &pts,
+                                base_matrix &h) const
+    { f->hess_of_points(c, pts, h); }
 
     virtual bool is_in_support(const base_node &) const;
     virtual void bounding_box(base_node &bmin_, base_node &bmax_) const {
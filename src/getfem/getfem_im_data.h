@@ -111,6 +111,26 @@ namespace getfem{
     /**Returns the index of the first integration point with filtering*/
     size_type filtered_index_of_first_point(size_type cv, short_type f = short_type(-1)) const;
 
+    /**Filtered indices of the interior integration points of an element.
+    These indices are consecutive, so that they are computed once per
+    element.*/
+    struct element_points {
+      size_type cv, first, nb;
+      element_points() : cv(-1), first(-1), nb(0) {}
+    };
+
+    /**Fill pts with the filtered indices of the interior points of cv*/
+    void filtered_points_of_element(size_type cv, element_points &pts) const;
+
+    /**Returns the filtered index of the point i of element cv, pts being
+    given by filtered_points_of_element(). No index computation is done for
+    the interior points of the element pts.cv.*/
+    size_type filtered_index_of_point(const element_points &pts,
+                                      size_type cv, size_type i) const {
+      return (cv == pts.cv && i < pts.nb) ? pts.first + i
+                                          : filtered_index_of_point(cv, i);
+    }
+
     /**Total numbers of index (integration points)*/
     size_type nb_index(bool use_filter=false) const;
 
@@ -80,6 +80,13 @@ namespace getfem {
        in Gmsh, that which does not occur in GetFEM since there is
        only one "type of region".
 
+       The format 4 files (4.0 in ASCII, 4.1 in ASCII or binary,
+       possibly partitioned) are read by a faster streaming reader. As
+       for the format 2, the region numbers are the physical tags, given
+       in the $Entities section, the entity tag being used for the
+       elements of an entity belonging to no physical group. An element belonging to several
+       physical groups is added to each of the corresponding regions.
+
 
       - "cdb" for meshes generated by ANSYS (in blocked format).
 
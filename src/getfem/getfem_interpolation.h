@@ -44,6 +44,7 @@
 #include "dal_tree_sorted.h"
 #include "getfem_im_data.h"
 #include "getfem_torus.h"
+#include "getfem_interpolation_operator.h"
 
 namespace getfem {
 
@@ -229,7 +230,10 @@ namespace getfem {
      and with extrapolation = 2 all  exterior points are extrapolated (could be expensive).
 
      If both mesh_fem shared the same mesh object, a fast interpolation
-     will be used.
+     will be used. In that case, when the same interpolation is called
+     again on unchanged mesh_fem objects, the interpolation matrix is
+     built and cached (see cached_interpolation_operator()) and the
+     interpolation reduces to a sparse matrix-vector product.
 
      If rg_source and rg_target are provided the operation is restricted to
      these regions. rg_source must contain only convexes.
@@ -259,6 +263,37 @@ namespace getfem {
                      mesh_region rg_source=mesh_region::all_convexes(),
                      mesh_region rg_target=mesh_region::all_convexes());
 
+  /**
+     @brief Build an interpolation operator from mf_source to mf_target.
+
+     The operator stores the matrix of interpolation(mf_source, mf_target,
+     M, ...) in CSR format and can be applied to any number of fields
+     (see getfem::interpolation_operator). mf_source and mf_target should
+     have the same Qdim.
+  */
+  void build_interpolation_operator
+  (const mesh_fem &mf_source, const mesh_fem &mf_target,
+   interpolation_operator &op, int extrapolation = 0, double EPS = 1E-10,
+   mesh_region rg_source=mesh_region::all_convexes(),
+   mesh_region rg_target=mesh_region::all_convexes());
+
+  /**
+     @brief Interpolation operator between two mesh_fem sharing the same
+     mesh, kept in a global cache.
+
+     A null pointer is returned at the first request for a pair of
+     mesh_fem objects, the operator being built at the second one, so that
+     an interpolation done only once does not pay for the matrix. The
+     cached operators are rebuilt when one of the mesh_fem is modified
+     and dropped when it is destroyed. At most 32 operators are kept, the
+     least recently used one being dropped first. A null pointer is also
+     returned when the entry is dropped or a mesh_fem modified while the
+     operator is built.
+  */
+  pinterpolation_operator
+  cached_interpolation_operator(const mesh_fem &mf_source,
+                                const mesh_fem &mf_target);
+
 
   /* --------------------------- Implementation ---------------------------*/
 
@@ -377,8 +412,7 @@ namespace getfem {
             V[(dof_t + k)*qqdim+qq] /= passes;
       else if (passes > scalar_type(0))
         for (size_type k=0; k < qdim; ++k)
-          for (size_type j=0; j < dof_source.size(); ++j)
-            gmm::scale(gmm::mat_row(M, dof_t + k), scalar_type(1)/passes);
+          gmm::scale(gmm::mat_row(M, dof_t + k), scalar_type(1)/passes);
     }
 
     if (version == 0)
@@ -700,8 +734,13 @@ namespace getfem {
                 && gmm::vect_size(V) != 0, "Dimensions mismatch");
     if (&mf_source.linked_mesh() == &mf_target.linked_mesh() &&
         rg_source.id() == mesh_region::all_convexes().id() &&
-        rg_target.id() == mesh_region::all_convexes().id())
-      interpolation_same_mesh(mf_source, mf_target, U, V, M, 0);
+        rg_target.id() == mesh_region::all_convexes().id()) {
+      pinterpolation_operator op;
+      if (mf_source.get_qdim() == mf_target.get_qdim())
+        op = cached_interpolation_operator(mf_source, mf_target);
+      if (op) op->apply(U, V);
+      else interpolation_same_mesh(mf_source, mf_target, U, V, M, 0);
+    }
     else {
       omp_distribute<VECTV> V_distributed;
       auto partitioning_allowed = rg_source.is_partitioning_allowed();
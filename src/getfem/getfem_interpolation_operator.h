@@ -0,0 +1,163 @@
+/* -*- c++ -*- (enables emacs c++ mode) */
+/*===========================================================================
+
+ Copyright (C) 2020 Yves Renard
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+ As a special exception, you  may use  this file  as it is a part of a free
+ software  library  without  restriction.  Specifically,  if   other  files
+ instantiate  templates  or  use macros or inline functions from this file,
+ or  you compile this  file  and  link  it  with other files  to produce an
+ executable, this file  does  not  by itself cause the resulting executable
+ to be covered  by the GNU Lesser General Public License.  This   exception
+ does not  however  invalidate  any  other  reasons why the executable file
+ might be covered by the GNU Lesser General Public License.
+
+===========================================================================*/
+
+/**@file getfem_interpolation_operator.h
+   @author  Yves Renard <Yves.Renard@insa-lyon.fr>
+   @date October 2020.
+   @brief Precomputed interpolation operators.
+
+   An interpolation operator stores, in compressed sparse row format,
+   the matrix of an interpolation from the degrees of freedom of a
+   mesh_fem to a fixed set of target values (the dofs of another
+   mesh_fem, or the nodes of a slice). Once built, the interpolation of
+   any number of fields is a plain sparse matrix-vector product, without
+   any element lookup nor base function evaluation.
+*/
+#ifndef GETFEM_INTERPOLATION_OPERATOR_H__
+#define GETFEM_INTERPOLATION_OPERATOR_H__
+
+#include "getfem_mesh_fem.h"
+
+namespace getfem {
+
+  /** Interpolation matrix stored in CSR format, each row corresponding
+      to a target value and each column to a dof of the source mesh_fem.
+
+      The operator keeps track of the mesh_fem objects it has been built
+      from (see add_mesh_fem()): is_up_to_date() returns false as soon as
+      one of them is modified or destroyed. The geometry of the target
+      (target mesh_fem or slice) is assumed not to change.
+
+      When applied to a vector U of size qqdim*ncols() (qqdim fields
+      interleaved as in a mesh_fem), the rows are grouped by blocks of
+      size block_size() (the Qdim of the slice for the slice operators, 1
+      otherwise) and the result is ordered as
+      V[((i / bs)*qqdim + qq)*bs + i % bs] for the row i and the field qq.
+  */
+  class interpolation_operator : public context_dependencies {
+    gmm::csr_matrix<scalar_type> M;
+    size_type bsize;
+    std::vector<size_type> chunks; // rows partition for the products
+    std::vector<const mesh_fem *> pmfs;
+    std::vector<gmm::uint64_type> mf_v_nums;
+
+    template <typename T> void mult_(const T *u, T *v, size_type qqdim) const {
+      auto treat_chunk = [&](size_type ic) {
+        for (size_type i = chunks[ic]; i < chunks[ic+1]; ++i) {
+          size_type i0 = (i / bsize) * qqdim * bsize + i % bsize;
+          for (size_type qq = 0; qq < qqdim; ++qq) {
+            T a(0);
+            for (size_type k = M.jc[i]; k < M.jc[i+1]; ++k)
+              a += M.pr[k] * u[M.ir[k]*qqdim+qq];
+            v[i0 + qq*bsize] = a;
+          }
+        }
+      };
+      size_type nbchunks = chunks.empty() ? 0 : chunks.size() - 1;
+      GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic, treat_chunk(ic));
+    }
+
+  public:
+    void update_from_context() const {}
+
+    size_type nrows() const { return M.nrows(); }
+    size_type ncols() const { return M.ncols(); }
+    size_type nnz() const { return M.pr.size(); }
+    size_type block_size() const { return bsize; }
+    const gmm::csr_matrix<scalar_type> &matrix() const { return M; }
+
+    /** Set the interpolation matrix (rows: target values, columns:
+        source dofs). */
+    template <typename MAT> void set_matrix(const MAT &MM,
+                                            size_type block = 1) {
+      GMM_ASSERT1(block > 0 && gmm::mat_nrows(MM) % block == 0,
+                  "Bad block size");
+      M.init_with(MM); bsize = block;
+      size_type nr = M.nrows(), nz = nnz();
+      size_type nbchunks = std::min(nr / 1024 + 1, 4 * max_concurrency());
+      chunks.resize(nbchunks+1);
+      chunks[0] = 0; chunks[nbchunks] = nr;
+      for (size_type ic = 1; ic < nbchunks; ++ic) // balanced on the nnz
+        chunks[ic] = std::lower_bound(M.jc.begin(), M.jc.end(),
+                                      (nz*ic)/nbchunks) - M.jc.begin();
+    }
+
+    /** Record a mesh_fem on which the operator depends. */
+    void add_mesh_fem(const mesh_fem &mf) {
+      add_dependency(mf);
+      for (size_type i = 0; i < pmfs.size(); ++i)
+        if (pmfs[i] == &mf) { mf_v_nums[i] = mf.version_number(); return; }
+      pmfs.push_back(&mf); mf_v_nums.push_back(mf.version_number());
+    }
+
+    /** Return false if one of the mesh_fem the operator depends on has
+        been modified or destroyed since the operator was built. */
+    bool is_up_to_date() const {
+      if (!is_context_valid()) return false;
+      if (is_context_changed()) return false;
+      for (size_type i = 0; i < pmfs.size(); ++i)
+        if (pmfs[i]->version_number() != mf_v_nums[i]) return false;
+      return true;
+    }
+
+    /** Compute V = M U, U containing one or several fields. */
+    template <typename T>
+    void apply(const std::vector<T> &U, std::vector<T> &V) const {
+      GMM_ASSERT1(ncols() > 0 && U.size() % ncols() == 0,
+                  "Dimensions mismatch");
+      size_type qqdim = U.size() / ncols();
+      GMM_ASSERT1(V.size() == nrows() * qqdim, "Dimensions mismatch");
+      mult_(U.data(), V.data(), qqdim);
+    }
+
+    template <typename VECT1, typename VECT2>
+    void apply(const VECT1 &U, VECT2 &V) const {
+      typedef typename gmm::linalg_traits<VECT2>::value_type T;
+      std::vector<T> u(gmm::vect_size(U)), v(gmm::vect_size(V));
+      gmm::copy(U, u);
+      apply(u, v);
+      gmm::copy(v, V);
+    }
+
+    template <typename VECT1, typename VECT2>
+    void apply(const VECT1 &U, const VECT2 &V) const
+    { apply(U, const_cast<VECT2 &>(V)); }
+
+    interpolation_operator() : bsize(1) {}
+  };
+
+  typedef std::shared_ptr<const interpolation_operator>
+  pinterpolation_operator;
+
+}  /* end of namespace getfem.                                             */
+
+
+#endif /* GETFEM_INTERPOLATION_OPERATOR_H__  */
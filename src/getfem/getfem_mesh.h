@@ -53,6 +53,8 @@ namespace getfem {
   gmm::uint64_type APIDECL act_counter();
 
   class integration_method;
+  class binary_file_writer;
+  class binary_file_reader;
   typedef std::shared_ptr<const integration_method> pintegration_method;
 
   /**@addtogroup mesh*/
@@ -232,6 +234,45 @@ namespace getfem {
       return i;
     }
 
+    using bgeot::mesh_structure::add_convex_noverif;
+    /** Add a convex to the mesh without checking whether a convex with
+        the same points already exists (to be used for instance by the
+        mesh importers, when the convexes are known to be distinct).
+        @param pgt the geometric transformation of the convex.
+        @param ipts an iterator to a set of point index.
+        @return the number of the new convex.
+     */
+    template<class ITER>
+    size_type add_convex_noverif(bgeot::pgeometric_trans pgt, ITER ipts) {
+      size_type i = bgeot::mesh_structure::add_convex_noverif(pgt->structure(),
+                                                               ipts);
+      gtab[i] = pgt; trans_exists[i] = true;
+      cvs_v_num[i] = act_counter(); touch();
+      return i;
+    }
+
+    using bgeot::mesh_structure::add_convexes_noverif;
+    /** Add nb convexes with the same geometric transformation to the mesh,
+        without checking whether they already exist.
+        @param pgt the geometric transformation of the convexes.
+        @param nb the number of convexes.
+        @param ipts an iterator to the nb*pgt->nb_points() point indexes
+        of the convexes, convex after convex.
+        @param ind if not null, receives the numbers of the new convexes.
+     */
+    template<class ITER>
+    void add_convexes_noverif(bgeot::pgeometric_trans pgt, size_type nb,
+                              ITER ipts, std::vector<size_type> *ind = 0) {
+      std::vector<size_type> icv;
+      bgeot::mesh_structure::add_convexes_noverif(pgt->structure(), nb,
+                                                  ipts, &icv);
+      gmm::uint64_type d = act_counter();
+      for (size_type i : icv)
+        { gtab[i] = pgt; trans_exists[i] = true; cvs_v_num[i] = d; }
+      touch();
+      if (ind) ind->swap(icv);
+    }
+
     /** Add a convex to the mesh, given a geometric transformation and a
         list of point coordinates.
 
@@ -476,6 +517,21 @@ namespace getfem {
         @see getfem::import_mesh.
     */
     void read_from_file(std::istream &ist);
+    /** Write the mesh to a binary file (see getfem_binary_io.h). The
+        coordinates are packed and the connectivity is grouped by
+        geometric transformation.
+        @param name the file name.
+    */
+    void write_to_binary_file(const std::string &name) const;
+    /** Write the mesh sections to an opened binary file. */
+    void write_to_binary_file(binary_file_writer &f) const;
+    /** Load the mesh from a binary file. The file is mapped in memory
+        and the convexes are inserted without any search for duplicates.
+        @param name the file name.
+    */
+    void read_from_binary_file(const std::string &name);
+    /** Load the mesh from the sections of an opened binary file. */
+    void read_from_binary_file(const binary_file_reader &f);
     /** Clone a mesh */
     void copy_from(const mesh& m); /* might be the copy constructor */
     size_type memsize() const;
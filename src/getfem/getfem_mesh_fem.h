@@ -632,6 +632,21 @@ namespace getfem {
         saved to the file.
     */
     void write_to_file(const std::string &name, bool with_mesh=false) const;
+    /** Write the mesh_fem to a binary file (see getfem_binary_io.h).
+
+        @param name the file name
+
+        @param with_mesh if set, then the linked_mesh() will also be
+        saved to the file.
+    */
+    void write_to_binary_file(const std::string &name,
+                              bool with_mesh=false) const;
+    /** Write the mesh_fem sections to an opened binary file. */
+    void write_to_binary_file(binary_file_writer &f) const;
+    /** Read the mesh_fem from a binary file. */
+    void read_from_binary_file(const std::string &name);
+    /** Read the mesh_fem from the sections of an opened binary file. */
+    void read_from_binary_file(const binary_file_reader &f);
   };
 
   /** Gives the descriptor of a classical finite element method of degree K
@@ -146,6 +146,15 @@ namespace getfem {
         saved to the file.
     */
     void write_to_file(const std::string &name, bool with_mesh=false) const;
+    /** Write the mesh_im to a binary file (see getfem_binary_io.h). */
+    void write_to_binary_file(const std::string &name,
+                              bool with_mesh=false) const;
+    /** Write the mesh_im sections to an opened binary file. */
+    void write_to_binary_file(binary_file_writer &f) const;
+    /** Read the mesh_im from a binary file. */
+    void read_from_binary_file(const std::string &name);
+    /** Read the mesh_im from the sections of an opened binary file. */
+    void read_from_binary_file(const binary_file_reader &f);
   };
 
   /** Dummy mesh_im for default parameter of functions. */
@@ -66,13 +66,24 @@ namespace getfem {
 				   ignored (for instance because
 				   INTEGRATE_INSIDE and the convex
 				   is outside etc.) */
-    std::vector<pintegration_method> build_methods;
+    /* integration method built on a cut convex, with the data on which
+       it depends: it is kept by adapt while the sub-mesh of the convex
+       and the nodes of the convex do not change. */
+    struct built_method {
+      std::shared_ptr<const mesh> pmsh;
+      std::vector<scalar_type> nodes;
+      bool crack_tip;
+      pintegration_method pim; // null when there is no integration point
+    };
+    std::map<size_type, built_method> build_methods;
+    bool build_methods_reusable; // false when the options have changed
+    size_type nb_built_again;
 
     mutable bool is_adapted;
     int integrate_where; // INTEGRATE_INSIDE or INTEGRATE_OUTSIDE
 
     void clear_build_methods();
-    void build_method_of_convex(size_type cv);
+    pintegration_method build_method_of_convex(size_type cv);
 
     /* CSG (constructive solid geometry) description for the
        definition of the domain with respect to one or more levelsets.
@@ -100,9 +111,14 @@ namespace getfem {
            INTEGRATE_BOUNDARY = 4};
     void update_from_context(void) const;
     
-    /** Apply the adequate integration methods. */
+    /** Apply the adequate integration methods. The methods of the cut
+	convexes whose sub-mesh has been kept by the last adapt of the
+	mesh_level_set are kept, the other ones are built in parallel. */
     void adapt(void);
     void clear(void); // to be modified
+    /** Number of cut convexes whose integration method has been built by
+	the last call of adapt. */
+    size_type nb_methods_built_again() const { return nb_built_again; }
 
     /** Set the specific integration methods. see the constructor
 	documentation for more details. */
@@ -110,6 +126,7 @@ namespace getfem {
 			pintegration_method sing = 0) {
       regular_simplex_pim = reg;
       base_singular_pim = sing;
+      build_methods_reusable = false;
     }
 
     int location() const { return integrate_where; }
@@ -172,6 +189,7 @@ namespace getfem {
     */
     void set_level_set_boolean_operations(const std::string description) {
       ls_csg_description = description;
+      build_methods_reusable = false;
     }
     void compute_normal_vector(const fem_interpolation_context &ctx,
 			       base_small_vector &vec) const;
@@ -74,10 +74,17 @@ namespace getfem {
       pmesh pmsh;
       zoneset zones;
       mesh_region ls_border_faces;
+      /* geometric transformation, radius and values of the level sets
+	 on the convex when it has been cut: the convex is not cut again
+	 by adapt as long as they do not change. */
+      bgeot::pgeometric_trans pgt;
+      std::vector<scalar_type> ls_values;
       convex_info() : pmsh(0) {}
     };
 
     std::map<size_type, convex_info> cut_cv;
+    bool cut_cv_reusable; // false when the level sets have been changed
+    size_type nb_cut_again;
 
     mutable dal::bit_vector crack_tip_convexes_;
 
@@ -92,6 +99,16 @@ namespace getfem {
       if (is_convex_cut(i)) return *((cut_cv.find(i))->second.pmsh);
       GMM_ASSERT1(false, "This element is not cut !");
     }
+    /** Shared pointer on the sub-mesh of a cut convex. The same sub-mesh
+	is kept by adapt while the level sets do not change on the
+	convex. */
+    std::shared_ptr<const mesh> pmesh_of_convex(size_type i) const {
+      if (is_convex_cut(i)) return (cut_cv.find(i))->second.pmsh;
+      GMM_ASSERT1(false, "This element is not cut !");
+    }
+    /** Number of convexes which have been cut by the last call of adapt
+	(the other cut convexes have kept their sub-mesh). */
+    size_type nb_convexes_cut_again() const { return nb_cut_again; }
     
     const dal::bit_vector &crack_tip_convexes() const;
 
@@ -106,6 +123,7 @@ namespace getfem {
 	   it != cut_cv.end(); ++it) {
 	res += sizeof(convex_info)
 	  + it->second.pmsh->memsize()
+	  + it->second.ls_values.capacity() * sizeof(scalar_type)
 	  + it->second.zones.size()
 	  * (level_sets.size() + sizeof(std::string *) + sizeof(std::string));
       }
@@ -116,7 +134,7 @@ namespace getfem {
       if (std::find(level_sets.begin(), level_sets.end(), &ls)
 	  == level_sets.end()) {
 	level_sets.push_back(&ls); touch();
-	is_adapted_ = false;
+	is_adapted_ = false; cut_cv_reusable = false;
       }
     }
     void sup_level_set(level_set &ls) {
@@ -124,14 +142,18 @@ namespace getfem {
 	it = std::find(level_sets.begin(), level_sets.end(), &ls);
       if (it != level_sets.end()) {
 	level_sets.erase(it);
-	is_adapted_ = false;
+	is_adapted_ = false; cut_cv_reusable = false;
 	touch();
       }
     }
 
     /** fill m with the (non-conformal) "cut" mesh. */
     void global_cut_mesh(mesh &m) const;
-    /** do all the work (cut the convexes wrt the levelsets) */
+    /** do all the work (cut the convexes wrt the levelsets). The convexes
+	on which the level sets have not changed since the previous call
+	keep their sub-mesh and zones. The convexes are cut in parallel
+	(with OpenMP), with the same result whatever the number of
+	threads. */
     void adapt(void);
     void merge_zoneset(zoneset &zones1, const zoneset &zones2) const;
     void merge_zoneset(zoneset &zones1, const std::string &subz) const;
@@ -163,14 +185,21 @@ namespace getfem {
 
 
   private:
+    /* The following functions only modify their arguments : adapt calls
+       them in parallel for different convexes. */
     void cut_element(size_type cv, const dal::bit_vector &primary,
-		     const dal::bit_vector &secondary, scalar_type radius);
+		     const dal::bit_vector &secondary, scalar_type radius,
+		     convex_info &cvi) const;
     int is_not_crossed_by(size_type c, plevel_set ls, unsigned lsnum,
-			  scalar_type radius);
+			  scalar_type radius) const;
     int sub_simplex_is_not_crossed_by(size_type cv, plevel_set ls,
-				      size_type sub_cv, scalar_type radius);
-    void find_zones_of_element(size_type cv, std::string &prezone,
-			       scalar_type radius);
+				      const mesh &msh, size_type sub_cv,
+				      scalar_type radius) const;
+    void subzones_of_element(size_type cv, const mesh &msh,
+			     const std::string &prezone, scalar_type radius,
+			     std::vector<std::string> &subzones) const;
+    void level_set_values_of_convex(size_type cv, scalar_type radius,
+				    std::vector<scalar_type> &v) const;
 
     /** For each levelset, if the convex cv is crossed, add the levelset number
 	into 'prim' (and 'sec' is the levelset has a secondary part).
@@ -179,10 +208,11 @@ namespace getfem {
     void find_crossing_level_set(size_type cv, 
 				 dal::bit_vector &prim, 
 				 dal::bit_vector &sec, std::string &zone,
-				 scalar_type radius);
+				 scalar_type radius) const;
     void run_delaunay(std::vector<base_node> &fixed_points,
 		      gmm::dense_matrix<size_type> &simplexes,
-		      std::vector<dal::bit_vector> &fixed_points_constraints);
+		      std::vector<dal::bit_vector> &fixed_points_constraints)
+      const;
     
     void update_crack_tip_convexes();
   };
@@ -38,6 +38,7 @@
 #define GETFEM_MESH_SLICE_H
 
 #include "getfem_mesh_slicers.h"
+#include "getfem_interpolation_operator.h"
 
 namespace getfem {
   class slicer_build_stored_mesh_slice;
@@ -82,6 +83,9 @@ namespace getfem {
     cvlst_ct cvlst;
     size_type dim_;
     std::vector<size_type> cv2pos; // convex id -> pos in cvlst
+    /* interpolation operators of the mesh_fem interpolated on the slice */
+    mutable std::map<const mesh_fem *,
+                     std::shared_ptr<interpolation_operator> > interp_ops;
     friend class slicer_build_stored_mesh_slice;
     friend class mesh_slicer;
   public:
@@ -131,6 +135,7 @@ namespace getfem {
       gmm::fill(cv2pos, size_type(-1));
       simplex_cnt.clear();
       clear_merged_nodes();
+      interp_ops.clear();
     }
     /** @brief merge with another mesh slice. */
     void merge(const stored_mesh_slice& sl);
@@ -141,7 +146,9 @@ namespace getfem {
          geometrical location but were extracted from two different
          convexes will be considered as one same node. Use for
          exportation purposes, as VTK and OpenDX do not like
-         'discontinuous' meshes
+         'discontinuous' meshes. The merged nodes are numbered in the
+         order of their first occurrence in the slice (the merging is
+         done in parallel, by chunks of convexes).
     */
     void merge_nodes() const;
 
@@ -204,6 +211,10 @@ namespace getfem {
     void build(const getfem::mesh& m, const slicer_action &a,
                const slicer_action &b, const slicer_action &c, 
                size_type nrefine = 1) { build(m,&a,&b,&c,nrefine); }
+    /** Build the slice. When all the slicer_action operations are
+        thread safe (see slicer_action::thread_safe), the convexes are
+        sliced in parallel, by chunks, with the same result as the
+        sequential build. */
     void build(const getfem::mesh& m, const slicer_action *a,
                const slicer_action *b, const slicer_action *c, 
                size_type nrefine);
@@ -240,9 +251,17 @@ namespace getfem {
 
         @param V on output, a vector corresponding to the interpolated
         field on the slice (values given on each node of the slice).
+
+        From the second interpolation of the same (unchanged) mesh_fem,
+        the interpolation matrix is built and kept by the slice, the
+        interpolation being then a sparse matrix-vector product (see
+        cached_interpolation_operator()).
     */
     template<typename V1, typename V2> void 
     interpolate(const getfem::mesh_fem &mf, const V1& UU, V2& V) const {
+      pinterpolation_operator op = cached_interpolation_operator(mf);
+      if (op) { op->apply(UU, V); return; }
+
       typedef typename gmm::linalg_traits<V2>::value_type T;
       std::vector<base_node> refpts;
       std::vector<std::vector<T> > coeff;
@@ -295,6 +314,27 @@ namespace getfem {
       }
       GMM_ASSERT1(pos == V.size(), "bad dimensions");
     }
+
+    /** @brief Build the matrix of the interpolation of a mesh_fem on the
+        slice.
+
+        The rows of the operator are the nb_points()*mf.get_qdim() values
+        on the slice nodes and its columns the dofs of mf, so that
+        op.apply(U, V) gives the same result as interpolate(mf, U, V).
+    */
+    void build_interpolation_operator(const mesh_fem &mf,
+                                      interpolation_operator &op) const;
+
+    /** @brief Interpolation operator of a mesh_fem kept by the slice.
+
+        A null pointer is returned at the first request for mf, the
+        operator being built at the second one. It is rebuilt when mf is
+        modified and dropped when the slice is cleared or merged. The
+        reference coordinates of the slice nodes should not be modified
+        through nodes() once an operator has been built.
+    */
+    pinterpolation_operator
+    cached_interpolation_operator(const mesh_fem &mf) const;
   };
 
   /** @brief a getfem::mesh_slicer whose side effect is to build a
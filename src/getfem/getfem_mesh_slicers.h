@@ -238,6 +238,12 @@ namespace getfem {
   public:
     static const float EPS;
     virtual void exec(mesh_slicer &ms) = 0;
+    /** Return true if exec can be called concurrently on several
+        mesh_slicer objects (i.e. if the slicer keeps no data between
+        two convexes, or keeps it per thread). stored_mesh_slice::build
+        slices the mesh in parallel when all its slicers are thread safe.
+    */
+    virtual bool thread_safe() const { return false; }
     virtual ~slicer_action() {}
   };
 
@@ -246,6 +252,7 @@ namespace getfem {
   public:
     slicer_none() {}
     void exec(mesh_slicer &/*ms*/) {}
+    bool thread_safe() const { return true; }
     static slicer_none& static_instance();
   };
 
@@ -262,6 +269,7 @@ namespace getfem {
     slicer_boundary(const mesh& m,
                     slicer_action &sA = slicer_none::static_instance());
     void exec(mesh_slicer &ms);
+    bool thread_safe() const { return !A || A->thread_safe(); }
   };
 
   /* Apply a precomputed deformation to the slice nodes */
@@ -300,18 +308,25 @@ namespace getfem {
         untils no simplex crosses the boundary
     */
     int orient;
-    dal::bit_vector pt_in, pt_bin;    
+    /* nodes of the current convex which are kept, and nodes which are on
+       the boundary of the volume (one copy for each thread). */
+    omp_distribute<dal::bit_vector, true_thread_policy> pt_in_, pt_bin_;
+    dal::bit_vector &pt_in() { return pt_in_.thrd_cast(); }
+    const dal::bit_vector &pt_in() const { return pt_in_.thrd_cast(); }
+    dal::bit_vector &pt_bin() { return pt_bin_.thrd_cast(); }
+    const dal::bit_vector &pt_bin() const { return pt_bin_.thrd_cast(); }
     
     /** Overload either 'prepare' or 'test_point'.
      */
     virtual void prepare(size_type /*cv*/,
                          const mesh_slicer::cs_nodes_ct& nodes,
                          const dal::bit_vector& nodes_index) {
-      pt_in.clear(); pt_bin.clear();
+      dal::bit_vector &in_ = pt_in(), &bin_ = pt_bin();
+      in_.clear(); bin_.clear();
       for (dal::bv_visitor i(nodes_index); !i.finished(); ++i) {
         bool in, bin; test_point(nodes[i].pt, in, bin);        
-        if (bin || ((orient > 0) ? !in : in)) pt_in.add(i);
-        if (bin) pt_bin.add(i);
+        if (bin || ((orient > 0) ? !in : in)) in_.add(i);
+        if (bin) bin_.add(i);
       }
     }
     virtual void test_point(const base_node&, bool& in, bool& bound) const
@@ -367,6 +382,7 @@ namespace getfem {
       slicer_volume(orient_), x0(x0_), n(n_/gmm::vect_norm2(n_)) {
         //n *= (1./bgeot::vect_norm2(n));
     }
+    bool thread_safe() const { return true; }
   };
 
   /**
@@ -386,7 +402,7 @@ namespace getfem {
       const base_node& B=nodes[iB].pt;
       scalar_type a,b,c; // a*x^2 + b*x + c = 0
       a = gmm::vect_norm2_sqr(B-A);
-      if (a < EPS) return pt_bin.is_in(iA) ? 0. : 1./EPS;
+      if (a < EPS) return pt_bin().is_in(iA) ? 0. : 1./EPS;
       b = 2*gmm::vect_sp(A-x0,B-A);
       c = gmm::vect_norm2_sqr(A-x0)-R*R;
       return slicer_volume::trinom(a,b,c);
@@ -397,6 +413,7 @@ namespace getfem {
        orient = +1 => select exterior */
     slicer_sphere(base_node x0_, scalar_type R_, int orient_) : 
       slicer_volume(orient_), x0(x0_), R(R_) {}
+    bool thread_safe() const { return true; }
     //cerr << "slicer_volume, x0=" << x0 << ", R=" << R << endl; }
   };
   
@@ -429,7 +446,7 @@ namespace getfem {
       scalar_type Fd = gmm::vect_sp(F,d);
       scalar_type Dd = gmm::vect_sp(D,d);
       scalar_type a = gmm::vect_norm2_sqr(D) - gmm::sqr(Dd);
-      if (a < EPS) return pt_bin.is_in(iA) ? 0. : 1./EPS;
+      if (a < EPS) return pt_bin().is_in(iA) ? 0. : 1./EPS;
       assert(a> -EPS);
       scalar_type b = 2*(gmm::vect_sp(F,D) - Fd*Dd);
       scalar_type c = gmm::vect_norm2_sqr(F) - gmm::sqr(Fd) - gmm::sqr(R);
@@ -440,6 +457,7 @@ namespace getfem {
       slicer_volume(orient_), x0(x0_), d(x1_-x0_), R(R_) {
       d /= gmm::vect_norm2(d);
     }
+    bool thread_safe() const { return true; }
   };
 
 
@@ -450,11 +468,12 @@ namespace getfem {
     std::unique_ptr<const mesh_slice_cv_dof_data_base> mfU;
     scalar_type val;
     scalar_type val_scaling; /* = max(abs(U)) */
-    std::vector<scalar_type> Uval;
+    omp_distribute<std::vector<scalar_type>, true_thread_policy> Uval_;
     void prepare(size_type cv, const mesh_slicer::cs_nodes_ct& nodes,
                  const dal::bit_vector& nodes_index);
     scalar_type edge_intersect(size_type iA, size_type iB,
                                const mesh_slicer::cs_nodes_ct&) const {
+      const std::vector<scalar_type> &Uval = Uval_.thrd_cast();
       assert(iA < Uval.size() && iB < Uval.size());
       if (((Uval[iA] < val) && (Uval[iB] > val)) ||
           ((Uval[iA] > val) && (Uval[iB] < val)))
@@ -470,6 +489,7 @@ namespace getfem {
                   "can't compute isovalues of a vector field !");
         val_scaling = mfU->maxval();
     }
+    bool thread_safe() const { return true; }
   };
   
   /** 
@@ -498,6 +518,7 @@ namespace getfem {
     slicer_union(const slicer_action &sA, const slicer_action &sB) : 
       A(&const_cast<slicer_action&>(sA)), B(&const_cast<slicer_action&>(sB)) {}
     void exec(mesh_slicer &ms);
+    bool thread_safe() const { return A->thread_safe() && B->thread_safe(); }
   };
 
   /**
@@ -508,6 +529,7 @@ namespace getfem {
   public:
     slicer_intersect(slicer_action &sA, slicer_action &sB) : A(&sA), B(&sB) {}
     void exec(mesh_slicer &ms);
+    bool thread_safe() const { return A->thread_safe() && B->thread_safe(); }
   };
 
   /**
@@ -518,6 +540,7 @@ namespace getfem {
   public:
     slicer_complementary(slicer_action &sA) : A(&sA) {}
     void exec(mesh_slicer &ms);
+    bool thread_safe() const { return A->thread_safe(); }
   };
   
   /**
@@ -582,6 +605,7 @@ namespace getfem {
     */
     slicer_explode(scalar_type c) : coef(c) {}
     void exec(mesh_slicer &ms);
+    bool thread_safe() const { return true; }
   };
 
 }
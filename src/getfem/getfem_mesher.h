@@ -126,6 +126,8 @@ namespace getfem {
     bgeot::base_poly base;
     mutable std::vector<base_poly> gradient;
     mutable std::vector<base_poly> hessian;
+    // value and gradient, for their evaluation on sets of points
+    mutable bgeot::polynomial_family<bgeot::opt_long_scalar_type> val_grad;
     const fem<base_poly> *pf;
     mutable int initialized;
     scalar_type shift_ls;     // for the computation of a gap on a level_set.
@@ -163,6 +165,10 @@ namespace getfem {
     }
     scalar_type grad(const base_node &P, base_small_vector &G) const;
     void hess(const base_node &P, base_matrix &H) const;
+    /** Values V[k] and gradients G(:,k) at the points pts[k], with a single
+        evaluation of the monomials for each point. */
+    void values_and_gradients(const std::vector<base_node> &pts,
+                              base_vector &V, base_matrix &G) const;
   };
 
   template <typename VECT> 
@@ -396,7 +396,14 @@ namespace getfem {
     void brick_init(size_type ib, build_version version,
                     size_type rhs_ind = 0) const;
 
-    void init() { complex_version = false; act_size_to_be_done = false; }
+    // Last checkpoint saved or loaded, for the incremental checkpoints
+    mutable gmm::uint64_type checkpoint_v_num;
+    mutable std::string checkpoint_file;
+
+    void init() {
+      complex_version = false; act_size_to_be_done = false;
+      checkpoint_v_num = 0;
+    }
 
     void resize_global_system() const;
 
@@ -1085,6 +1092,26 @@ namespace getfem {
     { init_step = true; init_time_step = ddt; }
     
 
+    /** Save the state of the model in a binary file (see
+        getfem_binary_io.h): the values of all the variables and data,
+        including their previous versions used by the time integration
+        schemes and the internal variables defined on im_data, the
+        affine dependent variables and the time parameters. Each variable
+        is stored with a fingerprint of its mesh_fem or im_data.
+
+        If incremental is true, only the arrays modified since the last
+        checkpoint saved or loaded are written, the other ones are read
+        from that checkpoint (whose name is stored in the file) at restore.
+        The dof constraints and the matrices of the bricks are not saved,
+        they are recomputed by the next assembly. */
+    void save_checkpoint(const std::string &filename,
+                         bool incremental = false) const;
+
+    /** Restore the state saved by save_checkpoint. The model should
+        have been built in the same way (same variables on the same
+        mesh_fem and im_data, same bricks). */
+    void load_checkpoint(const std::string &filename);
+
     /** Add a time dispacther to a brick. */
     void add_time_dispatcher(size_type ibrick, pdispatcher pdispatch);
 
@@ -91,6 +91,25 @@ namespace getfem {
                         scalar_type det_trans,
                         base_tensor &grad_sigma_ul)const;
 
+    /** Evaluation of the law on nb points at once. The Green-Lagrange
+        strain tensors E (N*N components per point), the parameters
+        (params_stride components per point, params_stride = 0 if the
+        parameters are the same for all points) and the determinants
+        det_trans (one per point) are stored point by point. So are the
+        results: the strain energy (one value per point), sigma (N*N
+        components) and grad_sigma (N^4 components), with the storage of
+        base_matrix and base_tensor. A null result pointer means that the
+        corresponding quantity is not computed. The default version loops
+        on the points, the standard laws use fixed-size kernels.
+    */
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
+
     size_type nb_params() const { return nb_params_; }
     abstract_hyperelastic_law() { nb_params_ = 0; }
     virtual ~abstract_hyperelastic_law() {}
@@ -120,6 +139,13 @@ namespace getfem {
                                 const base_vector &params,
                                 scalar_type det_trans,
                                 base_tensor &grad_sigma_ul)const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     SaintVenant_Kirchhoff_hyperelastic_law();
   };
 
@@ -158,6 +184,13 @@ namespace getfem {
                        const base_vector &params, scalar_type det_trans) const;
     virtual void grad_sigma(const base_matrix &E, base_tensor &result,
                             const base_vector &params, scalar_type det_trans) const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     explicit Mooney_Rivlin_hyperelastic_law(bool compressible_=false,
                                             bool neohookean_=false);
   };
@@ -175,6 +208,13 @@ namespace getfem {
                        const base_vector &params, scalar_type det_trans) const;
     virtual void grad_sigma(const base_matrix &E, base_tensor &result,
                             const base_vector &params, scalar_type det_trans) const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     explicit Neo_Hookean_hyperelastic_law(bool bonet_=true);
   };
 
@@ -189,6 +229,13 @@ namespace getfem {
                        const base_vector &params, scalar_type det_trans) const;
     virtual void grad_sigma(const base_matrix &E, base_tensor &result,
                             const base_vector &params, scalar_type det_trans) const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     generalized_Blatz_Ko_hyperelastic_law();
   };
 
@@ -204,6 +251,13 @@ namespace getfem {
                        const base_vector &params, scalar_type det_trans) const;
     virtual void grad_sigma(const base_matrix &E, base_tensor &result,
                             const base_vector &params, scalar_type det_trans) const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     Ciarlet_Geymonat_hyperelastic_law() { nb_params_ = 3; }
   };
 
@@ -216,6 +270,13 @@ namespace getfem {
                        const base_vector &params, scalar_type det_trans) const;
     virtual void grad_sigma(const base_matrix &E, base_tensor &result,
                             const base_vector &params, scalar_type det_trans) const;
+    virtual void evaluate_batch(size_type N, size_type nb,
+                                const scalar_type *E,
+                                const scalar_type *params,
+                                size_type params_stride,
+                                const scalar_type *det_trans,
+                                scalar_type *energy, scalar_type *sigma,
+                                scalar_type *grad_sigma) const;
     plane_strain_hyperelastic_law(const phyperelastic_law &pl_)
     { pl = pl_; nb_params_ = pl->nb_params(); }
   };
@@ -47,6 +47,7 @@ This is the kernel of getfem.
 
 #ifdef GETFEM_HAS_OPENMP
   #include <mutex>
+  #include <shared_mutex>
 #endif
 
 namespace getfem
@@ -93,6 +94,17 @@ namespace getfem
     mutable std::recursive_mutex mutex;
   };
 
+  //as lock_factory, for a reader-writer lock: the readers
+  //share the lock, the writers have an exclusive access
+  class shared_lock_factory
+  {
+  public:
+    std::shared_lock<std::shared_timed_mutex> get_shared_lock() const;
+    std::unique_lock<std::shared_timed_mutex> get_unique_lock() const;
+  private:
+    mutable std::shared_timed_mutex mutex;
+  };
+
   #define GLOBAL_OMP_GUARD getfem::omp_guard g; GMM_NOPERATION_(abs(&(g) != &(g)));
 
 #else
@@ -103,6 +115,11 @@ namespace getfem
   {
     inline local_guard get_lock() const {return local_guard();}
   };
+  struct shared_lock_factory
+  {
+    inline local_guard get_shared_lock() const {return local_guard();}
+    inline local_guard get_unique_lock() const {return local_guard();}
+  };
   #define GLOBAL_OMP_GUARD
 
 #endif
@@ -453,7 +470,7 @@ namespace getfem
   };
 
   #ifdef __GNUC__
-    #define pragma_op(arg) _Pragma("arg")
+    #define pragma_op(arg) _Pragma(#arg)
   #else
     #define pragma_op(arg) __pragma(arg)
   #endif
@@ -472,7 +489,7 @@ namespace getfem
 
     /**execute for loop in parallel. Not iterating over partitions*/
     #define GETFEM_OMP_FOR(init, check, increment, body) {\
-      auto boilerplate = getfem::parallel_boilerplate{};  \
+      getfem::parallel_boilerplate boilerplate;            \
       pragma_op(omp parallel for)                         \
       for (init; check; increment){                       \
         boilerplate.run_lambda([&](){body;});              \
@@ -484,7 +501,7 @@ namespace getfem
     #define GETFEM_OMP_PARALLEL_NO_PARTITION(body) body;
     #define GETFEM_OMP_FOR(init, check, increment, body)\
       for (init; check; increment) {                    \
-        body                                            \
+        body;                                           \
       }
 
   #endif
@@ -194,6 +194,19 @@ namespace getfem {
                                scalar_type stress_threshold,
                                base_matrix& proj,
                                size_type flag_proj) const = 0;
+    /** Projection (flag_proj=0) or gradient of the projection
+        (flag_proj=1) of nb N x N tensors stored contiguously in `tau`.
+        The threshold of the k-th tensor is
+        stress_threshold[k*threshold_stride]. The results are stored
+        contiguously in `proj`. The default version calls do_projection
+        for each tensor.
+    */
+    virtual void do_projection_batch(size_type N, size_type nb,
+                                     const scalar_type *tau,
+                                     const scalar_type *stress_threshold,
+                                     size_type threshold_stride,
+                                     scalar_type *proj,
+                                     size_type flag_proj) const;
     abstract_constraints_projection (size_type flag_hyp_ = 0) :
       flag_hyp(flag_hyp_) {}
     virtual ~abstract_constraints_projection () {}
@@ -346,6 +359,15 @@ namespace getfem {
     }
 
 
+    /** Batched Von Mises projection, with fixed-size kernels for
+        N = 1, 2 and 3. */
+    virtual void do_projection_batch(size_type N, size_type nb,
+                                     const scalar_type *tau,
+                                     const scalar_type *stress_threshold,
+                                     size_type threshold_stride,
+                                     scalar_type *proj,
+                                     size_type flag_proj) const;
+
     VM_projection(size_type flag_hyp_ = 0) :
       abstract_constraints_projection (flag_hyp_) {}
   };
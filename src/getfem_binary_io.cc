@@ -0,0 +1,221 @@
+/*===========================================================================
+
+ Copyright (C) 2020 Yves Renard
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+
+
+#include "getfem/getfem_binary_io.h"
+#include <cstring>
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace getfem {
+
+  static const char binary_file_magic[8]
+    = { 'G', 'E', 'T', 'F', 'E', 'M', 'B', 'F' };
+  static const gmm::uint32_type binary_file_version = 1;
+  static const gmm::uint32_type binary_file_endianness = 0x01020304;
+  enum { BF_TYPE_LENGTH = 32, BF_NAME_LENGTH = 48,
+         BF_HEADER_SIZE = 8 + 4 + 4 + BF_TYPE_LENGTH + 8 + 8,
+         BF_ENTRY_SIZE = BF_NAME_LENGTH + 8 + 8 };
+
+  /* ********************************************************************* */
+  /*  Writer.                                                              */
+  /* ********************************************************************* */
+
+  binary_file_writer::binary_file_writer(const std::string &name,
+                                         const std::string &file_type)
+    : f(name.c_str(), std::ios::binary | std::ios::trunc), fname(name),
+      pos(0) {
+    GMM_ASSERT1(f, "impossible to write to file '" << name << "'");
+    GMM_ASSERT1(file_type.size() < BF_TYPE_LENGTH, "File type too long");
+    char header[BF_HEADER_SIZE];
+    std::memset(header, 0, BF_HEADER_SIZE);
+    std::memcpy(header, binary_file_magic, 8);
+    std::memcpy(header+8, &binary_file_version, 4);
+    std::memcpy(header+12, &binary_file_endianness, 4);
+    std::memcpy(header+16, file_type.data(), file_type.size());
+    write_raw(header, BF_HEADER_SIZE); /* table position set by close() */
+  }
+
+  binary_file_writer::~binary_file_writer() { if (f.is_open()) close(); }
+
+  void binary_file_writer::write_raw(const void *data,
+                                     gmm::uint64_type nbytes) {
+    f.write(static_cast<const char *>(data), std::streamsize(nbytes));
+    GMM_ASSERT1(f, "Error while writing file '" << fname << "'");
+    pos += nbytes;
+  }
+
+  void binary_file_writer::align() {
+    static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    if (pos % 8) write_raw(zeros, 8 - (pos % 8));
+  }
+
+  void binary_file_writer::write_section(const std::string &name,
+                                         const void *data,
+                                         size_type nbytes) {
+    GMM_ASSERT1(f.is_open(), "File '" << fname << "' already closed");
+    GMM_ASSERT1(name.size() < BF_NAME_LENGTH, "Section name too long");
+    for (const section_desc &s : table)
+      GMM_ASSERT1(s.name != name, "Duplicate section '" << name << "'");
+    align();
+    section_desc s; s.name = name; s.offset = pos; s.nbytes = nbytes;
+    table.push_back(s);
+    if (nbytes) write_raw(data, nbytes);
+  }
+
+  void binary_file_writer::write_strings(const std::string &name,
+                                         const std::vector<std::string> &l) {
+    std::string s;
+    for (const std::string &e : l) { s += e; s.push_back('\0'); }
+    write_section(name, s.data(), s.size());
+  }
+
+  void binary_file_writer::close() {
+    align();
+    gmm::uint64_type table_offset = pos, nb = table.size();
+    std::vector<char> entries(BF_ENTRY_SIZE * table.size(), 0);
+    for (size_type i = 0; i < table.size(); ++i) {
+      char *e = &entries[i*BF_ENTRY_SIZE];
+      std::memcpy(e, table[i].name.data(), table[i].name.size());
+      std::memcpy(e+BF_NAME_LENGTH, &(table[i].offset), 8);
+      std::memcpy(e+BF_NAME_LENGTH+8, &(table[i].nbytes), 8);
+    }
+    if (entries.size()) write_raw(&entries[0], entries.size());
+    f.seekp(16 + BF_TYPE_LENGTH);
+    f.write(reinterpret_cast<const char *>(&nb), 8);
+    f.write(reinterpret_cast<const char *>(&table_offset), 8);
+    GMM_ASSERT1(f, "Error while writing file '" << fname << "'");
+    f.close();
+  }
+
+  /* ********************************************************************* */
+  /*  Reader.                                                              */
+  /* ********************************************************************* */
+
+  binary_file_reader::binary_file_reader(const std::string &name,
+                                         const std::string &file_type)
+    : fname(name), data(0), data_size(0), mapped(false) {
+#ifndef _WIN32
+    int fd = open(name.c_str(), O_RDONLY);
+    GMM_ASSERT1(fd >= 0, "File '" << name << "' does not exist");
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      data_size = size_type(st.st_size);
+      void *p = mmap(0, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p != MAP_FAILED) { data = static_cast<const char *>(p); mapped=true; }
+    }
+    ::close(fd);
+#endif
+    if (!mapped) {
+      std::ifstream ist(name.c_str(), std::ios::binary);
+      GMM_ASSERT1(ist, "File '" << name << "' does not exist");
+      ist.seekg(0, std::ios::end);
+      buffer.resize(size_type(ist.tellg()));
+      ist.seekg(0);
+      if (buffer.size()) ist.read(&buffer[0], std::streamsize(buffer.size()));
+      GMM_ASSERT1(ist, "Error while reading file '" << name << "'");
+      data = buffer.data(); data_size = buffer.size();
+    }
+
+    try {
+      read_table_(file_type);
+    } catch (...) { // the destructor is not called
+#ifndef _WIN32
+      if (mapped) munmap(const_cast<char *>(data), data_size);
+#endif
+      throw;
+    }
+  }
+
+  void binary_file_reader::read_table_(const std::string &file_type) {
+    GMM_ASSERT1(data_size >= BF_HEADER_SIZE &&
+                std::memcmp(data, binary_file_magic, 8) == 0,
+                "File '" << fname << "' is not a GetFEM binary file");
+    gmm::uint32_type version, endianness;
+    gmm::uint64_type nb, table_offset;
+    std::memcpy(&version, data+8, 4);
+    std::memcpy(&endianness, data+12, 4);
+    GMM_ASSERT1(endianness == binary_file_endianness, "File '" << fname
+                << "' has been written on a machine of different endianness");
+    GMM_ASSERT1(version <= binary_file_version, "File '" << fname
+                << "' has been written by a more recent version of GetFEM");
+    ftype = std::string(data+16, strnlen(data+16, BF_TYPE_LENGTH));
+    GMM_ASSERT1(file_type.empty() || file_type == ftype, "File '" << fname
+                << "' is a '" << ftype << "' file, '" << file_type
+                << "' expected");
+    std::memcpy(&nb, data+16+BF_TYPE_LENGTH, 8);
+    std::memcpy(&table_offset, data+24+BF_TYPE_LENGTH, 8);
+    // written so as not to overflow on a corrupted file
+    GMM_ASSERT1(table_offset <= data_size &&
+                nb <= (data_size - table_offset) / BF_ENTRY_SIZE,
+                "File '" << fname << "' is truncated");
+    for (size_type i = 0; i < nb; ++i) {
+      const char *e = data + table_offset + i*BF_ENTRY_SIZE;
+      section_desc s;
+      std::memcpy(&(s.offset), e+BF_NAME_LENGTH, 8);
+      std::memcpy(&(s.nbytes), e+BF_NAME_LENGTH+8, 8);
+      GMM_ASSERT1(s.offset <= data_size && s.nbytes <= data_size - s.offset,
+                  "File '" << fname << "' is corrupted");
+      table[std::string(e, strnlen(e, BF_NAME_LENGTH))] = s;
+    }
+  }
+
+  binary_file_reader::~binary_file_reader() {
+#ifndef _WIN32
+    if (mapped) munmap(const_cast<char *>(data), data_size);
+#endif
+  }
+
+  const void *binary_file_reader::section(const std::string &name,
+                                          size_type &nbytes) const {
+    auto it = table.find(name);
+    GMM_ASSERT1(it != table.end(), "Missing section '" << name
+                << "' in file '" << fname << "'");
+    nbytes = size_type(it->second.nbytes);
+    return data + it->second.offset;
+  }
+
+  void binary_file_reader::read_strings(const std::string &name,
+                                        std::vector<std::string> &l) const {
+    size_type n;
+    const char *p = section_as<char>(name, n);
+    l.resize(0);
+    for (size_type i = 0; i < n; ++i) {
+      size_type len = strnlen(p+i, n-i);
+      l.push_back(std::string(p+i, len));
+      i += len;
+    }
+  }
+
+  bool is_binary_file(const std::string &name) {
+    std::ifstream ist(name.c_str(), std::ios::binary);
+    char magic[8];
+    return ist && ist.read(magic, 8)
+      && std::memcmp(magic, binary_file_magic, 8) == 0;
+  }
+
+}  /* end of namespace getfem.                                             */
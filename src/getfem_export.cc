@@ -23,6 +23,9 @@
 #include "getfem/dal_singleton.h"
 #include "getfem/bgeot_comma_init.h"
 #include "getfem/getfem_export.h"
+#ifdef GETFEM_HAVE_ZLIB_H
+# include <zlib.h>
+#endif
 
 namespace getfem
 {
@@ -214,6 +217,14 @@ namespace getfem
       if (state == IN_POINT_DATA) os << "</PointData>\n";
       os << "</Piece>\n";
       os << "</UnstructuredGrid>\n";
+      if (appended) {
+        const std::vector<unsigned char> &data
+          = compressed ? appended_data : vals;
+        os << "<AppendedData encoding=\"raw\">\n_";
+        os.write(reinterpret_cast<const char *>(data.data()),
+                 std::streamsize(data.size()));
+        os << "\n</AppendedData>\n";
+      }
       os << "</VTKFile>\n";
     }
   }
@@ -224,9 +235,25 @@ namespace getfem
     static int test_endian = 0x01234567;
     reverse_endian = (*((char*)&test_endian) == 0x67);
     state = EMPTY;
+    appended = compressed = false;
+    block_start = 0;
     clear_vals();
   }
 
+  void vtk_export::set_appended_binary(bool compress) {
+    GMM_ASSERT1(!vtk, "appended data is only available for vtu files");
+    GMM_ASSERT1(state == EMPTY, "set_appended_binary should be called "
+                "before writing anything");
+    if (ascii) return;
+    appended = true;
+#ifdef GETFEM_HAVE_ZLIB_H
+    compressed = compress;
+#else
+    if (compress)
+      GMM_WARNING2("GetFEM is built without zlib, vtu data not compressed");
+#endif
+  }
+
   void vtk_export::switch_to_cell_data() {
     if (state != IN_CELL_DATA) {
       if (vtk) {
@@ -279,15 +306,22 @@ namespace getfem
     exporting(*pmf);
   }
 
-  void vtk_export::exporting(const mesh_fem& mf) {
-    dim_ = mf.linked_mesh().dim();
-    GMM_ASSERT1(dim_ <= 3, "attempt to export a " << int(dim_)
-                << "D mesh_fem (not supported)");
-    if (&mf != pmf.get())
-      pmf = std::make_unique<mesh_fem>(mf.linked_mesh());
-    /* initialize pmf with finite elements suitable for VTK (which only knows
-       isoparametric FEMs of order 1 and 2) */
-    for (dal::bv_visitor cv(mf.convex_index()); !cv.finished(); ++cv) {
+  void vtk_export::exporting(const mesh_fem& mf)
+  { exporting(mf, mf.convex_index()); }
+
+  /* Initialize pmf, on the convexes of cvlst, with finite elements
+     suitable for VTK (which only knows isoparametric FEMs of order 1 and 2),
+     find out the VTK cell type of each convex and which dofs are exported.
+     Pixels and voxels are used for the axis-aligned cells if with_voxels. */
+  static void vtk_compatible_mesh_fem(const mesh_fem &mf,
+                                      const dal::bit_vector &cvlst,
+                                      mesh_fem &pmf,
+                                      std::vector<unsigned> &mapping_type,
+                                      dal::bit_vector &dof_used,
+                                      bool with_voxels) {
+    dal::bit_vector cvs = mf.convex_index();
+    if (&cvlst != &(mf.convex_index())) cvs &= cvlst;
+    for (dal::bv_visitor cv(cvs); !cv.finished(); ++cv) {
       bgeot::pgeometric_trans pgt = mf.linked_mesh().trans_of_convex(cv);
       pfem pf = mf.fem_of_element(cv);
 
@@ -297,7 +331,7 @@ namespace getfem
           pf == fem_descriptor("FEM_PYRAMID_Q2_INCOMPLETE_DISCONTINUOUS") ||
           pf == fem_descriptor("FEM_PRISM_INCOMPLETE_P2") ||
           pf == fem_descriptor("FEM_PRISM_INCOMPLETE_P2_DISCONTINUOUS"))
-        pmf->set_finite_element(cv, pf);
+        pmf.set_finite_element(cv, pf);
       else {
         bool discontinuous = false;
         for (unsigned i=0; i < pf->nb_dof(cv); ++i) {
@@ -313,20 +347,20 @@ namespace getfem
             pgt->structure() != pgt->basic_structure())
           degree = 2;
 
-        pmf->set_finite_element(cv, discontinuous ?
-                                classical_discontinuous_fem(pgt, degree, 0, true) :
-                                classical_fem(pgt, degree, true));
+        pmf.set_finite_element(cv, discontinuous ?
+                               classical_discontinuous_fem(pgt, degree, 0, true) :
+                               classical_fem(pgt, degree, true));
       }
     }
     /* find out which dof will be exported to VTK/VTU */
 
-    const mesh &m = pmf->linked_mesh();
-    pmf_mapping_type.resize(pmf->convex_index().last_true() + 1, unsigned(-1));
-    pmf_dof_used.sup(0, pmf->nb_basic_dof());
-    for (dal::bv_visitor cv(pmf->convex_index()); !cv.finished(); ++cv) {
+    const mesh &m = pmf.linked_mesh();
+    mapping_type.resize(pmf.convex_index().last_true() + 1, unsigned(-1));
+    dof_used.sup(0, pmf.nb_basic_dof());
+    for (dal::bv_visitor cv(pmf.convex_index()); !cv.finished(); ++cv) {
       vtk_mapping_type t = NO_VTK_MAPPING;
-      size_type nbd = pmf->fem_of_element(cv)->nb_dof(cv);
-      switch (pmf->fem_of_element(cv)->dim()) {
+      size_type nbd = pmf.fem_of_element(cv)->nb_dof(cv);
+      switch (pmf.fem_of_element(cv)->dim()) {
       case 0: t = N1_TO_VTK_VERTEX; break;
       case 1:
         if (nbd == 2) t = N2_TO_VTK_LINE;
@@ -335,8 +369,8 @@ namespace getfem
       case 2:
         if (nbd == 3) t = N3_TO_VTK_TRIANGLE;
         else if (nbd == 4)
-          t = check_voxel(m.points_of_convex(cv)) ? N4_TO_VTK_PIXEL
-                                                  : N4_TO_VTK_QUAD;
+          t = (with_voxels && check_voxel(m.points_of_convex(cv)))
+            ? N4_TO_VTK_PIXEL : N4_TO_VTK_QUAD;
         else if (nbd == 6) t = N6_TO_VTK_QUADRATIC_TRIANGLE;
         else if (nbd == 8) t = N8_TO_VTK_QUADRATIC_QUAD;
         else if (nbd == 9) t = N9_TO_VTK_BIQUADRATIC_QUAD;
@@ -345,8 +379,8 @@ namespace getfem
         if (nbd == 4) t = N4_TO_VTK_TETRA;
         else if (nbd == 10) t = N10_TO_VTK_QUADRATIC_TETRA;
         else if (nbd == 8)
-          t = check_voxel(m.points_of_convex(cv)) ? N8_TO_VTK_VOXEL
-                                                  : N8_TO_VTK_HEXAHEDRON;
+          t = (with_voxels && check_voxel(m.points_of_convex(cv)))
+            ? N8_TO_VTK_VOXEL : N8_TO_VTK_HEXAHEDRON;
         else if (nbd == 20) t = N20_TO_VTK_QUADRATIC_HEXAHEDRON;
         else if (nbd == 27) t = N27_TO_VTK_TRIQUADRATIC_HEXAHEDRON;
         else if (nbd == 5) t = N5_TO_VTK_PYRAMID;
@@ -358,19 +392,28 @@ namespace getfem
         break;
       }
       GMM_ASSERT1(t != -1, "semi internal error. Could not map " <<
-                  name_of_fem(pmf->fem_of_element(cv))
-                << " to a VTK cell type");
-      pmf_mapping_type[cv] = t;
+                  name_of_fem(pmf.fem_of_element(cv))
+                  << " to a VTK cell type");
+      mapping_type[cv] = t;
 
       const std::vector<unsigned> &dmap = select_vtk_dof_mapping(t);
       //cout << "nbd = " << nbd << ", t = " << t << ", dmap = "<<dmap << "\n";
-      GMM_ASSERT1(dmap.size() <= pmf->nb_basic_dof_of_element(cv),
-                "inconsistency in vtk_dof_mapping");
+      GMM_ASSERT1(dmap.size() <= pmf.nb_basic_dof_of_element(cv),
+                  "inconsistency in vtk_dof_mapping");
       for (unsigned i=0; i < dmap.size(); ++i)
-        pmf_dof_used.add(pmf->ind_basic_dof_of_element(cv)[dmap[i]]);
+        dof_used.add(pmf.ind_basic_dof_of_element(cv)[dmap[i]]);
     }
-    // cout << "mf.nb_dof = " << mf.nb_dof() << ", pmf->nb_dof="
-    //      << pmf->nb_dof() << ", dof_used = " << pmf_dof_used.card() << "\n";
+  }
+
+  void vtk_export::exporting(const mesh_fem& mf,
+                             const dal::bit_vector &cvlst) {
+    dim_ = mf.linked_mesh().dim();
+    GMM_ASSERT1(dim_ <= 3, "attempt to export a " << int(dim_)
+                << "D mesh_fem (not supported)");
+    if (&mf != pmf.get())
+      pmf = std::make_unique<mesh_fem>(mf.linked_mesh());
+    vtk_compatible_mesh_fem(mf, cvlst, *pmf, pmf_mapping_type, pmf_dof_used,
+                            true);
   }
 
 
@@ -398,7 +441,12 @@ namespace getfem
       os << (ascii ? "ASCII\n" : "BINARY\n");
     } else {
       os << "<?xml version=\"1.0\"?>\n";
-      os << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" ";
+      os << "<VTKFile type=\"UnstructuredGrid\" ";
+      if (appended) {
+        os << "version=\"1.0\" header_type=\"UInt64\" ";
+        if (compressed) os << "compressor=\"vtkZLibDataCompressor\" ";
+      } else
+        os << "version=\"0.1\" ";
       os << "byte_order=\"" << (reverse_endian ? "LittleEndian" : "BigEndian") << "\">\n";
       os << "<!--" << header << "-->\n";
       os << "<UnstructuredGrid>\n";
@@ -414,11 +462,74 @@ namespace getfem
 
   void vtk_export::write_vals() {
     if (!vtk && !ascii) {
-      os << base64_encode(vals);
-      clear_vals();
+      if (!appended) {
+        os << base64_encode(vals);
+        clear_vals();
+      } else if (compressed) {
+        append_compressed_vals();
+        clear_vals();
+      } else { /* the block is already in vals, after its header */
+        gmm::uint64_type n = vals.size() - block_start - sizeof(n);
+        std::memcpy(&vals[block_start], &n, sizeof(n));
+      }
+    }
+  }
+
+  /* End of the opening tag of a DataArray. For appended data, the tag is
+     closed and a new block begins. */
+  void vtk_export::write_format() {
+    if (ascii) os << "format=\"ascii\">\n";
+    else if (!appended) os << "format=\"binary\">\n";
+    else {
+      size_type offset = compressed ? appended_data.size() : vals.size();
+      os << "format=\"appended\" offset=\"" << offset << "\"/>\n";
+      if (!compressed) {
+        block_start = vals.size();
+        vals.resize(block_start + sizeof(gmm::uint64_type));
+      }
     }
   }
 
+  /* Compression of the block in vals with the format of
+     vtkZLibDataCompressor: the data is split into sub-blocks of 32kB
+     compressed independently (in parallel), preceded by a header giving
+     the number of sub-blocks, their size, the size of the last one if it
+     is partial and the compressed size of each of them. */
+  void vtk_export::append_compressed_vals() {
+#ifdef GETFEM_HAVE_ZLIB_H
+    typedef gmm::uint64_type uint64;
+    const size_type bs = 32768;
+    size_type n = vals.size(), nb = (n + bs - 1) / bs;
+    std::vector<std::vector<unsigned char> > blocks(nb);
+    std::vector<char> bad(nb, 0);
+    auto compress_block = [&](size_type i) {
+      size_type s = std::min(bs, n - i*bs);
+      uLongf cs = compressBound(uLong(s));
+      blocks[i].resize(cs);
+      /* the fastest compression level: the export should stay cheap */
+      if (compress2(blocks[i].data(), &cs, &vals[i*bs], uLong(s), 1) != Z_OK)
+        bad[i] = 1;
+      blocks[i].resize(cs);
+    };
+    GETFEM_OMP_FOR(size_type i = 0, i < nb, ++i, compress_block(i));
+    for (size_type i = 0; i < nb; ++i)
+      GMM_ASSERT1(!bad[i], "zlib compression failed");
+
+    std::vector<uint64> bheader(3 + nb);
+    bheader[0] = nb; bheader[1] = bs; bheader[2] = n % bs;
+    for (size_type i = 0; i < nb; ++i) bheader[3+i] = blocks[i].size();
+    const unsigned char *h
+      = reinterpret_cast<const unsigned char *>(bheader.data());
+    appended_data.insert(appended_data.end(), h,
+                         h + bheader.size() * sizeof(uint64));
+    for (size_type i = 0; i < nb; ++i)
+      appended_data.insert(appended_data.end(), blocks[i].begin(),
+                           blocks[i].end());
+#else
+    GMM_ASSERT1(false, "GetFEM is built without zlib");
+#endif
+  }
+
   void vtk_export::write_mesh() {
     if (psl) write_mesh_structure_from_slice();
     else write_mesh_structure_from_mesh_fem();
@@ -447,8 +558,8 @@ namespace getfem
       os << "<Points>\n";
       os << "<DataArray type=\"Float32\" Name=\"Points\" ";
       os << "NumberOfComponents=\"3\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) write_val(int(sizeof(float)*psl->nb_points()*3));
+      write_format();
+      if (!ascii && !appended) write_val(int(sizeof(float)*psl->nb_points()*3));
     }
     /*
        points are not merge, vtk is mostly fine with that (except for
@@ -462,7 +573,7 @@ namespace getfem
     }
     write_vals();
     if (!vtk) {
-      os << (ascii ? "" : "\n") << "</DataArray>\n";
+      if (!appended) os << (ascii ? "" : "\n") << "</DataArray>\n";
       os << "</Points>\n";
     }
 
@@ -473,8 +584,8 @@ namespace getfem
     } else {
       os << "<Cells>\n";
       os << "<DataArray type=\"Int32\" Name=\"connectivity\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) {
+      write_format();
+      if (!ascii && !appended) {
         int size = 0;
         for (size_type ic=0; ic < psl->nb_convex(); ++ic) {
           for (const slice_simplex &s : psl->simplexes(ic))
@@ -498,10 +609,10 @@ namespace getfem
     if (vtk) {
       write_separ(); os << "CELL_TYPES " << splx_cnt << "\n";
     } else {
-      os << (ascii ? "" : "\n") << "</DataArray>\n";
+      if (!appended) os << (ascii ? "" : "\n") << "</DataArray>\n";
       os << "<DataArray type=\"Int32\" Name=\"offsets\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) {
+      write_format();
+      if (!ascii && !appended) {
         int size = 0;
         for (size_type ic=0; ic < psl->nb_convex(); ++ic)
           size += int(psl->simplexes(ic).size()*sizeof(int));
@@ -523,10 +634,10 @@ namespace getfem
     write_vals();
     assert(splx_cnt == 0); // sanity check
     if (!vtk) {
-      os << (ascii ? "" : "\n") << "</DataArray>\n";
+      if (!appended) os << (ascii ? "" : "\n") << "</DataArray>\n";
       os << "<DataArray type=\"Int32\" Name=\"types\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) {
+      write_format();
+      if (!ascii && !appended) {
         int size = 0;
         for (size_type ic=0; ic < psl->nb_convex(); ++ic)
           size += int(psl->simplexes(ic).size()*sizeof(int));
@@ -536,7 +647,7 @@ namespace getfem
         for (const slice_simplex &s : psl->simplexes(ic))
           write_val(int(vtk_simplex_code[s.dim()]));
       write_vals();
-      os << "\n" << "</DataArray>\n";
+      if (!appended) os << "\n" << "</DataArray>\n";
       os << "</Cells>\n";
     }
     state = STRUCTURE_WRITTEN;
@@ -556,8 +667,8 @@ namespace getfem
       os << "<Points>\n";
       os << "<DataArray type=\"Float32\" Name=\"Points\" ";
       os << "NumberOfComponents=\"3\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) write_val(int(sizeof(float)*pmf_dof_used.card()*3));
+      write_format();
+      if (!ascii && !appended) write_val(int(sizeof(float)*pmf_dof_used.card()*3));
     }
     std::vector<int> dofmap(pmf->nb_dof());
     int cnt = 0;
@@ -577,12 +688,12 @@ namespace getfem
       write_separ();
       os << "CELLS " << pmf->convex_index().card() << " " << nb_cell_values << "\n";
     } else {
-      os << (ascii ? "" : "\n") << "</DataArray>\n";
+      if (!appended) os << (ascii ? "" : "\n") << "</DataArray>\n";
       os << "</Points>\n";
       os << "<Cells>\n";
       os << "<DataArray type=\"Int32\" Name=\"connectivity\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii) {
+      write_format();
+      if (!ascii && !appended) {
         int size = 0;
         for (dal::bv_visitor cv(pmf->convex_index()); !cv.finished(); ++cv) {
           const std::vector<unsigned> &dmap = select_vtk_dof_mapping(pmf_mapping_type[cv]);
@@ -605,10 +716,10 @@ namespace getfem
       write_separ();
       os << "CELL_TYPES " << pmf->convex_index().card() << "\n";
     } else {
-      os << (ascii ? "" : "\n") << "</DataArray>\n";
+      if (!appended) os << (ascii ? "" : "\n") << "</DataArray>\n";
       os << "<DataArray type=\"Int32\" Name=\"offsets\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii)
+      write_format();
+      if (!ascii && !appended)
         write_val(int(pmf->convex_index().card()*sizeof(int)));
       cnt = 0;
       for (dal::bv_visitor cv(pmf->convex_index()); !cv.finished(); ++cv) {
@@ -617,10 +728,10 @@ namespace getfem
         write_val(cnt);
       }
       write_vals();
-      os << "\n" << "</DataArray>\n";
+      if (!appended) os << "\n" << "</DataArray>\n";
       os << "<DataArray type=\"Int32\" Name=\"types\" ";
-      os << (ascii ? "format=\"ascii\">\n" : "format=\"binary\">\n");
-      if (!ascii)
+      write_format();
+      if (!ascii && !appended)
         write_val(int(pmf->convex_index().card()*sizeof(int)));
     }
     for (dal::bv_visitor cv(pmf->convex_index()); !cv.finished(); ++cv) {
@@ -628,7 +739,7 @@ namespace getfem
       if (vtk) write_separ();
     }
     write_vals();
-    if (!vtk) os << "\n" << "</DataArray>\n" << "</Cells>\n";
+    if (!vtk) os << (appended ? "" : "\n</DataArray>\n") << "</Cells>\n";
 
     state = STRUCTURE_WRITTEN;
   }
@@ -652,6 +763,468 @@ namespace getfem
   }
 
 
+  /* -------------------------------------------------------------
+   * Parallel VTU export and collection files
+   * ------------------------------------------------------------- */
+
+  pvtu_export::pvtu_export(const std::string &basename_, bool compress_)
+    : basename(basename_), compress(compress_), nb_cells(0),
+      nb_total_pieces(0), first_piece(0), closed(false) {}
+
+  pvtu_export::~pvtu_export() {
+    try { close(); }
+    catch (const std::exception &e) { GMM_WARNING1(e.what()); }
+  }
+
+  size_type pvtu_export::nb_components(size_type Q) {
+    return (Q == 1) ? 1 : ((Q <= 3) ? 3 : 9);
+  }
+
+  void pvtu_export::check_exporting() const {
+    GMM_ASSERT1(!closed, "the pvtu export is already completed");
+    GMM_ASSERT1(nb_total_pieces, "exporting should be called first");
+  }
+
+  void pvtu_export::exporting(const mesh &m, size_type nb_pieces) {
+    pmf = std::make_unique<mesh_fem>(const_cast<mesh&>(m), dim_type(1));
+    for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv) {
+      bgeot::pgeometric_trans pgt = m.trans_of_convex(cv);
+      pmf->set_finite_element
+        (cv, classical_fem(pgt, pgt->complexity() > 1 ? 2 : 1));
+    }
+    exporting(*pmf, nb_pieces);
+  }
+
+  void pvtu_export::exporting(const mesh_fem &mf, size_type nb_pieces) {
+    GMM_ASSERT1(!closed && pieces.empty(), "exporting already called");
+    const dal::bit_vector &cvs = mf.convex_index();
+    std::vector<dal::bit_vector> lists;
+#if GETFEM_PARA_LEVEL > 1
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+    nb_total_pieces = size; first_piece = rank;
+    lists.resize(1);
+    lists[0] = mf.linked_mesh().get_mpi_region().index();
+    lists[0] &= cvs;
+    GMM_ASSERT1(nb_pieces <= 1, "with MPI, each process writes one piece");
+#else
+    if (nb_pieces == 0) nb_pieces = max_concurrency();
+    nb_pieces = std::max(size_type(1), std::min(nb_pieces, cvs.card()));
+    nb_total_pieces = nb_pieces;
+    lists.resize(nb_pieces);
+    size_type k = 0, nbcv = cvs.card();
+    for (dal::bv_visitor cv(cvs); !cv.finished(); ++cv, ++k)
+      lists[(k * nb_pieces) / nbcv].add(cv);
+#endif
+    nb_cells = 0;
+    cv_ofs.assign(1, 0);
+    for (const dal::bit_vector &l : lists) {
+      cv_ofs.push_back(cv_ofs.back() + l.card());
+      nb_cells += l.card();
+    }
+    mf.nb_dof(); // the dofs are enumerated before the parallel part.
+    for (size_type i = 0; i < lists.size(); ++i) {
+      std::stringstream fname;
+      fname << basename << "_" << first_piece + i << ".vtu";
+      pieces.push_back(std::make_unique<vtu_export>(fname.str()));
+      pieces.back()->set_appended_binary(compress);
+      pieces.back()->exporting(mf, lists[i]);
+    }
+  }
+
+  void pvtu_export::write_mesh() {
+    check_exporting();
+    auto write_piece = [&](size_type i) { pieces[i]->write_mesh(); };
+    GETFEM_OMP_FOR(size_type i = 0, i < pieces.size(), ++i, write_piece(i));
+  }
+
+  void pvtu_export::close() {
+    if (closed || !nb_total_pieces) return;
+    write_mesh();
+    /* the pieces are completed by their destructors */
+    auto close_piece = [&](size_type i) { pieces[i].reset(); };
+    GETFEM_OMP_FOR(size_type i = 0, i < pieces.size(), ++i, close_piece(i));
+    pieces.clear();
+    closed = true;
+    if (first_piece != 0) return;
+
+    std::string name = basename + ".pvtu";
+    std::ofstream f(name.c_str());
+    GMM_ASSERT1(f, "impossible to write to file '" << name << "'");
+    static int test_endian = 0x01234567;
+    bool little_endian = (*((char*)&test_endian) == 0x67);
+    std::string::size_type pos = basename.find_last_of("/\\");
+    std::string source = (pos == std::string::npos)
+      ? basename : basename.substr(pos+1);
+    f << "<?xml version=\"1.0\"?>\n";
+    f << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" "
+      << "header_type=\"UInt64\" byte_order=\""
+      << (little_endian ? "LittleEndian" : "BigEndian") << "\">\n";
+    f << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+    f << "<PPoints>\n<PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>"
+      << "\n</PPoints>\n";
+    if (point_arrays.size()) {
+      f << "<PPointData>\n";
+      for (const std::string &a : point_arrays) f << a;
+      f << "</PPointData>\n";
+    }
+    if (cell_arrays.size()) {
+      f << "<PCellData>\n";
+      for (const std::string &a : cell_arrays) f << a;
+      f << "</PCellData>\n";
+    }
+    for (size_type i = 0; i < nb_total_pieces; ++i)
+      f << "<Piece Source=\"" << source << "_" << i << ".vtu\"/>\n";
+    f << "</PUnstructuredGrid>\n";
+    f << "</VTKFile>\n";
+  }
+
+  void pvd_export::add_dataset(const std::string &fname, scalar_type time,
+                               size_type part) {
+    std::stringstream ss;
+    gmm::stream_standard_locale sl(ss);
+    ss << std::setprecision(16) << "<DataSet timestep=\"" << time
+       << "\" group=\"\" part=\"" << part << "\" file=\"" << fname
+       << "\"/>\n";
+    datasets.push_back(ss.str());
+    std::ofstream f(filename.c_str());
+    GMM_ASSERT1(f, "impossible to write to file '" << filename << "'");
+    f << "<?xml version=\"1.0\"?>\n";
+    f << "<VTKFile type=\"Collection\" version=\"0.1\">\n";
+    f << "<Collection>\n";
+    for (const std::string &d : datasets) f << d;
+    f << "</Collection>\n";
+    f << "</VTKFile>\n";
+  }
+
+
+  /* -------------------------------------------------------------
+   * XDMF time series export
+   * ------------------------------------------------------------- */
+
+  /* XDMF cell type corresponding to a VTK one (XDMF uses the node
+     ordering of VTK for the quadratic cells) */
+  static int xdmf_cell_type(int vtk_type) {
+    switch (vtk_type) {
+    case VTK_VERTEX:                      return 0x1; // Polyvertex
+    case VTK_LINE:                        return 0x2; // Polyline
+    case VTK_TRIANGLE:                    return 0x4;
+    case VTK_QUAD:                        return 0x5;
+    case VTK_TETRA:                       return 0x6;
+    case VTK_PYRAMID:                     return 0x7;
+    case VTK_WEDGE:                       return 0x8;
+    case VTK_HEXAHEDRON:                  return 0x9;
+    case VTK_QUADRATIC_EDGE:              return 0x22;
+    case VTK_BIQUADRATIC_QUAD:            return 0x23;
+    case VTK_QUADRATIC_TRIANGLE:          return 0x24;
+    case VTK_QUADRATIC_QUAD:              return 0x25;
+    case VTK_QUADRATIC_TETRA:             return 0x26;
+    case VTK_QUADRATIC_PYRAMID:           return 0x27;
+    case VTK_QUADRATIC_WEDGE:             return 0x28;
+    case VTK_BIQUADRATIC_QUADRATIC_WEDGE: return 0x29;
+    case VTK_QUADRATIC_HEXAHEDRON:        return 0x30;
+    case VTK_TRIQUADRATIC_HEXAHEDRON:     return 0x32;
+    }
+    GMM_ASSERT1(false, "no XDMF cell type for the VTK cell type "
+                << vtk_type);
+    return 0;
+  }
+
+  template<typename T> static void
+  append_raw(std::vector<unsigned char> &data, T v) {
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(&v);
+    data.insert(data.end(), p, p + sizeof(T));
+  }
+
+  xdmf_series_export::xdmf_series_export(const std::string &basename_,
+                                         size_type nb_buffers_)
+    : basename(basename_), psl(0), dim_(dim_type(-1)), nb_points(0),
+      nb_cells(0), data_size(0), nb_steps(0), in_step(false), closed(false),
+      nb_buffers(std::max(nb_buffers_, size_type(1))), stop(false) {
+    std::string::size_type pos = basename.find_last_of("/\\");
+    binname = ((pos == std::string::npos) ? basename
+                                          : basename.substr(pos+1)) + ".bin";
+    std::string name = basename + ".bin";
+    binfile.open(name.c_str(), std::ios_base::binary | std::ios_base::out
+                               | std::ios_base::trunc);
+    GMM_ASSERT1(binfile, "impossible to write to file '" << name << "'");
+    writer = std::thread(&xdmf_series_export::writer_loop, this);
+  }
+
+  xdmf_series_export::~xdmf_series_export() {
+    try { close(); }
+    catch (const std::exception &e) { GMM_WARNING1(e.what()); }
+    stop_writer();
+  }
+
+  void xdmf_series_export::check_exporting() const {
+    GMM_ASSERT1(!closed, "the xdmf export is already completed");
+    GMM_ASSERT1(psl || pmf.get(), "exporting should be called first");
+  }
+
+  void xdmf_series_export::exporting(const mesh &m) {
+    GMM_ASSERT1(geometry.empty(), "the geometry is already written");
+    pmf = std::make_unique<mesh_fem>(const_cast<mesh&>(m), dim_type(1));
+    for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv) {
+      bgeot::pgeometric_trans pgt = m.trans_of_convex(cv);
+      pmf->set_finite_element
+        (cv, classical_fem(pgt, pgt->complexity() > 1 ? 2 : 1));
+    }
+    exporting(*pmf);
+  }
+
+  void xdmf_series_export::exporting(const mesh_fem &mf) {
+    GMM_ASSERT1(geometry.empty(), "the geometry is already written");
+    dim_ = mf.linked_mesh().dim();
+    GMM_ASSERT1(dim_ <= 3, "attempt to export a " << int(dim_)
+                << "D mesh_fem (not supported)");
+    if (&mf != pmf.get())
+      pmf = std::make_unique<mesh_fem>(mf.linked_mesh());
+    /* XDMF has no pixel and voxel cells */
+    vtk_compatible_mesh_fem(mf, mf.convex_index(), *pmf, pmf_mapping_type,
+                            pmf_dof_used, false);
+    psl = 0;
+    nb_points = pmf_dof_used.card();
+    nb_cells = pmf->convex_index().card();
+  }
+
+  void xdmf_series_export::exporting(const stored_mesh_slice &sl) {
+    GMM_ASSERT1(geometry.empty(), "the geometry is already written");
+    psl = &sl; dim_ = dim_type(sl.dim());
+    GMM_ASSERT1(dim_ <= 3, "attempt to export a " << int(dim_)
+                << "D slice (not supported)");
+    pmf.reset();
+    nb_points = sl.nb_points();
+    nb_cells = 0;
+    for (size_type ic = 0; ic < sl.nb_convex(); ++ic)
+      nb_cells += sl.simplexes(ic).size();
+  }
+
+  /* DataItem referencing the next nb*nc values of the current chunk */
+  std::string xdmf_series_export::data_item(size_type nb, size_type nc,
+                                            bool real) {
+    static int test_endian = 0x01234567;
+    bool little_endian = (*((char*)&test_endian) == 0x67);
+    std::stringstream ss;
+    ss << "<DataItem Format=\"Binary\" NumberType=\""
+       << (real ? "Float" : "Int") << "\" Precision=\"4\" Endian=\""
+       << (little_endian ? "Little" : "Big") << "\" Seek=\""
+       << data_size + current.data.size() << "\" Dimensions=\"" << nb;
+    if (nc > 1) ss << " " << nc;
+    ss << "\">" << binname << "</DataItem>\n";
+    return ss.str();
+  }
+
+  void xdmf_series_export::write_mesh() {
+    check_exporting();
+    if (!geometry.empty()) return;
+    std::vector<unsigned char> &data = current.data;
+    data.reserve(3*sizeof(float)*nb_points);
+    std::string points = data_item(nb_points, 3, true);
+    std::vector<int> topology;
+    if (psl) {
+      /* element type codes for simplexes of dimensions 0,1,2,3 */
+      static int xdmf_simplex_code[4] = { 0x1, 0x2, 0x4, 0x6 };
+      size_type nodes_cnt = 0;
+      for (size_type ic = 0; ic < psl->nb_convex(); ++ic) {
+        for (const slice_node &n : psl->nodes(ic))
+          for (size_type k = 0; k < 3; ++k)
+            append_raw(data, float(k < n.pt.size() ? n.pt[k] : 0.0));
+        for (const slice_simplex &s : psl->simplexes(ic)) {
+          topology.push_back(xdmf_simplex_code[s.dim()]);
+          if (s.dim() < 2) topology.push_back(int(s.dim()+1));
+          for (size_type j = 0; j <= s.dim(); ++j)
+            topology.push_back(int(s.inodes[j] + nodes_cnt));
+        }
+        nodes_cnt += psl->nodes(ic).size();
+      }
+    } else {
+      std::vector<int> dofmap(pmf->nb_dof());
+      int cnt = 0;
+      for (dal::bv_visitor d(pmf_dof_used); !d.finished(); ++d) {
+        dofmap[d] = cnt++;
+        base_node P = pmf->point_of_basic_dof(d);
+        for (size_type k = 0; k < 3; ++k)
+          append_raw(data, float(k < P.size() ? P[k] : 0.0));
+      }
+      for (dal::bv_visitor cv(pmf->convex_index()); !cv.finished(); ++cv) {
+        unsigned t = pmf_mapping_type[cv];
+        const std::vector<unsigned> &dmap = select_vtk_dof_mapping(t);
+        int xt = xdmf_cell_type(select_vtk_type(t));
+        topology.push_back(xt);
+        if (xt <= 0x2) topology.push_back(int(dmap.size()));
+        for (size_type i = 0; i < dmap.size(); ++i)
+          topology.push_back(dofmap[pmf->ind_basic_dof_of_element(cv)[dmap[i]]]);
+      }
+    }
+    std::stringstream ss;
+    ss << "<Topology TopologyType=\"Mixed\" NumberOfElements=\"" << nb_cells
+       << "\">\n" << data_item(topology.size(), 1, false) << "</Topology>\n"
+       << "<Geometry GeometryType=\"XYZ\">\n" << points << "</Geometry>\n";
+    const unsigned char *p
+      = reinterpret_cast<const unsigned char *>(topology.data());
+    data.insert(data.end(), p, p + topology.size() * sizeof(int));
+    geometry = ss.str();
+    data_size += data.size();
+    push(std::move(current));
+    current = chunk();
+  }
+
+  void xdmf_series_export::begin_step(scalar_type time) {
+    check_exporting();
+    GMM_ASSERT1(!in_step, "end_step should be called before a new step");
+    write_mesh();
+    std::stringstream ss;
+    gmm::stream_standard_locale sl(ss);
+    ss << std::setprecision(16) << "<Grid Name=\"step_" << nb_steps
+       << "\" GridType=\"Uniform\">\n<Time Value=\"" << time << "\"/>\n"
+       << geometry;
+    current.grid = ss.str();
+    in_step = true;
+  }
+
+  void xdmf_series_export::write_dataset_(const std::vector<scalar_type> &U,
+                                          const std::string &name,
+                                          size_type qdim, bool cell_data) {
+    check_exporting();
+    GMM_ASSERT1(in_step, "begin_step should be called first");
+    GMM_ASSERT1(!cell_data || !psl, "cell data cannot be exported on a "
+                "slice, use point data");
+    size_type nb_val = cell_data ? nb_cells : nb_points;
+    size_type Q = qdim;
+    if (Q == 1 && nb_val) Q = U.size() / nb_val;
+    GMM_ASSERT1(U.size() == nb_val*Q,
+                "inconsistency in the size of the dataset: "
+                << U.size() << " != " << nb_val << "*" << Q);
+    size_type nc = 1;
+    if (Q == gmm::sqr(dim_) && Q > 3) nc = 9;
+    else if (Q > 1) nc = 3;
+    GMM_ASSERT1(Q <= 3 || nc == 9, "xdmf export does not accept vectors of "
+                "dimension > 3");
+
+    std::stringstream ss;
+    ss << "<Attribute Name=\"" << remove_spaces(name) << "\" AttributeType=\""
+       << (nc == 1 ? "Scalar" : (nc == 3 ? "Vector" : "Tensor"))
+       << "\" Center=\"" << (cell_data ? "Cell" : "Node") << "\">\n"
+       << data_item(nb_val, nc, true) << "</Attribute>\n";
+    current.grid += ss.str();
+
+    std::vector<unsigned char> &data = current.data;
+    data.reserve(data.size() + nb_val*nc*sizeof(float));
+    for (size_type i = 0; i < nb_val; ++i) {
+      if (nc == 9) {
+        /* tensors are stored in FORTRAN order, written in C order */
+        for (size_type k = 0; k < 3; ++k)
+          for (size_type l = 0; l < 3; ++l)
+            append_raw(data, float((k < dim_ && l < dim_)
+                                   ? U[i*Q + k + l*dim_] : 0.0));
+      } else
+        for (size_type k = 0; k < nc; ++k)
+          append_raw(data, float(k < Q ? U[i*Q + k] : 0.0));
+    }
+  }
+
+  void xdmf_series_export::end_step() {
+    check_exporting();
+    GMM_ASSERT1(in_step, "begin_step should be called first");
+    in_step = false;
+    current.grid += "</Grid>\n";
+    data_size += current.data.size();
+    ++nb_steps;
+    push(std::move(current));
+    current = chunk();
+  }
+
+  void xdmf_series_export::push(chunk &&c) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      cond.wait(lock, [this] {
+          return pending.size() < nb_buffers || !error.empty(); });
+      GMM_ASSERT1(error.empty(), error);
+      pending.push_back(std::move(c));
+    }
+    cond.notify_all();
+  }
+
+  void xdmf_series_export::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cond.wait(lock, [this] { return pending.empty(); });
+    GMM_ASSERT1(error.empty(), error);
+  }
+
+  void xdmf_series_export::stop_writer() {
+    if (!writer.joinable()) return;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    cond.notify_all();
+    writer.join();
+  }
+
+  void xdmf_series_export::close() {
+    if (closed) return;
+    if (in_step) end_step();
+    stop_writer();
+    closed = true;
+    binfile.close();
+    GMM_ASSERT1(error.empty(), error);
+  }
+
+  /* Background thread: writes the chunks in order. The chunk at the front
+     of the queue stays there until it is written, so that the size of
+     the queue bounds the memory in use. After an error, the chunks are
+     dropped and the error is reported to the calling thread. */
+  void xdmf_series_export::writer_loop() {
+    for (;;) {
+      std::unique_lock<std::mutex> lock(mutex);
+      cond.wait(lock, [this] { return stop || !pending.empty(); });
+      if (pending.empty()) return;
+      chunk &c = pending.front(); // not invalidated by push_back
+      bool failed = !error.empty();
+      lock.unlock();
+      if (!failed) {
+        try {
+          binfile.write(reinterpret_cast<const char *>(c.data.data()),
+                        std::streamsize(c.data.size()));
+          binfile.flush();
+          GMM_ASSERT1(binfile, "error while writing file '"
+                      << basename << ".bin'");
+          if (!c.grid.empty()) { grids += c.grid; write_index(); }
+        } catch (const std::exception &e) {
+          lock.lock(); error = e.what(); lock.unlock();
+        }
+      }
+      lock.lock();
+      pending.pop_front();
+      lock.unlock();
+      cond.notify_all();
+    }
+  }
+
+  /* the index is written to a temporary file and renamed, so that a
+     reader never sees an incomplete one */
+  void xdmf_series_export::write_index() {
+    std::string name = basename + ".xmf", tmp = name + ".tmp";
+    {
+      std::ofstream f(tmp.c_str());
+      GMM_ASSERT1(f, "impossible to write to file '" << tmp << "'");
+      f << "<?xml version=\"1.0\" ?>\n";
+      f << "<Xdmf Version=\"3.0\">\n<Domain>\n";
+      f << "<Grid Name=\"TimeSeries\" GridType=\"Collection\" "
+        << "CollectionType=\"Temporal\">\n";
+      f << grids;
+      f << "</Grid>\n</Domain>\n</Xdmf>\n";
+      GMM_ASSERT1(f, "error while writing file '" << tmp << "'");
+    }
+#ifdef _WIN32
+    std::remove(name.c_str());
+#endif
+    GMM_ASSERT1(std::rename(tmp.c_str(), name.c_str()) == 0,
+                "impossible to write to file '" << name << "'");
+  }
+
   /* -------------------------------------------------------------
    * OPENDX export
    * ------------------------------------------------------------- */
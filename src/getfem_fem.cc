@@ -90,20 +90,28 @@ namespace getfem {
     bgeot::mat_tmult(&(*(g.begin())), &(*(B.begin())), &(*(t.begin())),M,N,P);
   }
 
+  static inline void spec_mat_tmult_(const bgeot::packed_tensor_tab &g,
+                                     size_type i, const base_matrix &B,
+                                     base_tensor &t) {
+    size_type P = B.nrows(), N = B.ncols();
+    size_type M = t.adjust_sizes_changing_last(g.sizes(), P);
+    bgeot::mat_tmult(g[i], &(*(B.begin())), &(*(t.begin())), M, N, P);
+  }
+
   void fem_interpolation_context::pfp_base_value(base_tensor& t,
                                                  const pfem_precomp &pfp__) {
     const pfem &pf__ = pfp__->get_pfem();
     GMM_ASSERT1(ii_ != size_type(-1), "Internal error");
 
     if (pf__->is_standard())
-      t = pfp__->val(ii());
+      pfp__->vals().get(ii(), t);
     else {
       if (pf__->is_on_real_element())
         pf__->real_base_value(*this, t);
       else {
         switch(pf__->vectorial_type()) {
         case virtual_fem::VECTORIAL_NOTRANSFORM_TYPE:
-          t = pfp__->val(ii()); break;
+          pfp__->vals().get(ii(), t); break;
         case virtual_fem::VECTORIAL_PRIMAL_TYPE:
           t.mat_transp_reduction(pfp__->val(ii()), K(), 1); break;
         case virtual_fem::VECTORIAL_DUAL_TYPE:
@@ -121,7 +129,7 @@ namespace getfem {
   void fem_interpolation_context::base_value(base_tensor& t,
                                              bool withM) const {
     if (pfp_ && ii_ != size_type(-1) && pf_->is_standard())
-      t = pfp_->val(ii());
+      pfp_->vals().get(ii(), t);
     else {
       if (pf_->is_on_real_element())
         pf_->real_base_value(*this, t);
@@ -129,7 +137,7 @@ namespace getfem {
         if (pfp_ && ii_ != size_type(-1)) {
           switch(pf_->vectorial_type()) {
           case virtual_fem::VECTORIAL_NOTRANSFORM_TYPE:
-            t = pfp_->val(ii()); break;
+            pfp_->vals().get(ii(), t); break;
           case virtual_fem::VECTORIAL_PRIMAL_TYPE:
             t.mat_transp_reduction(pfp_->val(ii()), K(), 1); break;
           case virtual_fem::VECTORIAL_DUAL_TYPE:
@@ -165,7 +173,7 @@ namespace getfem {
 
     if (pf__->is_standard()) {
       // t.mat_transp_reduction(pfp__->grad(ii()), B(), 2);
-      spec_mat_tmult_(pfp__->grad(ii()), B(), t);
+      spec_mat_tmult_(pfp__->grads(), ii(), B(), t);
     } else {
       if (pf__->is_on_real_element())
         pf__->real_grad_base_value(*this, t);
@@ -175,7 +183,7 @@ namespace getfem {
           {
             base_tensor u;
             // u.mat_transp_reduction(pfp__->grad(ii()), B(), 2);
-            spec_mat_tmult_(pfp__->grad(ii()), B(), u);
+            spec_mat_tmult_(pfp__->grads(), ii(), B(), u);
             t.mat_transp_reduction(u, K(), 1);
           }
           break;
@@ -183,13 +191,13 @@ namespace getfem {
           {
             base_tensor u;
             // u.mat_transp_reduction(pfp__->grad(ii()), B(), 2);
-            spec_mat_tmult_(pfp__->grad(ii()), B(), u);
+            spec_mat_tmult_(pfp__->grads(), ii(), B(), u);
             t.mat_transp_reduction(u, B(), 1);
           }
           break;
         default:
           // t.mat_transp_reduction(pfp__->grad(ii()), B(), 2);
-          spec_mat_tmult_(pfp__->grad(ii()), B(), t);
+          spec_mat_tmult_(pfp__->grads(), ii(), B(), t);
         }
         if (!(pf__->is_equivalent())) {
           set_pfp(pfp__);
@@ -204,7 +212,7 @@ namespace getfem {
                                                   bool withM) const {
     if (pfp_ && ii_ != size_type(-1) && pf_->is_standard()) {
       // t.mat_transp_reduction(pfp_->grad(ii()), B(), 2);
-      spec_mat_tmult_(pfp_->grad(ii()), B(), t);
+      spec_mat_tmult_(pfp_->grads(), ii(), B(), t);
     } else {
       if (pf()->is_on_real_element())
         pf()->real_grad_base_value(*this, t);
@@ -215,7 +223,7 @@ namespace getfem {
             {
               base_tensor u;
               // u.mat_transp_reduction(pfp_->grad(ii()), B(), 2);
-              spec_mat_tmult_(pfp_->grad(ii()), B(), u);
+              spec_mat_tmult_(pfp_->grads(), ii(), B(), u);
               t.mat_transp_reduction(u, K(), 1);
             }
             break;
@@ -223,13 +231,13 @@ namespace getfem {
             {
               base_tensor u;
               // u.mat_transp_reduction(pfp_->grad(ii()), B(), 2);
-              spec_mat_tmult_(pfp_->grad(ii()), B(), u);
+              spec_mat_tmult_(pfp_->grads(), ii(), B(), u);
               t.mat_transp_reduction(u, B(), 1);
             }
             break;
           default:
             // t.mat_transp_reduction(pfp_->grad(ii()), B(), 2);
-            spec_mat_tmult_(pfp_->grad(ii()), B(), t);
+            spec_mat_tmult_(pfp_->grads(), ii(), B(), t);
           }
 
         } else {
@@ -260,7 +268,7 @@ namespace getfem {
     else {
       base_tensor tt;
       if (have_pfp() && ii() != size_type(-1))
-        tt = pfp()->hess(ii());
+        pfp()->hessians().get(ii(), tt);
       else
         pf()->hess_base_value(xref(), tt);
 
@@ -319,6 +327,36 @@ namespace getfem {
                                          base_tensor &t, bool withM) const
   { c.hess_base_value(t, withM); }
 
+  void virtual_fem::base_values(const bgeot::stored_point_tab &pts,
+                                bgeot::packed_tensor_tab &t) const {
+    base_tensor v;
+    for (size_type i = 0; i < pts.size(); ++i) {
+      base_value(pts[i], v);
+      if (i == 0) t.init(pts.size(), v);
+      t.set(i, v);
+    }
+  }
+
+  void virtual_fem::grad_base_values(const bgeot::stored_point_tab &pts,
+                                     bgeot::packed_tensor_tab &t) const {
+    base_tensor v;
+    for (size_type i = 0; i < pts.size(); ++i) {
+      grad_base_value(pts[i], v);
+      if (i == 0) t.init(pts.size(), v);
+      t.set(i, v);
+    }
+  }
+
+  void virtual_fem::hess_base_values(const bgeot::stored_point_tab &pts,
+                                     bgeot::packed_tensor_tab &t) const {
+    base_tensor v;
+    for (size_type i = 0; i < pts.size(); ++i) {
+      hess_base_value(pts[i], v);
+      if (i == 0) t.init(pts.size(), v);
+      t.set(i, v);
+    }
+  }
+
   /* ******************************************************************** */
   /*        Class for description of an interpolation dof.                */
   /* ******************************************************************** */
@@ -713,6 +751,151 @@ namespace getfem {
     face_tab = f.face_tab;
   }
 
+  /* ******************************************************************** */
+  /*    Fast evaluation of the polynomial fems.                           */
+  /* ******************************************************************** */
+
+  template<> void fem<base_poly>::compute_families_() const {
+    if (families_computed_) return;
+    GLOBAL_OMP_GUARD
+    if (families_computed_) return;
+    compute_grad_(); compute_hess_();
+    size_type R = nb_base_components(0);
+    families_valid_ = (R == nb_base(0) * target_dim()) &&
+      val_family_.init(R, [&](size_type l) -> const base_poly &
+                       { return base_[l]; }) &&
+      grad_family_.init(R*dim(), [&](size_type l) -> const base_poly &
+                        { return grad_[l%R][l/R]; }) &&
+      hess_family_.init(R*dim()*dim(), [&](size_type l) -> const base_poly &
+                        { return hess_[l%R][l/R]; });
+    families_computed_ = true;
+  }
+
+  static inline void
+  eval_family(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+              const base_node &x, base_tensor &t, std::true_type)
+  { f.eval(x.begin(), &(*(t.begin()))); }
+
+  static inline void
+  eval_family(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+              const base_node &x, base_tensor &t, std::false_type) {
+    std::vector<opt_long_scalar_type> v(f.size());
+    f.eval(x.begin(), &v[0]);
+    for (size_type i = 0; i < v.size(); ++i) t[i] = bgeot::to_scalar(v[i]);
+  }
+
+  static inline void
+  eval_family(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+              const base_node &x, base_tensor &t) {
+    eval_family(f, x, t,
+                std::is_same<opt_long_scalar_type, scalar_type>());
+  }
+
+  static inline void
+  eval_family_points(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+                     const bgeot::stored_point_tab &pts,
+                     bgeot::packed_tensor_tab &t, std::true_type)
+  { f.eval_points(pts, pts.size(), [&t](size_type k) { return t[k]; }); }
+
+  static inline void
+  eval_family_points(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+                     const bgeot::stored_point_tab &pts,
+                     bgeot::packed_tensor_tab &t, std::false_type) {
+    size_type nb = f.size();
+    std::vector<opt_long_scalar_type> v(pts.size() * nb);
+    f.eval_points(pts, pts.size(), [&](size_type k) { return &v[k*nb]; });
+    for (size_type k = 0; k < pts.size(); ++k)
+      for (size_type i = 0; i < nb; ++i)
+        t[k][i] = bgeot::to_scalar(v[k*nb+i]);
+  }
+
+  static inline void
+  eval_family_points(const bgeot::polynomial_family<opt_long_scalar_type> &f,
+                     const bgeot::stored_point_tab &pts,
+                     bgeot::packed_tensor_tab &t) {
+    eval_family_points(f, pts, t,
+                       std::is_same<opt_long_scalar_type, scalar_type>());
+  }
+
+  template<> void fem<base_poly>::base_value(const base_node &x,
+                                             base_tensor &t) const {
+    bgeot::multi_index mi(2);
+    mi[1] = target_dim(); mi[0] = short_type(nb_base(0));
+    t.adjust_sizes(mi);
+    if (!families_computed_) compute_families_();
+    if (families_valid_) { eval_family(val_family_, x, t); return; }
+    size_type R = nb_base_components(0);
+    base_tensor::iterator it = t.begin();
+    for (size_type  i = 0; i < R; ++i, ++it)
+      *it = bgeot::to_scalar(base_[i].eval(x.begin()));
+  }
+
+  template<> void fem<base_poly>::grad_base_value(const base_node &x,
+                                                  base_tensor &t) const {
+    bgeot::multi_index mi(3);
+    dim_type n = dim();
+    mi[2] = n; mi[1] = target_dim(); mi[0] = short_type(nb_base(0));
+    t.adjust_sizes(mi);
+    if (!families_computed_) compute_families_();
+    if (families_valid_) { eval_family(grad_family_, x, t); return; }
+    size_type R = nb_base_components(0);
+    base_tensor::iterator it = t.begin();
+    for (dim_type j = 0; j < n; ++j)
+      for (size_type i = 0; i < R; ++i, ++it)
+        *it = bgeot::to_scalar(grad_[i][j].eval(x.begin()));
+  }
+
+  template<> void fem<base_poly>::hess_base_value(const base_node &x,
+                                                  base_tensor &t) const {
+    bgeot::multi_index mi(4);
+    dim_type n = dim();
+    mi[3] = n; mi[2] = n; mi[1] = target_dim();
+    mi[0] = short_type(nb_base(0));
+    t.adjust_sizes(mi);
+    if (!families_computed_) compute_families_();
+    if (families_valid_) { eval_family(hess_family_, x, t); return; }
+    size_type R = nb_base_components(0);
+    base_tensor::iterator it = t.begin();
+    for (dim_type k = 0; k < n; ++k)
+      for (dim_type j = 0; j < n; ++j)
+        for (size_type i = 0; i < R; ++i, ++it)
+          *it = bgeot::to_scalar(hess_[i][j+k*n].eval(x.begin()));
+  }
+
+  template<> void fem<base_poly>::base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const {
+    if (!families_computed_) compute_families_();
+    if (!families_valid_ || pts.empty())
+      { virtual_fem::base_values(pts, t); return; }
+    bgeot::multi_index mi(2);
+    mi[1] = target_dim(); mi[0] = short_type(nb_base(0));
+    t.init(pts.size(), mi);
+    eval_family_points(val_family_, pts, t);
+  }
+
+  template<> void fem<base_poly>::grad_base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const {
+    if (!families_computed_) compute_families_();
+    if (!families_valid_ || pts.empty())
+      { virtual_fem::grad_base_values(pts, t); return; }
+    bgeot::multi_index mi(3);
+    mi[2] = dim(); mi[1] = target_dim(); mi[0] = short_type(nb_base(0));
+    t.init(pts.size(), mi);
+    eval_family_points(grad_family_, pts, t);
+  }
+
+  template<> void fem<base_poly>::hess_base_values
+  (const bgeot::stored_point_tab &pts, bgeot::packed_tensor_tab &t) const {
+    if (!families_computed_) compute_families_();
+    if (!families_valid_ || pts.empty())
+      { virtual_fem::hess_base_values(pts, t); return; }
+    bgeot::multi_index mi(4);
+    mi[3] = mi[2] = dim(); mi[1] = target_dim();
+    mi[0] = short_type(nb_base(0));
+    t.init(pts.size(), mi);
+    eval_family_points(hess_family_, pts, t);
+  }
+
   /* ******************************************************************** */
   /*        PK class.                                                         */
   /* ******************************************************************** */
@@ -855,6 +1038,7 @@ namespace getfem {
     : fem<base_poly>(*fi1) {
     grad_computed_ = false;
     hess_computed_ = false;
+    families_computed_ = false;
     GMM_ASSERT1(fi2->target_dim()==fi1->target_dim(), "dimensions mismatch.");
     GMM_ASSERT1(fi2->basic_structure(0) == fi1->basic_structure(0),
                 "Incompatible elements.");
@@ -4687,21 +4871,36 @@ namespace getfem {
   }
 
   void fem_precomp_::init_val() const {
-    c.resize(pspt->size());
-    for (size_type i = 0; i < pspt->size(); ++i)
-      pf->base_value((*pspt)[i], c[i]);
+    size_t m = cache_memsize();
+    pf->base_values(*pspt, c);
+    cache_memsize_changed(m);
   }
 
   void fem_precomp_::init_grad() const {
-    pc.resize(pspt->size());
-    for (size_type i = 0; i < pspt->size(); ++i)
-      pf->grad_base_value((*pspt)[i], pc[i]);
+    size_t m = cache_memsize();
+    pf->grad_base_values(*pspt, pc);
+    cache_memsize_changed(m);
   }
 
   void fem_precomp_::init_hess() const {
-    hpc.resize(pspt->size());
-    for (size_type i = 0; i < pspt->size(); ++i)
-      pf->hess_base_value((*pspt)[i], hpc[i]);
+    size_t m = cache_memsize();
+    pf->hess_base_values(*pspt, hpc);
+    cache_memsize_changed(m);
+  }
+
+  void fem_precomp_::unpack_(const bgeot::packed_tensor_tab &p,
+                             std::vector<base_tensor> &v) const {
+    size_t m = cache_memsize();
+    v.resize(p.size());
+    for (size_type i = 0; i < p.size(); ++i) p.get(i, v[i]);
+    cache_memsize_changed(m);
+  }
+
+  size_t fem_precomp_::cache_memsize() const {
+    size_t m = c.memsize() + pc.memsize() + hpc.memsize();
+    for (const std::vector<base_tensor> *v : {&c_pts, &pc_pts, &hpc_pts})
+      for (const base_tensor &t : *v) m += t.memsize();
+    return m;
   }
 
   pfem_precomp fem_precomp(pfem pf, bgeot::pstored_point_tab pspt,
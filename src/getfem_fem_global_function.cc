@@ -46,7 +46,9 @@ namespace getfem {
 
   fem_global_function::fem_global_function
   (const std::vector<pglobal_function> &funcs, const mesh &m_)
-    : functions(funcs), m(m_), mim(dummy_mesh_im()), has_mesh_im(false) {
+    : functions(funcs), m(m_), mim(dummy_mesh_im()), has_mesh_im(false),
+      precomps_hits(0), precomps_counter(0),
+      precomps_memory_limit(size_type(1) << 28) {
 
     DAL_STORED_OBJECT_DEBUG_CREATED(this, "Global function fem");
     GMM_ASSERT1(&m != &dummy_mesh(), "A non-empty mesh object"
@@ -63,7 +65,9 @@ namespace getfem {
 
   fem_global_function::fem_global_function
   (const std::vector<pglobal_function> &funcs, const mesh_im &mim_)
-    : functions(funcs), m(mim_.linked_mesh()), mim(mim_), has_mesh_im(true) {
+    : functions(funcs), m(mim_.linked_mesh()), mim(mim_), has_mesh_im(true),
+      precomps_hits(0), precomps_counter(0),
+      precomps_memory_limit(size_type(1) << 28) {
 
     DAL_STORED_OBJECT_DEBUG_CREATED(this, "Global function fem");
     GMM_ASSERT1(&mim != &dummy_mesh_im(), "A non-empty mesh_im object"
@@ -75,10 +79,12 @@ namespace getfem {
   void fem_global_function::update_from_context() const {
 
     if (precomps) {
-      for (const auto &cv_precomps : *precomps)
-        for (const auto &keyval : cv_precomps)
-          dal::del_dependency(precomps, keyval.first);
+      auto lock = precomps_locks.get_unique_lock();
+      for (const auto &keyval : precomps->nb_uses)
+        dal::del_dependency(precomps, keyval.first);
+      precomps->nb_uses.clear();
       precomps->clear();
+      precomps_stats.nb_entries = precomps_stats.memory = 0;
     } else {
       precomps = std::make_shared<precomp_pool>();
       dal::pstatic_stored_object_key pkey
@@ -187,39 +193,148 @@ namespace getfem {
                                             base_tensor &) const
   { GMM_ASSERT1(false, "No hess values, real only element."); }
 
+  void fem_global_function::compute_precomp
+  (size_type cv, const bgeot::stored_point_tab &ptab, size_type order,
+   base_vector &v) const {
+    size_type nbdof = nb_dof(cv), npt = ptab.size(), N = dim();
+    size_type nbc = (order == 0) ? 1 : ((order == 1) ? N : N*N);
+    gmm::resize(v, npt*nbdof*nbc);
+    if (npt == 0) return;
+    base_matrix G;
+    bgeot::vectors_to_base_matrix(G, m.points_of_convex(cv));
+    fem_interpolation_context
+      ctx(m.trans_of_convex(cv), shared_from_this(), ptab[0], G, cv);
+    base_vector val; base_matrix vals;
+    for (size_type i = 0; i < nbdof; ++i) {
+      const global_function &f = *(functions[index_of_global_dof_[cv][i]]);
+      switch (order) {
+      case 0:
+        f.val_of_points(ctx, ptab, val);
+        for (size_type k = 0; k < npt; ++k) v[k*nbdof + i] = val[k];
+        break;
+      case 1:
+        f.grad_of_points(ctx, ptab, vals);
+        break;
+      default:
+        f.hess_of_points(ctx, ptab, vals);
+      }
+      if (order > 0)
+        for (size_type k = 0; k < npt; ++k)
+          for (size_type j = 0; j < nbc; ++j)
+            v[(k*nbc + j)*nbdof + i] = vals(j, k);
+    }
+  }
+
+  void fem_global_function::evict_precomps() const {
+    // The least recently used entries are removed until only three quarters
+    // of the memory limit is used, to amortize the cost of the sort.
+    std::vector<std::pair<size_type,
+                std::pair<size_type, bgeot::pstored_point_tab>>> entries;
+    for (size_type cv = 0; cv < precomps->size(); ++cv)
+      for (const auto &keyval : (*precomps)[cv])
+        entries.push_back(std::make_pair(size_type(keyval.second.last_use),
+                                         std::make_pair(cv, keyval.first)));
+    std::sort(entries.begin(), entries.end(),
+              [](const decltype(entries)::value_type &a,
+                 const decltype(entries)::value_type &b)
+              { return a.first < b.first; });
+    size_type target = precomps_memory_limit / 4 * 3;
+    for (const auto &e : entries) {
+      if (precomps_stats.memory <= target) break;
+      const bgeot::pstored_point_tab &ptab = e.second.second;
+      auto it = (*precomps)[e.second.first].find(ptab);
+      for (const base_vector &d : it->second.data)
+        precomps_stats.memory -= d.size() * sizeof(scalar_type);
+      (*precomps)[e.second.first].erase(it);
+      auto itu = precomps->nb_uses.find(ptab);
+      if (--(itu->second) == 0) {
+        precomps->nb_uses.erase(itu);
+        dal::del_dependency(precomps, ptab);
+      }
+      --(precomps_stats.nb_entries);
+      ++(precomps_stats.nb_evictions);
+    }
+  }
+
+  void fem_global_function::precomp_value
+  (const fem_interpolation_context &c, size_type order, base_tensor &t) const {
+    size_type cv = c.convex_num(), sz = t.size();
+    const bgeot::pstored_point_tab ptab = c.pfp()->get_ppoint_tab();
+    GMM_ASSERT1(precomps, "Internal error");
+    {
+      // The cache hits only share the lock.
+      auto lock = precomps_locks.get_shared_lock();
+      if (precomps->size() == m.nb_allocated_convex()) {
+        auto it = (*precomps)[cv].find(ptab);
+        if (it != (*precomps)[cv].end() && it->second.data[order].size()) {
+          ++precomps_hits;
+          it->second.last_use = ++precomps_counter;
+          auto itd = it->second.data[order].begin() + c.ii()*sz;
+          std::copy(itd, itd + sz, t.begin());
+          return;
+        }
+      }
+    }
+
+    // The values on all the points of the convex are computed at once,
+    // outside of the lock.
+    base_vector v;
+    compute_precomp(cv, *ptab, order, v);
+
+    auto lock = precomps_locks.get_unique_lock();
+    if (precomps->size() == 0)
+      precomps->resize(m.nb_allocated_convex());
+    GMM_ASSERT1(precomps->size() == m.nb_allocated_convex(),
+                "Internal error");
+    ++(precomps_stats.nb_misses);
+    auto it = (*precomps)[cv].find(ptab);
+    if (it == (*precomps)[cv].end()) {
+      it = (*precomps)[cv].emplace(std::piecewise_construct,
+                                   std::forward_as_tuple(ptab),
+                                   std::forward_as_tuple()).first;
+      ++(precomps_stats.nb_entries);
+      if ((precomps->nb_uses[ptab])++ == 0)
+        dal::add_dependency(precomps, ptab);
+      // we could have added the dependency to this->shared_from_this()
+      // instead, but there is a risk that this will shadow the same
+      // dependency through a different path, so that it becomes dangerous
+      // to delete the dependency later
+    }
+    if (it->second.data[order].size() == 0) {
+      it->second.data[order].swap(v);
+      precomps_stats.memory
+        += it->second.data[order].size() * sizeof(scalar_type);
+    }
+    it->second.last_use = ++precomps_counter;
+    auto itd = it->second.data[order].begin() + c.ii()*sz;
+    std::copy(itd, itd + sz, t.begin());
+    if (precomps_stats.memory > precomps_memory_limit) evict_precomps();
+  }
+
+  fem_global_function::precomp_statistics
+  fem_global_function::cache_statistics() const {
+    auto lock = precomps_locks.get_unique_lock();
+    precomp_statistics st = precomps_stats;
+    st.nb_hits = precomps_hits;
+    return st;
+  }
+
+  void fem_global_function::set_cache_memory_limit(size_type bytes) const {
+    auto lock = precomps_locks.get_unique_lock();
+    precomps_memory_limit = bytes;
+    if (precomps && precomps_stats.memory > precomps_memory_limit)
+      evict_precomps();
+  }
+
   void fem_global_function::real_base_value(const fem_interpolation_context& c,
                                             base_tensor &t, bool) const {
     assert(target_dim() == 1);
     size_type cv = c.convex_num();
     size_type nbdof = nb_dof(cv);
     t.adjust_sizes(nbdof, target_dim());
-    if (c.have_pfp() && c.ii() != size_type(-1)) {
-      GMM_ASSERT1(precomps, "Internal error");
-      if (precomps->size() == 0)
-        precomps->resize(m.nb_allocated_convex());
-      GMM_ASSERT1(precomps->size() == m.nb_allocated_convex(), "Internal error");
-      const bgeot::pstored_point_tab ptab = c.pfp()->get_ppoint_tab();
-      auto it = (*precomps)[cv].find(ptab);
-      if (it == (*precomps)[cv].end()) {
-        it = (*precomps)[cv].emplace(ptab, precomp_data()).first;
-        dal::add_dependency(precomps, ptab);
-        // we could have added the dependency to this->shared_from_this()
-        // instead, but there is a risk that this will shadow the same
-        // dependency through a different path, so that it becomes dangerous
-        // to delete the dependency later
-      }
-      if (it->second.val.size() == 0) {
-        it->second.val.resize(ptab->size());
-        base_matrix G;
-        bgeot::vectors_to_base_matrix(G, m.points_of_convex(cv));
-        for (size_type k = 0; k < ptab->size(); ++k) {
-          const fem_interpolation_context
-            ctx(m.trans_of_convex(cv), shared_from_this(), (*ptab)[k], G, cv);
-          real_base_value(ctx, it->second.val[k]);
-        }
-      }
-      gmm::copy(it->second.val[c.ii()].as_vector(), t.as_vector());
-    } else
+    if (c.have_pfp() && c.ii() != size_type(-1))
+      precomp_value(c, 0, t);
+    else
       for (size_type i=0; i < nbdof; ++i) {
         /*cerr << "fem_global_function: real_base_value(" << c.xreal() << ")\n";
         if (c.have_G()) cerr << "G = " << c.G() << "\n";
@@ -234,29 +349,9 @@ namespace getfem {
     size_type cv = c.convex_num();
     size_type nbdof = nb_dof(cv);
     t.adjust_sizes(nbdof, target_dim(), dim());
-    if (c.have_pfp() && c.ii() != size_type(-1)) {
-      GMM_ASSERT1(precomps, "Internal error");
-      if (precomps->size() == 0)
-        precomps->resize(m.nb_allocated_convex());
-      GMM_ASSERT1(precomps->size() == m.nb_allocated_convex(), "Internal error");
-      const bgeot::pstored_point_tab ptab = c.pfp()->get_ppoint_tab();
-      auto it = (*precomps)[cv].find(ptab);
-      if (it == (*precomps)[cv].end()) {
-        it = (*precomps)[cv].emplace(ptab, precomp_data()).first;
-        dal::add_dependency(precomps, ptab);
-      }
-      if (it->second.grad.size() == 0) {
-        it->second.grad.resize(ptab->size());
-        base_matrix G;
-        bgeot::vectors_to_base_matrix(G, m.points_of_convex(cv));
-        for (size_type k = 0; k < ptab->size(); ++k) {
-          const fem_interpolation_context
-            ctx(m.trans_of_convex(cv), shared_from_this(), (*ptab)[k], G, cv);
-          real_grad_base_value(ctx, it->second.grad[k]);
-        }
-      }
-      gmm::copy(it->second.grad[c.ii()].as_vector(), t.as_vector());
-    } else {
+    if (c.have_pfp() && c.ii() != size_type(-1))
+      precomp_value(c, 1, t);
+    else {
       base_small_vector G(dim());
       for (size_type i=0; i < nbdof; ++i) {
         functions[index_of_global_dof_[cv][i]]->grad(c,G);
@@ -272,29 +367,9 @@ namespace getfem {
     size_type cv = c.convex_num();
     size_type nbdof = nb_dof(cv);
     t.adjust_sizes(nbdof, target_dim(), gmm::sqr(dim()));
-    if (c.have_pfp() && c.ii() != size_type(-1)) {
-      GMM_ASSERT1(precomps, "Internal error");
-      if (precomps->size() == 0)
-        precomps->resize(m.nb_allocated_convex());
-      GMM_ASSERT1(precomps->size() == m.nb_allocated_convex(), "Internal error");
-      const bgeot::pstored_point_tab ptab = c.pfp()->get_ppoint_tab();
-      auto it = (*precomps)[cv].find(ptab);
-      if (it == (*precomps)[cv].end()) {
-        it = (*precomps)[cv].emplace(ptab, precomp_data()).first;
-        dal::add_dependency(precomps, ptab);
-      }
-      if (it->second.hess.size() == 0) {
-        it->second.hess.resize(ptab->size());
-        base_matrix G;
-        bgeot::vectors_to_base_matrix(G, m.points_of_convex(cv));
-        for (size_type k = 0; k < ptab->size(); ++k) {
-          const fem_interpolation_context
-            ctx(m.trans_of_convex(cv), shared_from_this(), (*ptab)[k], G, cv);
-          real_hess_base_value(ctx, it->second.hess[k]);
-        }
-      }
-      gmm::copy(it->second.hess[c.ii()].as_vector(), t.as_vector());
-    } else {
+    if (c.have_pfp() && c.ii() != size_type(-1))
+      precomp_value(c, 2, t);
+    else {
       base_matrix H(dim(),dim());
       for (size_type i=0; i < nbdof; ++i) {
         functions[index_of_global_dof_[cv][i]]->hess(c,H);
@@ -132,12 +132,42 @@ namespace getfem {
   // Instructions for compilation: basic optimized operations on tensors
   //=========================================================================
 
+  // Indices of the points of an im_data on the current element, computed
+  // once per element (the data of these points is contiguous).
+  struct ga_instruction_im_data_points : public ga_instruction {
+    const im_data &imd;
+    const fem_interpolation_context &ctx;
+    im_data::element_points &pts;
+    virtual int exec() {
+      GA_DEBUG_INFO("Instruction: points of im data on the element");
+      imd.filtered_points_of_element(ctx.convex_num(), pts);
+      return 0;
+    }
+    ga_instruction_im_data_points(const im_data &imd_,
+                                  const fem_interpolation_context &ctx_,
+                                  im_data::element_points &pts_)
+      : imd(imd_), ctx(ctx_), pts(pts_) {}
+  };
+
+  static const im_data::element_points *
+  ga_im_data_points(ga_instruction_set::region_mim_instructions &rmi,
+                    const im_data &imd, const fem_interpolation_context &ctx) {
+    auto it = rmi.imd_points.find(&imd);
+    if (it == rmi.imd_points.end()) {
+      it = rmi.imd_points.emplace(&imd, im_data::element_points()).first;
+      rmi.elt_instructions.push_back
+        (std::make_shared<ga_instruction_im_data_points>(imd,ctx,it->second));
+    }
+    return &(it->second);
+  }
+
   struct ga_instruction_extract_local_im_data : public ga_instruction {
     base_tensor &t;
     const im_data &imd;
     papprox_integration &pai;
     const base_vector &U;
     const fem_interpolation_context &ctx;
+    const im_data::element_points *pts;
     size_type qdim, cv_old;
     virtual int exec() {
       GA_DEBUG_INFO("Instruction: extract local im data");
@@ -148,7 +178,8 @@ namespace getfem {
                     ->approx_method() == pai, "Im data have to be used only "
                     "on their original integration method.");
       }
-      size_type ipt = imd.filtered_index_of_point(cv, ctx.ii());
+      size_type ipt = pts ? imd.filtered_index_of_point(*pts, cv, ctx.ii())
+                          : imd.filtered_index_of_point(cv, ctx.ii());
       GMM_ASSERT1(ipt != size_type(-1),
                   "Im data with no data on the current integration point.");
       auto it = U.begin()+ipt*qdim;
@@ -158,9 +189,9 @@ namespace getfem {
     ga_instruction_extract_local_im_data
     (base_tensor &t_, const im_data &imd_, const base_vector &U_,
      papprox_integration &pai_, const fem_interpolation_context &ctx_,
-     size_type qdim_)
-      : t(t_), imd(imd_), pai(pai_), U(U_), ctx(ctx_), qdim(qdim_),
-        cv_old(-1)
+     size_type qdim_, const im_data::element_points *pts_ = nullptr)
+      : t(t_), imd(imd_), pai(pai_), U(U_), ctx(ctx_), pts(pts_),
+        qdim(qdim_), cv_old(-1)
     {}
   };
 
@@ -4744,10 +4775,11 @@ namespace getfem {
     scalar_type &coeff;
     const size_type &ipt;
     const bool initialize;
+    const im_data::element_points &pts;
     virtual int exec() {
       GA_DEBUG_INFO("Instruction: vector term assembly for im_data variable");
       size_type cv = ctx.convex_num();
-      size_type i = t.size() * imd.filtered_index_of_point(cv, ctx.ii());
+      size_type i = t.size() * imd.filtered_index_of_point(pts, cv, ctx.ii());
       GMM_ASSERT1(i+t.size() <= I.size(),
                   "Internal error "<<i<<"+"<<t.size()<<" <= "<<I.size());
       auto itw = V.begin() + I.first() + i;
@@ -4763,9 +4795,9 @@ namespace getfem {
     (const base_tensor &t_, base_vector &V_,
      const fem_interpolation_context &ctx_, const gmm::sub_interval &I_,
      const im_data &imd_, scalar_type &coeff_, const size_type &ipt_,
-     bool initialize_=false)
+     const im_data::element_points &pts_, bool initialize_=false)
     : t(t_), V(V_), ctx(ctx_), I(I_), imd(imd_), coeff(coeff_), ipt(ipt_),
-      initialize(initialize_)
+      initialize(initialize_), pts(pts_)
     {}
   };
 
@@ -4791,15 +4823,22 @@ namespace getfem {
     base_vector &V;
     const fem_interpolation_context &ctx;
     const im_data *imd;
+    const im_data::element_points &pts;
     virtual int exec() {
       GA_DEBUG_INFO("Instruction: Assignement to im_data");
-      imd->set_tensor(V, ctx.convex_num(), ctx.ii(), t);
+      GMM_ASSERT2(imd->tensor_size() == t.sizes(),
+                  "t is incompatible with im_data tensor size");
+      size_type ipt = imd->filtered_index_of_point(pts, ctx.convex_num(),
+                                                   ctx.ii());
+      GMM_ASSERT2(ipt != size_type(-1), "Point index of gauss point not found");
+      std::copy(t.begin(), t.end(), V.begin() + ipt*t.size());
       return 0;
     }
     ga_instruction_assignment(const base_tensor &t_, base_vector &V_,
                               const fem_interpolation_context &ctx_,
-                              const im_data *imd_)
-      : t(t_), V(V_), ctx(ctx_), imd(imd_) {}
+                              const im_data *imd_,
+                              const im_data::element_points &pts_)
+      : t(t_), V(V_), ctx(ctx_), imd(imd_), pts(pts_) {}
   };
 
   struct ga_instruction_extract_residual_on_imd_dofs : public ga_instruction {
@@ -4809,11 +4848,12 @@ namespace getfem {
     const gmm::sub_interval &I;
     const im_data &imd;
     const size_type &ipt;
+    const im_data::element_points &pts;
     virtual int exec() {
       GA_DEBUG_INFO("Instruction: extract residual for im_data variable");
       size_type ifirst = I.first();
       size_type cv = ctx.convex_num();
-      size_type i = t.size() * imd.filtered_index_of_point(cv, ctx.ii());
+      size_type i = t.size() * imd.filtered_index_of_point(pts, cv, ctx.ii());
       GMM_ASSERT1(i+t.size() <= I.size(),
                   "Internal error "<<i<<"+"<<t.size()<<" <= "<<I.size());
       for (auto &&val : t.as_vector())
@@ -4823,8 +4863,9 @@ namespace getfem {
     ga_instruction_extract_residual_on_imd_dofs
     (base_tensor &t_, const base_vector &V_,
      const fem_interpolation_context &ctx_, const gmm::sub_interval &I_,
-     const im_data &imd_, const size_type &ipt_)
-    : t(t_), V(V_), ctx(ctx_), I(I_), imd(imd_), ipt(ipt_)
+     const im_data &imd_, const size_type &ipt_,
+     const im_data::element_points &pts_)
+    : t(t_), V(V_), ctx(ctx_), I(I_), imd(imd_), ipt(ipt_), pts(pts_)
     {}
   };
 
@@ -6205,7 +6246,8 @@ namespace getfem {
                         " allowed)");
             pgai = std::make_shared<ga_instruction_extract_local_im_data>
               (pnode->tensor(), *imd, workspace.value(pnode->name),
-               gis.pai, gis.ctx, workspace.qdim(pnode->name));
+               gis.pai, gis.ctx, workspace.qdim(pnode->name),
+               ga_im_data_points(rmi, *imd, gis.ctx));
             rmi.instructions.push_back(std::move(pgai));
           } else {
             GMM_ASSERT1(mf, "Internal error");
@@ -8058,7 +8100,8 @@ namespace getfem {
                   (workspace.value(td.varname_interpolation));
                 GMM_ASSERT1(imd, "Internal error");
                 auto pgai = std::make_shared<ga_instruction_assignment>
-                  (root->tensor(), V, gis.ctx, imd);
+                  (root->tensor(), V, gis.ctx, imd,
+                   *ga_im_data_points(rmi, *imd, gis.ctx));
                 rmi.instructions.push_back(std::move(pgai));
               }
             } else { // Addition of an assembly instruction
@@ -8129,7 +8172,8 @@ namespace getfem {
                     pgai = std::make_shared<ga_instruction_vector_assembly_imd>
                            (root->tensor(), Vr, gis.ctx,
                             workspace.interval_of_variable(root->name_test1),
-                            *imd, gis.coeff, gis.ipt);
+                            *imd, gis.coeff, gis.ipt,
+                            *ga_im_data_points(rmi, *imd, gis.ctx));
                     // Variable root->name_test1 can be internal or not
                 } else {
                   pgai = std::make_shared<ga_instruction_vector_assembly>
@@ -8460,7 +8504,8 @@ namespace getfem {
               pgai =
                 std::make_shared<ga_instruction_extract_residual_on_imd_dofs>
                 (*(CC.RQpr[q1]), workspace.cached_vector(), // cached_V --> CC.RQpr[q1]
-                 gis.ctx, I1, *imd1, gis.ipt);
+                 gis.ctx, I1, *imd1, gis.ipt,
+                 *ga_im_data_points(rmi, *imd1, gis.ctx));
               rmi.instructions.push_back(std::move(pgai));
             }
 
@@ -8518,7 +8563,8 @@ namespace getfem {
               const bool initialize = true;
               pgai = std::make_shared<ga_instruction_vector_assembly_imd>
                 (*(CC.RQpr[q1]), workspace.assembled_vector(), // <- overwriting internal variables residual with internal solution
-                 gis.ctx, I1, *imd1, gis.ONE, gis.ipt, initialize); // without gis.coeff
+                 gis.ctx, I1, *imd1, gis.ONE, gis.ipt,
+                 *ga_im_data_points(rmi, *imd1, gis.ctx), initialize); // without gis.coeff
               rmi.instructions.push_back(std::move(pgai));
             } // for q1
           }
@@ -8631,7 +8677,8 @@ namespace getfem {
                 (Ri, R, gis.ctx, I1, *mf1, gis.coeff, gis.nbpt, gis.ipt, false);
             else if (imd1)
               pgai = std::make_shared<ga_instruction_vector_assembly_imd>
-                (Ri, R, gis.ctx, I1, *imd1, gis.coeff, gis.ipt);
+                (Ri, R, gis.ctx, I1, *imd1, gis.coeff, gis.ipt,
+                 *ga_im_data_points(rmi, *imd1, gis.ctx));
             else
               pgai = std::make_shared<ga_instruction_vector_assembly>
                 (Ri, R, I1, gis.coeff);
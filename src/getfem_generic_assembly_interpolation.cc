@@ -253,6 +253,7 @@ namespace getfem {
     const im_data &imd;
     bool initialized;
     size_type s;
+    im_data::element_points pts;
 
     virtual bgeot::pstored_point_tab
     ppoints_for_element(size_type cv, short_type f,
@@ -297,11 +298,12 @@ namespace getfem {
         initialized = true;
       }
       GMM_ASSERT1(s == si, "Internal error");
-      size_type ipt = imd.filtered_index_of_point(cv, i);
+      if (cv != pts.cv) imd.filtered_points_of_element(cv, pts);
+      size_type ipt = imd.filtered_index_of_point(pts, cv, i);
       GMM_ASSERT1(ipt != size_type(-1),
                   "Im data with no data on the current integration point.");
-      gmm::add(t.as_vector(),
-               gmm::sub_vector(result, gmm::sub_interval(s*ipt, s)));
+      auto it = result.begin() + s*ipt;
+      for (const scalar_type &val : t.as_vector()) *it++ += val;
     }
 
     virtual void finalize() {
@@ -26,6 +26,39 @@
 namespace getfem {
 
 
+  // Default evaluation of a global function on a set of points
+
+  void global_function::val_of_points(fem_interpolation_context &c,
+                                      const std::vector<base_node> &pts,
+                                      base_vector &v) const {
+    gmm::resize(v, pts.size());
+    for (size_type k = 0; k < pts.size(); ++k)
+      { c.set_xref(pts[k]); v[k] = val(c); }
+  }
+
+  void global_function::grad_of_points(fem_interpolation_context &c,
+                                       const std::vector<base_node> &pts,
+                                       base_matrix &g) const {
+    gmm::resize(g, dim_, pts.size());
+    base_small_vector gk(dim_);
+    for (size_type k = 0; k < pts.size(); ++k) {
+      c.set_xref(pts[k]); grad(c, gk);
+      gmm::copy(gk, gmm::mat_col(g, k));
+    }
+  }
+
+  void global_function::hess_of_points(fem_interpolation_context &c,
+                                       const std::vector<base_node> &pts,
+                                       base_matrix &h) const {
+    gmm::resize(h, size_type(dim_)*dim_, pts.size());
+    base_matrix hk(dim_, dim_);
+    for (size_type k = 0; k < pts.size(); ++k) {
+      c.set_xref(pts[k]); hess(c, hk);
+      gmm::copy(hk.as_vector(), gmm::mat_col(h, k));
+    }
+  }
+
+
   // Partial implementation of abstract class global_function_simple
 
   scalar_type global_function_simple::val
@@ -797,6 +830,51 @@ namespace getfem {
         }
     }
 
+    // The level sets are evaluated once for all the points, the nearest
+    // level set being selected once for the convex.
+    void xy_of_points(const fem_interpolation_context &c,
+                      const std::vector<base_node> &pts,
+                      base_vector &x, base_vector &y,
+                      base_matrix &dx, base_matrix &dy,
+                      scalar_type ytol) const {
+      update_mls(c.convex_num(), c.xref().size());
+      auto lsx = std::dynamic_pointer_cast<const mesher_level_set>(mls_x);
+      auto lsy = std::dynamic_pointer_cast<const mesher_level_set>(mls_y);
+      GMM_ASSERT1(lsx && lsy, "Internal error");
+      lsx->values_and_gradients(pts, x, dx);
+      lsy->values_and_gradients(pts, y, dy);
+      for (auto &yy : y) {
+        if (c.xfem_side() > 0 && yy <= ytol) yy = 1E-13;
+        if (c.xfem_side() < 0 && yy >= -ytol) yy = -1E-13;
+      }
+    }
+
+    virtual void val_of_points(fem_interpolation_context &c,
+                               const std::vector<base_node> &pts,
+                               base_vector &v) const {
+      base_vector x, y; base_matrix dx, dy;
+      xy_of_points(c, pts, x, y, dx, dy, 1E-13);
+      gmm::resize(v, pts.size());
+      for (size_type k = 0; k < pts.size(); ++k) v[k] = fn->val(x[k], y[k]);
+    }
+
+    virtual void grad_of_points(fem_interpolation_context &c,
+                                const std::vector<base_node> &pts,
+                                base_matrix &g) const {
+      base_vector x, y; base_matrix dx, dy;
+      xy_of_points(c, pts, x, y, dx, dy, 0.);
+      size_type P = dx.nrows();
+      base_small_vector gref(P);
+      gmm::resize(g, c.N(), pts.size());
+      for (size_type k = 0; k < pts.size(); ++k) {
+        base_small_vector gfn = fn->grad(x[k], y[k]);
+        for (size_type i = 0; i < P; ++i)
+          gref[i] = gfn[0]*dx(i, k) + gfn[1]*dy(i, k);
+        c.set_xref(pts[k]);
+        gmm::mult(c.B(), gref, gmm::mat_col(g, k));
+      }
+    }
+
     void update_from_context() const { cv =  size_type(-1); }
 
     global_function_on_levelsets_2D_(const std::vector<level_set> &lsets_,
@@ -156,6 +156,18 @@ namespace getfem
   size_type im_data::filtered_index_of_first_point(size_type cv, short_type f) const
   { return index_of_first_point(cv, f, true); }
 
+  void im_data::filtered_points_of_element(size_type cv,
+                                           element_points &pts) const {
+    context_check();
+    pts.cv = cv;
+    pts.first = size_type(-1);
+    pts.nb = 0;
+    if (cv < convexes.size() && convexes[cv].first_int_pt_fid != size_type(-1)) {
+      pts.first = convexes[cv].first_int_pt_fid;
+      pts.nb = convexes[cv].nb_int_pts;
+    }
+  }
+
   dal::bit_vector im_data::convex_index(bool use_filter) const {
     context_check();
     dal::bit_vector ind = im_.convex_index();
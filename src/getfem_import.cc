@@ -22,6 +22,7 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <unordered_map>
 
 #include "getfem/getfem_mesh.h"
 #include "getfem/getfem_import.h"
@@ -168,6 +169,174 @@ namespace getfem {
       }
     }
 
+    void reorder_nodes() {
+      // Reordering nodes for certain elements (should be completed ?)
+      // http://www.geuz.org/gmsh/doc/texinfo/gmsh.html#Node-ordering
+      std::vector<size_type> tmp_nodes(nodes);
+      switch(type) {
+      case 3 : {
+        nodes[2] = tmp_nodes[3];
+        nodes[3] = tmp_nodes[2];
+      } break;
+      case 5 : { /* First order hexaedron */
+        //nodes[0] = tmp_nodes[0];
+        //nodes[1] = tmp_nodes[1];
+        nodes[2] = tmp_nodes[3];
+        nodes[3] = tmp_nodes[2];
+        //nodes[4] = tmp_nodes[4];
+        //nodes[5] = tmp_nodes[5];
+        nodes[6] = tmp_nodes[7];
+        nodes[7] = tmp_nodes[6];
+      } break;
+      case 7 : { /* first order pyramid */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[2];
+        nodes[2] = tmp_nodes[1];
+        // nodes[3] = tmp_nodes[3];
+        // nodes[4] = tmp_nodes[4];
+      } break;
+      case 8 : { /* Second order line */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[2];
+        nodes[2] = tmp_nodes[1];
+      } break;
+      case 9 : { /* Second order triangle */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[3];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[5];
+        //nodes[4] = tmp_nodes[4];
+        nodes[5] = tmp_nodes[2];
+      } break;
+      case 10 : { /* Second order quadrangle */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[4];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[7];
+        nodes[4] = tmp_nodes[8];
+        //nodes[5] = tmp_nodes[5];
+        nodes[6] = tmp_nodes[3];
+        nodes[7] = tmp_nodes[6];
+        nodes[8] = tmp_nodes[2];
+      } break;
+      case 11: { /* Second order tetrahedron */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[4];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[6];
+        nodes[4] = tmp_nodes[5];
+        nodes[5] = tmp_nodes[2];
+        nodes[6] = tmp_nodes[7];
+        nodes[7] = tmp_nodes[9];
+        //nodes[8] = tmp_nodes[8];
+        nodes[9] = tmp_nodes[3];
+      } break;
+      case 12: { /* Second order hexahedron */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[8];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[9];
+        nodes[4] = tmp_nodes[20];
+        nodes[5] = tmp_nodes[11];
+        nodes[6] = tmp_nodes[3];
+        nodes[7] = tmp_nodes[13];
+        nodes[8] = tmp_nodes[2];
+        nodes[9] = tmp_nodes[10];
+        nodes[10] = tmp_nodes[21];
+        nodes[11] = tmp_nodes[12];
+        nodes[12] = tmp_nodes[22];
+        nodes[13] = tmp_nodes[26];
+        nodes[14] = tmp_nodes[23];
+        //nodes[15] = tmp_nodes[15];
+        nodes[16] = tmp_nodes[24];
+        nodes[17] = tmp_nodes[14];
+        nodes[18] = tmp_nodes[4];
+        nodes[19] = tmp_nodes[16];
+        nodes[20] = tmp_nodes[5];
+        nodes[21] = tmp_nodes[17];
+        nodes[22] = tmp_nodes[25];
+        nodes[23] = tmp_nodes[18];
+        nodes[24] = tmp_nodes[7];
+        nodes[25] = tmp_nodes[19];
+        nodes[26] = tmp_nodes[6];
+      } break;
+      case 16 : { /* Incomplete second order quadrangle */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[4];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[7];
+        nodes[4] = tmp_nodes[5];
+        nodes[5] = tmp_nodes[3];
+        nodes[6] = tmp_nodes[6];
+        nodes[7] = tmp_nodes[2];
+      } break;
+      case 17: { /* Incomplete second order hexahedron */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[8];
+        nodes[2] = tmp_nodes[1];
+        nodes[3] = tmp_nodes[9];
+        nodes[4] = tmp_nodes[11];
+        nodes[5] = tmp_nodes[3];
+        nodes[6] = tmp_nodes[13];
+        nodes[7] = tmp_nodes[2];
+        nodes[8] = tmp_nodes[10];
+        nodes[9] = tmp_nodes[12];
+        nodes[10] = tmp_nodes[15];
+        nodes[11] = tmp_nodes[14];
+        nodes[12] = tmp_nodes[4];
+        nodes[13] = tmp_nodes[16];
+        nodes[14] = tmp_nodes[5];
+        nodes[15] = tmp_nodes[17];
+        nodes[16] = tmp_nodes[18];
+        nodes[17] = tmp_nodes[7];
+        nodes[18] = tmp_nodes[19];
+        nodes[19] = tmp_nodes[6];
+      } break;
+      case 26 : { /* Third order line */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[2];
+        nodes[2] = tmp_nodes[3];
+        nodes[3] = tmp_nodes[1];
+      } break;
+      case 21 : { /* Third order triangle */
+        //nodes[0] = tmp_nodes[0];
+        nodes[1] = tmp_nodes[3];
+        nodes[2] = tmp_nodes[4];
+        nodes[3] = tmp_nodes[1];
+        nodes[4] = tmp_nodes[8];
+        nodes[5] = tmp_nodes[9];
+        nodes[6] = tmp_nodes[5];
+        //nodes[7] = tmp_nodes[7];
+        nodes[8] = tmp_nodes[6];
+        nodes[9] = tmp_nodes[2];
+      } break;
+      case 23: { /* Fourth order triangle */
+      //nodes[0]  = tmp_nodes[0];
+        nodes[1]  = tmp_nodes[3];
+        nodes[2]  = tmp_nodes[4];
+        nodes[3]  = tmp_nodes[5];
+        nodes[4]  = tmp_nodes[1];
+        nodes[5]  = tmp_nodes[11];
+        nodes[6]  = tmp_nodes[12];
+        nodes[7]  = tmp_nodes[13];
+        nodes[8]  = tmp_nodes[6];
+        nodes[9]  = tmp_nodes[10];
+        nodes[10] = tmp_nodes[14];
+        nodes[11] = tmp_nodes[7];
+        nodes[12] = tmp_nodes[9];
+        nodes[13] = tmp_nodes[8];
+        nodes[14] = tmp_nodes[2];
+      } break;
+      case 27: { /* Fourth order line */
+      //nodes[0]  = tmp_nodes[0];
+        nodes[1]  = tmp_nodes[2];
+        nodes[2]  = tmp_nodes[3];
+        nodes[3]  = tmp_nodes[4];
+        nodes[4]  = tmp_nodes[1];
+      } break;
+      }
+    }
+
     bool operator<(const gmsh_cv_info& other) const {
       unsigned this_dim = (type == 15) ? 0 : pgt->dim();
       unsigned other_dim = (other.type == 15) ? 0 : other.pgt->dim();
@@ -200,6 +369,557 @@ namespace getfem {
     return region_map;
   }
 
+  /* Gmsh file formats 4.0 (ASCII) and 4.1 (ASCII or binary).
+
+     The node and element blocks are read slice by slice. A slice is
+     loaded into memory in one go and then decoded in parallel chunks
+     (number parsing for the ASCII format, translation of the node tags
+     and reordering of the element nodes for both formats). Gmsh element
+     tags being unique, the convexes are inserted without looking for an
+     existing identical convex, and the regions are filled in one pass
+     per dimension once the elements of highest dimension are in the mesh.
+
+     Regions are numbered after the physical tags given in the $Entities
+     (or $PartitionedEntities) section, for both versions of the format
+     and as for the 2.x format. The entity tag is used for the elements of
+     an entity belonging to no physical group.
+
+     The 4.0 format differs by the bounding box given for the points in
+     $Entities, by the order of the entity tag and dimension in the block
+     headers, and by the node tags given on the line of the coordinates.
+  */
+
+  struct gmsh4_entity {
+    std::vector<int> phys;
+    int parent_dim = -1, parent_tag = 0;
+  };
+
+  struct gmsh4_elt_block {
+    int dim, tag, type;
+    size_type nb_nodes; // number of nodes per element
+    bgeot::pgeometric_trans pgt;
+    std::vector<size_type> nodes; // getfem node indices, in getfem order
+    std::vector<size_type> regions;
+    size_type nb_elements() const { return nodes.size() / nb_nodes; }
+  };
+
+  /* Gmsh node tag -> getfem node index. A plain array is used when the
+     tags are dense enough, which is the usual case. */
+  struct gmsh4_node_map {
+    size_type min_tag = 0;
+    bool dense = true;
+    std::vector<size_type> tab;
+    std::unordered_map<size_type, size_type> sparse_tab;
+
+    void init(size_type nb, size_type mint, size_type maxt) {
+      min_tag = mint;
+      dense = (maxt >= mint && maxt - mint < 2*nb + 1024);
+      if (dense) tab.assign(maxt - mint + 1, size_type(-1));
+    }
+    void set(size_type tag, size_type i) {
+      if (dense && tag >= min_tag && tag - min_tag < tab.size())
+        tab[tag - min_tag] = i;
+      else { dense = dense && tab.empty(); sparse_tab[tag] = i; }
+    }
+    size_type operator()(size_type tag) const {
+      if (dense && tag >= min_tag && tag - min_tag < tab.size())
+        return tab[tag - min_tag];
+      auto it = sparse_tab.find(tag);
+      return (it == sparse_tab.end()) ? size_type(-1) : it->second;
+    }
+  };
+
+  /* Apply f(i0, i1) on a partition of [0, n) in parallel chunks. */
+  template <typename FUNC>
+  static void gmsh4_for_chunks(size_type n, const FUNC &f) {
+    size_type nbchunks = std::min(n / 4096 + 1, 4 * max_concurrency());
+    if (nbchunks <= 1) { if (n) f(size_type(0), n); return; }
+    auto treat_chunk = [&](size_type ic) {
+      f((n*ic)/nbchunks, (n*(ic+1))/nbchunks);
+    };
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic, treat_chunk(ic));
+  }
+
+  class gmsh4_reader {
+    std::istream &f;
+    bool v40 = false, binary = false, swap = false;
+    std::string lines;              // raw ASCII lines of the current slice
+    std::vector<size_type> starts;  // start of each line in 'lines'
+    std::map<std::pair<int, int>, gmsh4_entity> entities, pentities;
+    std::map<std::pair<int, int>, std::string> phys_names;
+    gmsh4_node_map node_of_tag;
+    std::vector<gmsh4_elt_block> blocks;
+
+    enum { SLICE = 1 << 18 };
+
+    template <typename T> void swap_bytes(T *p, size_type n) const {
+      for (size_type i = 0; i < n; ++i) {
+        char *c = reinterpret_cast<char *>(p + i);
+        std::reverse(c, c + sizeof(T));
+      }
+    }
+
+    template <typename T> T value() {
+      T v;
+      if (binary) {
+        f.read(reinterpret_cast<char *>(&v), sizeof(T));
+        if (swap) swap_bytes(&v, 1);
+      } else f >> v;
+      return v;
+    }
+
+    template <typename T> void values(std::vector<T> &v, size_type n) {
+      v.resize(n);
+      if (n) f.read(reinterpret_cast<char *>(v.data()),
+                    std::streamsize(n * sizeof(T)));
+      if (swap) swap_bytes(v.data(), n);
+    }
+
+    void end_of_line()
+    { if (!binary) f.ignore(std::numeric_limits<std::streamsize>::max(),'\n'); }
+
+    void read_lines(size_type n) {
+      lines.clear(); starts.resize(n+1);
+      std::string line;
+      for (size_type i = 0; i < n; ++i) {
+        std::getline(f, line);
+        starts[i] = lines.size(); lines += line; lines += '\n';
+      }
+      starts[n] = lines.size();
+    }
+
+    static bool parse(const char *&p, size_type &v) {
+      char *e; v = size_type(strtoull(p, &e, 10));
+      bool ok = (e != p); p = e; return ok;
+    }
+    static bool parse(const char *&p, scalar_type &v) {
+      char *e; v = strtod(p, &e);
+      bool ok = (e != p); p = e; return ok;
+    }
+
+    void read_physical_names();
+    void read_entities(bool partitioned);
+    void read_nodes(mesh &m, bool remove_duplicated_nodes);
+    void read_nodes_v40(mesh &m, size_type nb_block,
+                        bool remove_duplicated_nodes);
+    void read_elements();
+    void node_tags_to_index(std::vector<size_type> &tags,
+                            gmsh4_elt_block &b);
+    const std::vector<int> &physical_tags(int dim, int tag) const;
+
+  public:
+    gmsh4_reader(std::istream &ff, double version)
+      : f(ff), v40(version < 4.05) {}
+    void read(mesh &m, std::map<std::string, size_type> *region_map,
+              std::set<size_type> *lower_dim_convex_rg,
+              bool add_all_element_type,
+              std::map<size_type, std::set<size_type>> *nodal_map,
+              bool remove_duplicated_nodes);
+  };
+
+  void gmsh4_reader::read_physical_names() { // always in ASCII
+    size_type nb;
+    f >> nb;
+    std::string name;
+    for (size_type i = 0; i < nb; ++i) {
+      int dim, tag;
+      f >> dim >> tag;
+      std::getline(f, name);
+      size_t pos = name.find_first_of("\"");
+      if (pos != name.npos) {
+        name.erase(0, pos+1);
+        pos = name.find_last_of("\"");
+        if (pos != name.npos) name.erase(pos);
+      }
+      phys_names[std::make_pair(dim, tag)] = name;
+    }
+  }
+
+  void gmsh4_reader::read_entities(bool partitioned) {
+    if (partitioned) {
+      size_type nb = value<size_type>(); // number of partitions
+      nb = value<size_type>();           // ghost entities
+      for (size_type i = 0; i < 2*nb; ++i) value<int>();
+    }
+    size_type nb[4];
+    for (int d = 0; d < 4; ++d) nb[d] = value<size_type>();
+    for (int d = 0; d < 4; ++d)
+      for (size_type i = 0; i < nb[d]; ++i) {
+        int tag = value<int>();
+        gmsh4_entity &e
+          = (partitioned ? pentities : entities)[std::make_pair(d, tag)];
+        if (partitioned) {
+          e.parent_dim = value<int>(); e.parent_tag = value<int>();
+          size_type nbp = value<size_type>();
+          for (size_type k = 0; k < nbp; ++k) value<int>();
+        }
+        for (int k = 0; k < ((d || v40) ? 6 : 3); ++k) value<scalar_type>();
+        size_type nbph = value<size_type>();
+        e.phys.resize(nbph);
+        for (size_type k = 0; k < nbph; ++k) e.phys[k] = value<int>();
+        if (d) {
+          size_type nbb = value<size_type>();
+          for (size_type k = 0; k < nbb; ++k) value<int>();
+        }
+      }
+  }
+
+  void gmsh4_reader::read_nodes(mesh &m, bool remove_duplicated_nodes) {
+    size_type nb_block = value<size_type>(), nb_node = value<size_type>();
+    if (v40) { read_nodes_v40(m, nb_block, remove_duplicated_nodes); return; }
+    size_type min_tag = value<size_type>(), max_tag = value<size_type>();
+    node_of_tag.init(nb_node, min_tag, max_tag);
+
+    std::vector<size_type> tags;
+    std::vector<scalar_type> coords;
+    base_node pt(3);
+    for (size_type block = 0; block < nb_block; ++block) {
+      int dim = value<int>(); value<int>();
+      int parametric = value<int>();
+      size_type nb = value<size_type>();
+      size_type nbc = 3 + (parametric ? size_type(dim) : 0);
+      end_of_line();
+
+      /* All the tags of the block come before the coordinates. */
+      if (binary) values(tags, nb);
+      else {
+        read_lines(nb);
+        tags.resize(nb);
+        bool ok = true;
+        for (size_type i = 0; i < nb; ++i) {
+          const char *p = lines.c_str() + starts[i];
+          ok = parse(p, tags[i]) && ok;
+        }
+        GMM_ASSERT1(ok, "Gmsh import: invalid node tag");
+      }
+
+      for (size_type i0 = 0; i0 < nb; i0 += SLICE) {
+        size_type n = std::min(nb - i0, size_type(SLICE));
+        if (binary) values(coords, n*nbc);
+        else {
+          read_lines(n);
+          coords.resize(n*nbc);
+          std::vector<int> bad(n, 0);
+          gmsh4_for_chunks(n, [&](size_type j0, size_type j1) {
+            for (size_type j = j0; j < j1; ++j) {
+              const char *p = lines.c_str() + starts[j];
+              for (size_type k = 0; k < nbc; ++k)
+                if (!parse(p, coords[j*nbc+k])) bad[j] = 1;
+            }
+          });
+          for (size_type j = 0; j < n; ++j)
+            GMM_ASSERT1(!bad[j], "Gmsh import: invalid coordinates for node "
+                        << tags[i0+j]);
+        }
+        for (size_type j = 0; j < n; ++j) {
+          std::copy(coords.begin() + j*nbc, coords.begin() + j*nbc + 3,
+                    pt.begin());
+          node_of_tag.set(tags[i0+j],
+                          m.add_point(pt, remove_duplicated_nodes ? 0.:-1.));
+        }
+      }
+    }
+  }
+
+  void gmsh4_reader::read_nodes_v40(mesh &m, size_type nb_block,
+                                    bool remove_duplicated_nodes) {
+    node_of_tag.init(0, 1, 0); // no tag range given in this version
+    std::vector<scalar_type> coords;
+    base_node pt(3);
+    for (size_type block = 0; block < nb_block; ++block) {
+      value<int>(); int dim = value<int>();
+      int parametric = value<int>();
+      size_type nb = value<size_type>();
+      size_type nbc = 4 + (parametric ? size_type(dim) : 0);
+      end_of_line();
+
+      for (size_type i0 = 0; i0 < nb; i0 += SLICE) {
+        size_type n = std::min(nb - i0, size_type(SLICE));
+        read_lines(n);
+        coords.resize(n*nbc);
+        std::vector<int> bad(n, 0);
+        gmsh4_for_chunks(n, [&](size_type j0, size_type j1) {
+          for (size_type j = j0; j < j1; ++j) {
+            const char *p = lines.c_str() + starts[j];
+            size_type tag;
+            if (!parse(p, tag)) bad[j] = 1;
+            coords[j*nbc] = scalar_type(tag);
+            for (size_type k = 1; k < nbc; ++k)
+              if (!parse(p, coords[j*nbc+k])) bad[j] = 1;
+          }
+        });
+        for (size_type j = 0; j < n; ++j) {
+          GMM_ASSERT1(!bad[j], "Gmsh import: invalid node line: "
+                      << lines.substr(starts[j], starts[j+1]-starts[j]-1));
+          std::copy(coords.begin() + j*nbc + 1, coords.begin() + j*nbc + 4,
+                    pt.begin());
+          node_of_tag.set(size_type(coords[j*nbc]),
+                          m.add_point(pt, remove_duplicated_nodes ? 0.:-1.));
+        }
+      }
+    }
+  }
+
+  void gmsh4_reader::node_tags_to_index(std::vector<size_type> &tags,
+                                        gmsh4_elt_block &b) {
+    /* tags holds for each element its tag followed by its node tags. */
+    size_type n = tags.size() / (b.nb_nodes + 1), nb0 = b.nodes.size();
+    b.nodes.resize(nb0 + n*b.nb_nodes);
+    std::vector<size_type> bad(n, 0);
+    gmsh4_for_chunks(n, [&](size_type i0, size_type i1) {
+      gmsh_cv_info ci; ci.type = unsigned(b.type);
+      ci.nodes.resize(b.nb_nodes);
+      for (size_type i = i0; i < i1; ++i) {
+        const size_type *t = &tags[i*(b.nb_nodes+1)];
+        for (size_type k = 0; k < b.nb_nodes; ++k) {
+          ci.nodes[k] = node_of_tag(t[k+1]);
+          if (ci.nodes[k] == size_type(-1)) bad[i] = t[k+1];
+        }
+        ci.reorder_nodes();
+        std::copy(ci.nodes.begin(), ci.nodes.end(),
+                  b.nodes.begin() + nb0 + i*b.nb_nodes);
+      }
+    });
+    for (size_type i = 0; i < n; ++i)
+      GMM_ASSERT1(!bad[i], "Invalid node ID " << bad[i]
+                  << " in gmsh element " << tags[i*(b.nb_nodes+1)]);
+  }
+
+  void gmsh4_reader::read_elements() {
+    size_type nb_block = value<size_type>();
+    value<size_type>();
+    if (!v40) { value<size_type>(); value<size_type>(); }
+
+    std::vector<size_type> tags;
+    for (size_type block = 0; block < nb_block; ++block) {
+      blocks.push_back(gmsh4_elt_block());
+      gmsh4_elt_block &b = blocks.back();
+      if (v40) { b.tag = value<int>(); b.dim = value<int>(); }
+      else { b.dim = value<int>(); b.tag = value<int>(); }
+      b.type = value<int>();
+      size_type nb = value<size_type>();
+      gmsh_cv_info ci; ci.type = unsigned(b.type);
+      ci.set_nb_nodes();
+      b.nb_nodes = ci.nodes.size();
+      if (b.type != 15) { ci.set_pgt(); b.pgt = ci.pgt; }
+      size_type nbt = b.nb_nodes + 1;
+      b.nodes.reserve(nb * b.nb_nodes);
+      end_of_line();
+
+      for (size_type i0 = 0; i0 < nb; i0 += SLICE) {
+        size_type n = std::min(nb - i0, size_type(SLICE));
+        if (binary) values(tags, n*nbt);
+        else {
+          read_lines(n);
+          tags.resize(n*nbt);
+          std::vector<int> bad(n, 0);
+          gmsh4_for_chunks(n, [&](size_type j0, size_type j1) {
+            for (size_type j = j0; j < j1; ++j) {
+              const char *p = lines.c_str() + starts[j];
+              for (size_type k = 0; k < nbt; ++k)
+                if (!parse(p, tags[j*nbt+k])) bad[j] = 1;
+            }
+          });
+          for (size_type j = 0; j < n; ++j)
+            GMM_ASSERT1(!bad[j], "Gmsh import: invalid element line: "
+                        << lines.substr(starts[j], starts[j+1]-starts[j]-1));
+        }
+        node_tags_to_index(tags, b);
+      }
+    }
+  }
+
+  const std::vector<int> &gmsh4_reader::physical_tags(int dim,
+                                                      int tag) const {
+    static const std::vector<int> none;
+    auto it = pentities.find(std::make_pair(dim, tag));
+    if (it != pentities.end()) {
+      if (it->second.phys.size()) return it->second.phys;
+      return physical_tags(it->second.parent_dim, it->second.parent_tag);
+    }
+    it = entities.find(std::make_pair(dim, tag));
+    return (it == entities.end()) ? none : it->second.phys;
+  }
+
+  void gmsh4_reader::read
+  (mesh &m, std::map<std::string, size_type> *region_map,
+   std::set<size_type> *lower_dim_convex_rg, bool add_all_element_type,
+   std::map<size_type, std::set<size_type>> *nodal_map,
+   bool remove_duplicated_nodes) {
+    gmm::standard_locale sl; // for strtod
+
+    int file_type, data_size;
+    f >> file_type >> data_size;
+    binary = (file_type == 1);
+    GMM_ASSERT1(!(binary && v40), "Gmsh import: the binary variant of the "
+                "4.0 format is not supported, please use the 4.1 format");
+    if (binary) {
+      GMM_ASSERT1(data_size == 8, "Gmsh import: unsupported data size "
+                  << data_size);
+      f.get(); // end of line
+      int one = value<int>();
+      if (one != 1) {
+        swap_bytes(&one, 1);
+        GMM_ASSERT1(one == 1, "Gmsh import: corrupted binary file");
+        swap = true;
+      }
+    }
+    bgeot::read_until(f, "$EndMeshFormat");
+
+    std::string section;
+    for (;;) {
+      int c = f.peek();
+      while (c != EOF && isspace(c)) { f.get(); c = f.peek(); }
+      if (c == EOF) break;
+      std::getline(f, section);
+      while (section.size() && isspace((unsigned char)(section.back())))
+        section.pop_back();
+      GMM_ASSERT1(section.size() && section[0] == '$',
+                  "Gmsh import: unexpected line " << section);
+      if (section == "$PhysicalNames") read_physical_names();
+      else if (section == "$Entities") read_entities(false);
+      else if (section == "$PartitionedEntities") read_entities(true);
+      else if (section == "$Nodes") read_nodes(m, remove_duplicated_nodes);
+      else if (section == "$Elements") read_elements();
+      bgeot::read_until(f, ("$End" + section.substr(1)).c_str());
+    }
+
+    /* Region numbers. As in the other formats, a region number shared by
+       entities of different dimensions is modified. */
+    std::map<std::pair<int, int>, size_type> region_of;
+    std::map<size_type, int> dim_of_region;
+    auto region_number = [&](int dim, int num) -> size_type {
+      auto key = std::make_pair(dim, num);
+      auto it = region_of.find(key);
+      if (it != region_of.end()) return it->second;
+      size_type r = size_type(num);
+      if (dim_of_region.count(r)) {
+        GMM_WARNING2("Two regions share the same number, "
+                     "the region numbering is modified");
+        while (dim_of_region.count(r)) r += 5;
+      }
+      dim_of_region[r] = dim;
+      return region_of[key] = r;
+    };
+
+    int N = -1;
+    for (gmsh4_elt_block &b : blocks) {
+      const std::vector<int> &phys = physical_tags(b.dim, b.tag);
+      int tag = b.tag;
+      auto it = pentities.find(std::make_pair(b.dim, b.tag));
+      if (it != pentities.end() && it->second.parent_dim == b.dim)
+        tag = it->second.parent_tag;
+      if (phys.size())
+        for (int p : phys) b.regions.push_back(region_number(b.dim, p));
+      else b.regions.push_back(region_number(b.dim, tag));
+      if (b.type != 15) N = std::max(N, int(b.pgt->dim()));
+    }
+
+    if (region_map) {
+      region_map->clear();
+      for (const auto &pn : phys_names)
+        (*region_map)[pn.second] = region_number(pn.first.first,
+                                                 pn.first.second);
+    }
+
+    if (N < 0) {
+      if (blocks.size())
+        GMM_WARNING2("Only nodes defined in the mesh! No elements are added.");
+      return;
+    }
+
+    /* Insertion of the convexes of block b, recorded in regions */
+    std::map<size_type, dal::bit_vector> region_cvs;
+    auto add_element = [&](const gmsh4_elt_block &b, size_type i) {
+      size_type ic = m.add_convex_noverif(b.pgt,
+                                          b.nodes.begin() + i*b.nb_nodes);
+      for (size_type r : b.regions) region_cvs[r].add(ic);
+    };
+    std::vector<size_type> icv;
+    auto add_block = [&](const gmsh4_elt_block &b) {
+      m.add_convexes_noverif(b.pgt, b.nb_elements(), b.nodes.begin(), &icv);
+      for (size_type r : b.regions)
+        for (size_type ic : icv) region_cvs[r].add(ic);
+    };
+
+    for (const gmsh4_elt_block &b : blocks)
+      if (b.type != 15 && int(b.pgt->dim()) == N) add_block(b);
+
+    for (int d = N-1; d >= 0; --d) {
+      for (const gmsh4_elt_block &b : blocks) {
+        bool is_node = (b.type == 15);
+        int bdim = is_node ? 0 : int(b.pgt->dim());
+        if (bdim != d) continue;
+        size_type nbe = b.nb_elements();
+
+        bool as_convexes = false;
+        if (lower_dim_convex_rg && !is_node)
+          for (size_type r : b.regions)
+            if (lower_dim_convex_rg->count(r)) as_convexes = true;
+        if (as_convexes) { add_block(b); continue; }
+
+        /* Look for the faces of the convexes of dimension d+1 matching
+           the elements of the block. */
+        std::vector<std::vector<std::pair<size_type, short_type> > >
+          faces(nbe);
+        gmsh4_for_chunks(nbe, [&](size_type i0, size_type i1) {
+          for (size_type i = i0; i < i1; ++i) {
+            auto ipts = b.nodes.begin() + i*b.nb_nodes;
+            for (size_type cv : m.convex_to_point(*ipts)) {
+              bgeot::pconvex_structure cvs = m.structure_of_convex(cv);
+              if (int(cvs->dim()) == d + 1)
+                for (short_type fc = 0; fc < cvs->nb_faces(); ++fc)
+                  if (m.is_convex_face_having_points
+                      (cv, fc, short_type(b.nb_nodes), ipts))
+                    faces[i].push_back(std::make_pair(cv, fc));
+            }
+          }
+        });
+
+        size_type nb_ignored = 0;
+        for (size_type i = 0; i < nbe; ++i) {
+          for (const auto &cf : faces[i])
+            for (size_type r : b.regions)
+              m.region(r).add(cf.first, cf.second);
+          if (is_node && nodal_map)
+            for (size_type r : b.regions)
+              (*nodal_map)[r].insert(b.nodes[i]);
+          if (faces[i].empty()) {
+            if (is_node) { if (!nodal_map) ++nb_ignored; }
+            else if (add_all_element_type) add_element(b, i);
+            else ++nb_ignored;
+          }
+        }
+        if (nb_ignored) {
+          if (is_node) {
+            GMM_WARNING2("gmsh import ignored " << nb_ignored << " node(s) "
+                         "of entity " << b.tag << ": points are not added "
+                         "explicitly as elements.");
+          } else {
+            GMM_WARNING2("gmsh import ignored " << nb_ignored
+                         << " element(s) of type "
+                         << bgeot::name_of_geometric_trans(b.pgt)
+                         << " as they do not belong to the face of another"
+                         " element");
+          }
+        }
+      }
+    }
+
+    for (auto &rc : region_cvs) m.region(rc.first).add(rc.second);
+  }
+
+  static void import_gmsh4_mesh_file
+  (std::istream& f, double version, mesh& m,
+   std::map<std::string, size_type> *region_map,
+   std::set<size_type> *lower_dim_convex_rg, bool add_all_element_type,
+   std::map<size_type, std::set<size_type>> *nodal_map,
+   bool remove_duplicated_nodes) {
+    gmsh4_reader(f, version).read(m, region_map, lower_dim_convex_rg,
+                         add_all_element_type, nodal_map,
+                         remove_duplicated_nodes);
+  }
+
   /*
      Format version 1 [for gmsh version < 2.0].
      structure: $NOD list_of_nodes $ENDNOD $ELT list_of_elt $ENDELT
@@ -256,6 +976,15 @@ namespace getfem {
     else
       GMM_ASSERT1(false, "can't read Gmsh format: " << header);
 
+    if (version >= 4.) { /* Format versions 4.0 and 4.1 */
+      import_gmsh4_mesh_file(f, version, m, region_map, lower_dim_convex_rg,
+                             add_all_element_type, nodal_map,
+                             remove_duplicated_nodes);
+      if (remove_last_dimension) maybe_remove_last_dimension(m);
+      m.build_face_adjacency();
+      return;
+    }
+
     /* read the region names */
     if (region_map != NULL) {
       if (version >= 2.) {
@@ -264,80 +993,45 @@ namespace getfem {
     }
     /* read the node list */
     if (version >= 2.)
-      bgeot::read_until(f, "$Nodes"); /* Format versions 2 and 4 */
+      bgeot::read_until(f, "$Nodes"); /* Format version 2 */
 
     size_type nb_block, nb_node, dummy;
     std::string dummy2;
     // cout << "version = " << version << endl;
-    if (version >= 4.05) {
-      f >> nb_block >> nb_node; bgeot::read_until(f, "\n");
-    } else if (version >= 4.) {
-      f >> nb_block >> nb_node;
-    } else {
-      nb_block = 1;
-      f >> nb_node;
-    }
+    nb_block = 1;
+    f >> nb_node;
 
     // cerr << "reading nodes..[nb=" << nb_node << "]\n";
     std::map<size_type, size_type> msh_node_2_getfem_node;
-     std::vector<size_type> inds(nb_node);
     for (size_type block=0; block < nb_block; ++block) {
-      if (version >= 4.)
-        f >> dummy >> dummy >> dummy >> nb_node;
-      // cout << "nb_nodes = " << nb_node << endl;
-
-      inds.resize(nb_node);
-      if (version >= 4.05) {
-	for (size_type node_cnt=0; node_cnt < nb_node; ++node_cnt)
-	  f >> inds[node_cnt];
-      }
-      
       for (size_type node_cnt=0; node_cnt < nb_node; ++node_cnt) {
         size_type node_id;
         base_node n{0,0,0};
-	if (version < 4.05) f >> node_id; else node_id = inds[node_cnt];
-
-	f >> n[0] >> n[1] >> n[2];
+        f >> node_id >> n[0] >> n[1] >> n[2];
         msh_node_2_getfem_node[node_id]
           = m.add_point(n, remove_duplicated_nodes ? 0. : -1.);
       }
     }
 
     if (version >= 2.)
-      bgeot::read_until(f, "$Endnodes"); /* Format versions 2 and 4 */
+      bgeot::read_until(f, "$Endnodes"); /* Format version 2 */
     else
       bgeot::read_until(f, "$ENDNOD");
 
     /* read the elements */
     if (version >= 2.)
-      bgeot::read_until(f, "$Elements"); /* Format versions 2 and 4 */
+      bgeot::read_until(f, "$Elements"); /* Format version 2 */
     else
       bgeot::read_until(f, "$ELM");
 
     size_type nb_cv;
-    if (version >= 4.05) {
-      f >> nb_block >> nb_cv; bgeot::read_until(f, "\n");
-    } else if (version >= 4.) { /* Format version 4 */
-      f >> nb_block >> nb_cv;
-    } else {
-      nb_block = 1;
-      f >> nb_cv;
-    }
+    nb_block = 1;
+    f >> nb_cv;
     // cout << "nb_bloc = " << nb_block << " nb_cv = " << nb_cv << endl;
      
     std::vector<gmsh_cv_info> cvlst; cvlst.reserve(nb_cv);
-    dal::bit_vector reg;
     for (size_type block=0; block < nb_block; ++block) {
-      unsigned dimr, type, region;
-      if (version >= 4.) { /* Format version 4 */
-        f >> dimr >> region >> type >> nb_cv;
-        if (reg.is_in(region)) {
-          GMM_WARNING2("Two regions share the same number, "
-                       "the region numbering is modified");
-          while (reg.is_in(region)) region += 5;
-        }
-        reg.add(region);
-      }
+      unsigned type, region;
       for (size_type cv=0; cv < nb_cv; ++cv) {
 
         cvlst.push_back(gmsh_cv_info());
@@ -346,16 +1040,14 @@ namespace getfem {
         ci.id--; /* gmsh numbering starts at 1 */
 
         unsigned cv_nb_nodes;
-        if (version >= 2.) { /* For versions 2 and 4 */
-          if (int(version) == 2) { /* Format version 2 */
-            unsigned nbtags;
-            f >> type >> nbtags;
-            GMM_ASSERT1(nbtags > 0 && nbtags <= 3,
-                        "Number of tags " << nbtags << " is not managed.");
-            f >> region;
-            if (nbtags > 1) f >> dummy;
-            if (nbtags > 2) f >> dummy;
-          }
+        if (version >= 2.) { /* Format version 2 */
+          unsigned nbtags;
+          f >> type >> nbtags;
+          GMM_ASSERT1(nbtags > 0 && nbtags <= 3,
+                      "Number of tags " << nbtags << " is not managed.");
+          f >> region;
+          if (nbtags > 1) f >> dummy;
+          if (nbtags > 2) f >> dummy;
           ci.type = type;
           ci.set_nb_nodes();
           cv_nb_nodes = unsigned(ci.nodes.size());
@@ -379,171 +1071,7 @@ namespace getfem {
         }
         if (ci.type != 15)
           ci.set_pgt();
-        // Reordering nodes for certain elements (should be completed ?)
-        // http://www.geuz.org/gmsh/doc/texinfo/gmsh.html#Node-ordering
-        std::vector<size_type> tmp_nodes(ci.nodes);
-        switch(ci.type) {
-        case 3 : {
-          ci.nodes[2] = tmp_nodes[3];
-          ci.nodes[3] = tmp_nodes[2];
-        } break;
-        case 5 : { /* First order hexaedron */
-          //ci.nodes[0] = tmp_nodes[0];
-          //ci.nodes[1] = tmp_nodes[1];
-          ci.nodes[2] = tmp_nodes[3];
-          ci.nodes[3] = tmp_nodes[2];
-          //ci.nodes[4] = tmp_nodes[4];
-          //ci.nodes[5] = tmp_nodes[5];
-          ci.nodes[6] = tmp_nodes[7];
-          ci.nodes[7] = tmp_nodes[6];
-        } break;
-        case 7 : { /* first order pyramid */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[2];
-          ci.nodes[2] = tmp_nodes[1];
-          // ci.nodes[3] = tmp_nodes[3];
-          // ci.nodes[4] = tmp_nodes[4];
-        } break;
-        case 8 : { /* Second order line */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[2];
-          ci.nodes[2] = tmp_nodes[1];
-        } break;
-        case 9 : { /* Second order triangle */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[3];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[5];
-          //ci.nodes[4] = tmp_nodes[4];
-          ci.nodes[5] = tmp_nodes[2];
-        } break;
-        case 10 : { /* Second order quadrangle */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[4];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[7];
-          ci.nodes[4] = tmp_nodes[8];
-          //ci.nodes[5] = tmp_nodes[5];
-          ci.nodes[6] = tmp_nodes[3];
-          ci.nodes[7] = tmp_nodes[6];
-          ci.nodes[8] = tmp_nodes[2];
-        } break;
-        case 11: { /* Second order tetrahedron */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[4];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[6];
-          ci.nodes[4] = tmp_nodes[5];
-          ci.nodes[5] = tmp_nodes[2];
-          ci.nodes[6] = tmp_nodes[7];
-          ci.nodes[7] = tmp_nodes[9];
-          //ci.nodes[8] = tmp_nodes[8];
-          ci.nodes[9] = tmp_nodes[3];
-        } break;
-        case 12: { /* Second order hexahedron */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[8];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[9];
-          ci.nodes[4] = tmp_nodes[20];
-          ci.nodes[5] = tmp_nodes[11];
-          ci.nodes[6] = tmp_nodes[3];
-          ci.nodes[7] = tmp_nodes[13];
-          ci.nodes[8] = tmp_nodes[2];
-          ci.nodes[9] = tmp_nodes[10];
-          ci.nodes[10] = tmp_nodes[21];
-          ci.nodes[11] = tmp_nodes[12];
-          ci.nodes[12] = tmp_nodes[22];
-          ci.nodes[13] = tmp_nodes[26];
-          ci.nodes[14] = tmp_nodes[23];
-          //ci.nodes[15] = tmp_nodes[15];
-          ci.nodes[16] = tmp_nodes[24];
-          ci.nodes[17] = tmp_nodes[14];
-          ci.nodes[18] = tmp_nodes[4];
-          ci.nodes[19] = tmp_nodes[16];
-          ci.nodes[20] = tmp_nodes[5];
-          ci.nodes[21] = tmp_nodes[17];
-          ci.nodes[22] = tmp_nodes[25];
-          ci.nodes[23] = tmp_nodes[18];
-          ci.nodes[24] = tmp_nodes[7];
-          ci.nodes[25] = tmp_nodes[19];
-          ci.nodes[26] = tmp_nodes[6];
-        } break;
-        case 16 : { /* Incomplete second order quadrangle */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[4];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[7];
-          ci.nodes[4] = tmp_nodes[5];
-          ci.nodes[5] = tmp_nodes[3];
-          ci.nodes[6] = tmp_nodes[6];
-          ci.nodes[7] = tmp_nodes[2];
-        } break;
-        case 17: { /* Incomplete second order hexahedron */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[8];
-          ci.nodes[2] = tmp_nodes[1];
-          ci.nodes[3] = tmp_nodes[9];
-          ci.nodes[4] = tmp_nodes[11];
-          ci.nodes[5] = tmp_nodes[3];
-          ci.nodes[6] = tmp_nodes[13];
-          ci.nodes[7] = tmp_nodes[2];
-          ci.nodes[8] = tmp_nodes[10];
-          ci.nodes[9] = tmp_nodes[12];
-          ci.nodes[10] = tmp_nodes[15];
-          ci.nodes[11] = tmp_nodes[14];
-          ci.nodes[12] = tmp_nodes[4];
-          ci.nodes[13] = tmp_nodes[16];
-          ci.nodes[14] = tmp_nodes[5];
-          ci.nodes[15] = tmp_nodes[17];
-          ci.nodes[16] = tmp_nodes[18];
-          ci.nodes[17] = tmp_nodes[7];
-          ci.nodes[18] = tmp_nodes[19];
-          ci.nodes[19] = tmp_nodes[6];
-        } break;
-        case 26 : { /* Third order line */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[2];
-          ci.nodes[2] = tmp_nodes[3];
-          ci.nodes[3] = tmp_nodes[1];
-        } break;
-        case 21 : { /* Third order triangle */
-          //ci.nodes[0] = tmp_nodes[0];
-          ci.nodes[1] = tmp_nodes[3];
-          ci.nodes[2] = tmp_nodes[4];
-          ci.nodes[3] = tmp_nodes[1];
-          ci.nodes[4] = tmp_nodes[8];
-          ci.nodes[5] = tmp_nodes[9];
-          ci.nodes[6] = tmp_nodes[5];
-          //ci.nodes[7] = tmp_nodes[7];
-          ci.nodes[8] = tmp_nodes[6];
-          ci.nodes[9] = tmp_nodes[2];
-        } break;
-        case 23: { /* Fourth order triangle */
-        //ci.nodes[0]  = tmp_nodes[0];
-          ci.nodes[1]  = tmp_nodes[3];
-          ci.nodes[2]  = tmp_nodes[4];
-          ci.nodes[3]  = tmp_nodes[5];
-          ci.nodes[4]  = tmp_nodes[1];
-          ci.nodes[5]  = tmp_nodes[11];
-          ci.nodes[6]  = tmp_nodes[12];
-          ci.nodes[7]  = tmp_nodes[13];
-          ci.nodes[8]  = tmp_nodes[6];
-          ci.nodes[9]  = tmp_nodes[10];
-          ci.nodes[10] = tmp_nodes[14];
-          ci.nodes[11] = tmp_nodes[7];
-          ci.nodes[12] = tmp_nodes[9];
-          ci.nodes[13] = tmp_nodes[8];
-          ci.nodes[14] = tmp_nodes[2];
-        } break;
-        case 27: { /* Fourth order line */
-        //ci.nodes[0]  = tmp_nodes[0];
-          ci.nodes[1]  = tmp_nodes[2];
-          ci.nodes[2]  = tmp_nodes[3];
-          ci.nodes[3]  = tmp_nodes[4];
-          ci.nodes[4]  = tmp_nodes[1];
-        } break;
-        }
+        ci.reorder_nodes();
       }
     }
 
@@ -625,6 +1153,7 @@ namespace getfem {
       }
     }
     if (remove_last_dimension) maybe_remove_last_dimension(m);
+    m.build_face_adjacency();
   }
 
   /* mesh file from GiD [http://gid.cimne.upc.es/]
@@ -1505,7 +2034,7 @@ namespace getfem {
   {
     m.clear();
     try {
-      std::ifstream f(filename.c_str());
+      std::ifstream f(filename.c_str(), std::ios::binary);
       GMM_ASSERT1(f.good(), "can't open file " << filename);
       /* throw exceptions when an error occurs */
       f.exceptions(std::ifstream::badbit | std::ifstream::failbit);
@@ -1574,6 +2103,7 @@ namespace getfem {
     }
     else GMM_ASSERT1(false, "cannot import "
                      << format << " mesh type : unknown mesh type");
+    if (!m.has_face_adjacency()) m.build_face_adjacency();
   }
 
   void import_mesh(const std::string& filename, mesh& msh) {
@@ -374,62 +374,59 @@ namespace getfem {
   /* methods stored in getfem_im_list.h                                    */
   /* ********************************************************************* */
 
+  /// index of the methods of getfem_im_list.h by name
+  static const std::unordered_map<std::string, int> &im_list_index() {
+    static const std::unordered_map<std::string, int> index = [] {
+      std::unordered_map<std::string, int> idx(2*NB_IM);
+      for (int i = 0; i < NB_IM; ++i) idx[im_desc_tab[i].method_name] = i;
+      return idx;
+    }();
+    return index;
+  }
+
   /// search a method in getfem_im_list.h
   static pintegration_method
   im_list_integration(std::string name,
                       std::vector<dal::pstatic_stored_object> &dependencies) {
     // cerr << "searching " << name << endl;
-    for (int i = 0; i < NB_IM; ++i)
-      if (!name.compare(im_desc_tab[i].method_name)) {
-        bgeot::pgeometric_trans pgt
-          = bgeot::geometric_trans_descriptor(im_desc_tab[i].geotrans_name);
-        dim_type N = pgt->structure()->dim();
-        base_node pt(N);
-        auto pai = std::make_shared<approx_integration>(pgt->convex_ref());
-        size_type fr = im_desc_tab[i].firstreal;
-        for (size_type j = 0; j < im_desc_tab[i].nb_points; ++j) {
-          for (dim_type k = 0; k < N; ++k)
-            pt[k] = atof(im_desc_real[fr+j*(N+1)+k]);
-          // pt[k] = LONG_SCALAR_ATOF(im_desc_real[fr+j*(N+1)+k]);
-
-          switch (im_desc_node_type[im_desc_tab[i].firsttype + j]) {
-          case 2: {
-            base_node pt2(pt.size());
-            for (bgeot::permutation p(pt.size()); !p.finished(); ++p) {
-              p.apply_to(pt,pt2);
-              pai->add_point_full_symmetric(pt2,
-                                            atof(im_desc_real[fr+j*(N+1)+N]));
-              // pai->add_point_full_symmetric(pt2,
-              //                LONG_SCALAR_ATOF(im_desc_real[fr+j*(N+1)+N]));
-            }
-          } break;
-          case 1: {
-            pai->add_point_full_symmetric(pt,atof(im_desc_real[fr+j*(N+1)+N]));
-            // pai->add_point_full_symmetric(pt,
-            //                   LONG_SCALAR_ATOF(im_desc_real[fr+j*(N+1)+N]));
-          } break;
-          case 0: {
-            pai->add_point(pt, atof(im_desc_real[fr+j*(N+1)+N]));
-            // pai->add_point(pt,LONG_SCALAR_ATOF(im_desc_real[fr+j*(N+1)+N]));
-          } break;
-          default: GMM_ASSERT1(false, "");
-          }
+    auto itn = im_list_index().find(name);
+    if (itn == im_list_index().end()) return pintegration_method();
+    const im_desc &desc = im_desc_tab[itn->second];
+
+    bgeot::pgeometric_trans pgt
+      = bgeot::geometric_trans_descriptor(desc.geotrans_name);
+    dim_type N = pgt->structure()->dim();
+    base_node pt(N);
+    auto pai = std::make_shared<approx_integration>(pgt->convex_ref());
+    for (size_type j = 0; j < desc.nb_points; ++j) {
+      const scalar_type *r = im_desc_real + desc.firstreal + j*(N+1);
+      std::copy(r, r + N, pt.begin());
+
+      switch (im_desc_node_type[desc.firsttype + j]) {
+      case 2: {
+        base_node pt2(pt.size());
+        for (bgeot::permutation p(pt.size()); !p.finished(); ++p) {
+          p.apply_to(pt,pt2);
+          pai->add_point_full_symmetric(pt2, r[N]);
         }
+      } break;
+      case 1: pai->add_point_full_symmetric(pt, r[N]); break;
+      case 0: pai->add_point(pt, r[N]); break;
+      default: GMM_ASSERT1(false, "");
+      }
+    }
 
-        for (short_type f = 0; N > 0 && f < pgt->structure()->nb_faces(); ++f)
-          pai->add_method_on_face
-            (int_method_descriptor
-             (im_desc_face_meth[im_desc_tab[i].firstface + f]), f);
+    for (short_type f = 0; N > 0 && f < pgt->structure()->nb_faces(); ++f)
+      pai->add_method_on_face
+        (int_method_descriptor(im_desc_face_meth[desc.firstface + f]), f);
 
-        pai->valid_method();
-        // cerr << "finding " << name << endl;
+    pai->valid_method();
+    // cerr << "finding " << name << endl;
 
-        pintegration_method p(std::make_shared<integration_method>(pai));
-        dependencies.push_back(p->approx_method()->ref_convex());
-        dependencies.push_back(p->approx_method()->pintegration_points());
-        return p;
-      }
-    return pintegration_method();
+    pintegration_method p(std::make_shared<integration_method>(pai));
+    dependencies.push_back(p->approx_method()->ref_convex());
+    dependencies.push_back(p->approx_method()->pintegration_points());
+    return p;
   }
 
 
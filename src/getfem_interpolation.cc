@@ -49,6 +49,15 @@ namespace getfem {
     return *it;
   }
 
+  /* result of the inversion of the geometric transformation of a convex
+     for a candidate point of its bounding box */
+  struct mti_candidate_ {
+    size_type ind;
+    base_node pt_ref;
+    scalar_type isin;
+    bool gicisin;
+  };
+
   void mesh_trans_inv::distribute(int extrapolation, mesh_region rg_source) {
 
     rg_source.from_mesh(msh);
@@ -61,66 +70,111 @@ namespace getfem {
     std::vector<double> dist(nbpts);
     std::vector<size_type> cvx_pts(nbpts);
     pts_cvx.clear(); pts_cvx.resize(nbcvx);
-    base_node min, max, pt_ref; /* bound of the box enclosing the convex */
-    bgeot::kdtree_tab_type boxpts;
     dal::bit_vector npt, cv_on_bound;
     npt.add(0, nbpts);
     scalar_type mult = scalar_type(1);
 
     bool projection_into_element(extrapolation == 0);
 
+    /* The box queries and the inversions are done in parallel on blocks
+       of convexes, the results being merged sequentially in the order of
+       the convexes so that the distribution does not depend on the
+       number of threads. On a single thread, each convex is merged
+       immediately, which avoids the inversion of the points already
+       found inside a previous convex. */
+    tree.build_tree();
+    size_type nb_threads = max_concurrency();
+    size_type block_size = (nb_threads > 1) ? 256*nb_threads : 1;
+    std::vector<size_type> cvs;
+    std::vector<std::vector<mti_candidate_> > candidates;
+
+    auto invert_on_convex = [&](size_type j,
+                                bgeot::geotrans_inv_convex &lgic,
+                                std::vector<mti_candidate_> &cands) {
+      base_node min, max; /* bound of the box enclosing the convex */
+      bgeot::kdtree_tab_type boxpts, ipts;
+      std::vector<base_node> pts_ref;
+      dal::bit_vector isin, converged;
+      cands.resize(0);
+      bgeot::pgeometric_trans pgt = msh.trans_of_convex(j);
+      bounding_box(min, max, msh.points_of_convex(j), pgt);
+      for (size_type k=0; k < min.size(); ++k) { min[k]-=EPS; max[k]+=EPS; }
+      if (extrapolation == 2 && cv_on_bound.is_in(j)) {
+        scalar_type h = scalar_type(0);
+        for (size_type k=0; k < min.size(); ++k)
+          h = std::max(h, max[k] - min[k]);
+        for (size_type k=0; k < min.size(); ++k)
+          { min[k]-=mult*h; max[k]+=mult*h; }
+      }
+      tree.points_in_box(boxpts, min, max);
+      for (size_type l = 0; l < boxpts.size(); ++l) {
+        size_type ind = boxpts[l].i;
+        if (npt.is_in(ind) || dist[ind] > 0) ipts.push_back(boxpts[l]);
+      }
+      if (ipts.size() == 0) return;
+      lgic.init(msh.points_of_convex(j), pgt);
+      lgic.invert(ipts, pts_ref, isin, converged, EPS,
+                  projection_into_element);
+      cands.resize(ipts.size());
+      for (size_type l = 0; l < ipts.size(); ++l) {
+        cands[l].ind = ipts[l].i;
+        cands[l].pt_ref = pts_ref[l];
+        cands[l].isin = pgt->convex_ref()->is_in(pts_ref[l]);
+        cands[l].gicisin = isin.is_in(l);
+      }
+    };
+
     do {
+      cvs.resize(0);
       for (dal::bv_visitor j(rg_source.index()); !j.finished(); ++j) {
         if (mult > scalar_type(1) && !(cv_on_bound.is_in(j))) continue;
-        bgeot::pgeometric_trans pgt = msh.trans_of_convex(j);
-        bounding_box(min, max, msh.points_of_convex(j), pgt);
-        for (size_type k=0; k < min.size(); ++k) { min[k]-=EPS; max[k]+=EPS; }
-        if (extrapolation == 2) {
-          if (mult == scalar_type(1))
-            for (short_type f = 0; f < msh.nb_faces_of_convex(j); ++f) {
-              size_type neighbor_cv = msh.neighbor_of_convex(j, f);
-              if (!all_convexes && neighbor_cv != size_type(-1)) {
-                // check if the neighbor is also contained in rg_source ...
-                if (!rg_source.is_in(neighbor_cv)) 
-                  cv_on_bound.add(j); // ... if not, treat the element as a boundary one
-              }
-              else // boundary element of the overall mesh
-                cv_on_bound.add(j);
+        if (extrapolation == 2 && mult == scalar_type(1))
+          for (short_type f = 0; f < msh.nb_faces_of_convex(j); ++f) {
+            size_type neighbor_cv = msh.neighbor_of_convex(j, f);
+            if (!all_convexes && neighbor_cv != size_type(-1)) {
+              // check if the neighbor is also contained in rg_source ...
+              if (!rg_source.is_in(neighbor_cv))
+                cv_on_bound.add(j); // ... if not, treat the element as a boundary one
             }
-          if (cv_on_bound.is_in(j)) {
-            scalar_type h = scalar_type(0);
-            for (size_type k=0; k < min.size(); ++k)
-              h = std::max(h, max[k] - min[k]);
-            for (size_type k=0; k < min.size(); ++k)
-              { min[k]-=mult*h; max[k]+=mult*h; }
+            else // boundary element of the overall mesh
+              cv_on_bound.add(j);
           }
+        cvs.push_back(j);
+      }
+
+      for (size_type ib = 0; ib < cvs.size(); ib += block_size) {
+        size_type nbcv = std::min(block_size, cvs.size() - ib);
+        candidates.resize(nbcv);
+        if (nbcv == 1)
+          invert_on_convex(cvs[ib], gic, candidates[0]);
+        else {
+          size_type nbchunks = std::min(nbcv, 4*nb_threads);
+          auto treat_chunk = [&](size_type ic) {
+            bgeot::geotrans_inv_convex lgic(EPS);
+            for (size_type i = (nbcv*ic)/nbchunks;
+                 i < (nbcv*(ic+1))/nbchunks; ++i)
+              invert_on_convex(cvs[ib+i], lgic, candidates[i]);
+          };
+          GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic,
+                         treat_chunk(ic));
         }
-        points_in_box(boxpts, min, max);
-
-        if (boxpts.size() > 0) gic.init(msh.points_of_convex(j), pgt);
-        
-        for (size_type l = 0; l < boxpts.size(); ++l) {
-          size_type ind = boxpts[l].i;
-          if (npt[ind] || dist[ind] > 0) {
-            bool converged;
-            bool gicisin = gic.invert(boxpts[l].n, pt_ref, converged, EPS,
-                                      projection_into_element);
-            bool toadd = extrapolation || gicisin;
-            double isin = pgt->convex_ref()->is_in(pt_ref);
-            
-            if (toadd && !(npt[ind])) {
-              if (isin < dist[ind]) pts_cvx[cvx_pts[ind]].erase(ind);
-              else toadd = false;
-            }
-            if (toadd) {
-//               if (mult > 1.5) {
-//                 cout << "adding " << ind << "ref_coord = " << pt_ref
-//                      << " cv = " << j << " mult = " << mult << endl;
-//               }
-              ref_coords[ind] = pt_ref;
-              dist[ind] = isin; cvx_pts[ind] = j;
-              pts_cvx[j].insert(ind);
-              npt.sup(ind);
+
+        for (size_type i = 0; i < nbcv; ++i) {
+          size_type j = cvs[ib+i];
+          for (const mti_candidate_ &c : candidates[i]) {
+            size_type ind = c.ind;
+            if (npt[ind] || dist[ind] > 0) {
+              bool toadd = extrapolation || c.gicisin;
+              if (toadd && !(npt[ind])) {
+                if (c.isin < dist[ind]) pts_cvx[cvx_pts[ind]].erase(ind);
+                else toadd = false;
+              }
+              if (toadd) {
+                ref_coords[ind] = c.pt_ref;
+                dist[ind] = c.isin; cvx_pts[ind] = j;
+                pts_cvx[j].insert(ind);
+                npt.sup(ind);
+              }
             }
           }
         }
@@ -128,5 +182,77 @@ namespace getfem {
       mult *= scalar_type(2);
     } while (npt.card() > 0 && extrapolation == 2);
   }
+
+  void build_interpolation_operator
+  (const mesh_fem &mf_source, const mesh_fem &mf_target,
+   interpolation_operator &op, int extrapolation, double EPS,
+   mesh_region rg_source, mesh_region rg_target) {
+    GMM_ASSERT1(mf_source.get_qdim() == mf_target.get_qdim(),
+                "An interpolation operator needs two mesh_fem of the same "
+                "Qdim");
+    gmm::row_matrix<gmm::rsvector<scalar_type> >
+      M(mf_target.nb_dof(), mf_source.nb_dof());
+    interpolation(mf_source, mf_target, M, extrapolation, EPS,
+                  rg_source, rg_target);
+    op.set_matrix(M);
+    op.add_mesh_fem(mf_source);
+    op.add_mesh_fem(mf_target);
+  }
+
+  /* Cache of the operators used by interpolation(mf_source, mf_target,
+     U, V) between two mesh_fem of the same mesh. An entry is first
+     recorded with an empty operator, which is only used to detect the
+     modification or the destruction of the mesh_fem objects. */
+  struct interpolation_operator_cache_entry {
+    const mesh_fem *pmf_source, *pmf_target;
+    std::shared_ptr<interpolation_operator> op;
+    bool built;
+  };
+
+  static const size_type interpolation_operator_cache_size = 32;
+
+  pinterpolation_operator
+  cached_interpolation_operator(const mesh_fem &mf_source,
+                                const mesh_fem &mf_target) {
+    static std::list<interpolation_operator_cache_entry> cache;
+    {
+      GLOBAL_OMP_GUARD;
+      for (auto it = cache.begin(); it != cache.end(); )
+        if (!(it->op->is_context_valid())) it = cache.erase(it); else ++it;
+
+      auto it = cache.begin();
+      for (; it != cache.end(); ++it)
+        if (it->pmf_source == &mf_source && it->pmf_target == &mf_target)
+          break;
+      if (it != cache.end() && it->op->is_up_to_date()) {
+        cache.splice(cache.begin(), cache, it);
+        if (it->built) return it->op;
+      } else {
+        if (it != cache.end()) cache.erase(it);
+        auto op = std::make_shared<interpolation_operator>();
+        op->add_mesh_fem(mf_source);
+        op->add_mesh_fem(mf_target);
+        cache.push_front({&mf_source, &mf_target, op, false});
+        if (cache.size() > interpolation_operator_cache_size)
+          cache.pop_back();
+        return pinterpolation_operator();
+      }
+    }
+
+    // second call on unchanged mesh_fem objects: build the operator
+    auto op = std::make_shared<interpolation_operator>();
+    build_interpolation_operator(mf_source, mf_target, *op);
+
+    /* The entry may have been evicted, or the mesh_fem objects modified,
+       during the build. The operator is then dropped. */
+    GLOBAL_OMP_GUARD;
+    for (auto &e : cache)
+      if (e.pmf_source == &mf_source && e.pmf_target == &mf_target) {
+        if (!(e.op->is_up_to_date())) break;
+        if (!(e.built)) { e.op = op; e.built = true; }
+        return e.op;
+      }
+    return pinterpolation_operator();
+  }
 }  /* end of namespace getfem.                                             */
 
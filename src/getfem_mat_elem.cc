@@ -68,6 +68,19 @@ namespace getfem {
 
       return true;
     }
+    // equal() compares the keys of the objects, so they are hashed
+    size_t hash() const override{
+      size_t h = dal::hash_combine(static_stored_object_key::hash(),
+                                   prefer_comp_on_real_element);
+      for (const dal::pstatic_stored_object &p
+             : {dal::pstatic_stored_object(pmt),
+                dal::pstatic_stored_object(ppi),
+                dal::pstatic_stored_object(pgt)}) {
+        auto pk = dal::key_of_stored_object(p);
+        h = dal::hash_combine(h, pk ? pk->hash() : 0);
+      }
+      return h;
+    }
     emelem_comp_key_(pmat_elem_type pm, pintegration_method pi,
                        bgeot::pgeometric_trans pg, bool on_relt)
     { pmt = pm; ppi = pi; pgt = pg; prefer_comp_on_real_element = on_relt; }
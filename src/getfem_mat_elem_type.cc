@@ -67,6 +67,15 @@ namespace getfem {
       auto &o = dynamic_cast<const mat_elem_type_key &>(oo);
       return *o.pmet == *pmet;
     }
+    size_t hash() const override{
+      size_t h = dal::hash_combine(static_stored_object_key::hash(),
+                                   pmet->size());
+      for (const constituant &c : *pmet) {
+        h = dal::hash_combine(h, size_t(c.t));
+        if (c.t == GETFEM_NONLINEAR_) h = dal::hash_combine(h, c.nl_part);
+      }
+      return h;
+    }
     mat_elem_type_key(const mat_elem_type *p) : pmet(p) {}
   };
 
@@ -24,6 +24,7 @@
 #include "gmm/gmm_condition_number.h"
 #include "getfem/getfem_mesh.h"
 #include "getfem/getfem_integration.h"
+#include "getfem/getfem_binary_io.h"
 
 #if GETFEM_HAVE_METIS_OLD_API
 extern "C" void METIS_PartGraphKway(int *, int *, int *, int *, int *, int *,
@@ -715,6 +716,141 @@ namespace getfem {
     o.close();
   }
 
+  /* Binary format: the sections are prefixed by "mesh/".
+     - info : dimension, number of points, of convexes, of geometric
+       transformations and of regions (uint64),
+     - point_ids, coords : indices (uint64) and packed coordinates of
+       the points,
+     - geotrans : names of the geometric transformations,
+     - convexes.t, connectivity.t : indices of the convexes having the
+       t-th geometric transformation and their point indices (uint64),
+     - regions, region.r : region numbers and, for each region, pairs
+       (convex, bitset of faces, bit 0 being the convex itself).
+  */
+  void mesh::write_to_binary_file(binary_file_writer &f) const {
+    typedef gmm::uint64_type uint64;
+    std::vector<uint64> ids, info(5);
+    std::vector<double> coords;
+    ids.reserve(nb_points()); coords.reserve(nb_points()*dim());
+    for (dal::bv_visitor i(points().index()); !i.finished(); ++i) {
+      ids.push_back(i);
+      coords.insert(coords.end(), pts[i].begin(), pts[i].end());
+    }
+    info[0] = dim(); info[1] = ids.size(); info[2] = nb_convex();
+
+    std::map<bgeot::pgeometric_trans, size_type> num_of_gt;
+    std::vector<std::string> gt_names;
+    std::vector<std::vector<uint64> > cv_of_gt, cnx_of_gt;
+    for (dal::bv_visitor cv(convex_index()); !cv.finished(); ++cv) {
+      bgeot::pgeometric_trans pgt = trans_of_convex(cv);
+      auto it = num_of_gt.find(pgt);
+      size_type t = (it == num_of_gt.end()) ? gt_names.size() : it->second;
+      if (t == gt_names.size()) {
+        num_of_gt[pgt] = t;
+        gt_names.push_back(bgeot::name_of_geometric_trans(pgt));
+        cv_of_gt.resize(t+1); cnx_of_gt.resize(t+1);
+      }
+      cv_of_gt[t].push_back(cv);
+      const ind_set &ipts = ind_points_of_convex(cv);
+      cnx_of_gt[t].insert(cnx_of_gt[t].end(), ipts.begin(), ipts.end());
+    }
+    info[3] = gt_names.size();
+
+    std::vector<uint64> rg_ids;
+    for (dal::bv_visitor bnum(valid_cvf_sets); !bnum.finished(); ++bnum)
+      rg_ids.push_back(bnum);
+    info[4] = rg_ids.size();
+
+    f.write_section("mesh/info", info);
+    f.write_section("mesh/point_ids", ids);
+    f.write_section("mesh/coords", coords);
+    f.write_strings("mesh/geotrans", gt_names);
+    for (size_type t = 0; t < gt_names.size(); ++t) {
+      f.write_section("mesh/convexes." + std::to_string(t), cv_of_gt[t]);
+      f.write_section("mesh/connectivity." + std::to_string(t),
+                      cnx_of_gt[t]);
+    }
+    f.write_section("mesh/regions", rg_ids);
+    for (uint64 bnum : rg_ids) {
+      const mesh_region &rg = region(bnum);
+      std::vector<uint64> v;
+      for (dal::bv_visitor cv(rg.index()); !cv.finished(); ++cv) {
+        v.push_back(cv); v.push_back(rg[cv].to_ulong());
+      }
+      f.write_section("mesh/region." + std::to_string(bnum), v);
+    }
+  }
+
+  void mesh::write_to_binary_file(const std::string &name) const {
+    binary_file_writer f(name, "GETFEM MESH");
+    write_to_binary_file(f);
+    f.close();
+  }
+
+  void mesh::read_from_binary_file(const binary_file_reader &f) {
+    typedef gmm::uint64_type uint64;
+    clear();
+    size_type n, nbpts, nbc;
+    const uint64 *info = f.section_as<uint64>("mesh/info", n);
+    GMM_ASSERT1(n >= 5, "This seems not to be a mesh file");
+    dim_type N = dim_type(info[0]);
+    const uint64 *ids = f.section_as<uint64>("mesh/point_ids", nbpts);
+    const double *coords = f.section_as<double>("mesh/coords", nbc);
+    GMM_ASSERT1(nbpts == info[1] && nbc == nbpts*N, "Corrupted mesh file");
+    base_node pt(N);
+    for (size_type i = 0; i < nbpts; ++i, coords += N) {
+      std::copy(coords, coords+N, pt.begin());
+      pts.add_node_to_index(size_type(ids[i]), pt);
+    }
+
+    std::vector<std::string> gt_names;
+    f.read_strings("mesh/geotrans", gt_names);
+    GMM_ASSERT1(gt_names.size() == info[3], "Corrupted mesh file");
+    std::vector<size_type> ind;
+    for (size_type t = 0; t < gt_names.size(); ++t) {
+      bgeot::pgeometric_trans pgt
+        = bgeot::geometric_trans_descriptor(gt_names[t]);
+      size_type nb = pgt->nb_points(), nbcv, nbi;
+      const uint64 *cvs
+        = f.section_as<uint64>("mesh/convexes." + std::to_string(t), nbcv);
+      const uint64 *cnx
+        = f.section_as<uint64>("mesh/connectivity."+std::to_string(t), nbi);
+      GMM_ASSERT1(nbi == nbcv*nb, "Corrupted mesh file");
+      ind.resize(nb);
+      for (size_type i = 0; i < nbcv; ++i, cnx += nb) {
+        size_type cv = size_type(cvs[i]);
+        GMM_ASSERT1(!convex_index().is_in(cv), "Repeated convex index "<< cv);
+        for (size_type k = 0; k < nb; ++k) {
+          ind[k] = size_type(cnx[k]);
+          GMM_ASSERT1(pts.index().is_in(ind[k]), "Missing point " << ind[k]);
+        }
+        add_convex_noverif(pgt->structure(), ind.begin(), cv);
+        gtab[cv] = pgt; trans_exists[cv] = true;
+        cvs_v_num[cv] = act_counter();
+      }
+    }
+
+    std::vector<uint64> rg_ids;
+    f.read_section("mesh/regions", rg_ids);
+    for (uint64 bnum : rg_ids) {
+      const uint64 *v
+        = f.section_as<uint64>("mesh/region." + std::to_string(bnum), n);
+      mesh_region &rg = region(size_type(bnum));
+      for (size_type i = 0; i+1 < n; i += 2) {
+        mesh_region::face_bitset fb(static_cast<unsigned long>(v[i+1]));
+        if (fb[0]) rg.add(size_type(v[i]));
+        for (short_type k = 1; k < fb.size(); ++k)
+          if (fb[k]) rg.add(size_type(v[i]), short_type(k-1));
+      }
+    }
+    touch();
+  }
+
+  void mesh::read_from_binary_file(const std::string &name) {
+    binary_file_reader f(name);
+    read_from_binary_file(f);
+  }
+
   size_type mesh::memsize(void) const {
     return bgeot::mesh_structure::memsize() - sizeof(bgeot::mesh_structure)
       + pts.memsize() + (pts.index().last_true()+1)*dim()*sizeof(scalar_type)
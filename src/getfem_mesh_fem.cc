@@ -24,6 +24,7 @@
 #include "getfem/dal_singleton.h"
 #include "getfem/getfem_mesh_fem.h"
 #include "getfem/getfem_torus.h"
+#include "getfem/getfem_binary_io.h"
 
 namespace getfem {
 
@@ -791,6 +792,159 @@ namespace getfem {
     write_to_file(o);
   }
 
+  /* Binary format: the sections are prefixed by "mesh_fem/".
+     - info : qdim, number of convexes, presence of a dof partition and
+       of reduction matrices (uint64),
+     - fems, convexes, fem_of_convex : names of the finite element
+       methods, indices of the convexes and index of their fem (uint32),
+     - dof_partition : partition of each convex (uint32), optional,
+     - dofs : basic dofs of each convex, as in write_basic_to_file,
+     - R_xx, E_xx : reduction (CSC) and extension (CSR) matrices.
+  */
+  template <typename MAT> static void
+  write_compressed_matrix_(binary_file_writer &f, const std::string &name,
+                           const MAT &M) {
+    std::vector<gmm::uint64_type> dims(2), jc(M.jc.begin(), M.jc.end()),
+      ir(M.ir.begin(), M.ir.end());
+    dims[0] = M.nrows(); dims[1] = M.ncols();
+    f.write_section(name + "_dims", dims);
+    f.write_section(name + "_jc", jc);
+    f.write_section(name + "_ir", ir);
+    f.write_section(name + "_pr", M.pr);
+  }
+
+  template <typename MAT> static void
+  read_compressed_matrix_(const binary_file_reader &f,
+                          const std::string &name, MAT &M) {
+    std::vector<gmm::uint64_type> dims, jc, ir;
+    f.read_section(name + "_dims", dims);
+    GMM_ASSERT1(dims.size() == 2, "Corrupted mesh_fem file");
+    M = MAT(size_type(dims[0]), size_type(dims[1]));
+    f.read_section(name + "_jc", jc);
+    f.read_section(name + "_ir", ir);
+    f.read_section(name + "_pr", M.pr);
+    GMM_ASSERT1(ir.size() == M.pr.size() && jc.size() == M.jc.size(),
+                "Corrupted mesh_fem file");
+    std::copy(jc.begin(), jc.end(), M.jc.begin());
+    M.ir.assign(ir.begin(), ir.end());
+  }
+
+  void mesh_fem::write_to_binary_file(binary_file_writer &f) const {
+    context_check();
+    typedef gmm::uint64_type uint64;
+    std::vector<uint64> info(4), cvs, dofs;
+    std::vector<gmm::uint32_type> fem_of_cv, partition;
+    std::map<pfem, size_type> num_of_fem;
+    std::vector<std::string> fem_names;
+    for (dal::bv_visitor cv(convex_index()); !cv.finished(); ++cv) {
+      pfem pf = fem_of_element(cv);
+      auto it = num_of_fem.find(pf);
+      size_type i = (it == num_of_fem.end()) ? fem_names.size() : it->second;
+      if (i == fem_names.size())
+        { num_of_fem[pf] = i; fem_names.push_back(name_of_fem(pf)); }
+      cvs.push_back(cv);
+      fem_of_cv.push_back(gmm::uint32_type(i));
+      if (!dof_partition.empty())
+        partition.push_back(gmm::uint32_type(get_dof_partition(cv)));
+      /* repeated dofs of "pseudo" vector elements are skipped */
+      size_type step = size_type(get_qdim()) / pf->target_dim();
+      const ind_dof_ct &idofs = ind_basic_dof_of_element(cv);
+      for (size_type k = 0; k < idofs.size(); k += step)
+        dofs.push_back(idofs[k]);
+    }
+    info[0] = get_qdim(); info[1] = cvs.size();
+    info[2] = !dof_partition.empty(); info[3] = use_reduction;
+    f.write_section("mesh_fem/info", info);
+    f.write_strings("mesh_fem/fems", fem_names);
+    f.write_section("mesh_fem/convexes", cvs);
+    f.write_section("mesh_fem/fem_of_convex", fem_of_cv);
+    if (info[2]) f.write_section("mesh_fem/dof_partition", partition);
+    f.write_section("mesh_fem/dofs", dofs);
+    if (use_reduction) {
+      write_compressed_matrix_(f, "mesh_fem/R", R_);
+      write_compressed_matrix_(f, "mesh_fem/E", E_);
+    }
+  }
+
+  void mesh_fem::write_to_binary_file(const std::string &name,
+                                      bool with_mesh) const {
+    binary_file_writer f(name, "GETFEM MESH_FEM");
+    if (with_mesh) linked_mesh().write_to_binary_file(f);
+    write_to_binary_file(f);
+    f.close();
+  }
+
+  void mesh_fem::read_from_binary_file(const binary_file_reader &f) {
+    GMM_ASSERT1(linked_mesh_ != 0, "Uninitialized mesh_fem");
+    typedef gmm::uint64_type uint64;
+    clear();
+    std::vector<uint64> info, cvs, dofs;
+    std::vector<gmm::uint32_type> fem_of_cv, partition;
+    std::vector<std::string> fem_names;
+    f.read_section("mesh_fem/info", info);
+    GMM_ASSERT1(info.size() >= 4, "This seems not to be a mesh_fem file");
+    f.read_strings("mesh_fem/fems", fem_names);
+    f.read_section("mesh_fem/convexes", cvs);
+    f.read_section("mesh_fem/fem_of_convex", fem_of_cv);
+    f.read_section("mesh_fem/dofs", dofs);
+    if (info[2]) f.read_section("mesh_fem/dof_partition", partition);
+    GMM_ASSERT1(cvs.size() == info[1] && fem_of_cv.size() == cvs.size()
+                && (!info[2] || partition.size() == cvs.size()),
+                "Corrupted mesh_fem file");
+
+    GMM_ASSERT1(info[0] > 0 && info[0] <= 250, "invalid qdim: " << info[0]);
+    set_qdim(dim_type(info[0]));
+    std::vector<pfem> fems(fem_names.size());
+    for (size_type i = 0; i < fems.size(); ++i) {
+      fems[i] = fem_descriptor(fem_names[i]);
+      GMM_ASSERT1(fems[i], "could not create the FEM '" << fem_names[i] << "'");
+    }
+    for (size_type i = 0; i < cvs.size(); ++i) {
+      size_type ic = size_type(cvs[i]);
+      GMM_ASSERT1(linked_mesh().convex_index().is_in(ic), "Convex " << ic <<
+                  " does not exist, are you sure "
+                  "that the mesh attached to this object is right one ?");
+      GMM_ASSERT1(fem_of_cv[i] < fems.size(), "Corrupted mesh_fem file");
+      set_finite_element(ic, fems[fem_of_cv[i]]);
+      if (info[2]) set_dof_partition(ic, partition[i]);
+    }
+
+    dal::bit_vector doflst;
+    dof_structure.clear(); dof_enumeration_made = false;
+    is_uniform_ = true;
+    size_type nbdof_unif = size_type(-1), j = 0;
+    std::vector<size_type> tab;
+    for (size_type i = 0; i < cvs.size(); ++i) {
+      size_type ic = size_type(cvs[i]);
+      pfem pf = fem_of_element(ic);
+      size_type nbd = nb_basic_dof_of_element(ic);
+      if (nbdof_unif == size_type(-1)) nbdof_unif = nbd;
+      else if (nbdof_unif != nbd) is_uniform_ = false;
+      tab.assign(nbd, 0);
+      GMM_ASSERT1(j + pf->nb_dof(ic) <= dofs.size(), "Corrupted mesh_fem file");
+      for (size_type k = 0; k < pf->nb_dof(ic); ++k, ++j) {
+        tab[k] = size_type(dofs[j]);
+        for (size_type q=0; q < size_type(get_qdim()) / pf->target_dim(); ++q)
+          doflst.add(tab[k]+q);
+      }
+      dof_structure.add_convex_noverif(pf->structure(ic), tab.begin(), ic);
+    }
+    dof_enumeration_made = true;
+    touch(); v_num = act_counter();
+    nb_total_dof = doflst.card();
+
+    if (info[3]) {
+      read_compressed_matrix_(f, "mesh_fem/R", R_);
+      read_compressed_matrix_(f, "mesh_fem/E", E_);
+      use_reduction = true;
+    }
+  }
+
+  void mesh_fem::read_from_binary_file(const std::string &name) {
+    binary_file_reader f(name);
+    read_from_binary_file(f);
+  }
+
   struct mf__key_ : public context_dependencies {
     const mesh *pmsh;
     dim_type order, qdim;
@@ -20,6 +20,7 @@
 ===========================================================================*/
 
 #include "getfem/getfem_mesh_im.h"
+#include "getfem/getfem_binary_io.h"
 
 
 namespace getfem {
@@ -226,6 +227,71 @@ namespace getfem {
     o.close();
   }
 
+  /* Binary format: the sections are prefixed by "mesh_im/".
+     - ims : names of the integration methods,
+     - convexes, im_of_convex : indices of the convexes and index of
+       their integration method (uint32).
+  */
+  void mesh_im::write_to_binary_file(binary_file_writer &f) const {
+    context_check();
+    std::vector<gmm::uint64_type> cvs;
+    std::vector<gmm::uint32_type> im_of_cv;
+    std::map<pintegration_method, size_type> num_of_im;
+    std::vector<std::string> im_names;
+    for (dal::bv_visitor cv(convex_index()); !cv.finished(); ++cv) {
+      pintegration_method pim = int_method_of_element(cv);
+      auto it = num_of_im.find(pim);
+      size_type i = (it == num_of_im.end()) ? im_names.size() : it->second;
+      if (i == im_names.size())
+        { num_of_im[pim] = i; im_names.push_back(name_of_int_method(pim)); }
+      cvs.push_back(cv);
+      im_of_cv.push_back(gmm::uint32_type(i));
+    }
+    f.write_strings("mesh_im/ims", im_names);
+    f.write_section("mesh_im/convexes", cvs);
+    f.write_section("mesh_im/im_of_convex", im_of_cv);
+  }
+
+  void mesh_im::write_to_binary_file(const std::string &name,
+                                     bool with_mesh) const {
+    binary_file_writer f(name, "GETFEM MESH_IM");
+    if (with_mesh) linked_mesh().write_to_binary_file(f);
+    write_to_binary_file(f);
+    f.close();
+  }
+
+  void mesh_im::read_from_binary_file(const binary_file_reader &f) {
+    GMM_ASSERT1(linked_mesh_ != 0, "Uninitialized mesh_im");
+    clear();
+    std::vector<std::string> im_names;
+    f.read_strings("mesh_im/ims", im_names);
+    std::vector<pintegration_method> pims(im_names.size());
+    for (size_type i = 0; i < pims.size(); ++i) {
+      pims[i] = int_method_descriptor(im_names[i]);
+      GMM_ASSERT1(pims[i], "could not create the integration method '"
+                  << im_names[i] << "'");
+    }
+    size_type nbcv, nbi;
+    const gmm::uint64_type *cvs
+      = f.section_as<gmm::uint64_type>("mesh_im/convexes", nbcv);
+    const gmm::uint32_type *im_of_cv
+      = f.section_as<gmm::uint32_type>("mesh_im/im_of_convex", nbi);
+    GMM_ASSERT1(nbcv == nbi, "Corrupted mesh_im file");
+    for (size_type i = 0; i < nbcv; ++i) {
+      size_type ic = size_type(cvs[i]);
+      GMM_ASSERT1(linked_mesh().convex_index().is_in(ic), "Convex " << ic <<
+                  " does not exist, are you sure "
+                  "that the mesh attached to this object is right one ?");
+      GMM_ASSERT1(im_of_cv[i] < pims.size(), "Corrupted mesh_im file");
+      set_integration_method(ic, pims[im_of_cv[i]]);
+    }
+  }
+
+  void mesh_im::read_from_binary_file(const std::string &name) {
+    binary_file_reader f(name);
+    read_from_binary_file(f);
+  }
+
   struct dummy_mesh_im_ {
     mesh_im mim;
     dummy_mesh_im_() : mim() {}
@@ -29,8 +29,8 @@ namespace getfem {
   { is_adapted = false; }
 
   void mesh_im_level_set::clear_build_methods() {
-    for (size_type i = 0; i < build_methods.size(); ++i)
-      del_stored_object(build_methods[i]);
+    for (const auto &bm : build_methods)
+      if (bm.second.pim) del_stored_object(bm.second.pim);
     build_methods.clear();
     cut_im.clear();
   }
@@ -51,19 +51,21 @@ namespace getfem {
     integrate_where = integrate_where_;
     set_simplex_im(reg, sing);
     this->add_dependency(*mls);
-    is_adapted = false;
+    is_adapted = false; build_methods_reusable = false;
   }
 
   mesh_im_level_set::mesh_im_level_set(mesh_level_set &me,
                                        int integrate_where_,
                                        pintegration_method reg,
                                        pintegration_method sing) {
-    mls = 0;
+    mls = 0; nb_built_again = 0;
     init_with_mls(me, integrate_where_, reg, sing);
   }
 
-  mesh_im_level_set::mesh_im_level_set(void)
-  { mls = 0; is_adapted = false; }
+  mesh_im_level_set::mesh_im_level_set(void) {
+    mls = 0; is_adapted = false;
+    build_methods_reusable = false; nb_built_again = 0;
+  }
 
 
   pintegration_method
@@ -218,7 +220,10 @@ namespace getfem {
     return r;
   }
 
-  void mesh_im_level_set::build_method_of_convex(size_type cv) {
+  /* Build the integration method of a cut convex. It may be called in
+     parallel for different convexes. */
+  pintegration_method
+  mesh_im_level_set::build_method_of_convex(size_type cv) {
     const mesh &msh(mls->mesh_of_convex(cv));
     GMM_ASSERT3(msh.convex_index().card() != 0, "Internal error");
     base_matrix G;
@@ -398,20 +403,54 @@ namespace getfem {
         pk = std::make_shared<special_imls_key>(new_approx);
       dal::add_stored_object(pk, pim, new_approx->ref_convex(),
                              new_approx->pintegration_points());
-      build_methods.push_back(pim);
-      cut_im.set_integration_method(cv, pim);
+      return pim;
     }
+    return pintegration_method();
   }
 
   void mesh_im_level_set::adapt(void) {
     GMM_ASSERT1(linked_mesh_ != 0, "mesh level set uninitialized");
     context_check();
-    clear_build_methods();
+    if (!build_methods_reusable) clear_build_methods();
+    cut_im.clear();
     ignored_im.clear();
+
+    /* The methods of the convexes whose sub-mesh and nodes have not
+       changed are kept, the other ones are built in parallel. */
+    std::map<size_type, built_method> previous_methods;
+    std::swap(previous_methods, build_methods);
+    std::vector<size_type> to_build;
     for (dal::bv_visitor cv(linked_mesh().convex_index());
          !cv.finished(); ++cv) {
-      if (mls->is_convex_cut(cv)) build_method_of_convex(cv);
+      if (!mls->is_convex_cut(cv)) continue;
+      built_method &bm = build_methods[cv];
+      bm.pmsh = mls->pmesh_of_convex(cv);
+      for (const base_node &pt : linked_mesh().points_of_convex(cv))
+        bm.nodes.insert(bm.nodes.end(), pt.begin(), pt.end());
+      bm.crack_tip = mls->crack_tip_convexes().is_in(cv);
+      auto it = previous_methods.find(cv);
+      if (it != previous_methods.end() && it->second.pmsh == bm.pmsh
+          && it->second.crack_tip == bm.crack_tip
+          && it->second.nodes == bm.nodes)
+        std::swap(bm.pim, it->second.pim);
+      else
+        to_build.push_back(cv);
+    }
+    for (const auto &bm : previous_methods)
+      if (bm.second.pim) del_stored_object(bm.second.pim);
+    previous_methods.clear();
+
+    std::vector<pintegration_method> pims(to_build.size());
+    GETFEM_OMP_FOR(size_type i = 0, i < to_build.size(), ++i,
+                   pims[i] = build_method_of_convex(to_build[i]));
+    for (size_type i = 0; i < to_build.size(); ++i)
+      build_methods[to_build[i]].pim = pims[i];
+    nb_built_again = to_build.size();
+    for (const auto &bm : build_methods)
+      if (bm.second.pim) cut_im.set_integration_method(bm.first, bm.second.pim);
 
+    for (dal::bv_visitor cv(linked_mesh().convex_index());
+         !cv.finished(); ++cv) {
       if (!cut_im.convex_index().is_in(cv)) {
         /* not exclusive with mls->is_convex_cut ... sometimes, cut cv
            contains no integration points.. */
@@ -435,7 +474,7 @@ namespace getfem {
         }
       }
     }
-    is_adapted = true; touch();
+    is_adapted = true; build_methods_reusable = true; touch();
     // cout << "Number of built methods : " << build_methods.size() << endl;
   }
 
@@ -19,6 +19,7 @@
 
 ===========================================================================*/
 
+#include <random>
 #include "getfem/getfem_mesh_level_set.h"
 
 
@@ -73,11 +74,20 @@ struct Chrono {
 #endif
 
   static bool noisy = false;
+
+  /* Pseudo-random point used to start the projections on the level sets
+     of the convex cv. It does not depend on the order in which the
+     convexes are treated, nor on the number of threads. */
+  static void fill_random_of_convex(base_node &X, size_type cv, unsigned k) {
+    std::minstd_rand gen(unsigned(4*cv + k + 1));
+    std::uniform_real_distribution<scalar_type> dist(-1., 1.);
+    for (scalar_type &x : X) x = dist(gen);
+  }
   void getfem_mesh_level_set_noisy(void) { noisy = true; }
 
   void mesh_level_set::clear(void) {
     cut_cv.clear();
-    is_adapted_ = false; touch();
+    is_adapted_ = false; cut_cv_reusable = false; touch();
   }
 
   const dal::bit_vector &mesh_level_set::crack_tip_convexes() const {
@@ -88,14 +98,17 @@ struct Chrono {
     GMM_ASSERT1(linked_mesh_ == 0, "mesh_level_set already initialized");
     linked_mesh_ = &me;
     this->add_dependency(me);
-    is_adapted_ = false;
+    is_adapted_ = false; cut_cv_reusable = false;
   }
 
   mesh_level_set::mesh_level_set(mesh &me)
-  { linked_mesh_ = 0; init_with_mesh(me); }
+  { linked_mesh_ = 0; nb_cut_again = 0; init_with_mesh(me); }
 
   mesh_level_set::mesh_level_set(void)
-  { linked_mesh_ = 0; is_adapted_ = false; }
+  {
+    linked_mesh_ = 0; is_adapted_ = false;
+    cut_cv_reusable = false; nb_cut_again = 0;
+  }
 
 
   mesh_level_set::~mesh_level_set() {}
@@ -302,7 +315,7 @@ struct Chrono {
   void mesh_level_set::run_delaunay(std::vector<base_node> &fixed_points,
 				    gmm::dense_matrix<size_type> &simplexes,
 				    std::vector<dal::bit_vector> &
-				    /* fixed_points_constraints */) {
+				    /* fixed_points_constraints */) const {
     double t0=gmm::uclock_sec();
     if (noisy) cout << "running delaunay with " << fixed_points.size()
 		    << " points.." << std::flush;
@@ -360,40 +373,60 @@ struct Chrono {
   }
 
   /* prezone was filled for the whole convex by find_crossing_level_set. 
-     This information is now refined for each sub-convex.
+     This information is now refined for each sub-convex of the sub-mesh
+     msh. The subzones are merged into the zones of the convex by adapt.
   */
-  void mesh_level_set::find_zones_of_element(size_type cv,
-					     std::string &prezone,
-					     scalar_type radius) {
-    convex_info &cvi = cut_cv[cv];
-    cvi.zones.clear();
-    for (dal::bv_visitor i(cvi.pmsh->convex_index()); !i.finished();++i) {
+  void mesh_level_set::subzones_of_element(size_type cv, const mesh &msh,
+					   const std::string &prezone,
+					   scalar_type radius,
+					   std::vector<std::string> &subzones)
+    const {
+    subzones.resize(0);
+    for (dal::bv_visitor i(msh.convex_index()); !i.finished();++i) {
       // If the sub element is too small, the zone is not taken into account
-      if (cvi.pmsh->convex_area_estimate(i) > 1e-8) {
+      if (msh.convex_area_estimate(i) > 1e-8) {
 	std::string subz = prezone;
 	//cout << "prezone for convex " << cv << " : " << subz << endl;
 	for (size_type j = 0; j < level_sets.size(); ++j) {
 	  if (subz[j] == '*' || subz[j] == '0') {
-	    int s = sub_simplex_is_not_crossed_by(cv, level_sets[j], i,radius);
+	    int s = sub_simplex_is_not_crossed_by(cv, level_sets[j], msh, i,
+						  radius);
 	    // cout << "sub_simplex_is_not_crossed_by = " << s << endl;
 	    subz[j] = (s < 0) ? '-' : ((s > 0) ? '+' : '0');
 	  }
 	}
-	merge_zoneset(cvi.zones, subz);
+	subzones.push_back(subz);
       }
     }
-    if (noisy) cout << "Number of zones for convex " << cv << " : "
-		    << cvi.zones.size() << endl;
   }
 
 
+  /* Data on which the cut of the convex cv depends: its radius and the
+     values of the level sets on its degrees of freedom (the cut is
+     computed on the reference element). */
+  void mesh_level_set::level_set_values_of_convex
+  (size_type cv, scalar_type radius, std::vector<scalar_type> &v) const {
+    v.resize(0);
+    v.push_back(radius);
+    for (const plevel_set &ls : level_sets) {
+      const mesh_fem &mf = ls->get_mesh_fem();
+      v.push_back(ls->get_shift());
+      for (unsigned lsnum = 0; lsnum < (ls->has_secondary() ? 2u : 1u);
+	   ++lsnum)
+	for (size_type dof : mf.ind_basic_dof_of_element(cv))
+	  v.push_back(ls->values(lsnum)[dof]);
+    }
+  }
+
   void mesh_level_set::cut_element(size_type cv,
 				   const dal::bit_vector &primary,
 				   const dal::bit_vector &secondary,
-				   scalar_type radius_cv) {
+				   scalar_type radius_cv,
+				   convex_info &cvi) const {
     
-    cut_cv[cv] = convex_info();
-    cut_cv[cv].pmsh = std::make_shared<mesh>();
+    cvi.pmsh = std::make_shared<mesh>();
+    cvi.zones.clear();
+    cvi.ls_border_faces.clear();
     if (noisy) cout << "cutting element " << cv << endl;
     bgeot::pgeometric_trans pgt = linked_mesh().trans_of_convex(cv);
     pmesher_signed_distance ref_element = new_ref_element(pgt);
@@ -419,7 +452,7 @@ struct Chrono {
     mesher_level_sets.reserve(nbtotls);
     for (size_type ll = 0; ll < level_sets.size(); ++ll) {
       if (primary[ll]) {
-	base_node X(n); gmm::fill_random(X);
+	base_node X(n); fill_random_of_convex(X, cv, 0);
 	K = std::max(K, (level_sets[ll])->degree());
 	mesher_level_sets.push_back(level_sets[ll]->mls_of_convex(cv, 0));
 	pmesher_signed_distance mls(mesher_level_sets.back());
@@ -525,9 +558,9 @@ struct Chrono {
       
       std::vector<base_node> fixed_points;
       std::vector<dal::bit_vector> fixed_points_constraints;
-      mesh &msh(*(cut_cv[cv].pmsh));
+      mesh &msh(*(cvi.pmsh));
 	
-      mesh_region &ls_border_faces(cut_cv[cv].ls_border_faces);
+      mesh_region &ls_border_faces(cvi.ls_border_faces);
       std::vector<base_node> cvpts;
 
       size_type nb_delaunay = 0;
@@ -771,19 +804,6 @@ struct Chrono {
 	else { h0 /= 2.0; dmin = 2.*h0; }
 	h0_is_ok = false;
       }
- 
-
-      if (h0_is_ok && noisy) { // ajout dans global mesh pour visu
-	vectors_to_base_matrix(G, linked_mesh().points_of_convex(cv));
-	std::vector<size_type> pts(msh.nb_points());
-	for (size_type i = 0; i < msh.nb_points(); ++i)
-	  pts[i] = global_mesh().add_point(pgt->transform(msh.points()[i], G));
-	
-	for (dal::bv_visitor i(msh.convex_index()); !i.finished(); ++i)
-	  global_mesh().add_convex(msh.trans_of_convex(i), 
-				   gmm::index_ref_iterator(pts.begin(),
-				   msh.ind_points_of_convex(i).begin()));
-      }
 
     } while (!h0_is_ok);
 
@@ -831,11 +851,16 @@ struct Chrono {
 
   void mesh_level_set::update_crack_tip_convexes() {
     crack_tip_convexes_.clear();
-     
-    for (std::map<size_type, convex_info>::const_iterator it = cut_cv.begin(); 
-	 it != cut_cv.end(); ++it) {
-      size_type cv = it->first;
-      mesh &msh = *(it->second.pmsh);      
+
+    std::vector<size_type> cvs;
+    std::vector<const mesh *> pmshs;
+    for (const auto &cvi : cut_cv)
+      { cvs.push_back(cvi.first); pmshs.push_back(cvi.second.pmsh.get()); }
+    std::vector<char> is_crack_tip(cvs.size(), 0);
+
+    auto test_convex = [&](size_type k) {
+      size_type cv = cvs[k];
+      const mesh &msh = *(pmshs[k]);
       for (unsigned ils = 0; ils < nb_level_sets(); ++ils) {
 	if (get_level_set(ils)->has_secondary()) {
 	  pmesher_signed_distance
@@ -846,16 +871,16 @@ struct Chrono {
 	    for (unsigned ipt = 0; ipt < msh.nb_points_of_convex(ii); ++ipt) {
 	      if (gmm::abs((*mesherls0)(msh.points_of_convex(ii)[ipt])) < 1E-10
 		  && gmm::abs((*mesherls1)(msh.points_of_convex(ii)[ipt])) < 1E-10) {
-		crack_tip_convexes_.add(cv);
-		goto next_convex;
+		is_crack_tip[k] = 1; return;
 	      }
 	    }
 	  }
 	}
       }
-    next_convex:
-      ;
-    }    
+    };
+    GETFEM_OMP_FOR(size_type k = 0, k < cvs.size(), ++k, test_convex(k));
+    for (size_type k = 0; k < cvs.size(); ++k)
+      if (is_crack_tip[k]) crack_tip_convexes_.add(cvs[k]);
   }
 
   void mesh_level_set::adapt(void) {
@@ -864,27 +889,108 @@ struct Chrono {
     // for each element touched, compute the sub mesh
     //   then compute the adapted integration method
     GMM_ASSERT1(linked_mesh_ != 0, "Uninitialized mesh_level_set");
+    /* The sub-meshes and zones of the convexes on which the level sets
+       have not changed are kept. Their zones are moved to the new
+       allzones and allsubzones, so that the ones no longer used are
+       dropped. */
+    std::map<size_type, convex_info> previous_cut_cv;
+    std::set<subzone> previous_subzones;
+    std::set<zone> previous_zones;
+    if (cut_cv_reusable) std::swap(previous_cut_cv, cut_cv);
+    std::swap(previous_subzones, allsubzones);
+    std::swap(previous_zones, allzones);
+    auto move_zoneset = [this](zoneset &zs) {
+      zoneset new_zs;
+      for (const zone *pz : zs) {
+	zone z;
+	for (const subzone *ps : *pz)
+	  z.insert(&(*(allsubzones.insert(*ps).first)));
+	new_zs.insert(&(*(allzones.insert(z).first)));
+      }
+      std::swap(zs, new_zs);
+    };
     cut_cv.clear();
-    allsubzones.clear();
     zones_of_convexes.clear();
-    allzones.clear();
+    nb_cut_again = 0;
 
     // noisy = true;
 
-    std::string z;
+    /* The convexes are treated independently, in parallel : first the
+       level sets crossing each convex, then the cut of the convexes and
+       the subzones of their sub-convexes, in per-convex buffers. The
+       subzones are then merged into the zones (stored in allzones) in the
+       order of the convexes. The dofs of the level sets are enumerated
+       before the parallel loops. */
+    for (const plevel_set &ls : level_sets) ls->get_mesh_fem().nb_dof();
+    std::vector<size_type> cvs;
     for (dal::bv_visitor cv(linked_mesh().convex_index()); 
-	 !cv.finished(); ++cv) {
-      scalar_type radius = linked_mesh().convex_radius_estimate(cv);
-      dal::bit_vector prim, sec;
-      find_crossing_level_set(cv, prim, sec, z, radius);
-      zones_of_convexes[cv] = &(*(allsubzones.insert(z).first));
+	 !cv.finished(); ++cv) cvs.push_back(cv);
+    std::vector<scalar_type> radius(cvs.size());
+    std::vector<dal::bit_vector> prim(cvs.size()), sec(cvs.size());
+    std::vector<std::string> z(cvs.size());
+    GETFEM_OMP_FOR(size_type i = 0, i < cvs.size(), ++i, {
+	radius[i] = linked_mesh().convex_radius_estimate(cvs[i]);
+	find_crossing_level_set(cvs[i], prim[i], sec[i], z[i], radius[i]);
+      });
+
+    std::vector<size_type> to_cut;
+    std::vector<convex_info *> pcvi;
+    std::vector<scalar_type> ls_values;
+    for (size_type i = 0; i < cvs.size(); ++i) {
+      size_type cv = cvs[i];
+      zones_of_convexes[cv] = &(*(allsubzones.insert(z[i]).first));
       if (noisy) cout << "element " << cv << " cut level sets : "
-		      << prim << " zone : " << z << endl;
-      if (prim.card()) {
-	cut_element(cv, prim, sec, radius);
-	find_zones_of_element(cv, z, radius);
+		      << prim[i] << " zone : " << z[i] << endl;
+      if (prim[i].card()) {
+	convex_info &cvi = cut_cv[cv];
+	bgeot::pgeometric_trans pgt = linked_mesh().trans_of_convex(cv);
+	level_set_values_of_convex(cv, radius[i], ls_values);
+	auto it = previous_cut_cv.find(cv);
+	if (it != previous_cut_cv.end() && it->second.pgt == pgt
+	    && it->second.ls_values == ls_values) {
+	  std::swap(cvi, it->second);
+	  move_zoneset(cvi.zones);
+	} else {
+	  cvi.pgt = pgt;
+	  std::swap(cvi.ls_values, ls_values);
+	  to_cut.push_back(i); pcvi.push_back(&cvi);
+	}
       }
     }
+    previous_cut_cv.clear();
+    previous_zones.clear(); previous_subzones.clear();
+
+    std::vector<std::vector<std::string> > subzones(to_cut.size());
+    GETFEM_OMP_FOR(size_type j = 0, j < to_cut.size(), ++j, {
+	size_type i = to_cut[j];
+	cut_element(cvs[i], prim[i], sec[i], radius[i], *(pcvi[j]));
+	subzones_of_element(cvs[i], *(pcvi[j]->pmsh), z[i], radius[i],
+			    subzones[j]);
+      });
+
+    base_matrix G;
+    for (size_type j = 0; j < to_cut.size(); ++j) {
+      convex_info &cvi = *(pcvi[j]);
+      for (const std::string &subz : subzones[j])
+	merge_zoneset(cvi.zones, subz);
+      size_type cv = cvs[to_cut[j]];
+      if (noisy) { // ajout dans global mesh pour visu
+	cout << "Number of zones for convex " << cv << " : "
+	     << cvi.zones.size() << endl;
+	const mesh &msh = *(cvi.pmsh);
+	vectors_to_base_matrix(G, linked_mesh().points_of_convex(cv));
+	std::vector<size_type> pts(msh.nb_points());
+	for (size_type i = 0; i < msh.nb_points(); ++i)
+	  pts[i] = global_mesh().add_point(cvi.pgt->transform(msh.points()[i],
+							      G));
+	for (dal::bv_visitor i(msh.convex_index()); !i.finished(); ++i)
+	  global_mesh().add_convex(msh.trans_of_convex(i), 
+				   gmm::index_ref_iterator(pts.begin(),
+				   msh.ind_points_of_convex(i).begin()));
+      }
+    }
+    nb_cut_again = to_cut.size();
+
     if (noisy) {
       getfem::stored_mesh_slice sl;
       sl.build(global_mesh(), getfem::slicer_none(), 6);
@@ -895,7 +1001,7 @@ struct Chrono {
     }
 
     update_crack_tip_convexes();
-    is_adapted_ = true;
+    is_adapted_ = true; cut_cv_reusable = true;
   }
 
   // detect the intersection of two or more level sets and the convexes
@@ -924,12 +1030,11 @@ struct Chrono {
   //           level-set if any.
   int mesh_level_set::sub_simplex_is_not_crossed_by(size_type cv,
 						    plevel_set ls,
+						    const mesh &msh,
 						    size_type sub_cv,
-						    scalar_type radius) {
+						    scalar_type radius) const {
     scalar_type EPS = 1e-7 * radius;
-    bgeot::pgeometric_trans pgt = linked_mesh().trans_of_convex(cv);
-    convex_info &cvi = cut_cv[cv];
-    bgeot::pgeometric_trans pgt2 = cvi.pmsh->trans_of_convex(sub_cv);
+    bgeot::pgeometric_trans pgt2 = msh.trans_of_convex(sub_cv);
 
     // cout << "cv " << cv << " radius = " << radius << endl;
 
@@ -939,11 +1044,11 @@ struct Chrono {
     bool is_cut = false;
     scalar_type d2 = 0, d1 = 1, d0 = 0, d0min = 0;
     for (size_type i = 0; i < pgt2->nb_points(); ++i) {
-      d0 = (*mls0)(cvi.pmsh->points_of_convex(sub_cv)[i]);
+      d0 = (*mls0)(msh.points_of_convex(sub_cv)[i]);
       if (i == 0) d0min = gmm::abs(d0);
       else d0min = std::min(d0min, gmm::abs(d0));
       if (ls->has_secondary())
-	d1 = std::min(d1, (*mls1)(cvi.pmsh->points_of_convex(sub_cv)[i]));
+	d1 = std::min(d1, (*mls1)(msh.points_of_convex(sub_cv)[i]));
      
       int p2 = ( (d0 < -EPS) ? -1 : ((d0 > EPS) ? +1 : 0));
       if (p == 0) p = p2;
@@ -958,7 +1063,8 @@ struct Chrono {
   }
 
   int mesh_level_set::is_not_crossed_by(size_type cv, plevel_set ls,
-					unsigned lsnum, scalar_type radius) {
+					unsigned lsnum,
+					scalar_type radius) const {
     const mesh_fem &mf = ls->get_mesh_fem();
     GMM_ASSERT1(!mf.is_reduced(), "Internal error");
     const mesh_fem::ind_dof_ct &dofs = mf.ind_basic_dof_of_element(cv);
@@ -981,19 +1087,19 @@ struct Chrono {
 
     pmesher_signed_distance mls1 = ls->mls_of_convex(cv, lsnum, false);
     base_node X(pf->dim()), G(pf->dim());
-    gmm::fill_random(X); X *= 1E-2;
+    fill_random_of_convex(X, cv, 1); X *= 1E-2;
     scalar_type d = mls1->grad(X, G);
     if (gmm::vect_norm2(G)*2.5 < gmm::abs(d)) return p;
 
     bgeot::pgeometric_trans pgt = linked_mesh().trans_of_convex(cv);
     pmesher_signed_distance ref_element = new_ref_element(pgt);
     
-    gmm::fill_random(X); X *= 1E-2;
+    fill_random_of_convex(X, cv, 2); X *= 1E-2;
     mesher_intersection mi1(ref_element, mls1);
     if (!try_projection(mi1, X)) return p;
     if ((*ref_element)(X) > 1E-8) return p;
     
-    gmm::fill_random(X); X *= 1E-2;
+    fill_random_of_convex(X, cv, 3); X *= 1E-2;
     pmesher_signed_distance mls2 = ls->mls_of_convex(cv, lsnum, true);
     mesher_intersection mi2(ref_element, mls2);
     if (!try_projection(mi2, X)) return p;
@@ -1006,7 +1112,7 @@ struct Chrono {
 					       dal::bit_vector &prim,
 					       dal::bit_vector &sec,
 					       std::string &z,
-					       scalar_type radius) {
+					       scalar_type radius) const {
     prim.clear(); sec.clear();
     z = std::string(level_sets.size(), '*');
     unsigned lsnum = 0;
@@ -101,6 +101,7 @@ namespace getfem {
     } else GMM_ASSERT1(poriginal_mesh == &m, "wrong mesh..");
 
     dim_ = m.dim();
+    interp_ops.clear();
     cv2pos.clear(); 
     cv2pos.resize(m.nb_allocated_convex(), size_type(-1));
 
@@ -276,13 +277,74 @@ namespace getfem {
                                 const slicer_action *c, 
                                 size_type nrefine) {
     clear();
-    mesh_slicer slicer(m);
-    slicer.push_back_action(*const_cast<slicer_action*>(a));
-    if (b) slicer.push_back_action(*const_cast<slicer_action*>(b));
-    if (c) slicer.push_back_action(*const_cast<slicer_action*>(c));
-    slicer_build_stored_mesh_slice sbuild(*this);
-    slicer.push_back_action(sbuild);
-    slicer.exec(nrefine);
+    bool thread_safe = a->thread_safe() && (!b || b->thread_safe())
+      && (!c || c->thread_safe());
+    size_type nbcv = m.convex_index().card();
+    size_type nbchunks = std::min(nbcv / 1024 + 1, 4 * max_concurrency());
+    if (!thread_safe || nbchunks < 2) {
+      mesh_slicer slicer(m);
+      slicer.push_back_action(*const_cast<slicer_action*>(a));
+      if (b) slicer.push_back_action(*const_cast<slicer_action*>(b));
+      if (c) slicer.push_back_action(*const_cast<slicer_action*>(c));
+      slicer_build_stored_mesh_slice sbuild(*this);
+      slicer.push_back_action(sbuild);
+      slicer.exec(nrefine);
+      return;
+    }
+
+    /* Parallel version: each chunk of consecutive convexes is sliced
+       into its own stored_mesh_slice, the parts are then appended in the
+       convex order, which gives the same result as the sequential
+       version. The refined meshes of the reference convexes are built
+       before, since they are shared by all the threads. */
+    std::vector<size_type> cvs; cvs.reserve(nbcv);
+    std::set<bgeot::pconvex_ref> cvrs;
+    for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv) {
+      cvs.push_back(cv);
+      bgeot::pconvex_ref cvr = m.trans_of_convex(cv)->convex_ref();
+      if (cvrs.insert(cvr).second)
+        bgeot::refined_simplex_mesh_for_convex(cvr, short_type(nrefine));
+    }
+    std::vector<mesh_region> rgs(nbchunks);
+    for (size_type ic = 0; ic < nbchunks; ++ic) {
+      for (size_type i = (ic*nbcv)/nbchunks; i < ((ic+1)*nbcv)/nbchunks; ++i)
+        rgs[ic].add(cvs[i]);
+      rgs[ic].prohibit_partitioning();
+    }
+
+    std::vector<stored_mesh_slice> parts(nbchunks);
+    auto treat_chunk = [&](size_type ic) {
+      mesh_slicer slicer(m);
+      slicer.push_back_action(*const_cast<slicer_action*>(a));
+      if (b) slicer.push_back_action(*const_cast<slicer_action*>(b));
+      if (c) slicer.push_back_action(*const_cast<slicer_action*>(c));
+      slicer_build_stored_mesh_slice sbuild(parts[ic]);
+      slicer.push_back_action(sbuild);
+      slicer.exec(nrefine, rgs[ic]);
+    };
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic, treat_chunk(ic));
+
+    for (size_type ic = 0; ic < nbchunks; ++ic) {
+      stored_mesh_slice &part = parts[ic];
+      if (!part.poriginal_mesh) continue;
+      if (!poriginal_mesh) {
+        poriginal_mesh = &m;
+        cv2pos.assign(m.nb_allocated_convex(), size_type(-1));
+        dim_ = part.dim_;
+      }
+      dim_ = std::max(dim_, part.dim_);
+      if (simplex_cnt.size() < part.simplex_cnt.size())
+        simplex_cnt.resize(part.simplex_cnt.size(), 0);
+      for (size_type i = 0; i < part.simplex_cnt.size(); ++i)
+        simplex_cnt[i] += part.simplex_cnt[i];
+      for (convex_slice &cs : part.cvlst) {
+        cv2pos[cs.cv_num] = cvlst.size();
+        cs.global_points_count = points_cnt;
+        points_cnt += cs.nodes.size();
+        cvlst.push_back(std::move(cs));
+      }
+      part.cvlst.clear();
+    }
   }
 
   void stored_mesh_slice::replay(slicer_action *a, slicer_action *b,
@@ -307,6 +369,7 @@ namespace getfem {
   void stored_mesh_slice::merge(const stored_mesh_slice& sl) {
     GMM_ASSERT1(dim()==sl.dim(), "inconsistent dimensions for slice merging");
     clear_merged_nodes();
+    interp_ops.clear();
     cv2pos.resize(std::max(cv2pos.size(), sl.cv2pos.size()), size_type(-1));
     for (size_type i=0; i < sl.nb_convex(); ++i) 
       GMM_ASSERT1(cv2pos[sl.convex_num(i)] == size_type(-1) ||
@@ -340,6 +403,81 @@ namespace getfem {
     assert(count == points_cnt);
   }
 
+  void stored_mesh_slice::build_interpolation_operator
+  (const mesh_fem &mf, interpolation_operator &op) const {
+    size_type qdim = mf.get_qdim(), pos = 0;
+    gmm::row_matrix<gmm::rsvector<scalar_type> >
+      M(nb_points()*qdim, mf.nb_basic_dof());
+    std::vector<base_node> refpts;
+    base_matrix G, Mloc;
+    fem_precomp_pool fppool;
+
+    for (size_type i=0; i < nb_convex(); ++i) {
+      size_type cv = convex_num(i);
+      if (!mf.convex_index().is_in(cv))
+        { pos += nodes(i).size() * qdim; continue; }
+      refpts.resize(nodes(i).size());
+      for (size_type j=0; j < refpts.size(); ++j)
+        refpts[j] = nodes(i)[j].pt_ref;
+
+      pfem pf = mf.fem_of_element(cv);
+      if (pf->need_G())
+        bgeot::vectors_to_base_matrix(G,
+                                      mf.linked_mesh().points_of_convex(cv));
+      pfem_precomp pfp = fppool(pf, store_point_tab(refpts));
+      mesh_fem::ind_dof_ct dof = mf.ind_basic_dof_of_element(cv);
+      fem_interpolation_context ctx(mf.linked_mesh().trans_of_convex(cv),
+                                    pfp, 0, G, cv, short_type(-1));
+      gmm::resize(Mloc, qdim, dof.size());
+      for (size_type j=0; j < refpts.size(); ++j, pos += qdim) {
+        ctx.set_ii(j);
+        pf->interpolation(ctx, Mloc, dim_type(qdim));
+        for (size_type k=0; k < qdim; ++k)
+          for (size_type l=0; l < dof.size(); ++l)
+            M(pos+k, dof[l]) = Mloc(k, l);
+      }
+    }
+    GMM_ASSERT1(pos == gmm::mat_nrows(M), "bad dimensions");
+
+    if (mf.is_reduced()) {
+      gmm::row_matrix<gmm::rsvector<scalar_type> >
+        MM(gmm::mat_nrows(M), mf.nb_dof());
+      gmm::mult(M, mf.extension_matrix(), MM);
+      op.set_matrix(MM, qdim);
+    } else
+      op.set_matrix(M, qdim);
+    op.add_mesh_fem(mf);
+  }
+
+  pinterpolation_operator
+  stored_mesh_slice::cached_interpolation_operator(const mesh_fem &mf) const {
+    {
+      GLOBAL_OMP_GUARD;
+      for (auto it = interp_ops.begin(); it != interp_ops.end(); )
+        if (!(it->second->is_context_valid())) it = interp_ops.erase(it);
+        else ++it;
+      auto it = interp_ops.find(&mf);
+      if (it == interp_ops.end() || !(it->second->is_up_to_date())) {
+        // first call, only record mf to detect its modifications
+        auto op = std::make_shared<interpolation_operator>();
+        op->add_mesh_fem(mf);
+        interp_ops[&mf] = op;
+        return pinterpolation_operator();
+      }
+      if (it->second->ncols() > 0) return it->second;
+    }
+
+    auto op = std::make_shared<interpolation_operator>();
+    build_interpolation_operator(mf, *op);
+    /* mf may have been modified during the build */
+    GLOBAL_OMP_GUARD;
+    auto it = interp_ops.find(&mf);
+    if (it == interp_ops.end() || !(it->second->is_up_to_date()))
+      return pinterpolation_operator();
+    if (it->second->ncols() == 0) it->second = op;
+    return it->second;
+  }
+
   void stored_mesh_slice::clear_merged_nodes() const { 
     merged_nodes_idx.clear(); merged_nodes.clear(); 
     to_merged_index.clear();
@@ -347,36 +485,72 @@ namespace getfem {
   }
 
   void stored_mesh_slice::merge_nodes() const {
-    size_type count = 0;
-    mesh mp;
     clear_merged_nodes();
-    std::vector<size_type> iv;
-    std::vector<const slice_node*> nv(nb_points());
-    to_merged_index.resize(nb_points());
-    for (cvlst_ct::const_iterator it = cvlst.begin(); it != cvlst.end(); ++it) {
-      for (size_type i=0; i < it->nodes.size(); ++i) {
-        nv[count] = &it->nodes[i];
-        to_merged_index[count++] = mp.add_point(it->nodes[i].pt);
-        // cout << "orig[" << count-1 << "] = " << nv[count-1]->pt
-        //      << ", idx=" << to_merged_index[count-1] << "\n";
+    size_type nbp = nb_points(), nbcv = nb_convex();
+    size_type nbchunks = std::min(nbp / 1024 + 1, 4 * max_concurrency());
+    nbchunks = std::max(size_type(1), std::min(nbchunks, nbcv));
+    to_merged_index.resize(nbp);
+
+    /* Nodes are first merged inside chunks of consecutive convexes, then
+       the local representatives are merged, in order, in a global table.
+       This gives the numbering of the sequential version: the merged
+       nodes are numbered in the order of their first occurrence. */
+    std::vector<size_type> cvchunks(nbchunks+1);
+    for (size_type ic = 0; ic <= nbchunks; ++ic)
+      cvchunks[ic] = (ic*nbcv)/nbchunks;
+    std::vector<std::vector<const slice_node *> > firsts(nbchunks);
+    auto merge_chunk = [&](size_type ic) {
+      bgeot::node_tab nt;
+      for (size_type i = cvchunks[ic]; i < cvchunks[ic+1]; ++i) {
+        const convex_slice &cs = cvlst[i];
+        for (size_type j = 0; j < cs.nodes.size(); ++j) {
+          size_type k = nt.add_node(cs.nodes[j].pt);
+          if (k == firsts[ic].size()) firsts[ic].push_back(&cs.nodes[j]);
+          to_merged_index[cs.global_points_count + j] = k;
+        }
       }
+    };
+    GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic, merge_chunk(ic));
+
+    size_type nbm = firsts[0].size();
+    if (nbchunks > 1) {
+      bgeot::node_tab nt;
+      std::vector<std::vector<size_type> > loc2glob(nbchunks);
+      for (size_type ic = 0; ic < nbchunks; ++ic) {
+        loc2glob[ic].resize(firsts[ic].size());
+        for (size_type k = 0; k < firsts[ic].size(); ++k)
+          loc2glob[ic][k] = nt.add_node(firsts[ic][k]->pt);
+      }
+      nbm = nt.card();
+      auto renumber_chunk = [&](size_type ic) {
+        for (size_type i = cvchunks[ic]; i < cvchunks[ic+1]; ++i) {
+          const convex_slice &cs = cvlst[i];
+          for (size_type j = 0; j < cs.nodes.size(); ++j) {
+            size_type &k = to_merged_index[cs.global_points_count + j];
+            k = loc2glob[ic][k];
+          }
+        }
+      };
+      GETFEM_OMP_FOR(size_type ic = 0, ic < nbchunks, ++ic,
+                     renumber_chunk(ic));
     }
-    gmm::sorted_indexes(to_merged_index,iv);
-    //cout << "to_merged_index = " << iv << "\n";
-    merged_nodes.resize(nb_points());
-    merged_nodes_idx.reserve(nb_points()/8);
-    
-    merged_nodes_idx.push_back(0);
-    for (size_type i=0; i < nb_points(); ++i) {
-      merged_nodes[i].P = nv[iv[i]];
-      merged_nodes[i].pos = unsigned(iv[i]);
-      // cout << "i=" << i << " -> {" << merged_nodes[i].P->pt
-      //      << "," << merged_nodes[i].pos << "}\n";
-      if (i == nb_points()-1 ||
-          to_merged_index[iv[i+1]] != to_merged_index[iv[i]]) 
-        merged_nodes_idx.push_back(i+1);
-    }
-    //cout << "merged_nodes_idx = " << merged_nodes_idx << "\n";
+
+    /* counting sort of the points on their merged index */
+    merged_nodes_idx.assign(nbm+1, 0);
+    for (size_type i = 0; i < nbp; ++i)
+      ++merged_nodes_idx[to_merged_index[i]+1];
+    for (size_type k = 0; k < nbm; ++k)
+      merged_nodes_idx[k+1] += merged_nodes_idx[k];
+    std::vector<size_type> next(merged_nodes_idx.begin(),
+                                merged_nodes_idx.end()-1);
+    merged_nodes.resize(nbp);
+    for (cvlst_ct::const_iterator it = cvlst.begin(); it != cvlst.end(); ++it)
+      for (size_type j = 0; j < it->nodes.size(); ++j) {
+        size_type ip = it->global_points_count + j;
+        size_type q = next[to_merged_index[ip]]++;
+        merged_nodes[q].P = &it->nodes[j];
+        merged_nodes[q].pos = unsigned(ip);
+      }
     merged_nodes_available = true;
   }
 
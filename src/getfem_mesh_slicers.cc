@@ -186,7 +186,7 @@ namespace getfem {
                                     std::bitset<32> spin, std::bitset<32> spbin) {
     scalar_type alpha = 0; size_type iA=0, iB = 0;
     bool intersection = false;
-    static int level = 0;
+    THREAD_SAFE_STATIC int level = 0;
 
     level++;    
     /*
@@ -214,7 +214,7 @@ namespace getfem {
       n.faces = A.faces & B.faces;
       size_type nn = ms.nodes.size();
       ms.nodes.push_back(n); /* invalidate A and B.. */
-      pt_bin.add(nn); pt_in.add(nn);
+      pt_bin().add(nn); pt_in().add(nn);
       
       std::bitset<32> spin2(spin), spbin2(spbin); 
       std::swap(s.inodes[iA],nn);
@@ -275,8 +275,8 @@ namespace getfem {
       size_type in_cnt = 0, in_bcnt = 0;
       std::bitset<32> spin, spbin;
       for (size_type i=0; i < s.dim()+1; ++i) {
-        if (pt_in.is_in(s.inodes[i])) { ++in_cnt; spin.set(i); }
-        if (pt_bin.is_in(s.inodes[i])) { ++in_bcnt; spbin.set(i); }
+        if (pt_in().is_in(s.inodes[i])) { ++in_cnt; spin.set(i); }
+        if (pt_bin().is_in(s.inodes[i])) { ++in_bcnt; spbin.set(i); }
       }
 
       if (in_cnt == 0) {
@@ -288,11 +288,11 @@ namespace getfem {
     }
 
     /* signalement des points qui se trouvent pile-poil sur la bordure */
-    if (pt_bin.card()) {
+    if (pt_bin().card()) {
       GMM_ASSERT1(ms.fcnt != dim_type(-1), 
                   "too much {faces}/{slices faces} in the convex " << ms.cv 
                   << " (nbfaces=" << ms.fcnt << ")");
-      for (dal::bv_visitor cnt(pt_bin); !cnt.finished(); ++cnt) {
+      for (dal::bv_visitor cnt(pt_bin()); !cnt.finished(); ++cnt) {
         ms.nodes[cnt].faces.set(ms.fcnt);
       }
       ms.fcnt++;
@@ -374,6 +374,8 @@ namespace getfem {
   void slicer_isovalues::prepare(size_type cv,
                                  const mesh_slicer::cs_nodes_ct& nodes, 
                                  const dal::bit_vector& nodes_index) {
+    dal::bit_vector &pt_in = this->pt_in(), &pt_bin = this->pt_bin();
+    std::vector<scalar_type> &Uval = Uval_.thrd_cast();
     pt_in.clear(); pt_bin.clear();
     std::vector<base_node> refpts(nodes.size());
     Uval.resize(nodes.size());
@@ -28,9 +28,27 @@ namespace getfem {
     for (dim_type d=0; d < base.dim(); ++d) {
       gradient[d] = base; gradient[d].derivative(d);
     }
+    GMM_ASSERT1(val_grad.init(base.dim()+1, [this](size_type i)
+                              -> const base_poly &
+                              { return i ? gradient[i-1] : base; }),
+                "Internal error");
     initialized = 1; 
   }
 
+  void mesher_level_set::values_and_gradients
+  (const std::vector<base_node> &pts, base_vector &V, base_matrix &G) const {
+    if (initialized < 1) init_grad();
+    size_type N = base.dim();
+    gmm::resize(V, pts.size()); gmm::resize(G, N, pts.size());
+    std::vector<bgeot::opt_long_scalar_type> res(N+1);
+    for (size_type k = 0; k < pts.size(); ++k) {
+      val_grad.eval(pts[k].begin(), &res[0]);
+      V[k] = bgeot::to_scalar(res[0]) + shift_ls;
+      for (size_type i = 0; i < N; ++i)
+        G(i, k) = bgeot::to_scalar(res[i+1]);
+    }
+  }
+
   void mesher_level_set::init_hess(void) const {
     if (initialized < 1) init_grad();
     hessian.resize(base.dim()*base.dim());
@@ -30,6 +30,7 @@
 #include "getfem/getfem_interpolation.h"
 #include "getfem/getfem_generic_assembly.h"
 #include "getfem/getfem_generic_assembly_tree.h"
+#include "getfem/getfem_binary_io.h"
 
 
 namespace getfem {
@@ -3113,6 +3114,247 @@ namespace getfem {
     cTM = model_complex_sparse_matrix();
     rrhs = model_real_plain_vector();
     crhs = model_complex_plain_vector();
+    checkpoint_file.clear();
+  }
+
+  /* ******************************************************************* */
+  /*  Checkpoints.                                                        */
+  /* ******************************************************************* */
+
+  /* 64 bits FNV-1a hash, used for the fingerprints of the mesh_fem and
+     im_data of the variables */
+  static void fnv_hash(gmm::uint64_type &h, const void *data, size_type n) {
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    for (size_type i = 0; i < n; ++i) { h ^= p[i]; h *= 1099511628211ULL; }
+  }
+
+  template <typename T> static void fnv_hash(gmm::uint64_type &h, T v)
+  { fnv_hash(h, &v, sizeof(T)); }
+
+  static const gmm::uint64_type fnv_offset_basis = 14695981039346656037ULL;
+
+  struct checkpoint_fingerprints {
+    std::map<const mesh *, std::vector<gmm::uint64_type> > meshes;
+    std::map<const void *, gmm::uint64_type> names;
+
+    const std::vector<gmm::uint64_type> &of_mesh(const mesh &m) {
+      std::vector<gmm::uint64_type> &fp = meshes[&m];
+      if (fp.empty()) {
+        gmm::uint64_type h = fnv_offset_basis;
+        for (dal::bv_visitor ip(m.points_index()); !ip.finished(); ++ip) {
+          fnv_hash(h, gmm::uint64_type(ip));
+          for (const scalar_type &x : m.points()[ip]) fnv_hash(h, x);
+        }
+        for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv) {
+          fnv_hash(h, gmm::uint64_type(cv));
+          for (size_type ip : m.ind_points_of_convex(cv))
+            fnv_hash(h, gmm::uint64_type(ip));
+        }
+        fp = { m.points_index().card(), m.convex_index().card(), h };
+      }
+      return fp;
+    }
+
+    gmm::uint64_type of_name(const void *p, const std::string &name) {
+      auto it = names.find(p);
+      if (it != names.end()) return it->second;
+      gmm::uint64_type h = fnv_offset_basis;
+      fnv_hash(h, name.data(), name.size());
+      return names[p] = h;
+    }
+
+    void of_mesh_fem(const mesh_fem &mf, std::vector<gmm::uint64_type> &fp) {
+      fp = of_mesh(mf.linked_mesh());
+      gmm::uint64_type h = fnv_offset_basis;
+      for (dal::bv_visitor cv(mf.convex_index()); !cv.finished(); ++cv) {
+        pfem pf = mf.fem_of_element(cv);
+        fnv_hash(h, gmm::uint64_type(cv));
+        fnv_hash(h, of_name(pf.get(), name_of_fem(pf)));
+      }
+      fp.insert(fp.end(), { mf.nb_dof(), mf.get_qdim(), h });
+    }
+
+    void of_im_data(const im_data &imd, std::vector<gmm::uint64_type> &fp) {
+      const mesh_im &mim = imd.linked_mesh_im();
+      fp = of_mesh(mim.linked_mesh());
+      gmm::uint64_type h = fnv_offset_basis;
+      for (dal::bv_visitor cv(mim.convex_index()); !cv.finished(); ++cv) {
+        pintegration_method pim = mim.int_method_of_element(cv);
+        fnv_hash(h, gmm::uint64_type(cv));
+        fnv_hash(h, of_name(pim.get(), name_of_int_method(pim)));
+      }
+      fp.insert(fp.end(), { imd.nb_filtered_index(), imd.nb_tensor_elem(),
+                            h });
+    }
+  };
+
+  /* Sections of a checkpoint file: "variables" (names), "base" (name of
+     the base checkpoint of an incremental one), "time" (time parameters)
+     and for the variable of index k, "v<k>.desc" (is_variable, is_complex,
+     n_iter, size, is_affine_dependent), "v<k>.fp" (fingerprint),
+     "v<k>.<i>" (version i of the value, absent in an incremental
+     checkpoint if unchanged), "v<k>.affine" and "v<k>.alpha". */
+  static std::string checkpoint_section(size_type k, const std::string &s) {
+    std::stringstream ss;
+    ss << "v" << k << "." << s;
+    return ss.str();
+  }
+
+  void model::save_checkpoint(const std::string &filename,
+                              bool incremental) const {
+    context_check(); if (act_size_to_be_done) actualize_sizes();
+    GMM_ASSERT1(!incremental || !checkpoint_file.empty(),
+                "No previous checkpoint, an incremental one cannot be saved");
+    gmm::uint64_type v_num_start = act_counter();
+    binary_file_writer f(filename, "model_checkpoint");
+    checkpoint_fingerprints fps;
+
+    std::vector<std::string> names;
+    for (const auto &v : variables) names.push_back(v.first);
+    f.write_strings("variables", names);
+    if (incremental)
+      f.write_strings("base", std::vector<std::string>(1, checkpoint_file));
+    std::vector<scalar_type> tp = { time_step, init_time_step,
+                                    scalar_type(time_integration),
+                                    scalar_type(init_step) };
+    f.write_section("time", tp);
+
+    size_type k = 0;
+    for (const auto &v : variables) {
+      const var_description &vd = v.second;
+      std::vector<gmm::uint64_type> desc = { vd.is_variable, vd.is_complex,
+                                             vd.n_iter, vd.size(),
+                                             vd.is_affine_dependent }, fp;
+      f.write_section(checkpoint_section(k, "desc"), desc);
+      if (vd.mf) fps.of_mesh_fem(vd.associated_mf(), fp);
+      else if (vd.imd) fps.of_im_data(*(vd.imd), fp);
+      f.write_section(checkpoint_section(k, "fp"), fp);
+      for (size_type i = 0; i < vd.n_iter; ++i) {
+        if (incremental
+            && std::max(vd.v_num, vd.v_num_data[i]) <= checkpoint_v_num)
+          continue;
+        std::stringstream ss; ss << i;
+        if (vd.is_complex)
+          f.write_section(checkpoint_section(k, ss.str()),
+                          vd.complex_value[i]);
+        else
+          f.write_section(checkpoint_section(k, ss.str()), vd.real_value[i]);
+      }
+      if (vd.is_affine_dependent) {
+        f.write_section(checkpoint_section(k, "alpha"),
+                        std::vector<scalar_type>(1, vd.alpha));
+        if (vd.is_complex)
+          f.write_section(checkpoint_section(k, "affine"),
+                          vd.affine_complex_value);
+        else
+          f.write_section(checkpoint_section(k, "affine"),
+                          vd.affine_real_value);
+      }
+      ++k;
+    }
+    f.close();
+    checkpoint_v_num = v_num_start;
+    checkpoint_file = filename;
+  }
+
+  void model::load_checkpoint(const std::string &filename) {
+    context_check(); if (act_size_to_be_done) actualize_sizes();
+    checkpoint_fingerprints fps;
+    std::unique_ptr<binary_file_reader>
+      f = std::make_unique<binary_file_reader>(filename, "model_checkpoint");
+
+    std::vector<std::string> names;
+    f->read_strings("variables", names);
+    std::vector<scalar_type> tp;
+    f->read_section("time", tp);
+    GMM_ASSERT1(tp.size() == 4, "Invalid checkpoint file " << filename);
+
+    /* check the compatibility of the model before modifying anything */
+    for (size_type k = 0; k < names.size(); ++k) {
+      auto it = variables.find(names[k]);
+      GMM_ASSERT1(it != variables.end(), "Variable " << names[k] << " of "
+                  "the checkpoint " << filename << " is not in the model");
+      const var_description &vd = it->second;
+      std::vector<gmm::uint64_type> desc, fp, fp0;
+      f->read_section(checkpoint_section(k, "desc"), desc);
+      f->read_section(checkpoint_section(k, "fp"), fp0);
+      GMM_ASSERT1(desc.size() == 5 && desc[0] == vd.is_variable
+                  && desc[1] == vd.is_complex && desc[2] == vd.n_iter
+                  && desc[3] == vd.size() && desc[4] == vd.is_affine_dependent,
+                  "Variable " << names[k] << " of the checkpoint " << filename
+                  << " does not match the one of the model");
+      if (vd.mf) fps.of_mesh_fem(vd.associated_mf(), fp);
+      else if (vd.imd) fps.of_im_data(*(vd.imd), fp);
+      GMM_ASSERT1(fp == fp0, "The mesh_fem or im_data of variable "
+                  << names[k] << " has changed since the checkpoint");
+    }
+    for (const auto &v : variables)
+      if (std::find(names.begin(), names.end(), v.first) == names.end())
+        GMM_WARNING2("Variable " << v.first << " is not in the checkpoint "
+                     << filename << ", it is left unchanged");
+
+    /* arrays of the checkpoint, and of its base ones if it is incremental */
+    std::set<std::pair<std::string, size_type> > missing;
+    for (const std::string &name : names) {
+      var_description &vd = variables[name];
+      for (size_type i = 0; i < vd.n_iter; ++i) missing.insert({name, i});
+    }
+    std::string fname = filename;
+    for (;;) {
+      std::vector<std::string> fnames;
+      f->read_strings("variables", fnames);
+      for (size_type k = 0; k < fnames.size(); ++k) {
+        auto it = variables.find(fnames[k]);
+        if (it == variables.end()) continue;
+        var_description &vd = it->second;
+        for (size_type i = 0; i < vd.n_iter; ++i) {
+          std::stringstream ss; ss << i;
+          std::string sname = checkpoint_section(k, ss.str());
+          if (!missing.count({fnames[k], i}) || !f->has_section(sname))
+            continue;
+          size_type n;
+          if (vd.is_complex) {
+            const complex_type *p = f->section_as<complex_type>(sname, n);
+            GMM_ASSERT1(n == vd.complex_value[i].size(), "Invalid size of "
+                        "variable " << fnames[k] << " in " << fname);
+            std::copy(p, p+n, vd.complex_value[i].begin());
+          } else {
+            const scalar_type *p = f->section_as<scalar_type>(sname, n);
+            GMM_ASSERT1(n == vd.real_value[i].size(), "Invalid size of "
+                        "variable " << fnames[k] << " in " << fname);
+            std::copy(p, p+n, vd.real_value[i].begin());
+          }
+          vd.v_num_data[i] = act_counter();
+          missing.erase({fnames[k], i});
+        }
+        if (fname == filename && vd.is_affine_dependent) {
+          std::vector<scalar_type> alpha;
+          f->read_section(checkpoint_section(k, "alpha"), alpha);
+          GMM_ASSERT1(alpha.size() == 1, "Invalid checkpoint file " << fname);
+          vd.alpha = alpha[0];
+          if (vd.is_complex)
+            f->read_section(checkpoint_section(k, "affine"),
+                            vd.affine_complex_value);
+          else
+            f->read_section(checkpoint_section(k, "affine"),
+                            vd.affine_real_value);
+        }
+      }
+      if (missing.empty()) break;
+      GMM_ASSERT1(f->has_section("base"), "Variable "
+                  << missing.begin()->first << " is missing in checkpoint "
+                  << fname);
+      std::vector<std::string> base;
+      f->read_strings("base", base);
+      GMM_ASSERT1(base.size() == 1, "Invalid checkpoint file " << fname);
+      fname = base[0];
+      f = std::make_unique<binary_file_reader>(fname, "model_checkpoint");
+    }
+
+    time_step = tp[0]; init_time_step = tp[1];
+    time_integration = int(tp[2]); init_step = (tp[3] != scalar_type(0));
+    checkpoint_v_num = act_counter();
+    checkpoint_file = filename;
   }
 
 
@@ -281,6 +281,345 @@ namespace getfem {
     return flags;
   }
 
+  /* Fixed size kernels, for the batched evaluation of the laws. The
+     matrices are stored column-wise in arrays of N*N components and the
+     fourth order tensors in arrays of N^4 components, as in base_matrix
+     and base_tensor.
+  */
+
+  // Determinant of a small matrix
+  static inline scalar_type small_det(const scalar_type *A, size_type N) {
+    switch (N) {
+    case 1: return A[0];
+    case 2: return A[0]*A[3] - A[1]*A[2];
+    case 3: return A[0]*(A[4]*A[8] - A[5]*A[7])
+              - A[3]*(A[1]*A[8] - A[2]*A[7]) + A[6]*(A[1]*A[5] - A[2]*A[4]);
+    default: {
+      std::vector<scalar_type> B(A, A+N*N);
+      return bgeot::lu_det(&(B[0]), N);
+    }
+    }
+  }
+
+  // Inverse of a small matrix (N = 2 or 3), returns its determinant. The
+  // inverse is not computed for a null determinant.
+  static inline scalar_type small_inverse(const scalar_type *A,
+                                          scalar_type *B, size_type N) {
+    scalar_type det = small_det(A, N);
+    if (det == scalar_type(0)) return det;
+    if (N == 2) {
+      B[0] = A[3]/det; B[1] = -A[1]/det; B[2] = -A[2]/det; B[3] = A[0]/det;
+    } else {
+      for (size_type i = 0; i < 3; ++i)
+        for (size_type j = 0; j < 3; ++j) {
+          size_type i1 = (i+1)%3, i2 = (i+2)%3, j1 = (j+1)%3, j2 = (j+2)%3;
+          B[j+3*i] = (A[i1+3*j1]*A[i2+3*j2] - A[i1+3*j2]*A[i2+3*j1]) / det;
+        }
+    }
+    return det;
+  }
+
+  /* Right Cauchy-Green tensor C = I + 2E, its three invariants and their
+     gradients (fixed size version of compute_invariants).
+  */
+  template <size_type N> struct small_invariants {
+    scalar_type C[N*N], Cinv[N*N], D[3][N*N];
+    scalar_type i1, i2, i3;
+
+    // Symmetrized second derivatives of the second and third invariants
+    scalar_type ddi2(size_type i, size_type j, size_type k,
+                     size_type l) const {
+      return ((i == j && k == l) ? scalar_type(1) : scalar_type(0))
+        - ((i == l && j == k) ? scalar_type(0.5) : scalar_type(0))
+        - ((i == k && j == l) ? scalar_type(0.5) : scalar_type(0));
+    }
+    scalar_type ddi3(size_type i, size_type j, size_type k,
+                     size_type l) const {
+      return i3 / scalar_type(2) *
+        (Cinv[j+N*i]*Cinv[l+N*k] - Cinv[j+N*k]*Cinv[l+N*i]
+         + Cinv[i+N*j]*Cinv[l+N*k] - Cinv[i+N*k]*Cinv[l+N*j]);
+    }
+
+    explicit small_invariants(const scalar_type *E) {
+      for (size_type ij = 0; ij < N*N; ++ij) C[ij] = scalar_type(2) * E[ij];
+      i1 = scalar_type(0);
+      for (size_type i = 0; i < N; ++i) i1 += (C[i*(N+1)] += scalar_type(1));
+      scalar_type trC2(0);
+      for (size_type i = 0; i < N; ++i)
+        for (size_type j = 0; j < N; ++j) trC2 += C[i+N*j] * C[j+N*i];
+      i2 = (i1*i1 - trC2) / scalar_type(2);
+      i3 = small_inverse(C, Cinv, N);
+      if (i3 == scalar_type(0)) std::fill(Cinv, Cinv+N*N, scalar_type(0));
+      for (size_type i = 0; i < N; ++i)
+        for (size_type j = 0; j < N; ++j) {
+          D[0][i+N*j] = (i == j) ? scalar_type(1) : scalar_type(0);
+          D[1][i+N*j] = ((i == j) ? i1 : scalar_type(0)) - C[i+N*j];
+          D[2][i+N*j] = i3 * Cinv[i+N*j];
+        }
+    }
+  };
+
+  /* Kernel of a law given by its strain energy W(i1, i2, i3):
+       sigma = 2 sum_a dW/di_a grad(i_a)
+       grad_sigma = 4 (sum_a dW/di_a grad(grad(i_a))
+                       + sum_ab d^2W/di_a di_b grad(i_a) x grad(i_b))
+     The derivatives of W are given by the structure DER which provides
+     energy(inv, params) and derivatives(inv, params, dW, ddW) (ddW is
+     null if the second derivatives are not needed). If penalized, the
+     energy is 1e200 and 1e200*C is added to sigma for a non positive
+     det_trans. The second derivatives ddW(a,b) are stored in ddW[a+3*b].
+  */
+  template <size_type N, typename DER> struct invariant_law_kernel {
+    DER der;
+    bool penalized;
+
+    void operator()(const scalar_type *E, const scalar_type *params,
+                    scalar_type det_trans, scalar_type *energy,
+                    scalar_type *sigma, scalar_type *grad_sigma) const {
+      small_invariants<N> inv(E);
+      bool penalty = penalized && det_trans <= scalar_type(0);
+      if (energy) *energy = penalty ? 1e200 : der.energy(inv, params);
+      if (!sigma && !grad_sigma) return;
+      scalar_type dW[3], ddW[9];
+      der.derivatives(inv, params, dW, grad_sigma ? ddW : 0);
+
+      if (sigma)
+        for (size_type ij = 0; ij < N*N; ++ij)
+          sigma[ij] = scalar_type(2) * (dW[0] * inv.D[0][ij]
+                                        + dW[1] * inv.D[1][ij]
+                                        + dW[2] * inv.D[2][ij])
+            + (penalty ? 1e200 * inv.C[ij] : scalar_type(0));
+
+      if (grad_sigma) {
+        scalar_type AD[3][N*N]; // AD[a] = sum_b ddW(a,b) grad(i_b)
+        for (size_type a = 0; a < 3; ++a)
+          for (size_type kl = 0; kl < N*N; ++kl)
+            AD[a][kl] = ddW[a]*inv.D[0][kl] + ddW[a+3]*inv.D[1][kl]
+              + ddW[a+6]*inv.D[2][kl];
+        scalar_type *it = grad_sigma;
+        for (size_type l = 0; l < N; ++l)
+          for (size_type k = 0; k < N; ++k)
+            for (size_type j = 0; j < N; ++j)
+              for (size_type i = 0; i < N; ++i, ++it) {
+                size_type ij = i+N*j, kl = k+N*l;
+                *it = scalar_type(4) * (dW[1] * inv.ddi2(i, j, k, l)
+                                        + dW[2] * inv.ddi3(i, j, k, l)
+                                        + inv.D[0][ij] * AD[0][kl]
+                                        + inv.D[1][ij] * AD[1][kl]
+                                        + inv.D[2][ij] * AD[2][kl]);
+              }
+      }
+    }
+
+    invariant_law_kernel(const DER &der_, bool penalized_)
+      : der(der_), penalized(penalized_) {}
+  };
+
+  // Loop of a fixed size kernel on the points of a batch
+  template <size_type N, typename KERNEL>
+  static void kernel_batch(const KERNEL &kernel, size_type nb,
+                           const scalar_type *E, const scalar_type *params,
+                           size_type params_stride,
+                           const scalar_type *det_trans,
+                           scalar_type *energy, scalar_type *sigma,
+                           scalar_type *grad_sigma) {
+    for (size_type k = 0; k < nb; ++k)
+      kernel(E + k*N*N, params + k*params_stride, det_trans[k],
+             energy ? energy + k : 0, sigma ? sigma + k*N*N : 0,
+             grad_sigma ? grad_sigma + k*N*N*N*N : 0);
+  }
+
+
+  // Saint-Venant Kirchhoff law
+  template <size_type N> struct SVK_kernel {
+    void operator()(const scalar_type *E, const scalar_type *p,
+                    scalar_type det_trans, scalar_type *energy,
+                    scalar_type *sigma, scalar_type *grad_sigma) const {
+      scalar_type trE(0);
+      for (size_type i = 0; i < N; ++i) trE += E[i*(N+1)];
+      if (energy) {
+        scalar_type nE(0);
+        for (size_type ij = 0; ij < N*N; ++ij) nE += E[ij] * E[ij];
+        *energy = (det_trans <= scalar_type(0)) ? 1e200
+          : trE * trE * p[0] / scalar_type(2) + nE * p[1];
+      }
+      if (sigma)
+        for (size_type j = 0; j < N; ++j)
+          for (size_type i = 0; i < N; ++i)
+            sigma[i+N*j] = ((i == j) ? p[0] * trE : scalar_type(0))
+              + E[i+N*j] * ((det_trans <= scalar_type(0)) ? 2*p[1] + 1e200
+                                                          : 2*p[1]);
+      if (grad_sigma) {
+        scalar_type *it = grad_sigma;
+        for (size_type l = 0; l < N; ++l)
+          for (size_type k = 0; k < N; ++k)
+            for (size_type j = 0; j < N; ++j)
+              for (size_type i = 0; i < N; ++i, ++it)
+                *it = ((i == j && k == l) ? p[0] : scalar_type(0))
+                  + ((i == k && j == l) ? p[1] : scalar_type(0))
+                  + ((i == l && j == k) ? p[1] : scalar_type(0));
+      }
+    }
+  };
+
+  // Ciarlet-Geymonat law
+  template <size_type N> struct Ciarlet_Geymonat_kernel {
+    void operator()(const scalar_type *E, const scalar_type *p,
+                    scalar_type det_trans, scalar_type *energy,
+                    scalar_type *sigma, scalar_type *grad_sigma) const {
+      scalar_type a = p[2];
+      scalar_type b = p[1]/scalar_type(2) - p[2];
+      scalar_type c = p[0]/scalar_type(4) - p[1]/scalar_type(2) + p[2];
+      scalar_type d = p[0]/scalar_type(2) + p[1];
+      scalar_type C[N*N], Cinv[N*N], trC(0);
+      for (size_type ij = 0; ij < N*N; ++ij) C[ij] = scalar_type(2) * E[ij];
+      for (size_type i = 0; i < N; ++i) trC += (C[i*(N+1)] += scalar_type(1));
+      scalar_type det = small_inverse(C, Cinv, N);
+      if (energy) {
+        if (det_trans <= scalar_type(0)) *energy = 1e200;
+        else {
+          scalar_type nC(0), e = -(scalar_type(3)*(a+b) + c);
+          for (size_type ij = 0; ij < N*N; ++ij) nC += C[ij] * C[ij];
+          *energy = a * trC + b * (trC * trC - nC) / scalar_type(2)
+            + c * det - d * log(det) / scalar_type(2) + e;
+        }
+      }
+      if (sigma) {
+        if (a > p[1]/scalar_type(2)
+            || a < p[1]/scalar_type(2) - p[0]/scalar_type(4) || a < 0)
+          GMM_WARNING1("Inconsistent third parameter for Ciarlet-Geymonat "
+                       "hyperelastic law");
+        bool penalty = (det_trans <= scalar_type(0));
+        scalar_type cinv = scalar_type(2) * c * det - d;
+        for (size_type j = 0; j < N; ++j)
+          for (size_type i = 0; i < N; ++i)
+            sigma[i+N*j] = ((i == j) ? scalar_type(2) * (a + b * trC)
+                                     : scalar_type(0))
+              - scalar_type(2) * b * C[i+N*j]
+              + (penalty ? 1e200 * C[i+N*j] : cinv * Cinv[i+N*j]);
+      }
+      if (grad_sigma) {
+        scalar_type b2 = p[1] - p[2]*scalar_type(2); // b*2
+        scalar_type c1 = d - scalar_type(2)*det*c, c2 = det*c*scalar_type(4);
+        scalar_type *it = grad_sigma;
+        for (size_type l = 0; l < N; ++l)
+          for (size_type k = 0; k < N; ++k)
+            for (size_type j = 0; j < N; ++j)
+              for (size_type i = 0; i < N; ++i, ++it)
+                *it = ((i == j && k == l) ? 2*b2 : scalar_type(0))
+                  - ((i == k && j == l) ? b2 : scalar_type(0))
+                  - ((i == l && j == k) ? b2 : scalar_type(0))
+                  + (Cinv[i+N*k]*Cinv[l+N*j] + Cinv[i+N*l]*Cinv[k+N*j]) * c1
+                  + Cinv[i+N*j] * Cinv[k+N*l] * c2;
+      }
+    }
+  };
+
+  // Derivatives of the strain energy of the Mooney-Rivlin law
+  struct Mooney_Rivlin_derivatives {
+    bool compressible, neohookean;
+
+    template <size_type N> scalar_type
+    energy(const small_invariants<N> &inv, const scalar_type *p) const {
+      scalar_type q = ::pow(gmm::abs(inv.i3), -scalar_type(1)/scalar_type(3));
+      size_type i = 0;
+      scalar_type W = p[i++] * (inv.i1 * q - scalar_type(3));
+      if (!neohookean) W += p[i++] * (inv.i2 * q * q - scalar_type(3));
+      if (compressible)
+        W += p[i++] * gmm::sqr(sqrt(gmm::abs(inv.i3)) - scalar_type(1));
+      return W;
+    }
+
+    template <size_type N>
+    void derivatives(const small_invariants<N> &inv, const scalar_type *p,
+                     scalar_type *dW, scalar_type *ddW) const {
+      scalar_type q = ::pow(gmm::abs(inv.i3), -scalar_type(1)/scalar_type(3));
+      scalar_type C1 = p[0], C2 = neohookean ? scalar_type(0) : p[1];
+      scalar_type D1 = compressible ? p[neohookean ? 1 : 2] : scalar_type(0);
+      scalar_type i3 = inv.i3, s3 = sqrt(gmm::abs(i3));
+      dW[0] = C1 * q;
+      dW[1] = C2 * q * q;
+      dW[2] = - C1 * inv.i1 * q / (scalar_type(3) * i3)
+        - scalar_type(2) * C2 * inv.i2 * q * q / (scalar_type(3) * i3);
+      if (compressible) dW[2] += D1 - D1 / s3;
+      if (ddW) {
+        std::fill(ddW, ddW+9, scalar_type(0));
+        ddW[2] = ddW[6] = - C1 * q / (scalar_type(3) * i3);
+        ddW[5] = ddW[7] = - scalar_type(2) * C2 * q * q / (scalar_type(3) * i3);
+        ddW[8] = (scalar_type(4) * C1 * inv.i1 * q
+                  + scalar_type(10) * C2 * inv.i2 * q * q)
+          / (scalar_type(9) * i3 * i3);
+        if (compressible) ddW[8] += D1 / (scalar_type(2) * s3 * s3 * s3);
+      }
+    }
+  };
+
+  // Derivatives of the strain energy of the Neo-Hookean law
+  struct Neo_Hookean_derivatives {
+    bool bonet;
+
+    template <size_type N> scalar_type
+    energy(const small_invariants<N> &inv, const scalar_type *p) const {
+      scalar_type lambda = p[0], mu = p[1], logi3 = log(inv.i3);
+      scalar_type W = mu/2 * (inv.i1 - scalar_type(3) - logi3);
+      if (bonet)
+        W += lambda/8 * gmm::sqr(logi3);
+      else // Wriggers
+        W += lambda/4 * (inv.i3 - scalar_type(1) - logi3);
+      return W;
+    }
+
+    template <size_type N>
+    void derivatives(const small_invariants<N> &inv, const scalar_type *p,
+                     scalar_type *dW, scalar_type *ddW) const {
+      scalar_type lambda = p[0], mu = p[1], i3 = inv.i3;
+      dW[0] = mu/2; dW[1] = scalar_type(0);
+      if (bonet)
+        dW[2] = (lambda/4 * log(i3) - mu/2) / i3;
+      else
+        dW[2] = lambda/4 - (lambda/4 + mu/2) / i3;
+      if (ddW) {
+        std::fill(ddW, ddW+9, scalar_type(0));
+        if (bonet)
+          ddW[8] = (lambda + 2*mu - lambda * log(i3)) / (4 * i3 * i3);
+        else
+          ddW[8] = (lambda + 2*mu) / (4 * i3 * i3);
+      }
+    }
+  };
+
+  // Derivatives of the strain energy of the generalized Blatz-Ko law
+  struct Blatz_Ko_derivatives {
+
+    template <size_type N> scalar_type
+    energy(const small_invariants<N> &inv, const scalar_type *p) const {
+      return pow(p[0]*inv.i1 + p[1]*sqrt(gmm::abs(inv.i3))
+                 + p[2]*inv.i2 / inv.i3 + p[3], p[4]);
+    }
+
+    template <size_type N>
+    void derivatives(const small_invariants<N> &inv, const scalar_type *p,
+                     scalar_type *dW, scalar_type *ddW) const {
+      scalar_type a = p[0], b = p[1], c = p[2], d = p[3], n = p[4];
+      scalar_type i2 = inv.i2, i3 = inv.i3;
+      scalar_type z = a*inv.i1 + b*sqrt(gmm::abs(i3)) + c*i2 / i3 + d;
+      scalar_type nz = n * pow(z, n-1.);
+      scalar_type y = (b / (2. * sqrt(gmm::abs(i3))) - c * i2 / gmm::sqr(i3));
+      dW[0] = nz * a; dW[1] = nz * c / i3; dW[2] = nz * y;
+      if (ddW) {
+        scalar_type nnz = n * (n-1.) * pow(z, n-2.);
+        ddW[0] = nnz * a * a;
+        ddW[1] = ddW[3] = nnz * a * c / i3;
+        ddW[2] = ddW[6] = nnz * a * y;
+        ddW[4] = nnz * c * c / gmm::sqr(i3);
+        ddW[5] = ddW[7] = nnz * y * c / i3 - nz * c / gmm::sqr(i3);
+        ddW[8] = nnz * y * y + nz * (2. * c * i2 / pow(i3, 3.)
+                                     - b / (4. * pow(i3, 1.5)));
+      }
+    }
+  };
+
+
   /* Member functions of hyperelastic laws */
 
   void abstract_hyperelastic_law::random_E(base_matrix &E) {
@@ -390,6 +729,29 @@ namespace getfem {
             }
   }
 
+  void abstract_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    base_matrix EE(N, N), S(N, N);
+    base_tensor GS(N, N, N, N);
+    base_vector P(nb_params());
+    for (size_type k = 0; k < nb; ++k) {
+      std::copy(E + k*N*N, E + (k+1)*N*N, EE.begin());
+      std::copy(params + k*params_stride,
+                params + k*params_stride + nb_params(), P.begin());
+      if (energy) energy[k] = strain_energy(EE, P, det_trans[k]);
+      if (sigma) {
+        this->sigma(EE, S, P, det_trans[k]);
+        std::copy(S.begin(), S.end(), sigma + k*N*N);
+      }
+      if (grad_sigma) {
+        this->grad_sigma(EE, GS, P, det_trans[k]);
+        std::copy(GS.begin(), GS.end(), grad_sigma + k*N*N*N*N);
+      }
+    }
+  }
+
   scalar_type SaintVenant_Kirchhoff_hyperelastic_law::strain_energy
   (const base_matrix &E, const base_vector &params, scalar_type det_trans) const {
         // should be optimized, maybe deriving sigma from strain energy
@@ -443,6 +805,25 @@ namespace getfem {
             params[1]*(Cinv(i,k)*Cinv(j,l) + Cinv(i,l)*Cinv(j,k)))*mult;
   }
 
+  void SaintVenant_Kirchhoff_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    switch (N) {
+    case 2:
+      kernel_batch<2>(SVK_kernel<2>(), nb, E, params, params_stride, det_trans,
+                      energy, sigma, grad_sigma);
+      break;
+    case 3:
+      kernel_batch<3>(SVK_kernel<3>(), nb, E, params, params_stride, det_trans,
+                      energy, sigma, grad_sigma);
+      break;
+    default: abstract_hyperelastic_law::evaluate_batch
+        (N, nb, E, params, params_stride, det_trans, energy, sigma,
+         grad_sigma);
+    }
+  }
+
   SaintVenant_Kirchhoff_hyperelastic_law::SaintVenant_Kirchhoff_hyperelastic_law() {
     nb_params_ = 2;
   }
@@ -597,6 +978,21 @@ namespace getfem {
 //                 "Fourth order tensor not symmetric : " << result);
   }
 
+  void Mooney_Rivlin_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    if (N == 3) {
+      Mooney_Rivlin_derivatives der = { compressible, neohookean };
+      kernel_batch<3>(invariant_law_kernel<3, Mooney_Rivlin_derivatives>
+                      (der, compressible), nb, E, params, params_stride,
+                      det_trans, energy, sigma, grad_sigma);
+    } else
+      abstract_hyperelastic_law::evaluate_batch
+        (N, nb, E, params, params_stride, det_trans, energy, sigma,
+         grad_sigma);
+  }
+
   Mooney_Rivlin_hyperelastic_law::Mooney_Rivlin_hyperelastic_law
   (bool compressible_, bool neohookean_)
   : compressible(compressible_), neohookean(neohookean_)
@@ -696,6 +1092,21 @@ namespace getfem {
 //                 "Fourth order tensor not symmetric : " << result);
   }
 
+  void Neo_Hookean_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    if (N == 3) {
+      Neo_Hookean_derivatives der = { bonet };
+      kernel_batch<3>(invariant_law_kernel<3, Neo_Hookean_derivatives>
+                      (der, true), nb, E, params, params_stride,
+                      det_trans, energy, sigma, grad_sigma);
+    } else
+      abstract_hyperelastic_law::evaluate_batch
+        (N, nb, E, params, params_stride, det_trans, energy, sigma,
+         grad_sigma);
+  }
+
   Neo_Hookean_hyperelastic_law::Neo_Hookean_hyperelastic_law(bool bonet_)
     : bonet(bonet_)
   {
@@ -808,6 +1219,20 @@ namespace getfem {
 //                 "Fourth order tensor not symmetric : " << result);
   }
 
+  void generalized_Blatz_Ko_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    if (N == 3)
+      kernel_batch<3>(invariant_law_kernel<3, Blatz_Ko_derivatives>
+                      (Blatz_Ko_derivatives(), true), nb, E, params,
+                      params_stride, det_trans, energy, sigma, grad_sigma);
+    else
+      abstract_hyperelastic_law::evaluate_batch
+        (N, nb, E, params, params_stride, det_trans, energy, sigma,
+         grad_sigma);
+  }
+
   generalized_Blatz_Ko_hyperelastic_law::generalized_Blatz_Ko_hyperelastic_law() {
     nb_params_ = 5;
     base_vector V(5);
@@ -891,6 +1316,26 @@ namespace getfem {
   }
 
 
+  void Ciarlet_Geymonat_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    switch (N) {
+    case 2:
+      kernel_batch<2>(Ciarlet_Geymonat_kernel<2>(), nb, E, params, params_stride, det_trans,
+                      energy, sigma, grad_sigma);
+      break;
+    case 3:
+      kernel_batch<3>(Ciarlet_Geymonat_kernel<3>(), nb, E, params, params_stride, det_trans,
+                      energy, sigma, grad_sigma);
+      break;
+    default: abstract_hyperelastic_law::evaluate_batch
+        (N, nb, E, params, params_stride, det_trans, energy, sigma,
+         grad_sigma);
+    }
+  }
+
+
   int levi_civita(int i, int j, int k) {
     int ii=i+1;
     int jj=j+1;
@@ -939,6 +1384,40 @@ namespace getfem {
     result(0,1,1,1) = result3D(0,1,1,1); result(1,1,1,1) = result3D(1,1,1,1);
   }
 
+  void plane_strain_hyperelastic_law::evaluate_batch
+  (size_type N, size_type nb, const scalar_type *E, const scalar_type *params,
+   size_type params_stride, const scalar_type *det_trans,
+   scalar_type *energy, scalar_type *sigma, scalar_type *grad_sigma) const {
+    GMM_ASSERT1(N == 2, "Plane strain law is for 2D only.");
+    const size_type CH = 8; // number of points given at once to the 3D law
+    scalar_type E3D[CH*9], sigma3D[CH*9], grad3D[CH*81];
+    for (size_type k0 = 0; k0 < nb; k0 += CH) {
+      size_type nbk = std::min(CH, nb - k0);
+      std::fill(E3D, E3D + nbk*9, scalar_type(0));
+      for (size_type k = 0; k < nbk; ++k)
+        for (size_type j = 0; j < 2; ++j)
+          for (size_type i = 0; i < 2; ++i)
+            E3D[k*9 + i+3*j] = E[(k0+k)*4 + i+2*j];
+      pl->evaluate_batch(3, nbk, E3D, params + k0*params_stride,
+                         params_stride, det_trans + k0,
+                         energy ? energy + k0 : 0, sigma ? sigma3D : 0,
+                         grad_sigma ? grad3D : 0);
+      for (size_type k = 0; k < nbk; ++k) {
+        if (sigma)
+          for (size_type j = 0; j < 2; ++j)
+            for (size_type i = 0; i < 2; ++i)
+              sigma[(k0+k)*4 + i+2*j] = sigma3D[k*9 + i+3*j];
+        if (grad_sigma)
+          for (size_type l = 0; l < 2; ++l)
+            for (size_type m = 0; m < 2; ++m)
+              for (size_type j = 0; j < 2; ++j)
+                for (size_type i = 0; i < 2; ++i)
+                  grad_sigma[(k0+k)*16 + i+2*(j+2*(m+2*l))]
+                    = grad3D[k*81 + i+3*(j+3*(m+3*l))];
+      }
+    }
+  }
+
 
 
 
@@ -1071,8 +1550,12 @@ namespace getfem {
     double normEz(0);        //norm of ez
     gmm::copy(gmm::identity_matrix(), Id);
     gmm::copy(gmm::identity_matrix(), IdNFem);
-    for (size_type i = 0; i < mf_vm.nb_dof(); ++i) {
-      gmm::resize(gradphi,NFem,N);
+    size_type nbd = mf_vm.nb_dof(), N2 = N*N;
+    if (nbd == 0) return;
+
+    // Second Piola-Kirchhoff stress at all the dofs, in one call to the law
+    model_real_plain_vector EE(nbd*N2), SIGMAHH(nbd*N2), DET(nbd, 1.);
+    for (size_type i = 0; i < nbd; ++i) {
       std::copy(GRAD.begin()+i*NFem*N, GRAD.begin()+(i+1)*NFem*N,
                 gradphit.begin());
       gmm::copy(gmm::transposed(gradphit),gradphi);
@@ -1081,9 +1564,20 @@ namespace getfem {
       gmm::mult(gmm::transposed(gradphi), gradphi, E);
       gmm::add(gmm::scaled(Id, -scalar_type(1)), E);
       gmm::scale(E, scalar_type(1)/scalar_type(2));
-      if (mf_params)
-        gmm::copy(gmm::sub_vector(PARAMS, gmm::sub_interval(i*NP,NP)), p);
-      AHL->sigma(E, sigmahathat, p, scalar_type(1));
+      std::copy(E.begin(), E.end(), EE.begin() + i*N2);
+    }
+    AHL->evaluate_batch(N, nbd, &EE[0], mf_params ? &PARAMS[0] : &p[0],
+                        mf_params ? NP : 0, &DET[0], 0, &SIGMAHH[0], 0);
+
+    for (size_type i = 0; i < nbd; ++i) {
+      gmm::resize(gradphi,NFem,N);
+      std::copy(GRAD.begin()+i*NFem*N, GRAD.begin()+(i+1)*NFem*N,
+                gradphit.begin());
+      gmm::copy(gmm::transposed(gradphit),gradphi);
+      for (unsigned int alpha = 0; alpha <N; ++alpha)
+        gradphi(alpha, alpha)+=1;
+      std::copy(SIGMAHH.begin() + i*N2, SIGMAHH.begin() + (i+1)*N2,
+                sigmahathat.begin());
       if (NFem == 3 && N == 2) {
         //jyh : compute ez, normal on deformed surface
         for (unsigned int l = 0; l <NFem; ++l)  {
@@ -1768,6 +2262,34 @@ namespace getfem {
   };
 
 
+  // Work arrays of the wrappers of the hyperelastic laws, on the stack for
+  // the usual dimensions.
+  struct AHL_work_arrays {
+    scalar_type local[4*9+2*81];
+    base_vector heap;
+    scalar_type *E, *F, *S, *GS, *T;
+    AHL_work_arrays(size_type N) {
+      size_type N2 = N*N, N4 = N2*N2;
+      scalar_type *p = local;
+      if (N > 3) { heap.resize(3*N2+2*N4); p = &heap[0]; }
+      E = p; F = E + N2; S = F + N2; GS = S + N2; T = GS + N4;
+    }
+  };
+
+  // Green-Lagrange strain E = (Grad_u+Grad_u'+Grad_u'Grad_u)/2 and
+  // F = I + Grad_u, returns det(F).
+  static scalar_type AHL_strain(size_type N, const base_tensor &Gu,
+                                scalar_type *E, scalar_type *F) {
+    for (size_type j = 0; j < N; ++j)
+      for (size_type i = 0; i < N; ++i) {
+        scalar_type e = Gu[i+N*j] + Gu[j+N*i];
+        for (size_type k = 0; k < N; ++k) e += Gu[k+N*i] * Gu[k+N*j];
+        E[i+N*j] = scalar_type(0.5) * e;
+        F[i+N*j] = Gu[i+N*j] + ((i == j) ? scalar_type(1) : scalar_type(0));
+      }
+    return bgeot::lu_det(F, N);
+  }
+
   struct AHL_wrapper_sigma : public ga_nonlinear_operator {
     phyperelastic_law AHL;
     bool result_size(const arg_list &args, bgeot::multi_index &sizes) const {
@@ -1781,49 +2303,33 @@ namespace getfem {
     // Value :
     void value(const arg_list &args, base_tensor &result) const {
       size_type N = args[0]->sizes()[0];
-      base_vector params(AHL->nb_params());
-      gmm::copy(args[1]->as_vector(), params);
-      base_matrix Gu(N, N), E(N,N), sigma(N,N);
-      gmm::copy(args[0]->as_vector(), Gu.as_vector());
-      gmm::mult(gmm::transposed(Gu), Gu, E);
-      gmm::add(Gu, E); gmm::add(gmm::transposed(Gu), E);
-      gmm::scale(E, scalar_type(0.5));
-      gmm::add(gmm::identity_matrix(), Gu);
-      scalar_type det = bgeot::lu_det(&(*(Gu.begin())), N);
-
-      AHL->sigma(E, sigma, params, det);
-      gmm::copy(sigma.as_vector(), result.as_vector());
+      AHL_work_arrays w(N);
+      scalar_type det = AHL_strain(N, *(args[0]), w.E, w.F);
+      AHL->evaluate_batch(N, 1, w.E, &((*(args[1]))[0]), 0, &det,
+                          0, &(result[0]), 0);
     }
 
-    // Derivative :
+    // Derivative : sum_m grad_sigma(i,j,m,l) F(k,m)
     void derivative(const arg_list &args, size_type nder,
                     base_tensor &result) const {
       size_type N = args[0]->sizes()[0];
-      base_vector params(AHL->nb_params());
-      gmm::copy(args[1]->as_vector(), params);
-      base_tensor grad_sigma(N, N, N, N);
-      base_matrix Gu(N, N), E(N,N);
-      gmm::copy(args[0]->as_vector(), Gu.as_vector());
-      gmm::mult(gmm::transposed(Gu), Gu, E);
-      gmm::add(Gu, E); gmm::add(gmm::transposed(Gu), E);
-      gmm::scale(E, scalar_type(0.5));
-      gmm::add(gmm::identity_matrix(), Gu);
-      scalar_type det = bgeot::lu_det(&(*(Gu.begin())), N);
-
       GMM_ASSERT1(nder == 1, "Sorry, the derivative of this hyperelastic "
                   "law with respect to its parameters is not available.");
+      AHL_work_arrays w(N);
+      scalar_type det = AHL_strain(N, *(args[0]), w.E, w.F);
+      AHL->evaluate_batch(N, 1, w.E, &((*(args[1]))[0]), 0, &det,
+                          0, 0, w.GS);
 
-      AHL->grad_sigma(E, grad_sigma, params, det);
-
+      size_type N2 = N*N;
       base_tensor::iterator it = result.begin();
       for (size_type l = 0; l < N; ++l)
         for (size_type k = 0; k < N; ++k)
-          for (size_type j = 0; j < N; ++j)
-            for (size_type i = 0; i < N; ++i, ++it) {
-              *it = scalar_type(0);
-              for (size_type m = 0; m < N; ++m)
-                *it += grad_sigma(i,j,m,l) * Gu(k, m); // to be optimized
-            }
+          for (size_type ij = 0; ij < N2; ++ij, ++it) {
+            scalar_type a(0);
+            for (size_type m = 0; m < N; ++m)
+              a += w.GS[ij + N2*(m+N*l)] * w.F[k+N*m];
+            *it = a;
+          }
       GMM_ASSERT1(it == result.end(), "Internal error");
     }
 
@@ -1852,78 +2358,65 @@ namespace getfem {
     // Value :
     void value(const arg_list &args, base_tensor &result) const {
       size_type N = args[0]->sizes()[0];
-      base_vector params(AHL->nb_params());
-      gmm::copy(args[1]->as_vector(), params);
-      base_matrix Gu(N, N), E(N,N);
-      gmm::copy(args[0]->as_vector(), Gu.as_vector());
-      gmm::mult(gmm::transposed(Gu), Gu, E);
-      gmm::add(Gu, E); gmm::add(gmm::transposed(Gu), E);
-      gmm::scale(E, scalar_type(0.5));
-      gmm::add(gmm::identity_matrix(), Gu);
-      scalar_type det = bgeot::lu_det(&(*(Gu.begin())), N); // not necessary here
-
-      result[0] = AHL->strain_energy(E, params, det);
+      AHL_work_arrays w(N);
+      scalar_type det = AHL_strain(N, *(args[0]), w.E, w.F);
+      AHL->evaluate_batch(N, 1, w.E, &((*(args[1]))[0]), 0, &det,
+                          &(result[0]), 0, 0);
     }
 
-    // Derivative :
+    // Derivative : F sigma
     void derivative(const arg_list &args, size_type nder,
                     base_tensor &result) const {
       size_type N = args[0]->sizes()[0];
-      base_vector params(AHL->nb_params());
-      gmm::copy(args[1]->as_vector(), params);
-      base_matrix Gu(N, N), E(N,N), sigma(N,N);
-      gmm::copy(args[0]->as_vector(), Gu.as_vector());
-      gmm::mult(gmm::transposed(Gu), Gu, E);
-      gmm::add(Gu, E); gmm::add(gmm::transposed(Gu), E);
-      gmm::scale(E, scalar_type(0.5));
-      gmm::add(gmm::identity_matrix(), Gu);
-      scalar_type det = bgeot::lu_det(&(*(Gu.begin())), N); // not necessary here
-
       GMM_ASSERT1(nder == 1, "Sorry, Cannot derive the potential with "
                   "respect to law parameters.");
+      AHL_work_arrays w(N);
+      scalar_type det = AHL_strain(N, *(args[0]), w.E, w.F);
+      AHL->evaluate_batch(N, 1, w.E, &((*(args[1]))[0]), 0, &det,
+                          0, w.S, 0);
 
-      AHL->sigma(E, sigma, params, det);
-      gmm::mult(Gu, sigma, E);
-      gmm::copy(E.as_vector(), result.as_vector());
+      base_tensor::iterator it = result.begin();
+      for (size_type j = 0; j < N; ++j)
+        for (size_type i = 0; i < N; ++i, ++it) {
+          scalar_type a(0);
+          for (size_type m = 0; m < N; ++m) a += w.F[i+N*m] * w.S[m+N*j];
+          *it = a;
+        }
     }
 
 
     // Second derivative :
+    // delta_ik sigma(l,j) + sum_mn grad_sigma(n,j,m,l) F(k,m) F(i,n)
     void second_derivative(const arg_list &args, size_type nder1,
                            size_type nder2, base_tensor &result) const {
-
       size_type N = args[0]->sizes()[0];
-      base_vector params(AHL->nb_params());
-      gmm::copy(args[1]->as_vector(), params);
-      base_tensor grad_sigma(N, N, N, N);
-      base_matrix Gu(N, N), E(N,N), sigma(N,N);
-      gmm::copy(args[0]->as_vector(), Gu.as_vector());
-      gmm::mult(gmm::transposed(Gu), Gu, E);
-      gmm::add(Gu, E); gmm::add(gmm::transposed(Gu), E);
-      gmm::scale(E, scalar_type(0.5));
-      gmm::add(gmm::identity_matrix(), Gu);
-      scalar_type det = bgeot::lu_det(&(*(Gu.begin())), N);
-
       GMM_ASSERT1(nder1 == 1 && nder2 == 1, "Sorry, Cannot derive the "
                   "potential with respect to law parameters.");
-
-      AHL->sigma(E, sigma, params, det);
-      AHL->grad_sigma(E, grad_sigma, params, det);
+      AHL_work_arrays w(N);
+      scalar_type det = AHL_strain(N, *(args[0]), w.E, w.F);
+      AHL->evaluate_batch(N, 1, w.E, &((*(args[1]))[0]), 0, &det,
+                          0, w.S, w.GS);
+
+      // T(i,j,m,l) = sum_n F(i,n) grad_sigma(n,j,m,l)
+      size_type N2 = N*N;
+      for (size_type jml = 0; jml < N2*N; ++jml)
+        for (size_type i = 0; i < N; ++i) {
+          scalar_type a(0);
+          for (size_type n = 0; n < N; ++n) a += w.F[i+N*n] * w.GS[n+N*jml];
+          w.T[i+N*jml] = a;
+        }
 
       base_tensor::iterator it = result.begin();
       for (size_type l = 0; l < N; ++l)
         for (size_type k = 0; k < N; ++k)
           for (size_type j = 0; j < N; ++j)
             for (size_type i = 0; i < N; ++i, ++it) {
-              *it = scalar_type(0);
-              if (i == k) *it += sigma(l,j);
-
-              for (size_type m = 0; m < N; ++m) // to be optimized
-                for (size_type n = 0; n < N; ++n)
-                  *it += grad_sigma(n,j,m,l) * Gu(k, m) * Gu(i, n);
+              scalar_type a = (i == k) ? w.S[l+N*j] : scalar_type(0);
+              for (size_type m = 0; m < N; ++m)
+                a += w.T[i+N*(j+N*(m+N*l))] * w.F[k+N*m];
+              *it = a;
             }
       GMM_ASSERT1(it == result.end(), "Internal error");
-
     }
 
     AHL_wrapper_potential(const phyperelastic_law &A) : AHL(A) {}
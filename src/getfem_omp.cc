@@ -53,6 +53,20 @@ namespace getfem{
     return local_guard{mutex};
   }
 
+  std::shared_lock<std::shared_timed_mutex>
+  shared_lock_factory::get_shared_lock() const {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if (me_is_multithreaded_now()) lock.lock();
+    return lock;
+  }
+
+  std::unique_lock<std::shared_timed_mutex>
+  shared_lock_factory::get_unique_lock() const {
+    std::unique_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if (me_is_multithreaded_now()) lock.lock();
+    return lock;
+  }
+
   size_type global_thread_policy::this_thread() {
     return partition_master::get().get_current_partition();
   }
@@ -459,6 +459,147 @@ namespace getfem {
   // Von Mises projection
   //=================================================================
 
+  // Projection of a N x N tensor tau: the deviatoric part of tau is
+  // projected on the ball of radius s. The size is fixed for NN != 0.
+  template <size_type NN> struct Von_Mises_projection_kernel {
+    size_type N_;
+    scalar_type buf[NN ? NN*NN : 1];
+    std::vector<scalar_type> heap;
+    scalar_type *tau_D, tau_m, norm_tau_D;
+
+    size_type dim() const { return NN ? NN : N_; }
+
+    void init(const scalar_type *tau) {
+      const size_type N = dim();
+      tau_m = scalar_type(0);
+      for (size_type i = 0; i < N; ++i) tau_m += tau[i*(N+1)];
+      tau_m /= scalar_type(N);
+      norm_tau_D = scalar_type(0);
+      for (size_type ij = 0; ij < N*N; ++ij) {
+        tau_D[ij] = tau[ij];
+        if (ij % (N+1) == 0) tau_D[ij] -= tau_m;
+        norm_tau_D += tau_D[ij] * tau_D[ij];
+      }
+      norm_tau_D = sqrt(norm_tau_D);
+    }
+
+    // tau_m Id + tau_D min(1, s/|tau_D|)
+    void value(const scalar_type *tau, scalar_type s,
+               scalar_type *res) const {
+      const size_type N = dim();
+      if (norm_tau_D > s) {
+        scalar_type a = s / norm_tau_D;
+        for (size_type ij = 0; ij < N*N; ++ij)
+          res[ij] = a * tau_D[ij] + ((ij % (N+1) == 0) ? tau_m : 0.);
+      } else
+        std::copy(tau, tau + N*N, res);
+    }
+
+    // s (Id - n x n)(Id - Id x Id / N) / |tau_D| + Id x Id / N
+    // with n = tau_D / |tau_D|
+    void grad(scalar_type s, scalar_type *res) const {
+      const size_type N = dim(), N2 = N*N;
+      std::fill(res, res + N2*N2, scalar_type(0));
+      if (norm_tau_D <= s) {
+        for (size_type ij = 0; ij < N2; ++ij) res[ij*(N2+1)] = 1.;
+      } else {
+        scalar_type a = s / norm_tau_D, b = a / (norm_tau_D * norm_tau_D);
+        scalar_type c = (scalar_type(1) - a) / scalar_type(N);
+        for (size_type mn = 0; mn < N2; ++mn) {
+          scalar_type *r = res + mn*N2;
+          for (size_type ij = 0; ij < N2; ++ij)
+            r[ij] = -b * tau_D[ij] * tau_D[mn];
+          r[mn] += a;
+          if (mn % (N+1) == 0)
+            for (size_type i = 0; i < N; ++i) r[i*(N+1)] += c;
+        }
+      }
+    }
+
+    // Derivative with respect to s : tau_D / |tau_D| if |tau_D| >= s
+    void grad_threshold(scalar_type s, scalar_type *res) const {
+      const size_type N = dim();
+      if (norm_tau_D < s)
+        std::fill(res, res + N*N, scalar_type(0));
+      else {
+        scalar_type a = (norm_tau_D != scalar_type(0))
+          ? scalar_type(1) / norm_tau_D : scalar_type(1);
+        for (size_type ij = 0; ij < N*N; ++ij) res[ij] = a * tau_D[ij];
+      }
+    }
+
+    Von_Mises_projection_kernel(size_type N) : N_(N) {
+      if (NN) tau_D = buf; else { heap.resize(N*N); tau_D = &heap[0]; }
+    }
+  };
+
+  enum { VM_PROJ_VALUE, VM_PROJ_GRAD, VM_PROJ_GRAD_THRESHOLD };
+
+  template <size_type NN>
+  static void Von_Mises_projection_points
+  (size_type N, size_type nb, const scalar_type *tau, const scalar_type *s,
+   size_type s_stride, scalar_type *res, int what) {
+    Von_Mises_projection_kernel<NN> k(N);
+    size_type N2 = N*N, rsize = (what == VM_PROJ_GRAD) ? N2*N2 : N2;
+    for (size_type i = 0; i < nb; ++i, tau += N2, s += s_stride,
+           res += rsize) {
+      k.init(tau);
+      switch (what) {
+      case VM_PROJ_VALUE: k.value(tau, *s, res); break;
+      case VM_PROJ_GRAD:  k.grad(*s, res); break;
+      default:            k.grad_threshold(*s, res); break;
+      }
+    }
+  }
+
+  static void Von_Mises_projection_points
+  (size_type N, size_type nb, const scalar_type *tau, const scalar_type *s,
+   size_type s_stride, scalar_type *res, int what) {
+    switch (N) {
+    case 1: Von_Mises_projection_points<1>(N,nb,tau,s,s_stride,res,what);
+      break;
+    case 2: Von_Mises_projection_points<2>(N,nb,tau,s,s_stride,res,what);
+      break;
+    case 3: Von_Mises_projection_points<3>(N,nb,tau,s,s_stride,res,what);
+      break;
+    default: Von_Mises_projection_points<0>(N,nb,tau,s,s_stride,res,what);
+    }
+  }
+
+  void abstract_constraints_projection::do_projection_batch
+  (size_type N, size_type nb, const scalar_type *tau,
+   const scalar_type *stress_threshold, size_type threshold_stride,
+   scalar_type *proj, size_type flag_proj) const {
+    base_matrix t(N, N), p;
+    for (size_type i = 0; i < nb; ++i) {
+      std::copy(tau + i*N*N, tau + (i+1)*N*N, t.begin());
+      do_projection(t, stress_threshold[i*threshold_stride], p, flag_proj);
+      std::copy(p.begin(), p.end(), proj);
+      proj += p.size();
+    }
+  }
+
+  void VM_projection::do_projection_batch
+  (size_type N, size_type nb, const scalar_type *tau,
+   const scalar_type *stress_threshold, size_type threshold_stride,
+   scalar_type *proj, size_type flag_proj) const {
+    if (flag_hyp != 0) {
+      abstract_constraints_projection::do_projection_batch
+        (N, nb, tau, stress_threshold, threshold_stride, proj, flag_proj);
+      return;
+    }
+    GMM_ASSERT1(flag_proj == 0 || flag_proj ==1,
+                "wrong value for the projection flag, must be 0 or 1 ");
+    for (size_type i = 0; i < nb; ++i)
+      GMM_ASSERT1(stress_threshold[i*threshold_stride] >= 0.,
+                  "s is not a positive number "
+                  << stress_threshold[i*threshold_stride]
+                  << ". You need to set s as a positive number");
+    Von_Mises_projection_points(N, nb, tau, stress_threshold,
+                                threshold_stride, proj,
+                                flag_proj ? VM_PROJ_GRAD : VM_PROJ_VALUE);
+  }
+
 
   struct Von_Mises_projection_operator : public ga_nonlinear_operator {
     bool result_size(const arg_list &args, bgeot::multi_index &sizes) const {
@@ -474,67 +615,19 @@ namespace getfem {
     // Value:
     void value(const arg_list &args, base_tensor &result) const {
       size_type N = (args[0]->sizes().size() == 2) ? args[0]->sizes()[0] : 1;
-      base_matrix tau(N, N), tau_D(N, N);
-      gmm::copy(args[0]->as_vector(), tau.as_vector());
-      scalar_type s = (*(args[1]))[0];
-
-      scalar_type tau_m = gmm::mat_trace(tau) / scalar_type(N);
-      gmm::copy(tau, tau_D);
-      for (size_type i = 0; i < N; ++i) tau_D(i,i) -= tau_m;
-
-      scalar_type norm_tau_D = gmm::mat_euclidean_norm(tau_D);
-
-      if (norm_tau_D > s) gmm::scale(tau_D, s / norm_tau_D);
-
-      for (size_type i = 0; i < N; ++i) tau_D(i,i) += tau_m;
-
-      gmm::copy(tau_D.as_vector(), result.as_vector());
+      Von_Mises_projection_points(N, 1, &((*(args[0]))[0]),
+                                  &((*(args[1]))[0]), 0, &(result[0]),
+                                  VM_PROJ_VALUE);
     }
 
     // Derivative:
     void derivative(const arg_list &args, size_type nder,
                     base_tensor &result) const {
       size_type N = (args[0]->sizes().size() == 2) ? args[0]->sizes()[0] : 1;
-      base_matrix tau(N, N), tau_D(N, N);
-      gmm::copy(args[0]->as_vector(), tau.as_vector());
-      scalar_type s = (*(args[1]))[0];
-      scalar_type tau_m = gmm::mat_trace(tau) / scalar_type(N);
-      gmm::copy(tau, tau_D);
-      for (size_type i = 0; i < N; ++i) tau_D(i,i) -= tau_m;
-      scalar_type norm_tau_D = gmm::mat_euclidean_norm(tau_D);
-
-      if (norm_tau_D != scalar_type(0))
-        gmm::scale(tau_D, scalar_type(1)/norm_tau_D);
-
-      switch(nder) {
-      case 1:
-        if (norm_tau_D <= s) {
-          gmm::clear(result.as_vector());
-          for (size_type i = 0; i < N; ++i)
-            for (size_type j = 0; j < N; ++j)
-              result(i,j,i,j) = scalar_type(1);
-        } else {
-          for (size_type i = 0; i < N; ++i)
-            for (size_type j = 0; j < N; ++j)
-              for (size_type m = 0; m < N; ++m)
-                for (size_type n = 0; n < N; ++n)
-                  result(i,j,m,n)
-                    = s * (-tau_D(i,j) * tau_D(m,n)
-                           + ((i == m && j == n) ? scalar_type(1) : scalar_type(0))
-                           - ((i == j && m == n) ? scalar_type(1)/scalar_type(N)
-                              : scalar_type(0))) / norm_tau_D;
-          for (size_type i = 0; i < N; ++i)
-            for (size_type j = 0; j < N; ++j)
-              result(i,i,j,j) += scalar_type(1)/scalar_type(N);
-        }
-        break;
-      case 2:
-        if (norm_tau_D < s)
-          gmm::clear(result.as_vector());
-        else
-          gmm::copy(tau_D.as_vector(), result.as_vector());
-        break;
-      }
+      Von_Mises_projection_points(N, 1, &((*(args[0]))[0]),
+                                  &((*(args[1]))[0]), 0, &(result[0]),
+                                  (nder == 1) ? VM_PROJ_GRAD
+                                  : VM_PROJ_GRAD_THRESHOLD);
     }
 
     // Second derivative : not implemented
@@ -1816,9 +1909,14 @@ namespace getfem {
       fem_interpolation_context
         ctx_u(pgt, pfp_u, size_type(-1), G, cv, short_type(-1));
 
-      size_type qdim = mf_u.get_qdim();
+      size_type qdim = mf_u.get_qdim(), q2 = qdim*qdim;
       base_matrix G_du(qdim, qdim), G_u_np1(qdim, qdim); // G_du = G_u_np1 - G_u_n
 
+      // sigma_hat and the thresholds on all the sigma dofs, then the
+      // projections are computed at once
+      model_real_plain_vector sigma_hat(q2*nbd_sigma), thresholds(nbd_sigma);
+      model_real_plain_vector elastic_np1(option == PLAST ? q2*nbd_sigma : 0);
+
       for (size_type ii = 0; ii < nbd_sigma; ++ii) {
 
         if (pmf_data) {
@@ -1840,43 +1938,50 @@ namespace getfem {
 
         // Compute sigma_hat = D*(eps_np1 - eps_n) + sigma_n
         // where D represents the elastic stiffness tensor
-        base_matrix sigma_hat(qdim, qdim);
+        scalar_type *sh = &sigma_hat[ii*q2];
         size_type sigma_dof = mf_sigma.ind_basic_dof_of_element(cv)[ii*qdim_sigma];
         for (dim_type j = 0; j < qdim; ++j) {
           for (dim_type i = 0; i < qdim; ++i)
-            sigma_hat(i,j) = Sigma_n[sigma_dof++]
-                             + params[1]*(G_du(i,j) + G_du(j,i));
-          sigma_hat(j,j) += ltrace_deps;
+            sh[i+qdim*j] = Sigma_n[sigma_dof++]
+                           + params[1]*(G_du(i,j) + G_du(j,i));
+          sh[j*(qdim+1)] += ltrace_deps;
         }
+        thresholds[ii] = params[2];
 
-        // Compute the projection or its grad
-        base_matrix proj;
-        t_proj.do_projection(sigma_hat, params[2], proj, flag_proj);
+        // D*eps_np1, subtracted from the projection for the plastic part
+        if (option == PLAST) {
+          scalar_type *en = &elastic_np1[ii*q2];
+          for (dim_type j = 0; j < qdim; ++j) {
+            for (dim_type i = 0; i < qdim; ++i)
+              en[i+qdim*j] = params[1]*(G_u_np1(i,j) + G_u_np1(j,i));
+            en[j*(qdim+1)] += ltrace_eps_np1;
+          }
+        }
+      } // ii = 0:nbd_sigma-1
+
+      // Compute the projection or its grad and fill in convex_coeffs
+      if (nbd_sigma)
+        t_proj.do_projection_batch(qdim, nbd_sigma, &sigma_hat[0],
+                                   &thresholds[0], 1, &convex_coeffs[0],
+                                   flag_proj);
+
+      for (size_type ii = 0; ii < nbd_sigma; ++ii) {
+        scalar_type *proj = &convex_coeffs[size_proj*ii];
 
         // Compute the plastic part if required
         if (option == PLAST)
-          for (dim_type i = 0; i < qdim; ++i) {
-            for (dim_type j = 0; j < qdim; ++j)
-              proj(i,j) -= params[1]*(G_u_np1(i,j) + G_u_np1(j,i));
-            proj(i,i) -= ltrace_eps_np1;
-          }
-
-        // Fill in convex_coeffs with sigma or its grad
-        std::copy(proj.begin(), proj.end(),
-                  convex_coeffs.begin() + proj.size() * ii);
+          for (size_type ij = 0; ij < q2; ++ij)
+            proj[ij] -= elastic_np1[ii*q2+ij];
 
         // Store the projected or plastic sigma
         if (store_sigma) {
-          sigma_dof = mf_sigma.ind_basic_dof_of_element(cv)[ii*qdim_sigma];
-          for (dim_type j = 0; j < qdim; ++j) {
-            for (dim_type i = 0; i < qdim; ++i) {
-              cumulated_count[sigma_dof] += 1;
-              cumulated_sigma[sigma_dof++] += proj(i,j);
-            }
+          size_type sigma_dof = mf_sigma.ind_basic_dof_of_element(cv)[ii*qdim_sigma];
+          for (size_type ij = 0; ij < q2; ++ij) {
+            cumulated_count[sigma_dof] += 1;
+            cumulated_sigma[sigma_dof++] += proj[ij];
           }
         }
-
-      } // ii = 0:nbd_sigma-1
+      }
 
     }
 
@@ -24,6 +24,20 @@
 
 namespace getfem
 {
+  /* Insertion of the convexes of a regular mesh, given by their point
+     indices convex after convex. They are distinct from each other, so
+     they are inserted in bulk, unless the mesh had already some convexes
+     that they could duplicate. */
+  static void add_regular_convexes(mesh &me, bgeot::pgeometric_trans pgt,
+                                   const std::vector<size_type> &cnx,
+                                   bool was_empty) {
+    size_type nbp = pgt->nb_points(), nb = cnx.size() / nbp;
+    if (was_empty) me.add_convexes_noverif(pgt, nb, cnx.begin());
+    else
+      for (size_type i = 0; i < nb; ++i)
+        me.add_convex(pgt, cnx.begin() + i*nbp);
+  }
+
   void parallelepiped_regular_simplex_mesh_
   (mesh &me, dim_type N, const base_node &org,
    const base_small_vector *ivect, const size_type *iref) {
@@ -50,8 +64,9 @@ namespace getfem
     // bgeot::simplexify(cvt, sl, pararef.points(), N, me.eps());
 
     size_type nbs = sl.nb_convex();
-    std::vector<size_type> tab1(N+1), tab(N), tab3(nbpt);
+    std::vector<size_type> tab(N), tab3(nbpt), cnx;
     size_type total = 0;
+    bool was_empty = (me.nb_convex() == 0);
     std::fill(tab.begin(), tab.end(), 0);
     while (tab[N-1] != iref[N-1]) {
       for (a = org, i = 0; i < N; i++)
@@ -64,10 +79,9 @@ namespace getfem
       for (i = 0; i < nbs; i++) {
         const mesh::ind_cv_ct &tab2 = sl.ind_points_of_convex(i);
         for (dim_type l = 0; l <= N; l++)
-          // tab1[l] = tab3[tab2[l]];
-          tab1[l] = tab3[(tab2[l]
-                          + (((total & 1) && N != 3) ? (nbpt/2) : 0)) % nbpt];
-        me.add_simplex(N, tab1.begin());
+          // cnx.push_back(tab3[tab2[l]]);
+          cnx.push_back(tab3[(tab2[l]
+                        + (((total & 1) && N != 3) ? (nbpt/2) : 0)) % nbpt]);
       }
 
       for (dim_type l = 0; l < N; l++) {
@@ -76,6 +90,7 @@ namespace getfem
         else break;
       }
     }
+    add_regular_convexes(me, bgeot::simplex_geotrans(N, 1), cnx, was_empty);
   }
 
 
@@ -116,8 +131,9 @@ namespace getfem
       pararef.points()[i] = a;
     }
 
-    std::vector<size_type> tab1(N+1), tab(N), tab3(nbpt);
+    std::vector<size_type> tab(N), cnx;
     size_type total = 0;
+    bool was_empty = (me.nb_convex() == 0);
     std::fill(tab.begin(), tab.end(), 0);
     while (tab[N-1] != iref[N-1]) {
       for (a = org, i = 0; i < N; i++)
@@ -125,10 +141,7 @@ namespace getfem
       //a.addmul(scalar_type(tab[i]), ivect[i]);
 
       for (i = 0; i < nbpt; i++)
-        tab3[i] = me.add_point(a + pararef.points()[i]);
-      me.add_convex(linear_gt ?
-                    bgeot::parallelepiped_linear_geotrans(N) :
-                    bgeot::parallelepiped_geotrans(N, 1), tab3.begin());
+        cnx.push_back(me.add_point(a + pararef.points()[i]));
 
       for (dim_type l = 0; l < N; l++) {
         tab[l]++; total++;
@@ -136,6 +149,9 @@ namespace getfem
         else break;
       }
     }
+    add_regular_convexes(me, linear_gt ?
+                         bgeot::parallelepiped_linear_geotrans(N) :
+                         bgeot::parallelepiped_geotrans(N, 1), cnx, was_empty);
   }
 
   void parallelepiped_regular_pyramid_mesh_
@@ -264,24 +280,27 @@ namespace getfem
 
     m.clear();
     /* build a mesh with a geotrans of degree K */
+    std::vector<size_type> cnx;
+    cnx.reserve(msh.nb_convex() * pgt->nb_points());
     for (dal::bv_visitor cv(msh.convex_index()); !cv.finished(); ++cv) {
       if (pgt == msh.trans_of_convex(cv)) {
-        m.add_convex_by_points(msh.trans_of_convex(cv),
-                               msh.points_of_convex(cv).begin());
+        for (const base_node &pt : msh.points_of_convex(cv))
+          cnx.push_back(m.add_point(pt));
       } else {
-        std::vector<base_node> pts(pgt->nb_points());
         for (size_type i=0; i < pgt->nb_points(); ++i) {
-          pts[i] = msh.trans_of_convex(cv)->transform
+          base_node pt = msh.trans_of_convex(cv)->transform
             (pgt->convex_ref()->points()[i], msh.points_of_convex(cv));
+          cnx.push_back(m.add_point(pt));
         }
-        m.add_convex_by_points(pgt, pts.begin());
       }
     }
+    add_regular_convexes(m, pgt, cnx, true);
 
     /* apply a continuous deformation + some noise */
     if (noised) noise_unit_mesh(m, nsubdiv, pgt);
 
     m.optimize_structure(false);
+    m.build_face_adjacency();
   }
 
 
@@ -35,13 +35,27 @@
    @date July 8, 2003.
    @brief Input/output on sparse matrices
 
-   Support Harwell-Boeing and Matrix-Market formats.
+   Support Harwell-Boeing and Matrix-Market formats, and a binary
+   storage of compressed sparse matrices.
 */
 #ifndef GMM_INOUTPUT_H
 #define GMM_INOUTPUT_H
 
 #include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <exception>
 #include "gmm_kernel.h"
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+#if !defined(_WIN32)
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <fcntl.h>
+# include <unistd.h>
+#endif
 namespace gmm {
 
   /*************************************************************************/
@@ -1021,6 +1035,18 @@ namespace gmm {
     void open(const char *filename);
     /* read opened file */
     template <typename Matrix> void read(Matrix &A);
+    /* read opened file, the parsing of the entries being shared between
+       nb_threads OpenMP threads (0 : the default number of threads). The
+       chunks are parsed in turn when OpenMP is not enabled. The compressed
+       matrices are directly built from the list of entries. */
+    template <typename Matrix> void read_parallel(Matrix &A,
+                                                  unsigned nb_threads = 0);
+    template <typename T, typename IND_TYPE, int shift>
+    void read_parallel(csc_matrix<T, IND_TYPE, shift> &A,
+                       unsigned nb_threads = 0);
+    template <typename T, typename IND_TYPE, int shift>
+    void read_parallel(csr_matrix<T, IND_TYPE, shift> &A,
+                       unsigned nb_threads = 0);
     /* write a matrix */
     template <typename T, typename IND_TYPE, int shift> static void 
     write(const char *filename, const csc_matrix<T, IND_TYPE, shift>& A);  
@@ -1029,8 +1055,67 @@ namespace gmm {
 	  const csc_matrix_ref<T*, INDI*, INDJ*, shift>& A);  
     template <typename MAT> static void 
     write(const char *filename, const MAT& A);  
+
+  private:
+    template <typename Matrix, typename T>
+    void fill_(Matrix &A, const std::vector<int> &II,
+               const std::vector<int> &J, const std::vector<T> &PR) const;
+    template <typename T>
+    void read_entries_(std::vector<int> &II, std::vector<int> &J,
+                       std::vector<T> &PR, unsigned nb_threads);
+    template <typename T>
+    void expand_entries_(std::vector<int> &II, std::vector<int> &J,
+                         std::vector<T> &PR) const;
   };
 
+  /* Compressed storage (jc, ir, pr) of a list of 0-based entries
+     (outer[k], inner[k], val[k]), with outer the column index for a CSC
+     storage and the row index for a CSR one. The entries of each outer
+     index are sorted and, for duplicated entries, the last one is kept. */
+  template <typename T, typename IND_TYPE, int shift, typename IND2>
+  void compress_entries__(size_type nouter, size_type ninner,
+                          const std::vector<IND2> &outer,
+                          const std::vector<IND2> &inner,
+                          const std::vector<T> &val, std::vector<T> &pr,
+                          std::vector<IND_TYPE> &ir,
+                          std::vector<IND_TYPE> &jc) {
+    size_type nz = val.size();
+    std::vector<size_type> cnt(ninner+1, 0), perm1(nz), perm2(nz);
+    for (size_type k = 0; k < nz; ++k) {
+      GMM_ASSERT1(size_type(outer[k]) < nouter && size_type(inner[k]) < ninner,
+                  "Index out of range");
+      ++cnt[size_type(inner[k])+1];
+    }
+    for (size_type i = 0; i < ninner; ++i) cnt[i+1] += cnt[i];
+    for (size_type k = 0; k < nz; ++k) perm1[cnt[size_type(inner[k])]++] = k;
+    cnt.assign(nouter+1, 0);
+    for (size_type k = 0; k < nz; ++k) ++cnt[size_type(outer[k])+1];
+    for (size_type i = 0; i < nouter; ++i) cnt[i+1] += cnt[i];
+    for (size_type l = 0; l < nz; ++l)
+      perm2[cnt[size_type(outer[perm1[l]])]++] = perm1[l];
+
+    jc.resize(nouter+1); pr.resize(nz); ir.resize(nz);
+    size_type p = 0, l = 0;
+    for (size_type o = 0; o < nouter; ++o) {
+      size_type start = p;
+      jc[o] = IND_TYPE(p + shift);
+      for (; l < cnt[o]; ++l) {
+        size_type k = perm2[l];
+        IND_TYPE i = IND_TYPE(size_type(inner[k]) + shift);
+        if (p > start && ir[p-1] == i) pr[p-1] = val[k];
+        else { ir[p] = i; pr[p] = val[k]; ++p; }
+      }
+    }
+    jc[nouter] = IND_TYPE(p + shift);
+    pr.resize(p); ir.resize(p);
+  }
+
+  template <typename T> inline T mm_make_value__(double re, double, T)
+  { return T(re); }
+  template <typename T> inline std::complex<T>
+  mm_make_value__(double re, double im, std::complex<T>)
+  { return std::complex<T>(T(re), T(im)); }
+
   /** load a matrix-market file */
   template <typename Matrix> inline void
   MatrixMarket_load(const char *filename, Matrix& A) {
@@ -1049,6 +1134,15 @@ namespace gmm {
     MatrixMarket_IO mm; mm.write(filename, A);
   }
 
+  /** load a matrix-market file, the entries being parsed by several
+      threads (see MatrixMarket_IO::read_parallel) */
+  template <typename Matrix> inline void
+  MatrixMarket_load_parallel(const char *filename, Matrix& A,
+                             unsigned nb_threads = 0) {
+    MatrixMarket_IO mm; mm.open(filename);
+    mm.read_parallel(A, nb_threads);
+  }
+
 
   inline void MatrixMarket_IO::open(const char *filename) {
     gmm::standard_locale sl;
@@ -1080,14 +1174,20 @@ namespace gmm {
 		"Bad MM matrix format (complex matrix expected)");
     GMM_ASSERT1(is_complex_double__(T()) || !isComplex,
 		"Bad MM matrix format (real matrix expected)");
-    A = Matrix(row, col);
-    gmm::clear(A);
     
     std::vector<int> II(nz), J(nz);
     std::vector<typename Matrix::value_type> PR(nz);
     mm_read_mtx_crd_data(f, row, col, nz, &II[0], &J[0],
 			 (double*)&PR[0], matcode);
-    
+    fill_(A, II, J, PR);
+  }
+
+  template <typename Matrix, typename T>
+  void MatrixMarket_IO::fill_(Matrix &A, const std::vector<int> &II,
+                              const std::vector<int> &J,
+                              const std::vector<T> &PR) const {
+    A = Matrix(row, col);
+    gmm::clear(A);
     for (size_type i = 0; i < size_type(nz); ++i) {
         A(II[i]-1, J[i]-1) = PR[i];
 
@@ -1106,6 +1206,144 @@ namespace gmm {
     }
   }
 
+  template <typename T>
+  void MatrixMarket_IO::read_entries_(std::vector<int> &II,
+                                      std::vector<int> &J,
+                                      std::vector<T> &PR,
+                                      unsigned nb_threads) {
+    GMM_ASSERT1(f, "no file opened!");
+    GMM_ASSERT1(!is_complex_double__(T()) || isComplex,
+		"Bad MM matrix format (complex matrix expected)");
+    GMM_ASSERT1(is_complex_double__(T()) || !isComplex,
+		"Bad MM matrix format (real matrix expected)");
+    
+    /* the remaining of the file is loaded in memory and split in chunks
+       of complete lines, each chunk being parsed by an OpenMP thread. */
+    long pos = ftell(f);
+    GMM_ASSERT1(pos >= 0 && fseek(f, 0, SEEK_END) == 0, "Cannot seek");
+    long end = ftell(f);
+    GMM_ASSERT1(end >= pos && fseek(f, pos, SEEK_SET) == 0, "Cannot seek");
+    size_type len = size_type(end - pos);
+    std::vector<char> buf(len+1);
+    GMM_ASSERT1(fread(&buf[0], 1, len, f) == len, "Read error");
+    buf[len] = 0;
+    const char *b = &buf[0];
+
+    if (nb_threads == 0) {
+#ifdef _OPENMP
+      nb_threads = unsigned(omp_get_max_threads());
+#else
+      nb_threads = 1;
+#endif
+    }
+    nb_threads = std::max(1U, std::min(nb_threads, unsigned(len/65536 + 1)));
+    std::vector<size_type> bounds(nb_threads+1);
+    bounds[0] = 0; bounds[nb_threads] = len;
+    for (unsigned t = 1; t < nb_threads; ++t) {
+      size_type p = std::max(bounds[t-1], (len * t) / nb_threads);
+      while (p > 0 && p < len && b[p-1] != '\n') ++p;
+      bounds[t] = p;
+    }
+
+    std::vector<std::vector<int> > IIs(nb_threads), Js(nb_threads);
+    std::vector<std::vector<T> > PRs(nb_threads);
+    std::vector<std::exception_ptr> errors(nb_threads);
+    bool cplx = isComplex;
+    auto parse = [&](unsigned t) {
+      try {
+        const char *p = b + bounds[t], *e = b + bounds[t+1];
+        size_type nzt = size_type(nz) * (bounds[t+1]-bounds[t]) / (len+1);
+        IIs[t].reserve(nzt+16); Js[t].reserve(nzt+16); PRs[t].reserve(nzt+16);
+        while (p < e) {
+          if (isspace((unsigned char)(*p))) { ++p; continue; }
+          if (*p == '%') { while (p < e && *p != '\n') ++p; continue; }
+          char *q;
+          long i = strtol(p, &q, 10);
+          GMM_ASSERT1(q != p, "Bad MM matrix entry"); p = q;
+          long j = strtol(p, &q, 10);
+          GMM_ASSERT1(q != p, "Bad MM matrix entry"); p = q;
+          double re = strtod(p, &q), im = 0.;
+          GMM_ASSERT1(q != p, "Bad MM matrix entry"); p = q;
+          if (cplx) {
+            im = strtod(p, &q);
+            GMM_ASSERT1(q != p, "Bad MM matrix entry"); p = q;
+          }
+          GMM_ASSERT1(i >= 1 && i <= row && j >= 1 && j <= col,
+                      "MM matrix entry out of range");
+          IIs[t].push_back(int(i)); Js[t].push_back(int(j));
+          PRs[t].push_back(mm_make_value__(re, im, T()));
+        }
+      } catch (...) { errors[t] = std::current_exception(); }
+    };
+#ifdef _OPENMP
+#   pragma omp parallel for num_threads(nb_threads) schedule(static, 1)
+#endif
+    for (int t = 0; t < int(nb_threads); ++t) parse(unsigned(t));
+    for (unsigned t = 0; t < nb_threads; ++t)
+      if (errors[t]) std::rethrow_exception(errors[t]);
+
+    II.resize(0); J.resize(0); PR.resize(0);
+    II.reserve(nz); J.reserve(nz); PR.reserve(nz);
+    for (unsigned t = 0; t < nb_threads; ++t) {
+      II.insert(II.end(), IIs[t].begin(), IIs[t].end());
+      J.insert(J.end(), Js[t].begin(), Js[t].end());
+      PR.insert(PR.end(), PRs[t].begin(), PRs[t].end());
+    }
+    GMM_ASSERT1(II.size() == size_type(nz), "Bad number of entries in MM "
+                "file (" << II.size() << " instead of " << nz << ")");
+  }
+
+  /* 0-based entries, the symmetric part being added */
+  template <typename T>
+  void MatrixMarket_IO::expand_entries_(std::vector<int> &II,
+                                        std::vector<int> &J,
+                                        std::vector<T> &PR) const {
+    size_type n = II.size();
+    for (size_type k = 0; k < n; ++k) { --II[k]; --J[k]; }
+    if (isSymmetric) {
+      for (size_type k = 0; k < n; ++k)
+        if (II[k] != J[k]) {
+          II.push_back(J[k]); J.push_back(II[k]);
+          PR.push_back(isHermitian ? gmm::conj(PR[k]) : PR[k]);
+        }
+    }
+  }
+
+  template <typename Matrix>
+  void MatrixMarket_IO::read_parallel(Matrix &A, unsigned nb_threads) {
+    gmm::standard_locale sl;
+    std::vector<int> II, J;
+    std::vector<typename linalg_traits<Matrix>::value_type> PR;
+    read_entries_(II, J, PR, nb_threads);
+    fill_(A, II, J, PR);
+  }
+
+  template <typename T, typename IND_TYPE, int shift>
+  void MatrixMarket_IO::read_parallel(csc_matrix<T, IND_TYPE, shift> &A,
+                                      unsigned nb_threads) {
+    gmm::standard_locale sl;
+    std::vector<int> II, J;
+    std::vector<T> PR;
+    read_entries_(II, J, PR, nb_threads);
+    expand_entries_(II, J, PR);
+    compress_entries__<T, IND_TYPE, shift>(col, row, J, II, PR,
+                                           A.pr, A.ir, A.jc);
+    A.nr = row; A.nc = col;
+  }
+
+  template <typename T, typename IND_TYPE, int shift>
+  void MatrixMarket_IO::read_parallel(csr_matrix<T, IND_TYPE, shift> &A,
+                                      unsigned nb_threads) {
+    gmm::standard_locale sl;
+    std::vector<int> II, J;
+    std::vector<T> PR;
+    read_entries_(II, J, PR, nb_threads);
+    expand_entries_(II, J, PR);
+    compress_entries__<T, IND_TYPE, shift>(row, col, II, J, PR,
+                                           A.pr, A.ir, A.jc);
+    A.nr = row; A.nc = col;
+  }
+
   template <typename T, typename IND_TYPE, int shift> void 
   MatrixMarket_IO::write(const char *filename, const csc_matrix<T, IND_TYPE, shift>& A) {
     write(filename, csc_matrix_ref<const T*, const unsigned*,
@@ -1144,12 +1382,420 @@ namespace gmm {
     MatrixMarket_IO::write(filename, tmp);
   }
 
+  /*************************************************************************/
+  /*                                                                       */
+  /*  Binary storage of compressed sparse matrices.                        */
+  /*                                                                       */
+  /*************************************************************************/
+
+  /** Header of a binary sparse matrix file. It is followed by the three
+      arrays of the compressed storage, jc (nrows+1 indices for a CSR
+      storage, ncols+1 for a CSC one), ir (nnz indices) and pr (nnz
+      values), each array starting at a multiple of 8 bytes. The data are
+      written in the byte order of the machine (checked at load time with
+      the endian field). For a symmetric or hermitian matrix, only the lower
+      triangular part is stored.
+  */
+  struct binary_sparse_header {
+    char magic[8];          /* "GMMSPBIN"                              */
+    uint32_type version;    /* 1                                       */
+    uint32_type endian;     /* 0x01020304                              */
+    uint32_type storage;    /* BINARY_SPARSE_CSR or BINARY_SPARSE_CSC  */
+    uint32_type value_type; /* see binary_sparse_value_code            */
+    uint32_type index_size; /* size of the indices in bytes (4 or 8)   */
+    int32_type shift;       /* 0 for C indices, 1 for Fortran indices  */
+    uint32_type symmetry;   /* BINARY_SPARSE_GENERAL, _SYMMETRIC, ...  */
+    uint32_type reserved;
+    uint64_type nrows, ncols, nnz;
+  };
+
+  enum { BINARY_SPARSE_CSR = 0, BINARY_SPARSE_CSC = 1 };
+  enum { BINARY_SPARSE_GENERAL = 0, BINARY_SPARSE_SYMMETRIC = 1,
+         BINARY_SPARSE_HERMITIAN = 2 };
+
+  template <typename T> struct binary_sparse_value_code {};
+  template <> struct binary_sparse_value_code<float>
+  { enum { value = 1, size = 4 }; };
+  template <> struct binary_sparse_value_code<double>
+  { enum { value = 2, size = 8 }; };
+  template <> struct binary_sparse_value_code<std::complex<float> >
+  { enum { value = 3, size = 8 }; };
+  template <> struct binary_sparse_value_code<std::complex<double> >
+  { enum { value = 4, size = 16 }; };
+
+  inline size_type binary_sparse_align__(size_type s)
+  { return (s + 7) & ~size_type(7); }
+
+  /** Binary input/output of compressed sparse matrices (CSR or CSC).
+
+      open() maps the file in memory (with mmap when available, the file
+      is read otherwise) and csr_ref() / csc_ref() give a zero-copy access
+      to the stored matrix, which remains valid until the file is closed
+      or another one is opened. read() copies the matrix into any gmm
+      matrix (the lower triangular part of symmetric matrices being
+      expanded).
+  */
+  class binary_sparse_IO {
+    binary_sparse_header h;
+    const char *data;
+    size_type size_;
+    void *map;
+    std::vector<uint64_type> buffer; // when the file is not mapped
+
+    size_type nouter() const
+    { return size_type(h.storage == BINARY_SPARSE_CSR ? h.nrows : h.ncols); }
+    size_type jc_offset() const
+    { return binary_sparse_align__(sizeof(binary_sparse_header)); }
+    size_type ir_offset() const
+    { return jc_offset() + binary_sparse_align__((nouter()+1)*h.index_size); }
+    size_type pr_offset() const {
+      return ir_offset()
+        + binary_sparse_align__(size_type(h.nnz)*h.index_size);
+    }
+    template <typename T, typename IND_TYPE> void check_types_(int shift) const {
+      GMM_ASSERT1(data, "no file opened!");
+      GMM_ASSERT1(h.value_type == binary_sparse_value_code<T>::value,
+                  "Bad value type for the stored matrix");
+      GMM_ASSERT1(h.index_size == sizeof(IND_TYPE),
+                  "Bad index type for the stored matrix");
+      GMM_ASSERT1(h.shift == shift, "Bad index shift for the stored matrix");
+    }
+    /* jc non decreasing from shift to nnz+shift, ir within bounds */
+    template <typename IND> bool valid_indices_() const {
+      const IND *ir = reinterpret_cast<const IND *>(data + ir_offset());
+      const IND *jc = reinterpret_cast<const IND *>(data + jc_offset());
+      size_type no = nouter(), s = size_type(h.shift);
+      size_type ni = is_csr() ? ncols() : nrows();
+      if (size_type(jc[0]) != s || size_type(jc[no]) != nnz() + s)
+        return false;
+      for (size_type o = 0; o < no; ++o)
+        if (jc[o+1] < jc[o]) return false;
+      for (size_type k = 0; k < nnz(); ++k)
+        if (size_type(ir[k]) < s || size_type(ir[k]) - s >= ni) return false;
+      return true;
+    }
+    template <typename T, typename IND>
+    void entries_(std::vector<size_type> &II, std::vector<size_type> &J,
+                  std::vector<T> &PR) const;
+    template <typename T, typename IND_TYPE>
+    static void write_(const char *filename, uint32_type storage,
+                       size_type nr, size_type nc, const std::vector<T> &pr,
+                       const std::vector<IND_TYPE> &ir,
+                       const std::vector<IND_TYPE> &jc, int shift,
+                       int symmetry);
+
+  public:
+    size_type nrows() const { return size_type(h.nrows); }
+    size_type ncols() const { return size_type(h.ncols); }
+    size_type nnz() const { return size_type(h.nnz); }
+    bool is_csr() const { return h.storage == BINARY_SPARSE_CSR; }
+    bool is_csc() const { return h.storage == BINARY_SPARSE_CSC; }
+    bool is_symmetric() const { return h.symmetry != BINARY_SPARSE_GENERAL; }
+    bool is_hermitian() const { return h.symmetry == BINARY_SPARSE_HERMITIAN; }
+    bool is_mapped() const { return map != 0; }
+    const binary_sparse_header &header() const { return h; }
+
+    /* open and map filename, and check its header */
+    void open(const char *filename);
+    void close();
+
+    /* zero-copy access to the stored matrix (the value type, index type
+       and shift have to be the ones of the file). */
+    template <typename T, typename IND_TYPE = unsigned int, int shift = 0>
+    csr_matrix_ref<const T *, const IND_TYPE *, const IND_TYPE *, shift>
+    csr_ref() const {
+      check_types_<T, IND_TYPE>(shift);
+      GMM_ASSERT1(is_csr(), "The stored matrix is not in CSR format");
+      return csr_matrix_ref<const T *, const IND_TYPE *, const IND_TYPE *,
+                            shift>
+        (reinterpret_cast<const T *>(data + pr_offset()),
+         reinterpret_cast<const IND_TYPE *>(data + ir_offset()),
+         reinterpret_cast<const IND_TYPE *>(data + jc_offset()),
+         nrows(), ncols());
+    }
+    template <typename T, typename IND_TYPE = unsigned int, int shift = 0>
+    csc_matrix_ref<const T *, const IND_TYPE *, const IND_TYPE *, shift>
+    csc_ref() const {
+      check_types_<T, IND_TYPE>(shift);
+      GMM_ASSERT1(is_csc(), "The stored matrix is not in CSC format");
+      return csc_matrix_ref<const T *, const IND_TYPE *, const IND_TYPE *,
+                            shift>
+        (reinterpret_cast<const T *>(data + pr_offset()),
+         reinterpret_cast<const IND_TYPE *>(data + ir_offset()),
+         reinterpret_cast<const IND_TYPE *>(data + jc_offset()),
+         nrows(), ncols());
+    }
+
+    /* copy of the stored matrix */
+    template <typename MAT> void read(MAT &A) const;
+    template <typename T, typename IND_TYPE, int shift>
+    void read(csr_matrix<T, IND_TYPE, shift> &A) const;
+    template <typename T, typename IND_TYPE, int shift>
+    void read(csc_matrix<T, IND_TYPE, shift> &A) const;
+
+    /* write a matrix. For symmetric (or hermitian) matrices, only the
+       lower triangular part is stored. */
+    template <typename T, typename IND_TYPE, int shift> static void
+    write(const char *filename, const csr_matrix<T, IND_TYPE, shift> &A,
+          int symmetry = BINARY_SPARSE_GENERAL)
+    { write_(filename, BINARY_SPARSE_CSR, A.nr, A.nc, A.pr, A.ir, A.jc,
+             shift, symmetry); }
+    template <typename T, typename IND_TYPE, int shift> static void
+    write(const char *filename, const csc_matrix<T, IND_TYPE, shift> &A,
+          int symmetry = BINARY_SPARSE_GENERAL)
+    { write_(filename, BINARY_SPARSE_CSC, A.nr, A.nc, A.pr, A.ir, A.jc,
+             shift, symmetry); }
+    template <typename MAT> static void
+    write(const char *filename, const MAT &A,
+          int symmetry = BINARY_SPARSE_GENERAL) {
+      csr_matrix<typename linalg_traits<MAT>::value_type> tmp;
+      tmp.init_with(A);
+      write(filename, tmp, symmetry);
+    }
+
+    binary_sparse_IO() : data(0), size_(0), map(0) { memset(&h, 0, sizeof(h)); }
+    binary_sparse_IO(const char *filename) : data(0), size_(0), map(0)
+    { memset(&h, 0, sizeof(h)); open(filename); }
+    binary_sparse_IO(const binary_sparse_IO &) = delete;
+    binary_sparse_IO &operator =(const binary_sparse_IO &) = delete;
+    ~binary_sparse_IO() { close(); }
+  };
+
+  inline void binary_sparse_IO::close() {
+#if !defined(_WIN32)
+    if (map) munmap(map, size_);
+#endif
+    map = 0; data = 0; size_ = 0;
+    buffer = std::vector<uint64_type>();
+    memset(&h, 0, sizeof(h));
+  }
+
+  inline void binary_sparse_IO::open(const char *filename) {
+    close();
+#if !defined(_WIN32)
+    int fd = ::open(filename, O_RDONLY);
+    GMM_ASSERT1(fd >= 0, "Sorry, cannot open file " << filename);
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+      { ::close(fd); GMM_ASSERT1(false, "Cannot read file " << filename); }
+    size_ = size_type(st.st_size);
+    void *p = mmap(0, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED)
+      { size_ = 0; GMM_ASSERT1(false, "Cannot map file " << filename); }
+    map = p;
+    data = static_cast<const char *>(p);
+#else
+    FILE *f;
+    SECURE_FOPEN(&f, filename, "rb");
+    GMM_ASSERT1(f, "Sorry, cannot open file " << filename);
+    fseek(f, 0, SEEK_END); long l = ftell(f); fseek(f, 0, SEEK_SET);
+    size_ = (l > 0) ? size_type(l) : 0;
+    buffer.resize((size_+7)/8);
+    size_type nread = size_ ? fread(&buffer[0], 1, size_, f) : 0;
+    fclose(f);
+    GMM_ASSERT1(size_ && nread == size_, "Cannot read file " << filename);
+    data = reinterpret_cast<const char *>(&buffer[0]);
+#endif
+    bool ok = (size_ >= sizeof(binary_sparse_header));
+    if (ok) memcpy(&h, data, sizeof(binary_sparse_header));
+    ok = ok && (memcmp(h.magic, "GMMSPBIN", 8) == 0);
+    if (!ok)
+      { close(); GMM_ASSERT1(false, filename << " is not a binary sparse "
+                             "matrix file"); }
+    std::stringstream err;
+    if (h.endian != 0x01020304) err << "bad byte order";
+    else if (h.version != 1) err << "unsupported version " << h.version;
+    else if (h.storage > BINARY_SPARSE_CSC) err << "bad storage";
+    else if (h.index_size != 4 && h.index_size != 8) err << "bad index size";
+    else if (h.value_type < 1 || h.value_type > 4) err << "bad value type";
+    else if (h.shift != 0 && h.shift != 1) err << "bad index shift";
+    else if (h.symmetry > BINARY_SPARSE_HERMITIAN
+             || (h.symmetry != BINARY_SPARSE_GENERAL && h.nrows != h.ncols))
+      err << "bad symmetry";
+    else if (nouter() >= size_ || h.nnz >= size_)
+      err << "truncated file"; // also prevents overflows below
+    else {
+      static const size_type vsizes[5] = { 0, 4, 8, 8, 16 };
+      if (size_ < pr_offset() + size_type(h.nnz) * vsizes[h.value_type])
+        err << "truncated file";
+      else if (!(h.index_size == 4 ? valid_indices_<uint32_type>()
+                 : valid_indices_<uint64_type>()))
+        err << "bad indices";
+    }
+    if (err.str().size())
+      { close(); GMM_ASSERT1(false, "File " << filename << ": " << err.str()); }
+  }
+
+  /* 0-based entries of the stored matrix, with the symmetric part */
+  template <typename T, typename IND>
+  void binary_sparse_IO::entries_(std::vector<size_type> &II,
+                                  std::vector<size_type> &J,
+                                  std::vector<T> &PR) const {
+    GMM_ASSERT1(h.value_type == binary_sparse_value_code<T>::value,
+                "Bad value type for the stored matrix");
+    const T *pr = reinterpret_cast<const T *>(data + pr_offset());
+    const IND *ir = reinterpret_cast<const IND *>(data + ir_offset());
+    const IND *jc = reinterpret_cast<const IND *>(data + jc_offset());
+    size_type no = nouter(), nz = nnz(), s = size_type(h.shift);
+    size_type nzs = is_symmetric() ? 2*nz : nz;
+    II.resize(0); J.resize(0); PR.resize(0);
+    II.reserve(nzs); J.reserve(nzs); PR.reserve(nzs);
+    for (size_type o = 0; o < no; ++o)
+      for (size_type k = size_type(jc[o]) - s; k < size_type(jc[o+1]) - s;
+           ++k) {
+        size_type i = size_type(ir[k]) - s, j = o;
+        if (is_csr()) std::swap(i, j);
+        II.push_back(i); J.push_back(j); PR.push_back(pr[k]);
+        if (is_symmetric() && i != j) {
+          II.push_back(j); J.push_back(i);
+          PR.push_back(is_hermitian() ? gmm::conj(pr[k]) : pr[k]);
+        }
+      }
+  }
+
+  template <typename MAT> void binary_sparse_IO::read(MAT &A) const {
+    typedef typename linalg_traits<MAT>::value_type T;
+    GMM_ASSERT1(data, "no file opened!");
+    csc_matrix<T> tmp;
+    read(tmp);
+    A = MAT(nrows(), ncols());
+    gmm::clear(A);
+    gmm::copy(tmp, A);
+  }
+
+  template <typename T, typename IND_TYPE, int shift>
+  void binary_sparse_IO::read(csr_matrix<T, IND_TYPE, shift> &A) const {
+    GMM_ASSERT1(data, "no file opened!");
+    std::vector<size_type> II, J;
+    std::vector<T> PR;
+    if (h.index_size == 4) entries_<T, uint32_type>(II, J, PR);
+    else entries_<T, uint64_type>(II, J, PR);
+    compress_entries__<T, IND_TYPE, shift>(nrows(), ncols(), II, J, PR,
+                                           A.pr, A.ir, A.jc);
+    A.nr = nrows(); A.nc = ncols();
+  }
+
+  template <typename T, typename IND_TYPE, int shift>
+  void binary_sparse_IO::read(csc_matrix<T, IND_TYPE, shift> &A) const {
+    GMM_ASSERT1(data, "no file opened!");
+    std::vector<size_type> II, J;
+    std::vector<T> PR;
+    if (h.index_size == 4) entries_<T, uint32_type>(II, J, PR);
+    else entries_<T, uint64_type>(II, J, PR);
+    compress_entries__<T, IND_TYPE, shift>(ncols(), nrows(), J, II, PR,
+                                           A.pr, A.ir, A.jc);
+    A.nr = nrows(); A.nc = ncols();
+  }
+
+  inline void binary_sparse_write_block__(FILE *f, const void *p,
+                                          size_type n) {
+    static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    GMM_ASSERT1(n == 0 || fwrite(p, 1, n, f) == n, "Write error");
+    size_type pad = binary_sparse_align__(n) - n;
+    GMM_ASSERT1(pad == 0 || fwrite(zeros, 1, pad, f) == pad, "Write error");
+  }
+
+  template <typename T, typename IND_TYPE>
+  void binary_sparse_IO::write_(const char *filename, uint32_type storage,
+                                size_type nr, size_type nc,
+                                const std::vector<T> &pr,
+                                const std::vector<IND_TYPE> &ir,
+                                const std::vector<IND_TYPE> &jc, int shift,
+                                int symmetry) {
+    size_type no = (storage == BINARY_SPARSE_CSR) ? nr : nc;
+    const std::vector<T> *ppr = &pr;
+    const std::vector<IND_TYPE> *pir = &ir, *pjc = &jc;
+    std::vector<T> pr2;
+    std::vector<IND_TYPE> ir2, jc2;
+    if (symmetry != BINARY_SPARSE_GENERAL) { // lower triangular part only
+      GMM_ASSERT1(nr == nc, "A symmetric matrix should be square");
+      jc2.resize(no+1);
+      for (size_type o = 0; o < no; ++o) {
+        jc2[o] = IND_TYPE(ir2.size() + size_type(shift));
+        for (size_type k = size_type(jc[o]) - size_type(shift);
+             k < size_type(jc[o+1]) - size_type(shift); ++k) {
+          size_type i = size_type(ir[k]) - size_type(shift);
+          if ((storage == BINARY_SPARSE_CSR) ? (i <= o) : (i >= o))
+            { ir2.push_back(ir[k]); pr2.push_back(pr[k]); }
+        }
+      }
+      jc2[no] = IND_TYPE(ir2.size() + size_type(shift));
+      ppr = &pr2; pir = &ir2; pjc = &jc2;
+    }
+
+    binary_sparse_header h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "GMMSPBIN", 8);
+    h.version = 1; h.endian = 0x01020304;
+    h.storage = storage;
+    h.value_type = binary_sparse_value_code<T>::value;
+    h.index_size = uint32_type(sizeof(IND_TYPE));
+    h.shift = int32_type(shift);
+    h.symmetry = uint32_type(symmetry);
+    // the arrays of the shifted storages have shift extra entries
+    size_type nz = size_type((*pjc)[no]) - size_type(shift);
+    h.nrows = nr; h.ncols = nc; h.nnz = nz;
+
+    FILE *f;
+    SECURE_FOPEN(&f, filename, "wb");
+    GMM_ASSERT1(f, "Sorry, cannot open file " << filename);
+    try {
+      binary_sparse_write_block__(f, &h, sizeof(h));
+      binary_sparse_write_block__(f, pjc->data(), (no+1)*sizeof(IND_TYPE));
+      binary_sparse_write_block__(f, pir->data(), nz*sizeof(IND_TYPE));
+      binary_sparse_write_block__(f, ppr->data(), nz*sizeof(T));
+    } catch (...) { fclose(f); throw; }
+    GMM_ASSERT1(fclose(f) == 0, "Write error on " << filename);
+  }
+
+  /** write a binary sparse matrix file */
+  template <typename MAT> inline void
+  binary_sparse_save(const char *filename, const MAT &A,
+                     int symmetry = BINARY_SPARSE_GENERAL)
+  { binary_sparse_IO::write(filename, A, symmetry); }
+
+  /** load a binary sparse matrix file (copy) */
+  template <typename MAT> inline void
+  binary_sparse_load(const char *filename, MAT &A)
+  { binary_sparse_IO bio(filename); bio.read(A); }
+
+  /* binary output of a vector, directly from its storage when it is
+     contiguous */
+  template <typename T> inline void
+  vecsave_binary__(std::ofstream &f, const std::vector<T> &V) {
+    if (V.size())
+      f.write(reinterpret_cast<const char*>(&V[0]),
+              std::streamsize(V.size() * sizeof(T)));
+  }
+  template <typename VEC> inline void
+  vecsave_binary__(std::ofstream &f, const VEC &V) {
+    for (size_type i=0; i < gmm::vect_size(V); ++i) {
+      typename linalg_traits<VEC>::value_type v = V[i];
+      f.write(reinterpret_cast<const char*>(&v), sizeof(v));
+    }
+  }
+
+  template <typename T> inline void
+  vecload_binary__(std::ifstream &f, std::vector<T> &V) {
+    if (V.size())
+      f.read(reinterpret_cast<char*>(&V[0]),
+             std::streamsize(V.size() * sizeof(T)));
+  }
+  template <typename VEC> inline void
+  vecload_binary__(std::ifstream &f, VEC &V) {
+    for (size_type i=0; i < gmm::vect_size(V); ++i) {
+      typename linalg_traits<VEC>::value_type v;
+      f.read(reinterpret_cast<char*>(&v), sizeof(v));
+      V[i] = v;
+    }
+  }
+
   template<typename VEC> static void vecsave(std::string fname, const VEC& V,
                                              bool binary=false, std::string Vformat="") {
     if (binary) {
       std::ofstream f(fname.c_str(), std::ofstream::binary);
-      for (size_type i=0; i < gmm::vect_size(V); ++i)
-        f.write(reinterpret_cast<const char*>(&V[i]), sizeof(V[i]));
+      vecsave_binary__(f, V);
     }
     else {
       if (Vformat.empty()){
@@ -1170,8 +1816,7 @@ namespace gmm {
     VEC &V(const_cast<VEC&>(V_));
     if (binary) {
       std::ifstream f(fname.c_str(), std::ifstream::binary);
-      for (size_type i=0; i < gmm::vect_size(V); ++i)
-        f.read(reinterpret_cast<char*>(&V[i]), sizeof(V[i]));
+      vecload_binary__(f, V);
     }
     else {
       std::ifstream f(fname.c_str()); f.imbue(std::locale("C"));
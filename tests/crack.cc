@@ -899,6 +899,54 @@ void crack_problem::compute_sif(const plain_vector &U) {
   }
 }
 
+/**************************************************************************/
+/*  Check of the values of the singular functions computed on the whole   */
+/*  convexes and stored by the fem against their pointwise evaluation.    */
+/**************************************************************************/
+
+bool check_global_function_cache(const getfem::mesh_fem &mf,
+				 const getfem::mesh_im &mim) {
+  const getfem::mesh &m = mf.linked_mesh();
+  getfem::pfem pf = 0;
+  scalar_type err = 0;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (dal::bv_visitor cv(mim.convex_index()); !cv.finished(); ++cv) {
+      if (!mf.convex_index().is_in(cv)) continue;
+      pf = mf.fem_of_element(cv);
+      if (pf->nb_dof(cv) == 0) continue;
+      getfem::papprox_integration pai
+	= mim.int_method_of_element(cv)->approx_method();
+      getfem::pfem_precomp pfp
+	= getfem::fem_precomp(pf, pai->pintegration_points(),
+			      mim.int_method_of_element(cv));
+      base_matrix G;
+      bgeot::vectors_to_base_matrix(G, m.points_of_convex(cv));
+      getfem::fem_interpolation_context
+	ctx1(m.trans_of_convex(cv), pfp, 0, G, cv),
+	ctx2(m.trans_of_convex(cv), pf, pai->point(0), G, cv);
+      getfem::base_tensor t1, t2;
+      for (size_type k = 0; k < pai->nb_points(); ++k) {
+	ctx1.set_ii(k); ctx2.set_xref(pai->point(k));
+	pf->real_base_value(ctx1, t1); pf->real_base_value(ctx2, t2);
+	err = std::max(err, gmm::vect_dist2(t1.as_vector(), t2.as_vector()));
+	pf->real_grad_base_value(ctx1, t1); pf->real_grad_base_value(ctx2, t2);
+	err = std::max(err, gmm::vect_dist2(t1.as_vector(), t2.as_vector()));
+      }
+    }
+    // The second pass is done with a small cache, to check the eviction.
+    auto pgf = std::dynamic_pointer_cast<const getfem::fem_global_function>(pf);
+    if (!pgf) return true;
+    getfem::fem_global_function::precomp_statistics
+      st = pgf->cache_statistics();
+    cout << "cache of the singular functions: " << st.nb_hits << " hits, "
+	 << st.nb_misses << " misses, " << st.nb_evictions << " evictions, "
+	 << st.memory << " bytes" << endl;
+    if (pass == 0) pgf->set_cache_memory_limit(st.memory / 4);
+  }
+  cout << "cache error : " << err << endl;
+  return (err < 1E-10);
+}
+
 /**************************************************************************/
 /*  main program.                                                         */
 /**************************************************************************/
@@ -920,6 +968,9 @@ int main(int argc, char *argv[]) {
 
     plain_vector U(p.mf_u().nb_dof());
     if (!p.solve(U)) GMM_ASSERT1(false, "Solve has failed");
+    if (p.enrichment_option != crack_problem::NO_ENRICHMENT)
+      GMM_ASSERT1(check_global_function_cache(p.mf_sing_u, p.mim),
+		  "Wrong cached values of the singular functions");
 
     p.compute_sif(U);
     
@@ -283,7 +283,7 @@ bool heat_equation_problem::solve(void) {
     standard_solve(model, iter);
   }
 
-  for (scalar_type t = 0.; t < T; t += dt) {
+  auto time_step = [&](scalar_type t) {
     sol_t = t+dt;
     
     gmm::resize(F, mf_rhs.nb_dof()*N);
@@ -305,6 +305,27 @@ bool heat_equation_problem::solve(void) {
     }
     
     model.shift_variables_for_time_integration();
+  };
+
+  // Checkpoints in the middle of the computation, the second one being
+  // an incremental one.
+  std::vector<scalar_type> times;
+  for (scalar_type t = 0.; t < T; t += dt) times.push_back(t);
+  size_type chk = times.size() / 2;
+  std::string chkname = datafilename + "_checkpoint_";
+  for (size_type i = 0; i < times.size(); ++i) {
+    time_step(times[i]);
+    if (chk > 1 && i+2 == chk) model.save_checkpoint(chkname + "0.gfb");
+    if (chk > 1 && i+1 == chk) model.save_checkpoint(chkname + "1.gfb", true);
+  }
+
+  // Restart from the checkpoint, the same solution should be obtained.
+  if (chk > 1) {
+    plain_vector U1 = U;
+    model.load_checkpoint(chkname + "1.gfb");
+    for (size_type i = chk; i < times.size(); ++i) time_step(times[i]);
+    GMM_ASSERT1(gmm::vect_dist2(U, U1) <= 1E-10 * gmm::vect_norm2(U1),
+                "Restart from checkpoint failed");
   }
 
   return (iter.converged());
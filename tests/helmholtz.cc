@@ -243,6 +243,15 @@ int main(int argc, char *argv[]) {
     vtu_exp.exporting(sl);
     vtu_exp.write_point_data(p.mf_u, gmm::real_part(U), "helmholtz_rfield");
     vtu_exp.write_point_data(p.mf_u, gmm::imag_part(U), "helmholtz_ifield");
+    cout << "export to " << p.datafilename + ".pvtu" << "..\n";
+    {
+      getfem::pvtu_export pvtu_exp(p.datafilename, true);
+      pvtu_exp.exporting(p.mf_u, 2);
+      pvtu_exp.write_point_data(p.mf_u, gmm::real_part(U),"helmholtz_rfield");
+      pvtu_exp.write_point_data(p.mf_u, gmm::imag_part(U),"helmholtz_ifield");
+    }
+    getfem::pvd_export pvd_exp(p.datafilename + ".pvd");
+    pvd_exp.add_dataset(p.datafilename + ".pvtu", 0.0);
     cout << "export done, you can view the data file with (for example)\n"
       "mayavi2 -d helmholtz.vtk -f WarpScalar -m Surface -m Outline"
       "\n";
@@ -446,6 +446,30 @@ static void print_some_methods() {
   print_method(getfem::classical_approx_im(bgeot::product_geotrans(bgeot::product_geotrans(bgeot::simplex_geotrans(2,2), bgeot::simplex_geotrans(2,2)), bgeot::simplex_geotrans(1,1)), 3));
 }
 
+/* Cost of the construction of the integration methods of a typical
+   model, then of the search of already built methods. */
+static void startup_cost() {
+  const char *names[] = {
+    "IM_TRIANGLE(6)", "IM_TETRAHEDRON(8)", "IM_GAUSS_PARALLELEPIPED(2,6)",
+    "IM_HEXAHEDRON(11)", "IM_STRUCTURED_COMPOSITE(IM_TRIANGLE(13),3)",
+    "IM_QUASI_POLAR(IM_TETRAHEDRON(8),2)", "IM_PRODUCT(IM_GAUSS1D(10), "
+    "IM_TRIANGLE(19))", "IM_GAUSSLOBATTO1D(31)" };
+  const size_type nb = sizeof(names) / sizeof(names[0]), nrep = 1000;
+  std::vector<getfem::pintegration_method> pims(nb);
+  double t0 = gmm::uclock_sec();
+  for (size_type i = 0; i < nb; ++i)
+    pims[i] = getfem::int_method_descriptor(names[i]);
+  double t1 = gmm::uclock_sec();
+  for (size_type k = 0; k < nrep; ++k)
+    for (size_type i = 0; i < nb; ++i)
+      GMM_ASSERT1(getfem::int_method_descriptor(names[i]) == pims[i],
+		  "Inconsistent integration method " << names[i]);
+  double t2 = gmm::uclock_sec();
+  cout << "Construction of " << nb << " integration methods: " << t1-t0
+       << " sec, search of an existing method: "
+       << (t2-t1) * 1E6 / double(nb*nrep) << " microsec" << endl;
+}
+
 int main(/* int argc, char **argv */) {
 
   FE_ENABLE_EXCEPT;        // Enable floating point exception for Nan.
@@ -456,6 +480,7 @@ int main(/* int argc, char **argv */) {
     getfem::pfem pf = getfem::QK_fem(2,1); //getfem::classical_fem(bgeot::parallelepiped_linear_geotrans(2),1);
     return 100;*/
 
+    startup_cost();
     int ok = 0;
     getfem::pintegration_method im_none = getfem::int_method_descriptor("IM_NONE()");
     try {
@@ -315,6 +315,81 @@ bool elastostatic_problem::solve(plain_vector &U) {
 /*  main program.                                                         */
 /**************************************************************************/
 
+/* Compare the batched evaluation of the hyperelastic laws with the
+   evaluation point by point. */
+bool check_batched_law(const getfem::abstract_hyperelastic_law &law,
+                       size_type N, const base_vector &params) {
+  const size_type nb = 11, N2 = N*N, NP = law.nb_params();
+  base_vector E(nb*N2), P(nb*NP), det(nb), energy(nb), sigma(nb*N2);
+  base_vector grad_sigma(nb*N2*N2);
+  base_matrix EE(N, N), C(N, N), S(N, N);
+  getfem::base_tensor GS(N, N, N, N);
+  for (size_type k = 0; k < nb; ++k) {
+    getfem::abstract_hyperelastic_law::random_E(EE);
+    std::copy(EE.begin(), EE.end(), E.begin() + k*N2);
+    std::copy(params.begin(), params.end(), P.begin() + k*NP);
+    gmm::copy(gmm::scaled(EE, scalar_type(2)), C);
+    gmm::add(gmm::identity_matrix(), C);
+    det[k] = sqrt(gmm::abs(gmm::lu_det(C)));
+  }
+  scalar_type err(0);
+  for (size_type stride = 0; stride <= NP; stride += NP) {
+    law.evaluate_batch(N, nb, &E[0], stride ? &P[0] : &params[0], stride,
+                       &det[0], &energy[0], &sigma[0], &grad_sigma[0]);
+    for (size_type k = 0; k < nb; ++k) {
+      std::copy(E.begin() + k*N2, E.begin() + (k+1)*N2, EE.begin());
+      scalar_type W = law.strain_energy(EE, params, det[k]);
+      law.sigma(EE, S, params, det[k]);
+      law.grad_sigma(EE, GS, params, det[k]);
+      err = std::max(err, gmm::abs(W - energy[k]) / (gmm::abs(W) + 1.));
+      for (size_type i = 0; i < N2; ++i)
+        err = std::max(err, gmm::abs(S[i] - sigma[k*N2+i])
+                       / (gmm::mat_maxnorm(S) + 1.));
+      for (size_type i = 0; i < N2*N2; ++i)
+        err = std::max(err, gmm::abs(GS[i] - grad_sigma[k*N2*N2+i])
+                       / (gmm::vect_norminf(GS.as_vector()) + 1.));
+    }
+  }
+  if (err > 1E-10) {
+    cout << "Batched evaluation of an hyperelastic law in dimension " << N
+         << " : error " << err << endl;
+    return false;
+  }
+  return true;
+}
+
+bool check_batched_laws() {
+  bool ok = true;
+  base_vector p2(2), p3(3), p5(5);
+  p2[0] = 1.2; p2[1] = 0.7;
+  p3[0] = 1.0; p3[1] = 1.0; p3[2] = 0.3;
+  p5[0] = 1.0; p5[1] = 1.0; p5[2] = 1.5; p5[3] = -0.5; p5[4] = 1.5;
+  getfem::SaintVenant_Kirchhoff_hyperelastic_law svk;
+  getfem::Ciarlet_Geymonat_hyperelastic_law cg;
+  for (size_type N = 2; N <= 3; ++N) {
+    ok = check_batched_law(svk, N, p2) && ok;
+    ok = check_batched_law(cg, N, p3) && ok;
+  }
+  for (int c = 0; c < 2; ++c)
+    for (int n = 0; n < 2; ++n) {
+      getfem::Mooney_Rivlin_hyperelastic_law mr(c != 0, n != 0);
+      base_vector p(mr.nb_params());
+      for (size_type i = 0; i < p.size(); ++i) p[i] = p3[i] + 0.1;
+      ok = check_batched_law(mr, 3, p) && ok;
+    }
+  for (int b = 0; b < 2; ++b) {
+    getfem::Neo_Hookean_hyperelastic_law nh(b != 0);
+    ok = check_batched_law(nh, 3, p2) && ok;
+  }
+  ok = check_batched_law(getfem::generalized_Blatz_Ko_hyperelastic_law(),
+                         3, p5) && ok;
+  ok = check_batched_law(getfem::plane_strain_hyperelastic_law
+                         (std::make_shared
+                          <getfem::Ciarlet_Geymonat_hyperelastic_law>()),
+                         2, p3) && ok;
+  return ok;
+}
+
 int main(int argc, char *argv[]) {
 
   GETFEM_MPI_INIT(argc, argv);
@@ -322,6 +397,7 @@ int main(int argc, char *argv[]) {
   FE_ENABLE_EXCEPT;        // Enable floating point exception for Nan.
 
   try {    
+    GMM_ASSERT1(check_batched_laws(), "Wrong batched hyperelastic laws");
     elastostatic_problem p;
     p.PARAM.read_command_line(argc, argv);
     p.init();
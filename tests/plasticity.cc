@@ -376,6 +376,33 @@ bool elastoplasticity_problem::solve(plain_vector &U) {
 // main program.                                                    
 //==================================================================
 
+/* Compare the batched Von Mises projection with the projection of each
+   tensor. */
+bool check_batched_projection() {
+  getfem::VM_projection proj(0);
+  scalar_type err(0);
+  for (size_type N = 1; N <= 4; ++N)
+    for (size_type flag = 0; flag < 2; ++flag) {
+      const size_type nb = 20, N2 = N*N, ps = flag ? N2*N2 : N2;
+      std::vector<scalar_type> tau(nb*N2), s(nb), res(nb*ps);
+      for (size_type i = 0; i < nb*N2; ++i) tau[i] = gmm::random(1.);
+      for (size_type k = 0; k < nb; ++k) s[k] = gmm::random(1.) + 1.;
+      proj.do_projection_batch(N, nb, &tau[0], &s[0], 1, &res[0], flag);
+      base_matrix t(N, N), p;
+      for (size_type k = 0; k < nb; ++k) {
+	std::copy(tau.begin() + k*N2, tau.begin() + (k+1)*N2, t.begin());
+	proj.do_projection(t, s[k], p, flag);
+	for (size_type i = 0; i < ps; ++i)
+	  err = std::max(err, gmm::abs(p.as_vector()[i] - res[k*ps+i]));
+      }
+    }
+  if (err > 1E-12) {
+    cout << "Batched Von Mises projection : error " << err << endl;
+    return false;
+  }
+  return true;
+}
+
 int main(int argc, char *argv[]) {
 
   GETFEM_MPI_INIT(argc, argv);
@@ -385,6 +412,9 @@ int main(int argc, char *argv[]) {
   FE_ENABLE_EXCEPT;        
   // Enable floating point exception for Nan.
    
+  if (!check_batched_projection())
+    GMM_ASSERT1(false, "Wrong batched projection");
+
   elastoplasticity_problem p;
   p.PARAM.read_command_line(argc, argv);
   p.init();
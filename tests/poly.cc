@@ -130,6 +130,41 @@ int main(void)
 	//cout << "Horner: " << PP.horner_print(mi,dim,0) << "\n";
       }
     }
+    // evaluation of all the monomials and of families of polynomials
+    for (bgeot::short_type dim=0; dim <= 4; ++dim) {
+      std::vector<bgeot::opt_long_scalar_type> X(dim);
+      for (unsigned i=0; i < dim; ++i) X[i] =
+	bgeot::opt_long_scalar_type(rand())
+	/ bgeot::opt_long_scalar_type(RAND_MAX);
+      for (bgeot::short_type dg=0; dg <= 8; ++dg) {
+	std::vector<bgeot::opt_long_scalar_type> M(bgeot::alpha(dim, dg));
+	bgeot::eval_monomials(X.begin(), dim, dg, &M[0]);
+	bgeot::power_index mi(dim);
+	for (unsigned k=0; k < M.size(); ++k, ++mi) {
+	  bgeot::opt_long_scalar_type m(1);
+	  for (unsigned i=0; i < dim; ++i)
+	    for (unsigned e=0; e < mi[i]; ++e) m *= X[i];
+	  assert(gmm::abs(M[k] - m) < 1e-14);
+	}
+
+	std::vector<bgeot::base_poly> PP(7);
+	for (unsigned j=0; j < PP.size(); ++j) {
+	  PP[j] = bgeot::base_poly(dim, bgeot::short_type(j % (dg+1)));
+	  for (unsigned i=0; i < PP[j].size(); ++i)
+	    if (rand() % 3) PP[j][i] = bgeot::opt_long_scalar_type(rand())
+			      / bgeot::opt_long_scalar_type(RAND_MAX);
+	}
+	bgeot::polynomial_family<bgeot::opt_long_scalar_type> F;
+	GMM_ASSERT1(F.init(PP.size(), [&PP](bgeot::size_type j)
+			   -> const bgeot::base_poly & { return PP[j]; }),
+		    "wrong family of polynomials");
+	assert(F.size() == PP.size());
+	std::vector<bgeot::opt_long_scalar_type> V(F.size());
+	F.eval(X.begin(), &V[0]);
+	for (unsigned j=0; j < PP.size(); ++j)
+	  assert(gmm::abs(V[j] - PP[j].eval(X.begin())) < 1e-13);
+      }
+    }
     cout << "\n--------------------------------------------------------\n";
     dump_poly_eval();
     cout << "\n--------------------------------------------------------\n";
@@ -53,7 +53,19 @@ int main(int argc, char *argv[]) {
   w.add_expression("d * Test_u", mim, -1);
   w.assembly(1);
 
+  // indices of the integration points computed once per element
+  bool ok = true;
+  getfem::im_data::element_points pts;
+  for (dal::bv_visitor cv(mim.convex_index()); !cv.finished(); ++cv) {
+    imd.filtered_points_of_element(cv, pts);
+    for (size_t i = 0; i < imd.nb_filtered_points_of_element(cv); ++i) {
+      size_t ipt = imd.filtered_index_of_point(cv, i);
+      if (imd.filtered_index_of_point(pts, cv, i) != ipt || d[ipt] <= 0.)
+        ok = false;
+    }
+  }
+
   GETFEM_MPI_FINALIZE;
   
-  return (gmm::abs(gmm::vect_norm2(v) - RESULT) < 1e-10) ? 0 : 1;
+  return (ok && gmm::abs(gmm::vect_norm2(v) - RESULT) < 1e-10) ? 0 : 1;
 }
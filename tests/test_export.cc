@@ -0,0 +1,293 @@
+/*===========================================================================
+
+ Copyright (C) 2020-2020 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/* Test of the xdmf time series export and of the vtu export with appended
+   (compressed) data: the files are read back and the exported fields
+   compared to the exact values at the exported points. */
+
+#include "getfem/getfem_export.h"
+#include "getfem/getfem_regular_meshes.h"
+#ifdef GETFEM_HAVE_ZLIB_H
+# include <zlib.h>
+#endif
+
+using std::endl; using std::cout; using std::cerr;
+using getfem::size_type;
+using getfem::scalar_type;
+using getfem::base_node;
+
+struct xdmf_item { size_type seek, nb, nc; };
+
+/* DataItem of the n-th occurrence of the tag 'what' in the index */
+static xdmf_item find_item(const std::string &xml, const std::string &what,
+                           size_type n) {
+  size_t pos = 0;
+  for (size_type i = 0; i <= n; ++i) {
+    pos = xml.find(what, pos);
+    GMM_ASSERT1(pos != std::string::npos, what << " not found");
+    pos += what.size();
+  }
+  pos = xml.find("<DataItem", pos);
+  GMM_ASSERT1(pos != std::string::npos, "no DataItem for " << what);
+  xdmf_item it;
+  size_t s = xml.find("Seek=\"", pos) + 6, d = xml.find("Dimensions=\"", pos);
+  it.seek = size_type(atol(xml.c_str() + s));
+  std::stringstream ss(xml.substr(d + 12, xml.find('"', d + 12) - d - 12));
+  ss >> it.nb; if (!(ss >> it.nc)) it.nc = 1;
+  return it;
+}
+
+static const float *data_of(const std::vector<char> &bin,
+                            const xdmf_item &it) {
+  GMM_ASSERT1(it.seek + it.nb*it.nc*sizeof(float) <= bin.size(),
+              "data out of the binary file");
+  return reinterpret_cast<const float *>(bin.data() + it.seek);
+}
+
+static void test_xdmf_series() {
+  getfem::mesh m;
+  getfem::regular_unit_mesh(m, std::vector<size_type>(2, 5),
+                            bgeot::simplex_geotrans(2, 1));
+  getfem::mesh_fem mf(m), mfv(m, 2);
+  mf.set_classical_finite_element(1);
+  mfv.set_classical_finite_element(1);
+
+  /* f = 1 + x + 2y, g = (x - y, 3x) : exactly interpolated */
+  std::vector<scalar_type> F(mf.nb_dof()), G(2*mf.nb_dof()), H(mfv.nb_dof());
+  for (size_type i = 0; i < mf.nb_dof(); ++i) {
+    base_node P = mf.point_of_basic_dof(i);
+    F[i] = 1. + P[0] + 2.*P[1];
+    G[2*i] = P[0] - P[1]; G[2*i+1] = 3.*P[0];
+  }
+  for (size_type i = 0; i < mfv.nb_dof(); ++i) {
+    base_node P = mfv.point_of_basic_dof(i);
+    H[i] = (i % 2) ? 3.*P[0] : P[0] - P[1];
+  }
+
+  const size_type nb_steps = 3;
+  {
+    getfem::xdmf_series_export exp("test_export");
+    exp.exporting(mf);
+    for (size_type k = 0; k < nb_steps; ++k) {
+      scalar_type c = scalar_type(k+1);
+      std::vector<scalar_type> Fk(F), Gk(G), Hk(H);
+      gmm::scale(Fk, c); gmm::scale(Gk, c); gmm::scale(Hk, c);
+      exp.begin_step(0.5*scalar_type(k));
+      exp.write_point_data(mf, Fk, "f");
+      exp.write_point_data(mf, Gk, "g"); // two components on a scalar mf
+      exp.write_point_data(mfv, Hk, "h");
+      exp.end_step();
+    }
+    exp.close();
+  }
+
+  std::ifstream fx("test_export.xmf");
+  GMM_ASSERT1(fx, "test_export.xmf not written");
+  std::string xml((std::istreambuf_iterator<char>(fx)),
+                  std::istreambuf_iterator<char>());
+  std::ifstream fb("test_export.bin", std::ios::binary);
+  GMM_ASSERT1(fb, "test_export.bin not written");
+  std::vector<char> bin((std::istreambuf_iterator<char>(fb)),
+                        std::istreambuf_iterator<char>());
+
+  size_type nb_grids = 0;
+  for (size_t pos = xml.find("<Grid Name=\"step_"); pos != std::string::npos;
+       pos = xml.find("<Grid Name=\"step_", pos+1)) ++nb_grids;
+  GMM_ASSERT1(nb_grids == nb_steps, "wrong number of steps: " << nb_grids);
+
+  for (size_type k = 0; k < nb_steps; ++k) {
+    scalar_type c = scalar_type(k+1);
+    std::stringstream st; st << "<Time Value=\"" << 0.5*scalar_type(k) << "\"";
+    GMM_ASSERT1(xml.find(st.str()) != std::string::npos,
+                "time of step " << k << " not found");
+    xdmf_item ip = find_item(xml, "<Geometry", k);
+    xdmf_item iff = find_item(xml, "<Attribute Name=\"f\"", k);
+    xdmf_item ig = find_item(xml, "<Attribute Name=\"g\"", k);
+    xdmf_item ih = find_item(xml, "<Attribute Name=\"h\"", k);
+    GMM_ASSERT1(ip.nb == mf.nb_dof() && ip.nc == 3, "wrong geometry");
+    GMM_ASSERT1(iff.nb == ip.nb && iff.nc == 1, "wrong dimensions of f");
+    GMM_ASSERT1(ig.nb == ip.nb && ig.nc == 3, "wrong dimensions of g");
+    GMM_ASSERT1(ih.nb == ip.nb && ih.nc == 3, "wrong dimensions of h");
+    GMM_ASSERT1(xml.find("AttributeType=\"Vector\"") != std::string::npos,
+                "g should be a vector field");
+    const float *pts = data_of(bin, ip), *f = data_of(bin, iff);
+    const float *g = data_of(bin, ig), *h = data_of(bin, ih);
+    for (size_type i = 0; i < ip.nb; ++i) {
+      scalar_type x = pts[3*i], y = pts[3*i+1];
+      GMM_ASSERT1(gmm::abs(f[i] - c*(1. + x + 2.*y)) < 1e-5, "wrong f");
+      for (const float *v : {g, h}) {
+        GMM_ASSERT1(gmm::abs(v[3*i] - c*(x - y)) < 1e-5
+                    && gmm::abs(v[3*i+1] - c*3.*x) < 1e-5
+                    && v[3*i+2] == 0.f, "wrong vector field");
+      }
+    }
+  }
+}
+
+static std::string read_file(const std::string &name) {
+  std::ifstream f(name.c_str(), std::ios::binary);
+  GMM_ASSERT1(f, name << " not written");
+  return std::string((std::istreambuf_iterator<char>(f)),
+                     std::istreambuf_iterator<char>());
+}
+
+static size_type attribute(const std::string &xml, size_t pos,
+                           const std::string &name) {
+  size_t a = xml.find(name + "=\"", pos);
+  GMM_ASSERT1(a != std::string::npos && a < xml.find('>', pos),
+              "no attribute " << name);
+  return size_type(atol(xml.c_str() + a + name.size() + 2));
+}
+
+/* Values of the DataArray 'name' (nb floats) of a vtu file with appended
+   data, the sizes given by the headers of the blocks being checked. */
+static std::vector<float> vtu_array(const std::string &vtu,
+                                    const std::string &name, size_type nb) {
+  typedef gmm::uint64_type uint64;
+  size_t pos = vtu.find("Name=\"" + name + "\"");
+  GMM_ASSERT1(pos != std::string::npos, "no DataArray " << name);
+  GMM_ASSERT1(vtu.find("format=\"appended\"", pos) < vtu.find('>', pos),
+              name << " is not appended");
+  size_t start = vtu.find("<AppendedData encoding=\"raw\">\n_");
+  GMM_ASSERT1(start != std::string::npos, "no appended data");
+  start += 31 + attribute(vtu, pos, "offset");
+  const std::string end = "\n</AppendedData>";
+  size_t stop = vtu.size() - end.size() - 12; // before "</VTKFile>\n"
+  GMM_ASSERT1(vtu.compare(stop, end.size(), end) == 0, "bad end of file");
+  auto read64 = [&](size_t p) {
+    uint64 v; GMM_ASSERT1(p + 8 <= stop, "header out of the data");
+    memcpy(&v, vtu.data() + p, 8); return v;
+  };
+
+  std::vector<float> V(nb);
+  size_type n = nb*sizeof(float);
+  if (vtu.find("compressor=\"vtkZLibDataCompressor\"") == std::string::npos) {
+    GMM_ASSERT1(read64(start) == n, "wrong size of the block of " << name);
+    GMM_ASSERT1(start + 8 + n <= stop, "block of " << name << " truncated");
+    memcpy(V.data(), vtu.data() + start + 8, n);
+    return V;
+  }
+#ifdef GETFEM_HAVE_ZLIB_H
+  size_type nbb = read64(start), bs = read64(start+8);
+  size_type last = read64(start+16);
+  GMM_ASSERT1(bs == 32768 && nbb == (n + bs - 1) / bs && last == n % bs,
+              "wrong header of the compressed block of " << name);
+  size_t p = start + 24 + 8*nbb;
+  for (size_type i = 0; i < nbb; ++i) {
+    size_type cs = read64(start + 24 + 8*i);
+    size_type s = (i+1 == nbb && last) ? last : bs;
+    GMM_ASSERT1(p + cs <= stop, "compressed block out of the data");
+    uLongf us = uLongf(s);
+    GMM_ASSERT1(uncompress(reinterpret_cast<Bytef *>(V.data()) + i*bs, &us,
+                           reinterpret_cast<const Bytef *>(vtu.data() + p),
+                           uLong(cs)) == Z_OK && us == s,
+                "bad compressed block " << i << " of " << name);
+    p += cs;
+  }
+#else
+  GMM_ASSERT1(false, "compressed data without zlib");
+#endif
+  return V;
+}
+
+/* f = 1 + x + 2y and g = (x - y, 3x, 0) at the points of a vtu file */
+static size_type check_vtu_fields(const std::string &fname) {
+  std::string vtu = read_file(fname);
+  size_t piece = vtu.find("<Piece ");
+  GMM_ASSERT1(vtu.find("header_type=\"UInt64\"") != std::string::npos
+              && piece != std::string::npos, "bad vtu header");
+  size_type nbpt = attribute(vtu, piece, "NumberOfPoints");
+  std::vector<float> pts = vtu_array(vtu, "Points", 3*nbpt);
+  std::vector<float> f = vtu_array(vtu, "f", nbpt);
+  std::vector<float> g = vtu_array(vtu, "g", 3*nbpt);
+  for (size_type i = 0; i < nbpt; ++i) {
+    scalar_type x = pts[3*i], y = pts[3*i+1];
+    GMM_ASSERT1(gmm::abs(f[i] - (1. + x + 2.*y)) < 1e-5, "wrong f");
+    GMM_ASSERT1(gmm::abs(g[3*i] - (x - y)) < 1e-5
+                && gmm::abs(g[3*i+1] - 3.*x) < 1e-5 && g[3*i+2] == 0.f,
+                "wrong vector field");
+  }
+  return attribute(vtu, piece, "NumberOfCells");
+}
+
+static void test_vtu_appended(bool compress) {
+  getfem::mesh m;
+  getfem::regular_unit_mesh(m, std::vector<size_type>(2, 100),
+                            bgeot::simplex_geotrans(2, 1));
+  getfem::mesh_fem mf(m);
+  mf.set_classical_finite_element(1);
+  std::vector<scalar_type> F(mf.nb_dof()), G(2*mf.nb_dof());
+  for (size_type i = 0; i < mf.nb_dof(); ++i) {
+    base_node P = mf.point_of_basic_dof(i);
+    F[i] = 1. + P[0] + 2.*P[1];
+    G[2*i] = P[0] - P[1]; G[2*i+1] = 3.*P[0];
+  }
+
+  /* the points take several blocks of 32kB once compressed */
+  {
+    getfem::vtu_export exp("test_export_vtu.vtu");
+    exp.set_appended_binary(compress);
+    exp.exporting(mf);
+    exp.write_point_data(mf, F, "f");
+    exp.write_point_data(mf, G, "g");
+  }
+#ifdef GETFEM_HAVE_ZLIB_H
+  GMM_ASSERT1((read_file("test_export_vtu.vtu").find("vtkZLibDataCompressor")
+               != std::string::npos) == compress, "wrong compression");
+#endif
+  GMM_ASSERT1(check_vtu_fields("test_export_vtu.vtu")
+              == m.convex_index().card(), "wrong number of cells");
+
+  /* pieces of a pvtu file, referenced by a pvd collection */
+  {
+    getfem::pvtu_export pexp("test_export_p", compress);
+    pexp.exporting(mf, 3);
+    pexp.write_point_data(mf, F, "f");
+    pexp.write_point_data(mf, G, "g");
+  }
+  getfem::pvd_export pvd("test_export.pvd");
+  pvd.add_dataset("test_export_p.pvtu", 0.5);
+  std::string pvtu = read_file("test_export_p.pvtu");
+  size_type nb_cells = 0;
+  for (size_type i = 0; i < 3; ++i) {
+    std::stringstream s; s << "test_export_p_" << i << ".vtu";
+    GMM_ASSERT1(pvtu.find("<Piece Source=\"" + s.str() + "\"/>")
+                != std::string::npos, "piece " << i << " not referenced");
+    nb_cells += check_vtu_fields(s.str());
+  }
+  GMM_ASSERT1(nb_cells == m.convex_index().card(), "wrong number of cells");
+  GMM_ASSERT1(read_file("test_export.pvd").find
+              ("<DataSet timestep=\"0.5\" group=\"\" part=\"0\" "
+               "file=\"test_export_p.pvtu\"/>") != std::string::npos,
+              "wrong pvd file");
+}
+
+int main(void) {
+
+  try {
+    test_xdmf_series();
+    test_vtu_appended(false);
+    test_vtu_appended(true);
+  }
+  GMM_STANDARD_CATCH_ERROR;
+
+  return 0;
+}
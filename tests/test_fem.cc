@@ -0,0 +1,120 @@
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/* Test of the evaluation of the base functions of the fems: fast
+   evaluation of the polynomial fems at a point and evaluation on all the
+   points of a point tab at once. */
+
+#include "getfem/getfem_fem.h"
+#include "getfem/getfem_integration.h"
+
+using std::endl; using std::cout; using std::cerr;
+using bgeot::base_node;
+using bgeot::base_tensor;
+using bgeot::scalar_type;
+using bgeot::size_type;
+using bgeot::short_type;
+
+/* The fast evaluation of the polynomial fems gives the values of the
+   polynomials. */
+static void check_poly_fem(const std::string &name,
+                           bgeot::pstored_point_tab pspt) {
+  getfem::pfem pf = getfem::fem_descriptor(name);
+  getfem::ppolyfem ppf = dynamic_cast<getfem::ppolyfem>(pf.get());
+  GMM_ASSERT1(ppf, name << " is not a polynomial fem");
+  size_type R = ppf->base().size(), N = pf->dim();
+  base_tensor t, tg, th;
+  for (size_type k = 0; k < pspt->size(); ++k) {
+    const base_node &x = (*pspt)[k];
+    pf->base_value(x, t); pf->grad_base_value(x, tg);
+    pf->hess_base_value(x, th);
+    for (size_type i = 0; i < R; ++i) {
+      GMM_ASSERT1(gmm::abs(t[i] - ppf->base()[i].eval(x.begin())) < 1e-12,
+                  "wrong value for " << name);
+      for (size_type j = 0; j < N; ++j) {
+        bgeot::base_poly G = ppf->base()[i]; G.derivative(short_type(j));
+        GMM_ASSERT1(gmm::abs(tg[i+j*R] - G.eval(x.begin())) < 1e-10,
+                    "wrong gradient for " << name);
+        for (size_type l = 0; l < N; ++l) {
+          bgeot::base_poly H = G; H.derivative(short_type(l));
+          GMM_ASSERT1(gmm::abs(th[i+(l+j*N)*R] - H.eval(x.begin())) < 1e-8,
+                      "wrong hessian for " << name);
+        }
+      }
+    }
+  }
+}
+
+static void check_packed(const bgeot::packed_tensor_tab &p,
+                         const base_tensor &t, size_type k,
+                         const std::string &name) {
+  GMM_ASSERT1(p.sizes().is_equal(t.sizes()), "wrong sizes for " << name);
+  for (size_type i = 0; i < t.size(); ++i)
+    GMM_ASSERT1(gmm::abs(p[k][i] - t[i]) < 1e-12, "wrong value at the point "
+                << k << " for " << name);
+}
+
+/* The evaluation on all the points of a point tab gives the values at
+   each point. */
+static void check_base_values(const std::string &name,
+                              bgeot::pstored_point_tab pspt) {
+  getfem::pfem pf = getfem::fem_descriptor(name);
+  bgeot::packed_tensor_tab p, pg, ph;
+  pf->base_values(*pspt, p); pf->grad_base_values(*pspt, pg);
+  pf->hess_base_values(*pspt, ph);
+  GMM_ASSERT1(p.size() == pspt->size() && pg.size() == pspt->size()
+              && ph.size() == pspt->size(), "wrong number of points");
+  base_tensor t;
+  for (size_type k = 0; k < pspt->size(); ++k) {
+    pf->base_value((*pspt)[k], t); check_packed(p, t, k, name);
+    pf->grad_base_value((*pspt)[k], t); check_packed(pg, t, k, name);
+    pf->hess_base_value((*pspt)[k], t); check_packed(ph, t, k, name);
+  }
+}
+
+int main(void) {
+
+  try {
+    bgeot::pstored_point_tab pspt
+      = getfem::int_method_descriptor("IM_TRIANGLE(10)")
+      ->approx_method()->pintegration_points();
+    bgeot::pstored_point_tab pspt_prism
+      = getfem::int_method_descriptor("IM_PRODUCT(IM_TRIANGLE(6),"
+                                      "IM_GAUSS1D(4))")
+      ->approx_method()->pintegration_points();
+
+    check_poly_fem("FEM_PK(2,3)", pspt);
+    check_poly_fem("FEM_QK(2,4)", pspt);
+    check_poly_fem("FEM_HERMITE(2)", pspt);
+    check_poly_fem("FEM_PK_WITH_CUBIC_BUBBLE(2,2)", pspt);
+    check_poly_fem("FEM_PK_PRISM(3,2)", pspt_prism);
+
+    check_base_values("FEM_PK(2,3)", pspt);
+    check_base_values("FEM_QK(2,4)", pspt);
+    check_base_values("FEM_HERMITE(2)", pspt);
+    check_base_values("FEM_PK_PRISM(3,2)", pspt_prism);
+    check_base_values("FEM_HCT_TRIANGLE", pspt); // default version
+  }
+  GMM_STANDARD_CATCH_ERROR;
+
+  cout << "Test OK" << endl;
+  return 0;
+}
@@ -0,0 +1,195 @@
+/*===========================================================================
+
+ Copyright (C) 2020 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/* Test of the binary sparse matrix format and of the multithreaded
+   MatrixMarket reader. */
+
+#include "gmm/gmm.h"
+#include "gmm/gmm_inoutput.h"
+
+using gmm::size_type;
+
+template <typename MAT1, typename MAT2>
+double mat_dist(const MAT1 &A, const MAT2 &B) {
+  typedef typename gmm::linalg_traits<MAT1>::value_type T;
+  gmm::col_matrix<gmm::wsvector<T> > C(gmm::mat_nrows(A), gmm::mat_ncols(A));
+  gmm::copy(A, C);
+  gmm::add(gmm::scaled(B, T(-1)), C);
+  return gmm::mat_maxnorm(C);
+}
+
+template <typename T> void random_sparse(gmm::row_matrix<gmm::wsvector<T> > &A,
+                                         bool sym) {
+  size_type m = gmm::mat_nrows(A), n = gmm::mat_ncols(A);
+  for (size_type k = 0; k < 4*m; ++k) {
+    size_type i = size_type(rand()) % m, j = size_type(rand()) % n;
+    A(i, j) = gmm::random(T());
+    if (sym) A(j, i) = A(i, j);
+  }
+}
+
+template <typename T> void test_binary(T) {
+  size_type m = 200, n = 150;
+  gmm::row_matrix<gmm::wsvector<T> > A(m, n), S(n, n);
+  random_sparse(A, false);
+  random_sparse(S, true);
+
+  gmm::csr_matrix<T> Acsr; Acsr.init_with(A);
+  gmm::binary_sparse_IO::write("test_gmm_inoutput.bin", Acsr);
+  {
+    gmm::binary_sparse_IO bio("test_gmm_inoutput.bin");
+    GMM_ASSERT1(bio.nrows() == m && bio.ncols() == n && bio.is_csr() &&
+                bio.nnz() == gmm::nnz(Acsr), "wrong header");
+    GMM_ASSERT1(mat_dist(A, bio.csr_ref<T>()) == 0., "wrong zero-copy load");
+    gmm::csc_matrix<T> Acsc; bio.read(Acsc);
+    GMM_ASSERT1(mat_dist(A, Acsc) == 0., "wrong load");
+    gmm::dense_matrix<T> Ad; bio.read(Ad);
+    GMM_ASSERT1(mat_dist(A, Ad) == 0., "wrong load");
+  }
+
+  /* CSC storage with Fortran indices and 64 bits indices */
+  gmm::csc_matrix<T, size_type, 1> Acsc1; Acsc1.init_with(A);
+  gmm::binary_sparse_save("test_gmm_inoutput.bin", Acsc1);
+  {
+    gmm::binary_sparse_IO bio("test_gmm_inoutput.bin");
+    GMM_ASSERT1(bio.is_csc() && bio.header().shift == 1, "wrong header");
+    GMM_ASSERT1(mat_dist(A, bio.csc_ref<T, size_type, 1>()) == 0.,
+                "wrong zero-copy load");
+    gmm::csr_matrix<T, unsigned, 1> Acsr1; bio.read(Acsr1);
+    GMM_ASSERT1(mat_dist(A, Acsr1) == 0., "wrong load");
+  }
+
+  /* symmetric matrix: only the lower part is stored */
+  gmm::binary_sparse_save("test_gmm_inoutput.bin", S,
+                          gmm::BINARY_SPARSE_SYMMETRIC);
+  {
+    gmm::binary_sparse_IO bio("test_gmm_inoutput.bin");
+    GMM_ASSERT1(bio.is_symmetric() && bio.nnz() < gmm::nnz(S),
+                "wrong header");
+    gmm::col_matrix<gmm::wsvector<T> > S2; bio.read(S2);
+    GMM_ASSERT1(mat_dist(S, S2) == 0., "wrong symmetric load");
+  }
+}
+
+template <typename T> void test_matrix_market(T) {
+  typedef typename gmm::number_traits<T>::magnitude_type R;
+  size_type m = 300, n = 250;
+  gmm::row_matrix<gmm::wsvector<T> > A(m, n);
+  random_sparse(A, false);
+  gmm::MatrixMarket_IO::write("test_gmm_inoutput.mtx", A);
+
+  gmm::col_matrix<gmm::wsvector<T> > B0;
+  gmm::MatrixMarket_load("test_gmm_inoutput.mtx", B0);
+  for (unsigned nb_threads = 1; nb_threads <= 4; nb_threads += 3) {
+    gmm::csc_matrix<T> B1;
+    gmm::csr_matrix<T> B2;
+    gmm::col_matrix<gmm::wsvector<T> > B3;
+    gmm::MatrixMarket_load_parallel("test_gmm_inoutput.mtx", B1, nb_threads);
+    gmm::MatrixMarket_load_parallel("test_gmm_inoutput.mtx", B2, nb_threads);
+    gmm::MatrixMarket_load_parallel("test_gmm_inoutput.mtx", B3, nb_threads);
+    GMM_ASSERT1(mat_dist(B0, B1) == R(0) && mat_dist(B0, B2) == R(0) &&
+                mat_dist(B0, B3) == R(0), "wrong parallel read");
+    GMM_ASSERT1(mat_dist(A, B1) < R(1E-12), "wrong parallel read");
+  }
+}
+
+void test_matrix_market_symmetric() {
+  {
+    std::ofstream f("test_gmm_inoutput.mtx");
+    f << "%%MatrixMarket matrix coordinate real symmetric\n"
+      << "% a comment\n"
+      << "3 3 4\n"
+      << "1 1 2.0\n"
+      << "2 1 -1.0\n\n"
+      << "% another comment\n"
+      << "3 2 -1.5e0\n"
+      << "3 3 4\n";
+  }
+  gmm::csc_matrix<double> A;
+  gmm::MatrixMarket_load_parallel("test_gmm_inoutput.mtx", A, 3);
+  gmm::dense_matrix<double> B(3, 3);
+  B(0,0) = 2.; B(1,0) = B(0,1) = -1.; B(2,1) = B(1,2) = -1.5; B(2,2) = 4.;
+  GMM_ASSERT1(gmm::nnz(A) == 6 && mat_dist(B, A) == 0.,
+              "wrong symmetric read");
+}
+
+/* files with bad compressed arrays are rejected by open() */
+void test_binary_corrupted() {
+  gmm::row_matrix<gmm::wsvector<double> > A(20, 10);
+  random_sparse(A, false);
+  gmm::csr_matrix<double> Acsr; Acsr.init_with(A);
+  gmm::binary_sparse_IO::write("test_gmm_inoutput.bin", Acsr);
+  std::vector<char> buf;
+  {
+    std::ifstream f("test_gmm_inoutput.bin", std::ios::binary);
+    buf.assign(std::istreambuf_iterator<char>(f),
+               std::istreambuf_iterator<char>());
+  }
+  size_type jc_offset = 64, ir_offset = jc_offset + 88; // 21 indices
+  for (int c = 0; c < 4; ++c) {
+    std::vector<char> b(buf);
+    unsigned *jc = reinterpret_cast<unsigned *>(&b[jc_offset]);
+    unsigned *ir = reinterpret_cast<unsigned *>(&b[ir_offset]);
+    switch (c) {
+    case 0 : jc[1] = jc[2] + 1; break;            // jc decreasing
+    case 1 : jc[20] += 1; break;                  // jc[nrows] != nnz
+    case 2 : ir[0] = 10; break;                   // column out of range
+    case 3 : b.resize(b.size() - 8); break;       // truncated values
+    }
+    {
+      std::ofstream f("test_gmm_inoutput.bin", std::ios::binary);
+      f.write(&b[0], std::streamsize(b.size()));
+    }
+    bool rejected = false;
+    try { gmm::binary_sparse_IO bio("test_gmm_inoutput.bin"); }
+    catch (const gmm::gmm_error &) { rejected = true; }
+    GMM_ASSERT1(rejected, "corrupted file " << c << " not detected");
+  }
+}
+
+int main(void) {
+
+  srand(1459);
+
+  test_binary(double());
+  test_binary(float());
+  test_binary(std::complex<double>());
+  test_matrix_market(double());
+  test_matrix_market(std::complex<double>());
+  test_matrix_market_symmetric();
+  test_binary_corrupted();
+
+  std::vector<double> V(1000), W(1000);
+  gmm::fill_random(V);
+  gmm::vecsave("test_gmm_inoutput.vec", V, true);
+  gmm::vecload("test_gmm_inoutput.vec", W, true);
+  GMM_ASSERT1(V == W, "wrong binary vector I/O");
+  std::vector<double> X(20), Y(10);   // non contiguous vectors
+  gmm::vecload("test_gmm_inoutput.vec",
+               gmm::sub_vector(X, gmm::sub_slice(1, 10, 2)), true);
+  gmm::vecsave("test_gmm_inoutput.vec",
+               gmm::sub_vector(X, gmm::sub_slice(1, 10, 2)), true);
+  gmm::vecload("test_gmm_inoutput.vec", Y, true);
+  for (size_type i = 0; i < 10; ++i)
+    GMM_ASSERT1(X[2*i+1] == V[i] && Y[i] == V[i], "wrong binary vector I/O");
+
+  return 0;
+}
@@ -403,6 +403,131 @@ void testDim_3D() {
   cerr << "Ok, it works !\n";
 }
 
+/* comparison of the interpolation operators with the direct
+   interpolations, on the same mesh, on two different meshes and on a
+   slice. */
+void test_interpolation_operator() {
+  cout << "Testing interpolation operators..\n";
+  mesh m1, m2;
+  build_mesh(m1, 0, 2, 2, 6, 1, false);
+  build_mesh(m2, 0, 2, 2, 7, 1, true);
+  mesh_fem mf1(m1, 2), mf1d(m1, 2), mf2(m1, 2), mf3(m2, 2);
+  mf1.set_finite_element(getfem::PK_fem(2, 2));
+  mf1d.set_classical_discontinuous_finite_element(1);
+  mf2.set_finite_element(getfem::PK_fem(2, 1));
+  mf3.set_finite_element(getfem::PK_fem(2, 1));
+
+  const mesh_fem *sources[2] = { &mf1, &mf1d };
+  for (const mesh_fem *pmf : sources) {
+    std::vector<scalar_type> U(pmf->nb_dof()*2), V1(mf2.nb_dof()*2);
+    std::vector<scalar_type> V2(V1.size()), V3(V1.size());
+    for (size_type d=0; d < U.size(); ++d) U[d] = gmm::random(double());
+
+    getfem::interpolation(*pmf, mf2, U, V1);        // direct
+    getfem::interpolation_operator op;
+    getfem::build_interpolation_operator(*pmf, mf2, op);
+    op.apply(U, V2);
+    gmm::add(gmm::scaled(V1, -1.), V2);
+    GMM_ASSERT1(gmm::vect_norminf(V2) < 1e-12, "wrong interpolation operator");
+    for (int i=0; i < 2; ++i)                        // cached operator
+      getfem::interpolation(*pmf, mf2, U, V3);
+    gmm::add(gmm::scaled(V1, -1.), V3);
+    GMM_ASSERT1(gmm::vect_norminf(V3) < 1e-12, "wrong cached operator");
+    GMM_ASSERT1(op.is_up_to_date(), "");
+  }
+
+  std::vector<scalar_type> U(mf1.nb_dof()), V1(mf3.nb_dof()), V2(V1.size());
+  for (size_type d=0; d < U.size(); ++d) U[d] = gmm::random(double());
+  rsr_matrix M(mf3.nb_dof(), mf1.nb_dof());
+  getfem::interpolation(mf1, mf3, M, 1);
+  gmm::mult(M, U, V1);
+  getfem::interpolation_operator op;
+  getfem::build_interpolation_operator(mf1, mf3, op, 1);
+  op.apply(U, V2);
+  gmm::add(gmm::scaled(V1, -1.), V2);
+  GMM_ASSERT1(gmm::vect_norminf(V2) < 1e-12, "wrong interpolation operator");
+
+  getfem::stored_mesh_slice sl(m1, 3);
+  std::vector<scalar_type> W1(sl.nb_points()*2), W2(W1.size());
+  sl.interpolate(mf1, U, W1);                       // direct
+  sl.interpolate(mf1, U, W2);                       // operator built
+  sl.interpolate(mf1, U, W2);
+  gmm::add(gmm::scaled(W1, -1.), W2);
+  GMM_ASSERT1(gmm::vect_norminf(W2) < 1e-12, "wrong slice operator");
+  GMM_ASSERT1(sl.cached_interpolation_operator(mf1)->nrows() == W1.size(),
+              "");
+  mf1.set_qdim(1);                                  // invalidates it
+  std::vector<scalar_type> W3(sl.nb_points()), W4(W3.size());
+  gmm::resize(U, mf1.nb_dof());
+  sl.interpolate(mf1, U, W3);
+  sl.interpolate(mf1, U, W4);
+  GMM_ASSERT1(sl.cached_interpolation_operator(mf1)->nrows() == W3.size(),
+              "");
+  gmm::add(gmm::scaled(W3, -1.), W4);
+  GMM_ASSERT1(gmm::vect_norminf(W4) < 1e-12, "wrong slice operator");
+}
+
+/* Invalidation of the operators cached by getfem::interpolation: a
+   modified mesh_fem, a destroyed one and the eviction of the least
+   recently used entry. */
+void test_interpolation_operator_cache() {
+  cout << "Testing the cache of interpolation operators..\n";
+  mesh m;
+  build_mesh(m, 0, 2, 2, 5, 1, false);
+  mesh_fem mfs(m);
+  mfs.set_finite_element(getfem::PK_fem(2, 2));
+  std::vector<scalar_type> U(mfs.nb_dof());
+  for (size_type d=0; d < U.size(); ++d) U[d] = gmm::random(double());
+
+  { // modified target
+    mesh_fem mft(m);
+    mft.set_finite_element(getfem::PK_fem(2, 1));
+    GMM_ASSERT1(!getfem::cached_interpolation_operator(mfs, mft), "");
+    GMM_ASSERT1(getfem::cached_interpolation_operator(mfs, mft), "");
+    mft.set_finite_element(getfem::PK_fem(2, 3));
+    GMM_ASSERT1(!getfem::cached_interpolation_operator(mfs, mft),
+                "operator of a modified mesh_fem returned");
+    std::vector<scalar_type> V1(mft.nb_dof()), V2(V1.size());
+    getfem::interpolation_operator op;
+    getfem::build_interpolation_operator(mfs, mft, op);
+    op.apply(U, V1);
+    getfem::interpolation(mfs, mft, U, V2);          // operator rebuilt
+    getfem::pinterpolation_operator pop
+      = getfem::cached_interpolation_operator(mfs, mft);
+    GMM_ASSERT1(pop && pop->nrows() == mft.nb_dof(), "operator not rebuilt");
+    gmm::add(gmm::scaled(V1, -1.), V2);
+    GMM_ASSERT1(gmm::vect_norminf(V2) < 1e-12, "wrong rebuilt operator");
+  }
+
+  { // destroyed target, the new one may be allocated at the same address
+    std::unique_ptr<mesh_fem> pmft = std::make_unique<mesh_fem>(m);
+    pmft->set_finite_element(getfem::PK_fem(2, 1));
+    getfem::cached_interpolation_operator(mfs, *pmft);
+    GMM_ASSERT1(getfem::cached_interpolation_operator(mfs, *pmft), "");
+    pmft.reset();
+    pmft = std::make_unique<mesh_fem>(m);
+    pmft->set_finite_element(getfem::PK_fem(2, 3));
+    GMM_ASSERT1(!getfem::cached_interpolation_operator(mfs, *pmft),
+                "operator of a destroyed mesh_fem returned");
+  }
+
+  { // eviction of the least recently used operator
+    const size_type nb = 33;
+    std::vector<std::unique_ptr<mesh_fem>> mfts;
+    for (size_type i = 0; i < nb; ++i) {
+      mfts.push_back(std::make_unique<mesh_fem>(m));
+      mfts.back()->set_finite_element(getfem::PK_fem(2, 1));
+      getfem::cached_interpolation_operator(mfs, *(mfts.back()));
+      GMM_ASSERT1(getfem::cached_interpolation_operator(mfs, *(mfts.back())),
+                  "");
+    }
+    GMM_ASSERT1(getfem::cached_interpolation_operator(mfs, *(mfts[1])),
+                "operator evicted too early");
+    GMM_ASSERT1(!getfem::cached_interpolation_operator(mfs, *(mfts[0])),
+                "least recently used operator not evicted");
+  }
+}
+
 int main(int argc, char *argv[]) {
 
   FE_ENABLE_EXCEPT;        // Enable floating point exception for Nan.
@@ -411,6 +536,8 @@ int main(int argc, char *argv[]) {
   
   testDim_3D();
   test0();
+  test_interpolation_operator();
+  test_interpolation_operator_cache();
   for (int mat_version = 0; mat_version < 5; ++mat_version) {
     const char *msg[] = {"Testing interpolation", 
 			 "Testing stored interpolator in rsc matrix",
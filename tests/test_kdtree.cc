@@ -106,6 +106,61 @@ void check_tree() {
   cout << "\nthe kdtree is ok!\n";
 }
 
+double dist2_(const base_node &a, const base_node &b) {
+  return gmm::vect_dist2_sqr(a, b);
+}
+
+void check_neighbors() {
+  bgeot::kdtree tree;
+  std::vector<base_node> pts, qpts;
+  for (size_type i=0; i < 2000; ++i) {
+    base_node pt(3);
+    for (size_type k=0; k < 3; ++k) pt[k] = gmm::random(double());
+    if (i % 10 == 0) pt[2] = 0.5; /* some points on a same plane */
+    pts.push_back(pt);
+    tree.add_point(pt);
+  }
+  for (size_type i=0; i < 200; ++i) {
+    base_node pt(3);
+    for (size_type k=0; k < 3; ++k) pt[k] = gmm::random(double())*1.2-0.1;
+    qpts.push_back(pt);
+  }
+  const size_type K = 7;
+  const double R = 0.1;
+  std::vector<size_type> ids, ptr, bids;
+  std::vector<double> d2;
+  tree.k_nearest_neighbors(qpts, K, ids, d2);
+  tree.points_in_balls(qpts, R, ptr, bids);
+  for (size_type j=0; j < qpts.size(); ++j) {
+    std::vector<double> bd2(pts.size());
+    for (size_type i=0; i < pts.size(); ++i) bd2[i] = dist2_(pts[i], qpts[j]);
+    std::vector<double> sd2(bd2);
+    std::sort(sd2.begin(), sd2.end());
+
+    /* k nearest neighbors, single and batched queries */
+    bgeot::kdtree_tab_type ipts;
+    std::vector<double> dd;
+    tree.k_nearest_neighbors(ipts, qpts[j], K, &dd);
+    assert(ipts.size() == K);
+    for (size_type l=0; l < K; ++l) {
+      assert(gmm::abs(dd[l] - sd2[l]) < 1e-14);
+      assert(gmm::abs(bd2[ipts[l].i] - sd2[l]) < 1e-14);
+      assert(ids[j*K+l] == ipts[l].i && d2[j*K+l] == dd[l]);
+    }
+    bgeot::index_node_pair ipt;
+    assert(gmm::abs(tree.nearest_neighbor(ipt, qpts[j]) - sd2[0]) < 1e-14);
+
+    /* points in a ball, single and batched queries */
+    dal::bit_vector bv1, bv2, bv3;
+    for (size_type i=0; i < pts.size(); ++i) if (bd2[i] <= R*R) bv1.add(i);
+    tree.points_in_ball(ipts, qpts[j], R);
+    for (size_type l=0; l < ipts.size(); ++l) bv2.add(ipts[l].i);
+    for (size_type l=ptr[j]; l < ptr[j+1]; ++l) bv3.add(bids[l]);
+    assert(bv1 == bv2 && bv1 == bv3);
+  }
+  cout << "k nearest neighbors and ball queries are ok!\n";
+}
+
 void speed_test(unsigned N, unsigned NPT, unsigned nrepeat) {
   bgeot::kdtree tree;
   base_node pt(N);
@@ -141,11 +196,22 @@ void speed_test(unsigned N, unsigned NPT, unsigned nrepeat) {
   }
   cout << "POINT QUERY: nb points in " << pt << ":" << pt << " is : " << npt << "\n";
   cout << "average query time is: " << (gmm::uclock_sec()-t)/(nrepeat*200.)*1e6 << " microseconds\n";
+
+  std::vector<base_node> qpts(nrepeat*20, base_node(N));
+  for (size_type j=0; j < qpts.size(); ++j)
+    for (dim_type k = 0; k < N; ++k) qpts[j][k] = gmm::random(double())*2.;
+  std::vector<size_type> ids;
+  std::vector<double> d2;
+  t = gmm::uclock_sec();
+  tree.k_nearest_neighbors(qpts, 8, ids, d2);
+  cout << "BATCHED 8-NN QUERY: average query time is: "
+       << (gmm::uclock_sec()-t)/double(qpts.size())*1e6 << " microseconds\n";
 }
 
 int main(int argc, char **argv) {
   if (argc == 2 && strcmp(argv[1],"-quick")==0) quick = true;
   check_tree();
+  check_neighbors();
   if (!quick)
     speed_test(3,300000,20000);
   else speed_test(2,10000,100);
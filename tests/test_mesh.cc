@@ -22,7 +22,10 @@
 #include "getfem/bgeot_poly_composite.h"
 #include "getfem/bgeot_comma_init.h"
 #include "getfem/getfem_export.h"
+#include "getfem/getfem_import.h"
 #include "getfem/bgeot_node_tab.h"
+#include "getfem/getfem_mesh_im.h"
+#include "getfem/getfem_binary_io.h"
 using std::endl; using std::cout; using std::cerr;
 using std::ends; using std::cin;
 using getfem::size_type;
@@ -215,6 +218,22 @@ void test_mesh(getfem::mesh &m) {
   assert(m2.region(3).is_in(3,1));
   assert(m2.region(3).is_in(2));
   assert(!m2.region(3).is_in(0));
+
+  m.write_to_binary_file("test_mesh.gfb");
+  getfem::mesh m4; m4.read_from_binary_file("test_mesh.gfb");
+  assert(m4.convex_index() == m.convex_index());
+  assert(m4.points_index() == m.points_index());
+  for (dal::bv_visitor ic(m.convex_index()); !ic.finished(); ++ic) {
+    assert(m4.trans_of_convex(ic) == m.trans_of_convex(ic));
+    for (size_type j = 0; j < m.nb_points_of_convex(ic); ++j) {
+      assert(m4.ind_points_of_convex(ic)[j] == m.ind_points_of_convex(ic)[j]);
+      assert(gmm::vect_dist2(m4.points_of_convex(ic)[j],
+			     m.points_of_convex(ic)[j]) == 0.);
+    }
+  }
+  assert(m4.region(3).index().card() == 2);
+  assert(m4.region(3).is_in(3,1));
+  assert(m4.region(4).is_in(5));
   //m.write_to_file(cout);
 }
 
@@ -632,6 +651,295 @@ void test_incomplete_Q2(void) {
 
 
 
+template <typename T> void write_raw(std::ostream &o, T v)
+{ o.write(reinterpret_cast<const char *>(&v), sizeof(T)); }
+
+void check_gmsh4_square(getfem::mesh &m,
+                        std::map<std::string, size_type> &region_map) {
+  assert(m.dim() == 2);
+  assert(m.convex_index().card() == 2);
+  assert(m.nb_points() == 4);
+  assert(region_map["bottom"] == 10 && region_map["domain"] == 20);
+  assert(m.region(20).index().card() == 2);
+  assert(m.region(10).index().card() == 1);
+  assert(m.region(10).is_in(0, 2));
+}
+
+void test_import_gmsh4() {
+  const char *s =
+    "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+    "$PhysicalNames\n2\n1 10 \"bottom\"\n2 20 \"domain\"\n$EndPhysicalNames\n"
+    "$Entities\n0 1 1 0\n"
+    "1 0 0 0 1 0 0 1 10 0\n"
+    "1 0 0 0 1 1 0 1 20 1 1\n"
+    "$EndEntities\n"
+    "$Nodes\n2 4 1 4\n"
+    "1 1 0 2\n1\n2\n0 0 0\n1 0 0\n"
+    "2 1 0 2\n3\n4\n1 1 0\n0 1 0\n"
+    "$EndNodes\n"
+    "$Elements\n2 3 1 3\n"
+    "1 1 1 1\n3 1 2\n"
+    "2 1 2 2\n1 1 2 3\n2 1 3 4\n"
+    "$EndElements\n";
+  std::map<std::string, size_type> region_map;
+  getfem::mesh m;
+  std::stringstream ss(s);
+  getfem::import_mesh_gmsh(ss, m, region_map);
+  check_gmsh4_square(m, region_map);
+  assert(m.has_face_adjacency());
+
+  /* Same mesh in the binary format */
+  std::stringstream sb;
+  sb << "$MeshFormat\n4.1 1 8\n";
+  write_raw(sb, int(1));
+  sb << "\n$EndMeshFormat\n"
+     << "$PhysicalNames\n2\n1 10 \"bottom\"\n2 20 \"domain\"\n"
+     << "$EndPhysicalNames\n$Entities\n";
+  for (gmm::uint64_type n : {0, 1, 1, 0}) write_raw(sb, n);
+  for (int d = 1; d <= 2; ++d) {
+    write_raw(sb, int(1));
+    for (int k = 0; k < 6; ++k) write_raw(sb, double(k == 3 || k == 4));
+    write_raw(sb, gmm::uint64_type(1)); write_raw(sb, int(10*d));
+    write_raw(sb, gmm::uint64_type(0));
+  }
+  sb << "\n$EndEntities\n$Nodes\n";
+  for (gmm::uint64_type n : {2, 4, 1, 4}) write_raw(sb, n);
+  double coords[4][3] = {{0,0,0}, {1,0,0}, {1,1,0}, {0,1,0}};
+  for (int d = 1; d <= 2; ++d) {
+    write_raw(sb, d); write_raw(sb, int(1)); write_raw(sb, int(0));
+    write_raw(sb, gmm::uint64_type(2));
+    for (int i = 0; i < 2; ++i) write_raw(sb, gmm::uint64_type(2*d+i-1));
+    for (int i = 0; i < 2; ++i)
+      for (int k = 0; k < 3; ++k) write_raw(sb, coords[2*d+i-2][k]);
+  }
+  sb << "\n$EndNodes\n$Elements\n";
+  for (gmm::uint64_type n : {2, 3, 1, 3}) write_raw(sb, n);
+  write_raw(sb, int(1)); write_raw(sb, int(1)); write_raw(sb, int(1));
+  for (gmm::uint64_type n : {1, 3, 1, 2}) write_raw(sb, n);
+  write_raw(sb, int(2)); write_raw(sb, int(1)); write_raw(sb, int(2));
+  for (gmm::uint64_type n : {2, 1, 1, 2, 3, 2, 1, 3, 4}) write_raw(sb, n);
+  sb << "\n$EndElements\n";
+
+  getfem::mesh m2;
+  std::map<std::string, size_type> region_map2;
+  getfem::import_mesh_gmsh(sb, m2, region_map2);
+  check_gmsh4_square(m2, region_map2);
+  for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv)
+    for (size_type j = 0; j < 3; ++j)
+      assert(m2.ind_points_of_convex(cv)[j] == m.ind_points_of_convex(cv)[j]);
+
+  /* Same mesh in the 4.0 format: the regions are also numbered after the
+     physical tags. */
+  const char *s40 =
+    "$MeshFormat\n4 0 8\n$EndMeshFormat\n"
+    "$PhysicalNames\n2\n1 10 \"bottom\"\n2 20 \"domain\"\n$EndPhysicalNames\n"
+    "$Entities\n0 1 1 0\n"
+    "1 0 0 0 1 0 0 1 10 0\n"
+    "1 0 0 0 1 1 0 1 20 0\n"
+    "$EndEntities\n"
+    "$Nodes\n2 4\n"
+    "1 1 0 2\n1 0 0 0\n2 1 0 0\n"
+    "1 2 0 2\n3 1 1 0\n4 0 1 0\n"
+    "$EndNodes\n"
+    "$Elements\n2 3\n"
+    "1 1 1 1\n3 1 2\n"
+    "1 2 2 2\n1 1 2 3\n2 1 3 4\n"
+    "$EndElements\n";
+  getfem::mesh m3;
+  std::map<std::string, size_type> region_map3;
+  std::stringstream ss3(s40);
+  getfem::import_mesh_gmsh(ss3, m3, region_map3);
+  check_gmsh4_square(m3, region_map3);
+
+  /* Same mesh partitioned in two parts, with ghost entities and elements.
+     The partitioned entities carry no physical tag, which is inherited
+     from their parent entity. */
+  const char *sp =
+    "$MeshFormat\n4.1 0 8\n$EndMeshFormat\n"
+    "$PhysicalNames\n2\n1 10 \"bottom\"\n2 20 \"domain\"\n$EndPhysicalNames\n"
+    "$Entities\n0 1 1 0\n"
+    "1 0 0 0 1 0 0 1 10 0\n"
+    "1 0 0 0 1 1 0 1 20 1 1\n"
+    "$EndEntities\n"
+    "$PartitionedEntities\n2\n1\n3 1\n0 1 2 0\n"
+    "2 1 1 1 1 0 0 0 1 0 0 0 0\n"
+    "2 2 1 1 1 0 0 0 1 1 0 0 0\n"
+    "3 2 1 1 2 0 0 0 1 1 0 0 0\n"
+    "$EndPartitionedEntities\n"
+    "$Nodes\n3 4 1 4\n"
+    "1 2 0 2\n1\n2\n0 0 0\n1 0 0\n"
+    "2 2 0 1\n3\n1 1 0\n"
+    "2 3 0 1\n4\n0 1 0\n"
+    "$EndNodes\n"
+    "$Elements\n3 3 1 3\n"
+    "1 2 1 1\n3 1 2\n"
+    "2 2 2 1\n1 1 2 3\n"
+    "2 3 2 1\n2 1 3 4\n"
+    "$EndElements\n"
+    "$GhostElements\n1\n2 2 1 1\n$EndGhostElements\n";
+  getfem::mesh m4;
+  std::map<std::string, size_type> region_map4;
+  std::stringstream ss4(sp);
+  getfem::import_mesh_gmsh(ss4, m4, region_map4);
+  check_gmsh4_square(m4, region_map4);
+  assert(m4.region(20).index().card() == 2);
+}
+
+void check_face_adjacency(getfem::mesh &m, bool with_faces = true) {
+  m.clear_face_adjacency();
+  std::vector<bgeot::convex_face> adj;
+  for (dal::bv_visitor ic(m.convex_index()); !ic.finished(); ++ic)
+    for (bgeot::short_type f = 0; f < m.nb_faces_of_convex(ic); ++f)
+      adj.push_back(with_faces ? m.adjacent_face(ic, f)
+                    : bgeot::convex_face(m.neighbor_of_convex(ic, f), 0));
+  getfem::mesh_region outer;
+  getfem::outer_faces_of_mesh(m, m.convex_index(), outer);
+
+  m.build_face_adjacency();
+  assert(m.has_face_adjacency());
+  size_type i = 0;
+  for (dal::bv_visitor ic(m.convex_index()); !ic.finished(); ++ic)
+    for (bgeot::short_type f = 0; f < m.nb_faces_of_convex(ic); ++f, ++i) {
+      if (with_faces) {
+        bgeot::convex_face cf = m.adjacent_face(ic, f);
+        assert(cf.cv == adj[i].cv && cf.f == adj[i].f);
+      }
+      assert(m.neighbor_of_convex(ic, f) == adj[i].cv);
+    }
+  getfem::mesh_region outer2;
+  getfem::outer_faces_of_mesh(m, m.convex_index(), outer2);
+  assert(outer2.index() == outer.index());
+  for (getfem::mr_visitor v(outer); !v.finished(); ++v)
+    assert(outer2.is_in(v.cv(), v.f()));
+}
+
+void test_face_adjacency() {
+  std::vector<size_type> nsubdiv(3, 3);
+  getfem::mesh m1;
+  getfem::regular_unit_mesh(m1, nsubdiv, bgeot::simplex_geotrans(3, 1));
+  assert(m1.has_face_adjacency());
+  check_face_adjacency(m1);
+  getfem::mesh m2;
+  getfem::regular_unit_mesh(m2, nsubdiv, bgeot::parallelepiped_geotrans(3,2));
+  check_face_adjacency(m2);
+
+  /* bulk insertion of the convexes of m1 */
+  getfem::mesh m3;
+  for (dal::bv_visitor ip(m1.points().index()); !ip.finished(); ++ip)
+    m3.add_point(m1.points()[ip]);
+  std::vector<size_type> cnx, icv;
+  for (dal::bv_visitor ic(m1.convex_index()); !ic.finished(); ++ic)
+    for (size_type ip : m1.ind_points_of_convex(ic)) cnx.push_back(ip);
+  m3.add_convexes_noverif(m1.trans_of_convex(0), m1.nb_convex(),
+                          cnx.begin(), &icv);
+  assert(icv.size() == m1.nb_convex() && m3.nb_convex() == m1.nb_convex());
+  for (size_type ip : m3.ind_points_of_convex(icv.back()))
+    assert(std::find(m3.convex_to_point(ip).begin(),
+                     m3.convex_to_point(ip).end(), icv.back())
+           != m3.convex_to_point(ip).end());
+  check_face_adjacency(m3);
+
+  /* a mesh mixing linear and quadratic triangles */
+  getfem::mesh m4;
+  base_node p0(0, 0), p1(1, 0), p2(0, 1), p3(1, 1);
+  base_node p4(0.5, 0.5), p5(0.5, 1), p6(1, 0.5);
+  m4.add_triangle_by_points(p0, p1, p2);
+  std::vector<base_node> ptab = {p1, p6, p3, p4, p5, p2};
+  m4.add_convex_by_points(bgeot::simplex_geotrans(2, 2), ptab.begin());
+  check_face_adjacency(m4, false);
+
+  m1.sup_convex(m1.convex_index().last_true());
+  assert(!m1.has_face_adjacency());
+  check_face_adjacency(m1);
+}
+
+/* round trip of a mesh_fem and a mesh_im through the binary format */
+void test_binary_mesh_fem_im() {
+  getfem::mesh m;
+  getfem::regular_unit_mesh(m, std::vector<size_type>(2, 4),
+                            bgeot::simplex_geotrans(2, 1));
+  getfem::pfem pf1 = getfem::fem_descriptor("FEM_PK(2,1)");
+  getfem::pfem pf2 = getfem::fem_descriptor("FEM_PK(2,2)");
+  getfem::pfem pf3 = getfem::fem_descriptor("FEM_PK_DISCONTINUOUS(2,1)");
+  getfem::pintegration_method pim1
+    = getfem::int_method_descriptor("IM_TRIANGLE(2)");
+  getfem::pintegration_method pim2
+    = getfem::int_method_descriptor("IM_TRIANGLE(6)");
+
+  getfem::mesh_fem mf(m, 2);
+  getfem::mesh_im mim(m);
+  for (dal::bv_visitor cv(m.convex_index()); !cv.finished(); ++cv) {
+    mf.set_finite_element(cv, (cv % 3 == 0) ? pf1
+                          : ((cv % 3 == 1) ? pf2 : pf3));
+    mim.set_integration_method(cv, (cv % 2) ? pim1 : pim2);
+  }
+  mf.set_finite_element(m.convex_index().last_true(), 0);
+  dal::bit_vector kept;
+  for (size_type i = 0; i < mf.nb_basic_dof(); i += 3) kept.add(i);
+  mf.reduce_to_basic_dof(kept);
+  assert(mf.is_reduced() && mf.nb_dof() == kept.card());
+
+  mf.write_to_binary_file("test_mesh_fem.gfb", true);
+  mim.write_to_binary_file("test_mesh_im.gfb", false);
+
+  getfem::mesh m2;
+  getfem::mesh_fem mf2(m2);
+  {
+    getfem::binary_file_reader f("test_mesh_fem.gfb");
+    m2.read_from_binary_file(f);
+    mf2.read_from_binary_file(f);
+  }
+  assert(m2.convex_index() == m.convex_index());
+  assert(mf2.get_qdim() == 2);
+  assert(mf2.convex_index() == mf.convex_index());
+  assert(mf2.nb_basic_dof() == mf.nb_basic_dof());
+  assert(mf2.nb_dof() == mf.nb_dof() && mf2.is_reduced());
+  for (dal::bv_visitor cv(mf.convex_index()); !cv.finished(); ++cv) {
+    assert(mf2.fem_of_element(cv) == mf.fem_of_element(cv));
+    assert(mf2.ind_basic_dof_of_element(cv).size()
+           == mf.ind_basic_dof_of_element(cv).size());
+    for (size_type i = 0; i < mf.nb_basic_dof_of_element(cv); ++i)
+      assert(mf2.ind_basic_dof_of_element(cv)[i]
+             == mf.ind_basic_dof_of_element(cv)[i]);
+  }
+  assert(gmm::mat_nrows(mf2.reduction_matrix())
+         == gmm::mat_nrows(mf.reduction_matrix()));
+  assert(gmm::mat_ncols(mf2.extension_matrix())
+         == gmm::mat_ncols(mf.extension_matrix()));
+  std::vector<getfem::scalar_type> U(mf.nb_basic_dof()), V1(mf.nb_dof()),
+    V2(mf.nb_dof()), W1(mf.nb_basic_dof()), W2(mf.nb_basic_dof());
+  gmm::fill_random(U);
+  mf.reduce_vector(U, V1); mf2.reduce_vector(U, V2);
+  assert(gmm::vect_dist2(V1, V2) == 0.);
+  mf.extend_vector(V1, W1); mf2.extend_vector(V1, W2);
+  assert(gmm::vect_dist2(W1, W2) == 0.);
+
+  getfem::mesh_im mim2(m2);
+  mim2.read_from_binary_file("test_mesh_im.gfb");
+  assert(mim2.convex_index() == mim.convex_index());
+  for (dal::bv_visitor cv(mim.convex_index()); !cv.finished(); ++cv)
+    assert(mim2.int_method_of_element(cv) == mim.int_method_of_element(cv));
+
+  // corrupted sizes, whose sums with the offsets wrap around, are detected
+  std::ifstream ist("test_mesh_im.gfb", std::ios::binary);
+  std::string buf((std::istreambuf_iterator<char>(ist)),
+                  std::istreambuf_iterator<char>());
+  gmm::uint64_type table_offset, huge = gmm::uint64_type(-8);
+  std::memcpy(&table_offset, &buf[56], 8);
+  for (size_type pos : {size_type(48), size_type(table_offset + 56)}) {
+    std::string b = buf;
+    std::memcpy(&b[pos], &huge, 8); // number of sections or size of one
+    {
+      std::ofstream ost("test_mesh_corrupted.gfb", std::ios::binary);
+      ost.write(b.data(), std::streamsize(b.size()));
+    }
+    bool detected = false;
+    try { getfem::binary_file_reader f("test_mesh_corrupted.gfb"); }
+    catch (const gmm::gmm_error &) { detected = true; }
+    assert(detected);
+  }
+}
+
 int main(void) {
 
   test_mesh_building(2, 100); 
@@ -659,6 +967,12 @@ int main(void) {
   test_refinable(3, 3);
 
   test_incomplete_Q2();
+
+  test_import_gmsh4();
+
+  test_face_adjacency();
+
+  test_binary_mesh_fem_im();
   
   return 0;
 }
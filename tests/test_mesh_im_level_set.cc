@@ -170,6 +170,153 @@ void test_3d() {
     GMM_ASSERT1(false, "Cutting integration method has failed");
 }
 
+static scalar_type area_of(getfem::mesh_im &mim) {
+  const getfem::mesh &m = mim.linked_mesh();
+  scalar_type area(0);
+  base_matrix G;
+  for (dal::bv_visitor i(m.convex_index()); !i.finished(); ++i) {
+    getfem::papprox_integration pai
+      = mim.int_method_of_element(i)->approx_method();
+    if (!pai) continue;
+    bgeot::vectors_to_base_matrix(G, m.points_of_convex(i));
+    bgeot::geotrans_interpolation_context c(m.trans_of_convex(i),
+					    pai->point(0), G);
+    for (size_type j = 0; j < pai->nb_points_on_convex(); ++j) {
+      c.set_xref(pai->point(j));
+      area += pai->coeff(j) * c.J();
+    }
+  }
+  return area;
+}
+
+/* zones of a convex, independently of the addresses of the subzones */
+static std::set<std::set<std::string> >
+zones_of(const getfem::mesh_level_set &mls, size_type cv) {
+  std::set<std::set<std::string> > zs;
+  for (const getfem::mesh_level_set::zone *pz : mls.zoneset_of_convex(cv)) {
+    std::set<std::string> z;
+    for (const std::string *ps : *pz) z.insert(*ps);
+    zs.insert(z);
+  }
+  return zs;
+}
+
+/* After a local change of the level set, only the convexes where it has
+   changed are cut again. */
+void test_incremental() {
+  getfem::mesh m; m.read_from_file("meshes/disc_2D_degree3.mesh");
+  getfem::level_set ls(m, 2);
+  const getfem::mesh_fem &lsmf = ls.get_mesh_fem();
+  scalar_type R=.4;
+  for (unsigned i=0; i < lsmf.nb_dof(); ++i)
+    ls.values()[i] = gmm::vect_dist2_sqr(lsmf.point_of_basic_dof(i),
+					 getfem::base_node(0,0)) -R*R;
+  getfem::mesh_level_set mls(m);
+  mls.add_level_set(ls);
+  getfem::mesh_im_level_set
+    mim(mls, getfem::mesh_im_level_set::INTEGRATE_INSIDE,
+	getfem::int_method_descriptor("IM_TRIANGLE(6)"));
+  mim.set_integration_method(m.convex_index(),
+			     getfem::int_method_descriptor("IM_TRIANGLE(6)"));
+  mls.adapt(); mim.adapt();
+  size_type nbcut = mls.nb_convexes_cut_again();
+  GMM_ASSERT1(nbcut > 0 && mim.nb_methods_built_again() == nbcut,
+	      "wrong number of cut convexes");
+  mls.adapt(); mim.adapt();
+  GMM_ASSERT1(mls.nb_convexes_cut_again() == 0
+	      && mim.nb_methods_built_again() == 0, "convexes cut again");
+  GMM_ASSERT1(gmm::abs(area_of(mim) - M_PI*R*R) < 1E-3, "wrong area");
+
+  // the circle is moved on the right side only
+  for (unsigned i=0; i < lsmf.nb_dof(); ++i) {
+    base_node P = lsmf.point_of_basic_dof(i);
+    if (P[0] > 0.3)
+      ls.values()[i] = gmm::vect_dist2_sqr(P, getfem::base_node(0.02,0))-R*R;
+  }
+  mls.adapt(); mim.adapt();
+  size_type nbcut2 = 0;
+  for (dal::bv_visitor i(m.convex_index()); !i.finished(); ++i)
+    if (mls.is_convex_cut(i)) ++nbcut2;
+  cout << "cut convexes : " << nbcut2 << ", cut again : "
+       << mls.nb_convexes_cut_again() << endl;
+  GMM_ASSERT1(mls.nb_convexes_cut_again() > 0
+	      && mls.nb_convexes_cut_again() < nbcut2/2
+	      && mim.nb_methods_built_again() == mls.nb_convexes_cut_again(),
+	      "wrong number of convexes cut again");
+
+  // same result as a new cut
+  getfem::mesh_level_set mls2(m);
+  mls2.add_level_set(ls);
+  getfem::mesh_im_level_set
+    mim2(mls2, getfem::mesh_im_level_set::INTEGRATE_INSIDE,
+	 getfem::int_method_descriptor("IM_TRIANGLE(6)"));
+  mim2.set_integration_method(m.convex_index(),
+			      getfem::int_method_descriptor("IM_TRIANGLE(6)"));
+  mls2.adapt(); mim2.adapt();
+  GMM_ASSERT1(mls2.nb_convexes_cut_again() == nbcut2, "wrong cut");
+  scalar_type a1 = area_of(mim), a2 = area_of(mim2);
+  cout << "area after a local change : " << a1 << " and " << a2 << endl;
+  GMM_ASSERT1(gmm::abs(a1 - a2) < 1E-4, "incremental adapt has failed");
+  for (dal::bv_visitor i(m.convex_index()); !i.finished(); ++i) {
+    GMM_ASSERT1(mls.primary_zone_of_convex(i)
+		== mls2.primary_zone_of_convex(i), "wrong primary zone");
+    if (mls.is_convex_cut(i))
+      GMM_ASSERT1(zones_of(mls, i) == zones_of(mls2, i),
+		  "wrong zones of a kept convex");
+  }
+}
+
+/* The parallel cut of the convexes gives the same sub-meshes and zones
+   on one thread and on several ones. */
+void test_parallel_cut() {
+  getfem::mesh m; m.read_from_file("meshes/disc_2D_degree3.mesh");
+  getfem::level_set ls1(m, 2), ls2(m, 1);
+  const getfem::mesh_fem &lsmf1 = ls1.get_mesh_fem();
+  const getfem::mesh_fem &lsmf2 = ls2.get_mesh_fem();
+  scalar_type R=.4;
+  for (unsigned i=0; i < lsmf1.nb_dof(); ++i)
+    ls1.values()[i] = gmm::vect_dist2_sqr(lsmf1.point_of_basic_dof(i),
+					  getfem::base_node(0,0)) -R*R;
+  for (unsigned i=0; i < lsmf2.nb_dof(); ++i) {
+    base_node P = lsmf2.point_of_basic_dof(i);
+    ls2.values()[i] = P[1] - 0.1*P[0] - 0.05;
+  }
+
+  getfem::mesh_level_set mls1(m), mlsn(m);
+  mls1.add_level_set(ls1); mls1.add_level_set(ls2);
+  mlsn.add_level_set(ls1); mlsn.add_level_set(ls2);
+  getfem::set_num_threads(1);
+  mls1.adapt();
+  getfem::set_num_threads(4);
+  mlsn.adapt();
+  getfem::set_num_threads(1);
+
+  size_type nbcut = 0;
+  for (dal::bv_visitor i(m.convex_index()); !i.finished(); ++i) {
+    GMM_ASSERT1(mls1.is_convex_cut(i) == mlsn.is_convex_cut(i)
+		&& mls1.primary_zone_of_convex(i)
+		== mlsn.primary_zone_of_convex(i), "wrong parallel cut");
+    if (!mls1.is_convex_cut(i)) continue;
+    ++nbcut;
+    GMM_ASSERT1(zones_of(mls1, i) == zones_of(mlsn, i),
+		"wrong zones of the parallel cut");
+    const getfem::mesh &m1 = mls1.mesh_of_convex(i);
+    const getfem::mesh &mn = mlsn.mesh_of_convex(i);
+    GMM_ASSERT1(m1.nb_points() == mn.nb_points()
+		&& m1.convex_index() == mn.convex_index(),
+		"wrong sub-mesh of the parallel cut");
+    for (dal::bv_visitor ip(m1.points().index()); !ip.finished(); ++ip)
+      GMM_ASSERT1(gmm::vect_dist2(m1.points()[ip], mn.points()[ip]) < 1E-12,
+		  "wrong point of the parallel cut");
+    for (dal::bv_visitor ic(m1.convex_index()); !ic.finished(); ++ic)
+      GMM_ASSERT1(std::equal(m1.ind_points_of_convex(ic).begin(),
+			     m1.ind_points_of_convex(ic).end(),
+			     mn.ind_points_of_convex(ic).begin()),
+		  "wrong sub-convex of the parallel cut");
+  }
+  GMM_ASSERT1(nbcut > 0, "no convex cut");
+}
+
 int main(/* int argc, char **argv */) {
 
   GMM_SET_EXCEPTION_DEBUG; // Exceptions make a memory fault, to debug.
@@ -178,6 +325,8 @@ int main(/* int argc, char **argv */) {
   try {
     // getfem::getfem_mesh_level_set_noisy();
     test_2d();
+    test_incremental();
+    test_parallel_cut();
   }
   GMM_STANDARD_CATCH_ERROR;
   return 0;
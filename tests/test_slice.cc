@@ -21,6 +21,7 @@
 #include "getfem/bgeot_comma_init.h"
 #include "getfem/bgeot_comma_init.h"
 #include "getfem/getfem_mesh_slice.h"
+#include "getfem/getfem_regular_meshes.h"
 using std::endl; using std::cout; using std::cerr;
 using std::ends; using std::cin;
 
@@ -113,5 +114,51 @@ main() {
   cout << sl << endl;
 
   cout << "memory 1: " << sl.memsize() << " bytes\n";
+
+  /* parallel slicing of a larger mesh, compared to the sequential one */
+  getfem::mesh m2;
+  std::vector<size_type> nsubdiv(2, 40);
+  getfem::regular_unit_mesh(m2, nsubdiv, bgeot::parallelepiped_geotrans(2,1));
+  getfem::base_node xc{.5,.5};
+  getfem::slicer_sphere sls(xc, 0.3, getfem::slicer_volume::VOLIN);
+  getfem::slicer_half_space slh2(xc, n1, getfem::slicer_volume::VOLIN);
+  getfem::slicer_union slu(sls, slh2);
+  getfem::stored_mesh_slice slp, sls2;
+  slp.build(m2, slu, 2);
+  getfem::mesh_slicer ms2(m2);
+  ms2.push_back_action(slu);
+  getfem::slicer_build_stored_mesh_slice slb2(sls2);
+  ms2.push_back_action(slb2);
+  ms2.exec(2);
+  GMM_ASSERT1(slp.nb_convex() == sls2.nb_convex() && slp.nb_convex() > 0 &&
+              slp.nb_points() == sls2.nb_points() &&
+              slp.nb_simplexes(2) == sls2.nb_simplexes(2), "wrong slice");
+  for (size_type ic = 0; ic < slp.nb_convex(); ++ic) {
+    GMM_ASSERT1(slp.convex_num(ic) == sls2.convex_num(ic) &&
+                slp.nodes(ic).size() == sls2.nodes(ic).size(), "wrong slice");
+    for (size_type i = 0; i < slp.nodes(ic).size(); ++i)
+      GMM_ASSERT1(gmm::vect_dist2(slp.nodes(ic)[i].pt,
+                                  sls2.nodes(ic)[i].pt) < 1E-14,
+                  "wrong slice");
+  }
+
+  /* merged nodes are numbered in the order of their first occurrence */
+  slp.merge_nodes();
+  size_type nbm = 0;
+  for (size_type ic = 0; ic < slp.nb_convex(); ++ic)
+    for (size_type i = 0; i < slp.nodes(ic).size(); ++i) {
+      size_type k = slp.merged_index(ic, i);
+      GMM_ASSERT1(k <= nbm, "wrong merged node numbering");
+      if (k == nbm) ++nbm;
+      GMM_ASSERT1(gmm::vect_dist2(slp.merged_point(k),
+                                  slp.nodes(ic)[i].pt) < 1E-10,
+                  "wrong merged node");
+    }
+  GMM_ASSERT1(nbm == slp.nb_merged_nodes(), "wrong number of merged nodes");
+  bgeot::node_tab nt;
+  for (size_type k = 0; k < nbm; ++k) nt.add_node(slp.merged_point(k));
+  GMM_ASSERT1(nt.card() == nbm, "nodes are not merged");
+  cout << "parallel slice: " << slp.nb_convex() << " convexes, "
+       << slp.nb_points() << " points, " << nbm << " merged points\n";
   return 0;
 }
@@ -0,0 +1,252 @@
+/*===========================================================================
+
+ Copyright (C) 2022-2022 Yves Renard.
+
+ This file is a part of GetFEM
+
+ GetFEM  is  free software;  you  can  redistribute  it  and/or modify it
+ under  the  terms  of the  GNU  Lesser General Public License as published
+ by  the  Free Software Foundation;  either version 3 of the License,  or
+ (at your option) any later version along with the GCC Runtime Library
+ Exception either version 3.1 or (at your option) any later version.
+ This program  is  distributed  in  the  hope  that it will be useful,  but
+ WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ or  FITNESS  FOR  A PARTICULAR PURPOSE.  See the GNU Lesser General Public
+ License and GCC Runtime Library Exception for more details.
+ You  should  have received a copy of the GNU Lesser General Public License
+ along  with  this program;  if not, write to the Free Software Foundation,
+ Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301, USA.
+
+===========================================================================*/
+
+/* Test of the storage of the pre-computations (fem_precomp and
+   geotrans_precomp), of the statistics and memory budget of the global
+   storage of objects and of the searches and dependencies in this storage. */
+
+#include <cstring>
+#include <sstream>
+#include "getfem/getfem_fem.h"
+#include "getfem/getfem_integration.h"
+
+using std::endl; using std::cout; using std::cerr;
+using bgeot::base_node;
+using bgeot::base_tensor;
+using bgeot::base_vector;
+using bgeot::base_matrix;
+using bgeot::scalar_type;
+using bgeot::size_type;
+
+bool quick = false;
+
+static void check_equal(const base_tensor &t1, const base_tensor &t2) {
+  GMM_ASSERT1(t1.sizes().is_equal(t2.sizes()), "sizes differ: "
+              << t1.sizes() << " and " << t2.sizes());
+  for (size_type k = 0; k < t1.size(); ++k)
+    GMM_ASSERT1(t1[k] == t2[k], "values differ");
+}
+
+static bool is_aligned(const scalar_type *p)
+{ return (reinterpret_cast<std::uintptr_t>(p) % 32) == 0; }
+
+static void check_fem_precomp(const std::string &name,
+                              bgeot::pstored_point_tab pspt) {
+  getfem::pfem pf = getfem::fem_descriptor(name);
+  getfem::pfem_precomp pfp = getfem::fem_precomp(pf, pspt, 0);
+  base_tensor t;
+  for (size_type i = 0; i < pspt->size(); ++i) {
+    pf->base_value((*pspt)[i], t); check_equal(t, pfp->val(i));
+    pf->grad_base_value((*pspt)[i], t); check_equal(t, pfp->grad(i));
+    pf->hess_base_value((*pspt)[i], t); check_equal(t, pfp->hess(i));
+    GMM_ASSERT1(is_aligned(pfp->vals()[i]) && is_aligned(pfp->grads()[i])
+                && is_aligned(pfp->hessians()[i]), "misaligned values");
+  }
+
+  // interpolation with and without the pre-computations
+  bgeot::pgeometric_trans pgt = bgeot::geometric_trans_descriptor("GT_PK(2,1)");
+  bgeot::pgeotrans_precomp pgp = bgeot::geotrans_precomp(pgt, pspt, 0);
+  base_matrix G(2, 3);
+  G(0,0) = 0.1; G(1,0) = 0.2; G(0,1) = 1.3; G(1,1) = 0.1;
+  G(0,2) = 0.4; G(1,2) = 0.9;
+  base_tensor t1, t2;
+  for (size_type i = 0; i < pspt->size(); ++i) {
+    getfem::fem_interpolation_context c1(pgp, pfp, i, G, 0);
+    getfem::fem_interpolation_context c2(pgt, pf, (*pspt)[i], G, 0);
+    c1.base_value(t1); c2.base_value(t2);
+    GMM_ASSERT1(gmm::vect_dist2(t1.as_vector(), t2.as_vector()) < 1e-12,
+                "wrong interpolation of the values");
+    c1.grad_base_value(t1); c2.grad_base_value(t2);
+    GMM_ASSERT1(gmm::vect_dist2(t1.as_vector(), t2.as_vector()) < 1e-10,
+                "wrong interpolation of the gradients");
+  }
+}
+
+static void check_geotrans_precomp(const std::string &name,
+                                   bgeot::pstored_point_tab pspt) {
+  bgeot::pgeometric_trans pgt = bgeot::geometric_trans_descriptor(name);
+  bgeot::pgeotrans_precomp pgp = bgeot::geotrans_precomp(pgt, pspt, 0);
+  size_type N = pgt->dim(), nbpt = pgt->nb_points();
+  base_vector v(nbpt);
+  base_matrix m(nbpt, N), h(nbpt, N*N);
+  for (size_type i = 0; i < pspt->size(); ++i) {
+    pgt->poly_vector_val((*pspt)[i], v);
+    pgt->poly_vector_grad((*pspt)[i], m);
+    pgt->poly_vector_hess((*pspt)[i], h);
+    base_matrix m2 = pgp->grad(i), h2 = pgp->hessian(i);
+    gmm::add(gmm::scaled(m, scalar_type(-1)), m2);
+    gmm::add(gmm::scaled(h, scalar_type(-1)), h2);
+    GMM_ASSERT1(gmm::vect_dist2(v, pgp->val(i)) == 0 &&
+                gmm::mat_euclidean_norm(m2) == 0 &&
+                gmm::mat_euclidean_norm(h2) == 0,
+                "wrong geotrans pre-computations");
+  }
+}
+
+static void check_budget(bgeot::pstored_point_tab pspt) {
+  dal::reset_stored_objects_statistics();
+  dal::stored_objects_stats st0 = dal::stored_objects_statistics();
+  GMM_ASSERT1(st0.hits == 0 && st0.misses == 0 && st0.evictions == 0,
+              "statistics not reset");
+
+  getfem::pfem pf = getfem::fem_descriptor("FEM_PK(2,1)");
+  getfem::pfem_precomp held = getfem::fem_precomp(pf, pspt, 0);
+  held->vals(); held->grads();
+  GMM_ASSERT1(getfem::fem_precomp(pf, pspt, 0) == held, "not cached");
+  dal::stored_objects_stats st1 = dal::stored_objects_statistics();
+  GMM_ASSERT1(st1.hits > st0.hits && st1.misses > st0.misses,
+              "hits or misses not counted");
+
+  // unused pre-computations
+  size_type K = quick ? 6 : 10;
+  for (size_type k = 2; k <= K; ++k) {
+    std::stringstream name; name << "FEM_PK(2," << k << ")";
+    getfem::pfem_precomp pfp
+      = getfem::fem_precomp(getfem::fem_descriptor(name.str()), pspt, 0);
+    pfp->vals(); pfp->grads(); pfp->hessians();
+  }
+  dal::stored_objects_stats st2 = dal::stored_objects_statistics();
+  cout << "cached data: " << st2.memsize << " bytes in " << st2.nb_objects
+       << " objects" << endl;
+
+  size_type budget = st2.memsize / 4;
+  dal::set_stored_objects_memory_budget(budget);
+  getfem::pfem_precomp pfp
+    = getfem::fem_precomp(getfem::fem_descriptor("FEM_QK(2,2)"), pspt, 0);
+  dal::stored_objects_stats st3 = dal::stored_objects_statistics();
+  cout << "after eviction: " << st3.memsize << " bytes in "
+       << st3.nb_objects << " objects, " << st3.evictions << " evicted"
+       << endl;
+  GMM_ASSERT1(st3.evictions > 0 && st3.memsize <= budget / 4 * 3,
+              "not evicted down to the low-water mark");
+  GMM_ASSERT1(dal::exists_stored_object(held)
+              && dal::exists_stored_object(pfp), "used object deleted");
+
+  // a budget which the used objects exceed: the failed eviction is not
+  // attempted again before the memory grows
+  dal::set_stored_objects_memory_budget(1);
+  getfem::pfem_precomp pfp2
+    = getfem::fem_precomp(getfem::fem_descriptor("FEM_QK(2,1)"), pspt, 0);
+  dal::stored_objects_stats st4 = dal::stored_objects_statistics();
+  GMM_ASSERT1(st4.memsize > 1 && dal::exists_stored_object(held)
+              && dal::exists_stored_object(pfp2), "used object deleted");
+  getfem::pfem_precomp pfp3
+    = getfem::fem_precomp(getfem::fem_descriptor("FEM_PK(2,2)"), pspt, 0);
+  pfp3->vals(); pfp3 = getfem::pfem_precomp();
+  getfem::pfem_precomp pfp4
+    = getfem::fem_precomp(getfem::fem_descriptor("FEM_QK(2,3)"), pspt, 0);
+  dal::stored_objects_stats st5 = dal::stored_objects_statistics();
+  GMM_ASSERT1(st5.evictions > st4.evictions,
+              "no eviction after the memory has grown");
+  dal::set_stored_objects_memory_budget(0);
+
+  // the evicted pre-computations are computed again
+  check_fem_precomp("FEM_PK(2,3)", pspt);
+}
+
+DAL_DOUBLE_KEY(test_key_, int, std::string);
+DAL_DOUBLE_KEY(test_vector_key_, int, std::vector<scalar_type>);
+
+struct test_object : public dal::static_stored_object {
+  int i;
+  test_object(int ii) : i(ii) {}
+};
+
+static std::string test_name(int i)
+{ std::stringstream s; s << "object " << i; return s.str(); }
+
+static dal::pstatic_stored_object test_search(int i) {
+  return dal::search_stored_object(std::make_shared<test_key_>
+                                   (i, test_name(i)));
+}
+
+/* Search, dependencies and deletion of many objects, in the hash tables. */
+static void check_registry(void) {
+  size_type nb0 = dal::nb_stored_objects();
+  int N = quick ? 1000 : 10000;
+  std::vector<dal::pstatic_stored_object> objects(N);
+  for (int i = 0; i < N; ++i) {
+    GMM_ASSERT1(!test_search(i), "object found before being stored");
+    objects[i] = std::make_shared<test_object>(i);
+    // object 2k+1 depends on object 2k
+    if (i % 2)
+      dal::add_stored_object(std::make_shared<test_key_>(i, test_name(i)),
+                             objects[i], objects[i-1]);
+    else
+      dal::add_stored_object(std::make_shared<test_key_>(i, test_name(i)),
+                             objects[i]);
+  }
+  GMM_ASSERT1(std::make_shared<test_key_>(3, "a")->hash()
+              == std::make_shared<test_key_>(3, "a")->hash(), "bad hash");
+  std::vector<scalar_type> v1(3, 0.5), v2(3, 0.25);
+  GMM_ASSERT1(test_vector_key_(1, v1).hash() == test_vector_key_(1, v1).hash()
+              && test_vector_key_(1, v1).hash()
+              != test_vector_key_(1, v2).hash(),
+              "key not hashed from its contents");
+  GMM_ASSERT1(dal::nb_stored_objects() == nb0 + N, "wrong number of objects");
+  for (int i = N-1; i >= 0; --i) {
+    auto p = test_search(i);
+    GMM_ASSERT1(p == objects[i], "wrong object found");
+    GMM_ASSERT1(*dal::key_of_stored_object(p) == test_key_(i, test_name(i)),
+                "wrong key");
+  }
+  dal::test_stored_objects();
+
+  // deleting object 2k deletes object 2k+1
+  std::list<dal::pstatic_stored_object> to_delete;
+  for (int i = 0; i < N; i += 4) to_delete.push_back(objects[i]);
+  dal::del_stored_objects(to_delete, false);
+  for (int i = 0; i < N; ++i)
+    GMM_ASSERT1(dal::exists_stored_object(objects[i]) == (i % 4 >= 2)
+                && bool(test_search(i)) == (i % 4 >= 2),
+                "wrong deletion of the dependent objects");
+  dal::delete_specific_type_stored_objects<test_object>();
+  GMM_ASSERT1(dal::nb_stored_objects() == nb0, "objects not deleted");
+  dal::test_stored_objects();
+
+  // equal point tabs are stored once
+  std::vector<base_node> pts;
+  for (int i = 0; i < 20; ++i) pts.push_back(base_node(0.1*i, 0.3));
+  bgeot::pstored_point_tab ps1 = bgeot::store_point_tab(pts);
+  bgeot::pstored_point_tab ps2 = bgeot::store_point_tab(pts);
+  pts[19][1] = 0.2;
+  bgeot::pstored_point_tab ps3 = bgeot::store_point_tab(pts);
+  GMM_ASSERT1(ps1 == ps2 && ps1 != ps3, "wrong storage of the point tabs");
+}
+
+int main(int argc, char **argv) {
+  if (argc == 2 && strcmp(argv[1],"-quick")==0) quick = true;
+
+  getfem::pintegration_method im
+    = getfem::int_method_descriptor("IM_TRIANGLE(10)");
+  bgeot::pstored_point_tab pspt = im->approx_method()->pintegration_points();
+
+  check_fem_precomp("FEM_PK(2,3)", pspt);
+  check_fem_precomp("FEM_PK_DISCONTINUOUS(2,2)", pspt);
+  check_fem_precomp("FEM_HERMITE(2)", pspt);
+  check_geotrans_precomp("GT_PK(2,1)", pspt);
+  check_geotrans_precomp("GT_PK(2,3)", pspt);
+  check_budget(pspt);
+  check_registry();
+
+  cout << "Test OK" << endl;
+  return 0;
+}